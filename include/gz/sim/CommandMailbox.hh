@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_COMMANDMAILBOX_HH_
+#define GZ_SIM_COMMANDMAILBOX_HH_
+
+#include <array>
+#include <atomic>
+#include <utility>
+
+#include "gz/sim/config.hh"
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    /// \brief Wait-free single-producer single-consumer mailbox holding the
+    /// most recent command.
+    ///
+    /// Command-driven systems typically receive commands on a transport
+    /// callback thread and consume the latest one in PreUpdate, guarding a
+    /// shared member with a mutex. At high command rates the simulation
+    /// thread then blocks on a lock the callback happens to hold. This
+    /// mailbox replaces that pattern with a triple buffer: the producer
+    /// always writes into a slot it owns and publishes it with one atomic
+    /// exchange, so neither side ever waits and the consumer always sees a
+    /// complete, most recent value. Intermediate commands are overwritten,
+    /// which is the same latest-wins behavior the mutex-guarded member had.
+    ///
+    /// \code
+    /// // Transport callback thread
+    /// void OnCmd(const msgs::Double &_msg)
+    /// {
+    ///   this->cmdMailbox.Push(_msg.data());
+    /// }
+    ///
+    /// // Simulation thread
+    /// void PreUpdate(...)
+    /// {
+    ///   // Leaves this->setpoint untouched when no new command arrived.
+    ///   this->cmdMailbox.Pop(this->setpoint);
+    ///   ...
+    /// }
+    /// \endcode
+    ///
+    /// There must be exactly one producer thread and one consumer thread.
+    template <typename T>
+    class CommandMailbox
+    {
+      /// \brief Deposit a new value, replacing any value not yet consumed.
+      /// Must only be called from the producer thread.
+      /// \param[in] _value Value to deposit.
+      public: void Push(const T &_value)
+      {
+        this->buffer[this->writeIndex] = _value;
+        this->writeIndex = this->ready.exchange(
+            this->writeIndex | kDirtyBit,
+            std::memory_order_acq_rel) & kIndexMask;
+      }
+
+      /// \brief Retrieve the most recent value deposited since the last
+      /// call. Must only be called from the consumer thread.
+      /// \param[out] _value Set to the retrieved value; left untouched when
+      /// nothing new was deposited.
+      /// \return True if a new value was retrieved.
+      public: bool Pop(T &_value)
+      {
+        // The consumer always stores its index without the dirty bit, so
+        // receiving a slot with the bit set means it was published by a
+        // Push since the last Pop. Publication and freshness travel in the
+        // same exchange, so a concurrent Push can never make a stale slot
+        // look new.
+        const int slot = this->ready.exchange(this->readIndex,
+            std::memory_order_acq_rel);
+        this->readIndex = slot & kIndexMask;
+        if (!(slot & kDirtyBit))
+          return false;
+        _value = std::move(this->buffer[this->readIndex]);
+        return true;
+      }
+
+      /// \brief Mask extracting the slot index from a value in ready.
+      private: static constexpr int kIndexMask{3};
+
+      /// \brief Bit set alongside the index in ready when the slot holds a
+      /// value not yet consumed.
+      private: static constexpr int kDirtyBit{4};
+
+      /// \brief Value slots. At any time the producer owns writeIndex, the
+      /// consumer owns readIndex and the slot in ready is in transit, so no
+      /// slot is ever accessed from both threads.
+      private: std::array<T, 3> buffer{};
+
+      /// \brief Slot the producer writes into next. Producer thread only.
+      private: int writeIndex{0};
+
+      /// \brief Slot holding the most recently published value, with
+      /// kDirtyBit set when that value has not been consumed yet.
+      private: std::atomic<int> ready{1};
+
+      /// \brief Slot the consumer last read from. Consumer thread only.
+      private: int readIndex{2};
+    };
+    }
+  }
+}
+#endif
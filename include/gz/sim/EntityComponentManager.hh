@@ -20,11 +20,13 @@
 #include <gz/msgs/serialized.pb.h>
 #include <gz/msgs/serialized_map.pb.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <tuple>
 #include <typeinfo>
 #include <type_traits>
 #include <unordered_set>
@@ -34,6 +36,7 @@
 
 #include <gz/common/Console.hh>
 #include <gz/math/graph/Graph.hh>
+#include <gz/math/Pose3d.hh>
 #include "gz/sim/Entity.hh"
 #include "gz/sim/Export.hh"
 #include "gz/sim/Types.hh"
@@ -43,6 +46,12 @@
 
 namespace gz
 {
+  namespace common
+  {
+    // Forward declaration.
+    class WorkerPool;
+  }
+
   namespace sim
   {
     // Inline bracket to help doxygen filtering.
@@ -57,6 +66,28 @@ namespace gz
     /// All edges are positive booleans.
     using EntityGraph = math::graph::DirectedGraph<Entity, bool>;
 
+    /// \brief Statistics about the components of a single type, reported by
+    /// EntityComponentManager::ComponentStats.
+    struct ComponentTypeStats
+    {
+      /// \brief Number of components of this type currently attached to
+      /// entities. Components marked as removed are not counted.
+      public: std::size_t count{0};
+
+      /// \brief Shallow bytes used by the counted components. Memory owned
+      /// by the component data through indirection is not included.
+      public: std::size_t bytes{0};
+
+      /// \brief Total number of components of this type created since the
+      /// manager was constructed.
+      public: uint64_t created{0};
+
+      /// \brief Total number of components of this type removed since the
+      /// manager was constructed, including those removed together with
+      /// their entity.
+      public: uint64_t removed{0};
+    };
+
     /** \class EntityComponentManager EntityComponentManager.hh \
      * gz/sim/EntityComponentManager.hh
     **/
@@ -196,6 +227,17 @@ namespace gz
       /// \return True if successful. Will fail if entities don't exist.
       public: bool SetParentEntity(const Entity _child, const Entity _parent);
 
+      /// \brief Get the world pose of an entity, i.e. its Pose component
+      /// composed with the poses of all its ancestors up to the first one
+      /// without a Pose component. Results are cached and reused until a
+      /// Pose or ParentEntity component changes, so repeated calls within
+      /// a simulation step don't walk the parent chain over and over.
+      /// \param[in] _entity Entity to get the world pose of.
+      /// \return World pose, or an identity pose if the entity has no Pose
+      /// component.
+      /// \sa gz::sim::worldPose
+      public: math::Pose3d WorldPose(const Entity _entity) const;
+
       /// \brief Get whether a component type has ever been created.
       /// \param[in] _typeId ID of the component type to check.
       /// \return True if the provided _typeId has been created.
@@ -304,12 +346,45 @@ namespace gz
               bool SetComponentData(const Entity _entity,
               const typename ComponentTypeT::Type &_data);
 
+      /// \brief Start a component creation batch. While a batch is active,
+      /// components created with CreateComponent are stored immediately, but
+      /// matching the affected entities against the views is deferred until
+      /// EndComponentBatch. Use this when creating many components at once,
+      /// e.g. while loading a whole model subtree, so each entity is matched
+      /// against the views once instead of once per component.
+      /// \sa EndComponentBatch
+      public: void BeginComponentBatch();
+
+      /// \brief End a component creation batch and match all entities that
+      /// had components created during the batch against the views.
+      /// Querying a view while a batch is active is safe: the pending
+      /// entities are flushed into the views before the view is returned.
+      /// \sa BeginComponentBatch
+      public: void EndComponentBatch();
+
       /// \brief Get the type IDs of all components attached to an entity.
       /// \param[in] _entity Entity to check.
       /// \return All the component type IDs.
       public: std::unordered_set<ComponentTypeId> ComponentTypes(
           Entity _entity) const;
 
+      /// \brief Get per component type statistics: how many components of
+      /// each type are attached to entities, the shallow bytes they use, and
+      /// how many have been created and removed since the manager was
+      /// constructed. Useful for finding the component types responsible for
+      /// memory growth in long-running worlds.
+      /// \return Statistics keyed by component type ID.
+      public: std::map<ComponentTypeId, ComponentTypeStats>
+          ComponentStats() const;
+
+      /// \brief Get the number of components of a type currently attached to
+      /// entities. Unlike HasComponentType, which reports whether a type was
+      /// ever created, this reflects the current state, and it is O(1) so it
+      /// can be polled every step.
+      /// \param[in] _typeId Component type ID to count.
+      /// \return Number of components of the given type.
+      public: std::size_t ComponentCount(ComponentTypeId _typeId) const;
+
       /// \brief Get an entity which matches the value of all the given
       /// components. For example, the following will return the entity which
       /// has a name component equal to "name" and has a model component:
@@ -447,6 +522,88 @@ namespace gz
                   bool(const Entity &_entity,
                        ComponentTypeTs *...)>>::type _f);
 
+      /// \brief Get all entities whose component of the given type changed
+      /// since the end of the last simulation step, as well as the changed
+      /// components. Both periodic and one-time changes are reported. The
+      /// iteration walks a dense per-type bitset of changed entities, so no
+      /// hash lookups are involved.
+      /// \param[in] _f Callback function to be called for each changed
+      /// entity. The callback function can return false to stop subsequent
+      /// calls to the callback, otherwise a true value should be returned.
+      /// \tparam ComponentTypeT The desired component type.
+      /// \warning This function should not be called outside of System's
+      /// PreUpdate, Update, or PostUpdate callbacks.
+      public: template<typename ComponentTypeT>
+              void EachChanged(typename identity<std::function<
+                  bool(const Entity &_entity,
+                       const ComponentTypeT *)>>::type _f) const;
+
+      /// \brief Get all entities whose component of the given type changed
+      /// since the end of the last simulation step, as well as the mutable
+      /// changed components. Both periodic and one-time changes are
+      /// reported. The iteration walks a dense per-type bitset of changed
+      /// entities, so no hash lookups are involved.
+      /// \param[in] _f Callback function to be called for each changed
+      /// entity. The callback function can return false to stop subsequent
+      /// calls to the callback, otherwise a true value should be returned.
+      /// \tparam ComponentTypeT The desired mutable component type.
+      /// \warning This function should not be called outside of System's
+      /// PreUpdate, Update, or PostUpdate callbacks.
+      public: template<typename ComponentTypeT>
+              void EachChanged(typename identity<std::function<
+                  bool(const Entity &_entity,
+                       ComponentTypeT *)>>::type _f);
+
+      /// \brief A parallel version of Each(). The view's entities are
+      /// partitioned into contiguous ranges and the callback is invoked
+      /// concurrently from a pool of worker threads, one range per worker.
+      /// The pool is owned by this manager, created on the first EachParallel
+      /// call and shared by all subsequent ones, so no threads are spawned
+      /// per call. The number of workers defaults to the hardware concurrency
+      /// and can be limited with the GZ_SIM_ECM_THREAD_COUNT environment
+      /// variable.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. Returning false stops subsequent calls to the callback from
+      /// the calling worker and prevents the remaining workers from starting
+      /// new calls, but calls already in flight on other workers will finish.
+      /// \tparam ComponentTypeTs All the desired component types.
+      /// \warning The callback may be invoked from multiple threads
+      /// simultaneously. It must not create or remove entities or
+      /// components, and it must only write to components of the entity it
+      /// was invoked with; any other shared state must be synchronized by
+      /// the caller.
+      /// \warning This function should not be called outside of System's
+      /// PreUpdate, Update, or PostUpdate callbacks.
+      public: template<typename ...ComponentTypeTs>
+              void EachParallel(typename identity<std::function<
+                  bool(const Entity &_entity,
+                       const ComponentTypeTs *...)>>::type _f) const;
+
+      /// \brief A parallel version of Each(). The view's entities are
+      /// partitioned into contiguous ranges and the callback is invoked
+      /// concurrently from a pool of worker threads, one range per worker.
+      /// The pool is owned by this manager, created on the first EachParallel
+      /// call and shared by all subsequent ones, so no threads are spawned
+      /// per call. The number of workers defaults to the hardware concurrency
+      /// and can be limited with the GZ_SIM_ECM_THREAD_COUNT environment
+      /// variable.
+      /// \param[in] _f Callback function to be called for each matching
+      /// entity. Returning false stops subsequent calls to the callback from
+      /// the calling worker and prevents the remaining workers from starting
+      /// new calls, but calls already in flight on other workers will finish.
+      /// \tparam ComponentTypeTs All the desired mutable component types.
+      /// \warning The callback may be invoked from multiple threads
+      /// simultaneously. It must not create or remove entities or
+      /// components, and it must only write to components of the entity it
+      /// was invoked with; any other shared state must be synchronized by
+      /// the caller.
+      /// \warning This function should not be called outside of System's
+      /// PreUpdate, Update, or PostUpdate callbacks.
+      public: template<typename ...ComponentTypeTs>
+              void EachParallel(typename identity<std::function<
+                  bool(const Entity &_entity,
+                       ComponentTypeTs *...)>>::type _f);
+
       /// \brief Call a function for each parameter in a pack.
       /// \param[in] _f Function to be called.
       /// \param[in] _components Parameters which should be passed to the
@@ -543,6 +700,29 @@ namespace gz
       /// responsibility of the caller to timestamp it before use.
       public: msgs::SerializedState ChangedState() const;
 
+      /// \brief Get a flat binary snapshot of the given entities and
+      /// components. This is a length-prefixed alternative to the protobuf
+      /// based State() that avoids building intermediate message objects;
+      /// component payloads are produced with the components' own
+      /// serializers. The snapshot can be applied with SetRawState.
+      /// \param[in] _entities Entities to be serialized. Leave empty to get
+      /// all entities.
+      /// \param[in] _types Type ID of components to be serialized. Leave
+      /// empty to get all components.
+      /// \return The snapshot buffer.
+      /// \sa SetRawState
+      public: std::vector<char> RawState(
+          const std::unordered_set<Entity> &_entities = {},
+          const std::unordered_set<ComponentTypeId> &_types = {}) const;
+
+      /// \brief Set the absolute state of the ECM from a raw binary snapshot
+      /// produced by RawState. Entities and components that are in the
+      /// snapshot but not in the ECM will be created; existing components
+      /// will be updated.
+      /// \param[in] _buffer Snapshot buffer to apply.
+      /// \sa RawState
+      public: void SetRawState(const std::vector<char> &_buffer);
+
       /// \brief Get whether there are new entities.
       /// \return True if there are new entities.
       public: bool HasNewEntities() const;
@@ -651,6 +831,40 @@ namespace gz
           const Entity _entity, const ComponentTypeId _type,
           sim::ComponentState _c = ComponentState::OneTimeChange);
 
+      /// \brief Set the changed state of many components in one call. This
+      /// lets systems that compute component updates on worker threads
+      /// collect the resulting change records and apply them to the
+      /// manager's change tracking from a single thread.
+      /// \param[in] _changes Entity, component type, and changed state
+      /// value for each component to mark.
+      public: void SetChanged(const std::vector<
+          std::tuple<Entity, ComponentTypeId, sim::ComponentState>> &_changes);
+
+      /// \brief Register a callback invoked whenever the given component on
+      /// the given entity is marked as changed through SetChanged. Dispatch
+      /// costs one map lookup plus the observers registered on that entity
+      /// and component, so watching a few entities is much cheaper than
+      /// scanning the world with Each / EachChanged every iteration.
+      /// Callbacks run synchronously on the thread calling SetChanged — the
+      /// simulation thread for all in-tree systems — and must be fast and
+      /// must not create or remove entities or components.
+      /// \param[in] _entity The entity to observe.
+      /// \param[in] _typeId Component type to observe.
+      /// \param[in] _callback Callback invoked with the entity, component
+      /// type, and new change state.
+      /// \return Observer id to pass to RemoveComponentChangeObserver.
+      public: uint64_t OnComponentChange(
+          const Entity _entity, const ComponentTypeId _typeId,
+          std::function<void(Entity, ComponentTypeId,
+              sim::ComponentState)> _callback);
+
+      /// \brief Remove an observer registered with OnComponentChange.
+      /// Observers on removed entities stay registered but never fire, so
+      /// callers should remove them when they stop caring.
+      /// \param[in] _observerId Id returned by OnComponentChange.
+      /// \return True if the observer was found and removed.
+      public: bool RemoveComponentChangeObserver(const uint64_t _observerId);
+
       /// \brief Get a component's state.
       /// \param[in] _entity Entity that contains the component.
       /// \param[in] _typeId Component type ID.
@@ -762,6 +976,33 @@ namespace gz
                    const Entity _entity,
                    const ComponentTypeId _type);
 
+      /// \brief Get the dense bitset of entities whose component of the
+      /// given type changed since the end of the last simulation step. A set
+      /// bit at index `entity` means the entity's component of type _typeId
+      /// changed. Used by EachChanged.
+      /// \param[in] _typeId The component type.
+      /// \return The bitset, stored as 64 bit words, or nullptr if no
+      /// component of this type has ever changed.
+      private: const std::vector<uint64_t> *ChangedBitset(
+                   const ComponentTypeId _typeId) const;
+
+      /// \brief Get all entities that have all of the given component types.
+      /// Components that are marked as removed are ignored. When the
+      /// archetype index is enabled (see the GZ_SIM_ECM_ARCHETYPE_STORAGE
+      /// environment variable), this only visits the archetype buckets whose
+      /// component sets are supersets of _types instead of checking every
+      /// entity.
+      /// \param[in] _types The component types an entity must have to match.
+      /// \return All matching entities.
+      private: std::vector<Entity> EntitiesMatching(
+                   const std::set<ComponentTypeId> &_types) const;
+
+      /// \brief Match all entities touched by the active component batch
+      /// against the views and clear the pending set. No-op if no batch is
+      /// active or no components were created since the batch began.
+      /// \sa BeginComponentBatch
+      private: void FlushComponentBatch() const;
+
       /// \brief Find a View that matches the set of ComponentTypeIds. If
       /// a match is not found, then a new view is created.
       /// \tparam ComponentTypeTs All the component types that define a view.
@@ -788,6 +1029,28 @@ namespace gz
                    const detail::ComponentTypeKey &_types,
                    std::unique_ptr<detail::BaseView> _view) const;
 
+      /// \brief Get the worker pool that runs the entity ranges of
+      /// EachParallel, creating it on first use. The pool persists for the
+      /// lifetime of this manager and is shared by all EachParallel calls,
+      /// so repeated calls don't pay for thread creation and teardown.
+      /// \return The shared worker pool.
+      private: common::WorkerPool &EachParallelWorkerPool() const;
+
+      /// \brief Get all entities whose Name component holds _name, using
+      /// the maintained name index instead of scanning every named entity.
+      /// Index entries are verified against the current component data
+      /// before being returned, and stale ones are repaired in place.
+      /// \param[in] _name Name component data to look for.
+      /// \return All entities whose Name component equals _name.
+      private: std::vector<Entity> EntitiesByNameIndex(
+                   const std::string &_name) const;
+
+      /// \brief Re-index an entity in the name index after its Name
+      /// component was modified in place, e.g. by deserializing a state
+      /// message into it.
+      /// \param[in] _entity Entity whose Name component changed.
+      private: void RefreshNameIndex(const Entity _entity) const;
+
       /// \brief Add an entity and its components to a serialized state message.
       /// \param[out] _msg The state message.
       /// \param[in] _entity The entity to be added.
@@ -71,23 +71,30 @@ namespace gz
               gz::common::ConnectionPtr
               Connect(const typename E::CallbackT &_subscriber)
               {
-                if (this->events.find(typeid(E)) == this->events.end()) {
-                  this->events[typeid(E)] = std::make_unique<E>();
-                }
+                return this->Event<E>()->Connect(_subscriber);
+              }
 
-                E *eventPtr = dynamic_cast<E *>(this->events[typeid(E)].get());
-                // All values in the map should be derived from Event,
-                // so this shouldn't be an issue, but it doesn't hurt to check.
-                if (eventPtr != nullptr)
-                {
-                  return eventPtr->Connect(_subscriber);
-                }
-                else
+      /// \brief Get the event object for an event type, creating it if it
+      /// does not exist yet.
+      ///
+      /// Emitters that signal every step can fetch this once, for example
+      /// at configure time, and call Signal or ConnectionCount on it
+      /// directly, skipping the per-emit type lookup. The returned pointer
+      /// stays valid for the lifetime of the EventManager; events are
+      /// never removed.
+      /// \return Pointer to the event object.
+      public: template <typename E>
+              E *Event()
+              {
+                auto it = this->events.find(typeid(E));
+                if (it == this->events.end())
                 {
-                  gzerr << "Failed to connect event: "
-                    << typeid(E).name() << std::endl;
-                  return nullptr;
+                  it = this->events.emplace(
+                      typeid(E), std::make_unique<E>()).first;
                 }
+                // Entries are only ever inserted keyed by their own type,
+                // so the cast cannot fail.
+                return static_cast<E *>(it->second.get());
               }
 
       /// \brief Emit an event signal to connected subscribers.
@@ -96,29 +103,22 @@ namespace gz
       public: template <typename E, typename ... Args>
               void Emit(Args && ... _args)
               {
-                if (this->events.find(typeid(E)) == this->events.end())
+                auto it = this->events.find(typeid(E));
+                if (it == this->events.end())
                 {
                   // If there are no events of type E in the map, create it.
                   // But it also means there is nothing to signal.
                   //
                   // This is also needed to suppress unused function warnings
                   // for Events that are purely emitted, with no connections.
-                  this->events[typeid(E)] = std::make_unique<E>();
+                  this->events.emplace(typeid(E), std::make_unique<E>());
                   return;
                 }
 
-                E *eventPtr = dynamic_cast<E *>(this->events[typeid(E)].get());
-                // All values in the map should be derived from Event,
-                // so this shouldn't be an issue, but it doesn't hurt to check.
-                if (eventPtr != nullptr)
-                {
-                  eventPtr->Signal(std::forward<Args>(_args) ...);
-                }
-                else
-                {
-                  gzerr << "Failed to signal event: "
-                    << typeid(E).name() << std::endl;
-                }
+                // Entries are only ever inserted keyed by their own type,
+                // so the cast cannot fail.
+                static_cast<E *>(it->second.get())->Signal(
+                    std::forward<Args>(_args) ...);
               }
 
       /// \brief Get connection count for a particular event
@@ -127,24 +127,15 @@ namespace gz
               unsigned int
               ConnectionCount()
               {
-                if (this->events.find(typeid(E)) == this->events.end())
+                auto it = this->events.find(typeid(E));
+                if (it == this->events.end())
                 {
                   return 0u;
                 }
 
-                E *eventPtr = dynamic_cast<E *>(this->events[typeid(E)].get());
-                // All values in the map should be derived from Event,
-                // so this shouldn't be an issue, but it doesn't hurt to check.
-                if (eventPtr != nullptr)
-                {
-                  return eventPtr->ConnectionCount();
-                }
-                else
-                {
-                  gzerr << "Failed to get connection count for event: "
-                    << typeid(E).name() << std::endl;
-                  return 0u;
-                }
+                // Entries are only ever inserted keyed by their own type,
+                // so the cast cannot fail.
+                return static_cast<E *>(it->second.get())->ConnectionCount();
               }
 
       /// \brief Convenience type for storing typeinfo references.
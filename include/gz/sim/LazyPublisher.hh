@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_LAZYPUBLISHER_HH_
+#define GZ_SIM_LAZYPUBLISHER_HH_
+
+#include <utility>
+
+#include <gz/transport/Node.hh>
+
+#include "gz/sim/config.hh"
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    /// \brief Wrapper over transport::Node::Publisher that defers message
+    /// construction until there is at least one subscriber.
+    ///
+    /// Systems that publish periodically tend to build and stamp their
+    /// message and only then (if at all) check for subscribers, so
+    /// headless runs pay for serialization nobody reads. With this
+    /// wrapper the message is produced by a callable that is invoked
+    /// only when `HasConnections()` is true:
+    ///
+    /// \code
+    /// this->pub = node.Advertise<msgs::Odometry>(topic);
+    /// ...
+    /// this->pub.Publish([&]() -> msgs::Odometry &
+    ///     {
+    ///       // Only runs while someone is subscribed.
+    ///       this->FillOdometry(this->odomMsg);
+    ///       return this->odomMsg;
+    ///     });
+    /// \endcode
+    ///
+    /// Note that state the system must track regardless of subscribers
+    /// (velocity estimates, last-published times) belongs outside the
+    /// builder, which may not run for many steps in a row.
+    class LazyPublisher
+    {
+      /// \brief Construct an invalid publisher; assign one later.
+      public: LazyPublisher() = default;
+
+      /// \brief Wrap an advertised publisher.
+      /// \param[in] _pub Publisher returned by transport::Node::Advertise.
+      public: explicit LazyPublisher(const transport::Node::Publisher &_pub)
+        : pub(_pub)
+      {
+      }
+
+      /// \brief Wrap an advertised publisher.
+      /// \param[in] _pub Publisher returned by transport::Node::Advertise.
+      /// \return Reference to this.
+      public: LazyPublisher &operator=(const transport::Node::Publisher &_pub)
+      {
+        this->pub = _pub;
+        return *this;
+      }
+
+      /// \brief Whether the underlying publisher is valid.
+      public: bool Valid() const
+      {
+        return this->pub.Valid();
+      }
+
+      /// \brief Whether the underlying publisher is valid and has at
+      /// least one subscriber.
+      public: bool HasConnections() const
+      {
+        return this->pub.Valid() && this->pub.HasConnections();
+      }
+
+      /// \brief Build and publish a message if anyone is subscribed.
+      /// \param[in] _build Callable returning the message (by value or
+      /// reference); only invoked when the publisher has connections.
+      /// \return True if the message was built and published.
+      public: template <typename BuilderT>
+              bool Publish(BuilderT &&_build)
+      {
+        if (!this->HasConnections())
+          return false;
+        this->pub.Publish(std::forward<BuilderT>(_build)());
+        return true;
+      }
+
+      /// \brief Access the wrapped publisher, e.g. to publish an already
+      /// built message.
+      public: transport::Node::Publisher &Publisher()
+      {
+        return this->pub;
+      }
+
+      /// \brief The wrapped publisher.
+      private: transport::Node::Publisher pub;
+    };
+    }
+  }
+}
+#endif
@@ -21,6 +21,8 @@
 #include <gz/sim/config.hh>
 #include <gz/sim/Export.hh>
 
+#include <sdf/Root.hh>
+
 #include <string>
 
 namespace gz
@@ -74,6 +76,38 @@ namespace gz
     /// Empty string if the _typeName is invalid.
     std::string GZ_SIM_VISIBLE
     getPrimitive(const std::string &_typeName);
+
+    /// \brief Return a parsed SDF root of one of the available primitive
+    /// shape types. The underlying SDF string is parsed once per process
+    /// and cached, so repeated calls only pay for a clone instead of a
+    /// string parse. Prefer this over getPrimitiveShape when spawning many
+    /// primitives.
+    /// \param[in] _type Type of shape to retrieve
+    /// \return Root containing the primitive shape model. An empty root if
+    /// the _type is not supported.
+    sdf::Root GZ_SIM_VISIBLE
+    getPrimitiveShapeRoot(const PrimitiveShape &_type);
+
+    /// \brief Return a parsed SDF root of one of the available primitive
+    /// light types. The underlying SDF string is parsed once per process
+    /// and cached, so repeated calls only pay for a clone instead of a
+    /// string parse.
+    /// \param[in] _type Type of light to retrieve
+    /// \return Root containing the primitive light. An empty root if the
+    /// _type is not supported.
+    sdf::Root GZ_SIM_VISIBLE
+    getPrimitiveLightRoot(const PrimitiveLight &_type);
+
+    /// \brief Return a parsed SDF root of one of the available primitive
+    /// shape or light types, from the same per-process cache as
+    /// getPrimitiveShapeRoot and getPrimitiveLightRoot.
+    /// \param[in] _typeName Type name of the of shape or light to retrieve.
+    /// Must be one of: box, sphere, cylinder, cone, capsule, ellipsoid,
+    /// directional, point, or spot.
+    /// \return Root containing the primitive shape or light. An empty root
+    /// if the _typeName is invalid.
+    sdf::Root GZ_SIM_VISIBLE
+    getPrimitiveRoot(const std::string &_typeName);
     }
   }  // namespace sim
 }  // namespace gz
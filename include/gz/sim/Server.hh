@@ -18,6 +18,8 @@
 #define GZ_SIM_SERVER_HH_
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -26,6 +28,7 @@
 #include <gz/sim/Export.hh>
 #include <gz/sim/ServerConfig.hh>
 #include <gz/sim/SystemPluginPtr.hh>
+#include <gz/sim/Types.hh>
 #include <sdf/Element.hh>
 #include <sdf/Plugin.hh>
 
@@ -162,6 +165,45 @@ namespace gz
       /// not being initialized, or if the server is already running.
       public: bool RunOnce(const bool _paused = true);
 
+      /// \brief Run the server on a background thread and return a future
+      /// that becomes ready when the run completes. This lets a single
+      /// orchestrator thread drive many Server instances, waiting on their
+      /// futures instead of dedicating a blocked thread to each one.
+      /// \param[in] _iterations Number of steps to perform. A value of
+      /// zero will run indefinitely.
+      /// \param[in] _paused True to start simulation in a paused state,
+      /// false, to start simulation unpaused.
+      /// \return A future holding the result of the run, with the same
+      /// semantics as the return value of a blocking Run() call. If the
+      /// server could not start, for example because it is already running,
+      /// the future is ready immediately and holds false. Unlike
+      /// Run(false, ...), this function does not wait for the run to start,
+      /// so Running() may briefly return false after it returns.
+      public: std::future<bool> RunAsync(const uint64_t _iterations = 0,
+                  const bool _paused = true);
+
+      /// \brief Run the server until a condition becomes true. This is a
+      /// blocking call that steps simulation at full speed and evaluates
+      /// the condition in-process after every step, so a test harness can
+      /// wait for an event (entity reached a region, contact occurred, a
+      /// component crossed a threshold) without paying a service round
+      /// trip per step.
+      /// \param[in] _condition Callable evaluated after each step with the
+      /// step's update information and the world's entity component
+      /// manager. Return true to stop the run.
+      /// \param[in] _iterations Maximum number of steps to perform. A
+      /// value of zero means no limit.
+      /// \param[in] _worldIndex Index of the world to run.
+      /// \return True if the run stopped because the condition became
+      /// true. False if the condition was empty, _worldIndex was invalid,
+      /// the server was already running, or the iteration limit was
+      /// reached first.
+      public: bool RunUntil(const std::function<
+                  bool(const UpdateInfo &, const EntityComponentManager &)>
+                  &_condition,
+                  const uint64_t _iterations = 0,
+                  const unsigned int _worldIndex = 0);
+
       /// \brief Get whether the server is running. The server can have zero
       /// or more simulation worlds, each of which may or may not be
       /// running. See Running(const unsigned int) to get the running status
@@ -335,6 +377,33 @@ namespace gz
                                       bool _recursive = true,
                                       const unsigned int _worldIndex = 0);
 
+      /// \brief Save a named in-memory checkpoint of a world's current
+      /// state. Checkpoints are raw binary ECM snapshots, far cheaper than
+      /// a full state serialization, so they can be taken every few steps,
+      /// e.g. to branch rollouts. While the server is running, the capture
+      /// happens at the start of the next simulation step. Saving to an
+      /// existing name overwrites that checkpoint. Checkpoints are held in
+      /// memory only and discarded when the server is destroyed.
+      /// \param[in] _name Name identifying the checkpoint.
+      /// \param[in] _worldIndex Index of the world.
+      /// \return True if the world exists and the checkpoint was saved or
+      /// scheduled.
+      public: bool SaveCheckpoint(const std::string &_name,
+                                  const unsigned int _worldIndex = 0);
+
+      /// \brief Restore a checkpoint previously saved with SaveCheckpoint.
+      /// Entities created after the checkpoint are removed, and restored
+      /// components are marked as changed so systems pick up the new
+      /// state. Sim time and iterations are not rewound. While the server
+      /// is running, the restore happens at the start of the next
+      /// simulation step.
+      /// \param[in] _name Name of the checkpoint to restore.
+      /// \param[in] _worldIndex Index of the world.
+      /// \return True if the world and checkpoint exist and the restore
+      /// was performed or scheduled.
+      public: bool RestoreCheckpoint(const std::string &_name,
+                                     const unsigned int _worldIndex = 0);
+
       /// \brief Stop the server. This will stop all running simulations.
       public: void Stop();
 
@@ -219,6 +219,76 @@ namespace gz
       /// \param[in] _levels Value to set.
       public: void SetUseLevels(const bool _levels);
 
+      /// \brief Get whether per-system update timing is recorded and
+      /// published on the world's system_timing topic.
+      /// \return True if system profiling is enabled.
+      public: bool ProfileSystems() const;
+
+      /// \brief Set whether per-system update timing is recorded and
+      /// published on the world's system_timing topic.
+      /// \param[in] _profile Value to set.
+      public: void SetProfileSystems(const bool _profile);
+
+      /// \brief Get the file that Chrome-trace output is written to.
+      /// \return The trace file path, or empty if tracing is disabled.
+      public: std::string TracePath() const;
+
+      /// \brief Set the file to write Chrome-trace output to. When
+      /// non-empty, the server records spans for each step, system phase
+      /// and ECM operation in a format readable by chrome://tracing and
+      /// Perfetto, and writes them to this file on shutdown.
+      /// \param[in] _path Trace file path; empty disables tracing.
+      public: void SetTracePath(const std::string &_path);
+
+      /// \brief Get the number of simulation steps between runs of per-step
+      /// housekeeping (statistics and clock publication, and world control
+      /// message processing).
+      /// \return The step batch size. Defaults to 1, i.e. housekeeping runs
+      /// every step.
+      public: unsigned int StepBatchSize() const;
+
+      /// \brief Set the number of simulation steps between runs of per-step
+      /// housekeeping (statistics and clock publication, and world control
+      /// message processing). Raising this cuts the fixed per-step cost of
+      /// headless faster-than-realtime runs, at the price of stats, clock,
+      /// and world control messages only being handled every N steps.
+      /// Housekeeping always runs while paused so that the server remains
+      /// responsive.
+      /// \param[in] _size Step batch size. Values below 1 are treated as 1.
+      public: void SetStepBatchSize(const unsigned int _size);
+
+      /// \brief Get the number of copies of each world to instantiate.
+      /// \return The world replication count. Defaults to 1.
+      public: unsigned int WorldReplication() const;
+
+      /// \brief Set the number of copies of each world to instantiate.
+      /// When greater than 1, the server creates that many independent
+      /// copies of each world in the SDF file, named `<world>_<i>`, each
+      /// with its own simulation runner. The copies are stepped in
+      /// parallel on the server's worker pool and share process-wide
+      /// immutable assets such as loaded meshes. This is aimed at
+      /// high-throughput workloads like reinforcement learning that
+      /// want many instances of a small world in a single process.
+      /// \param[in] _count World replication count. Values below 1 are
+      /// treated as 1.
+      public: void SetWorldReplication(const unsigned int _count);
+
+      /// \brief Get the CPUs that PostUpdate worker threads are pinned to.
+      /// \return CPU indices, or an empty vector if thread placement is
+      /// left to the scheduler.
+      public: const std::vector<unsigned int> &PostUpdateCpuAffinity() const;
+
+      /// \brief Set the CPUs that PostUpdate worker threads are pinned to.
+      /// Worker threads are assigned to the given CPUs round-robin. On
+      /// multi-socket hosts, restricting the workers to the socket whose
+      /// memory holds the entity component manager avoids cross-socket
+      /// stalls while systems iterate components in PostUpdate. Pinning is
+      /// only supported on Linux and is ignored with a warning elsewhere.
+      /// \param[in] _cpus CPU indices to pin worker threads to. An empty
+      /// vector (the default) leaves thread placement to the scheduler.
+      public: void SetPostUpdateCpuAffinity(
+                  const std::vector<unsigned int> &_cpus);
+
       /// \brief Get whether the server is using the distributed sim system
       /// \return True if the server is set to use the distributed simulation
       /// system
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <unordered_set>
 
 #include <gz/sim/config.hh>
 #include <gz/sim/EntityComponentManager.hh>
@@ -96,6 +97,14 @@ namespace gz
       public: constexpr static std::string_view kPriorityElementName =
           {"gz:system_priority"};
 
+      /// \brief Name of the XML element from which the update rate divisor
+      /// will be parsed. A system with divisor N only receives its PreUpdate,
+      /// Update and PostUpdate callbacks every Nth simulation iteration, so
+      /// slow controllers don't pay per-step callback overhead in fast
+      /// worlds.
+      public: constexpr static std::string_view kRateDivisorElementName =
+          {"gz:system_rate_divisor"};
+
       /// \brief Constructor
       public: System() = default;
 
@@ -196,6 +205,47 @@ namespace gz
                                   EntityComponentManager &_ecm) = 0;
     };
 
+    /// \class ISystemComponentAccess ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system that declares which component types its
+    /// PreUpdate and Update callbacks access. When parallel system updates
+    /// are enabled (see the GZ_SIM_PARALLEL_SYSTEM_UPDATE environment
+    /// variable), consecutive systems of the same priority whose declared
+    /// accesses do not conflict are run concurrently; systems that do not
+    /// implement this interface always run serially.
+    ///
+    /// A system implementing this interface must restrict its PreUpdate and
+    /// Update callbacks to reading and writing the data of existing
+    /// components of the declared types. Creating or removing entities or
+    /// components is not covered by the declaration and must be deferred or
+    /// synchronized by the system.
+    class ISystemComponentAccess {
+      /// \brief Component types that are read, but not written, during
+      /// PreUpdate and Update.
+      /// \return The read-only component type IDs.
+      public: virtual std::unordered_set<ComponentTypeId>
+          ReadComponents() const = 0;
+
+      /// \brief Component types that are written during PreUpdate and
+      /// Update.
+      /// \return The written component type IDs.
+      public: virtual std::unordered_set<ComponentTypeId>
+          WriteComponents() const = 0;
+    };
+
+    /// \class ISystemTriggerComponents ISystem.hh gz/sim/System.hh
+    /// \brief Interface for a system whose update callbacks are only needed
+    /// while components of certain types exist. While none of the declared
+    /// trigger component types is attached to any entity, the SystemManager
+    /// skips the system's PreUpdate, Update and PostUpdate callbacks, so
+    /// e.g. a buoyancy plugin loaded with the world costs nothing until a
+    /// vessel spawns. Configure and Reset are always delivered.
+    class ISystemTriggerComponents {
+      /// \brief Component types whose presence activates the system.
+      /// \return The trigger component type IDs.
+      public: virtual std::unordered_set<ComponentTypeId>
+          TriggerComponents() const = 0;
+    };
+
     /// \class ISystemPostUpdate ISystem.hh gz/sim/System.hh
     /// \brief Interface for a system that uses the PostUpdate phase
     class ISystemPostUpdate{
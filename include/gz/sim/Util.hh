@@ -336,6 +336,19 @@ namespace gz
     /// \brief Environment variable holding paths to custom rendering engine
     /// plugins.
     const std::string kRenderPluginPathEnv{"GZ_SIM_RENDER_ENGINE_PATH"};
+
+    /// \brief Environment variable holding the directory used for compiled
+    /// world caches. When set, the server serializes the initial entity
+    /// component state of each world it creates and restores that state on
+    /// later runs of an identical world, skipping entity creation.
+    const std::string kCompiledWorldCachePathEnv{"GZ_SIM_WORLD_CACHE_PATH"};
+
+    /// \brief Environment variable holding the number of recent simulation
+    /// steps the server retains as in-memory state snapshots. When set to a
+    /// positive value, seeking backwards by up to that many steps restores
+    /// the retained state instead of requiring a full reset and replay.
+    /// Unset or zero disables retention.
+    const std::string kStepHistoryEnv{"GZ_SIM_STEP_HISTORY"};
     }
   }
 }
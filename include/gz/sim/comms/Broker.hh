@@ -129,6 +129,11 @@ namespace comms
     /// \param[in] _msg The message from the client.
     public: void OnMsg(const gz::msgs::Dataframe &_msg);
 
+    /// \brief Move the messages staged by OnMsg() into the outbound queues
+    /// of their senders, stamping them with the current time. The caller
+    /// must hold the lock on the message manager.
+    public: void DispatchStagedMsgs();
+
     /// \brief Process all the messages in the inbound queue and deliver them
     /// to the destination clients.
     public: void DeliverMsgs();
@@ -145,6 +145,11 @@ class GZ_SIM_VISIBLE MsgManager
   /// \param[in] _newContent New content to be set.
   public: void Set(const Registry &_newContent);
 
+  /// \brief Set the data structure containing subscriptions and data queues,
+  /// taking ownership of the content instead of copying it.
+  /// \param[in] _newContent New content to be set.
+  public: void Set(Registry &&_newContent);
+
   /// \brief Private data pointer.
   GZ_UTILS_UNIQUE_IMPL_PTR(dataPtr)
 };
@@ -36,14 +36,16 @@ namespace components
   /// \brief A component type that contains angular acceleration of an entity
   /// represented by gz::math::Vector3d.
   using AngularAcceleration =
-      Component<math::Vector3d, class AngularAccelerationTag>;
+      Component<math::Vector3d, class AngularAccelerationTag,
+      serializers::RawBytesSerializer<math::Vector3d>>;
   GZ_SIM_REGISTER_COMPONENT("gz_sim_components.AngularAcceleration",
                                 AngularAcceleration)
 
   /// \brief A component type that contains angular acceleration of an entity in
   /// the world frame represented by gz::math::Vector3d.
   using WorldAngularAcceleration =
-      Component<math::Vector3d, class WorldAngularAccelerationTag>;
+      Component<math::Vector3d, class WorldAngularAccelerationTag,
+      serializers::RawBytesSerializer<math::Vector3d>>;
   GZ_SIM_REGISTER_COMPONENT(
       "gz_sim_components.WorldAngularAcceleration",
       WorldAngularAcceleration)
@@ -36,14 +36,16 @@ namespace components
   /// \brief A component type that contains angular velocity of an entity
   /// represented by gz::math::Vector3d.
   using AngularVelocity =
-    Component<math::Vector3d, class AngularVelocityTag>;
+    Component<math::Vector3d, class AngularVelocityTag,
+    serializers::RawBytesSerializer<math::Vector3d>>;
   GZ_SIM_REGISTER_COMPONENT("gz_sim_components.AngularVelocity",
       AngularVelocity)
 
   /// \brief A component type that contains angular velocity of an entity in the
   /// world frame represented by gz::math::Vector3d.
   using WorldAngularVelocity =
-      Component<math::Vector3d, class WorldAngularVelocityTag>;
+      Component<math::Vector3d, class WorldAngularVelocityTag,
+      serializers::RawBytesSerializer<math::Vector3d>>;
   GZ_SIM_REGISTER_COMPONENT("gz_sim_components.WorldAngularVelocity",
       WorldAngularVelocity)
 }
@@ -17,10 +17,13 @@
 #ifndef GZ_SIM_COMPONENTS_COMPONENT_HH_
 #define GZ_SIM_COMPONENTS_COMPONENT_HH_
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <sstream>
+#include <type_traits>
 #include <utility>
 
 #include <gz/common/Console.hh>
@@ -222,6 +225,43 @@ namespace serializers
       return _in;
     }
   };
+
+  /// \brief Serializer that copies the raw bytes of the component data in
+  /// and out of the stream, avoiding the text formatting done by the
+  /// stream operators. Only available for trivially copyable data types,
+  /// enforced at compile time.
+  ///
+  /// The byte layout is that of the running architecture, which is fine
+  /// because serialized state is only exchanged between processes built
+  /// from the same libraries, but it does mean state recorded on one
+  /// architecture can't be played back on another.
+  /// \tparam DataType Type whose bytes will be copied.
+  template <typename DataType>
+  class RawBytesSerializer
+  {
+    static_assert(std::is_trivially_copyable_v<DataType>,
+        "RawBytesSerializer requires a trivially copyable data type");
+
+    /// Serialization
+    /// \param[in] _out Out stream.
+    /// \param[in] _data Data to serialize.
+    public: static std::ostream &Serialize(std::ostream &_out,
+                                           const DataType &_data)
+    {
+      _out.write(reinterpret_cast<const char *>(&_data), sizeof(DataType));
+      return _out;
+    }
+
+    /// \brief Deserialization
+    /// \param[in] _in In stream.
+    /// \param[out] _data Data resulting from deserialization.
+    public: static std::istream &Deserialize(std::istream &_in,
+                                             DataType &_data)
+    {
+      _in.read(reinterpret_cast<char *>(&_data), sizeof(DataType));
+      return _in;
+    }
+  };
 }
 
 namespace components
@@ -283,6 +323,30 @@ namespace components
     /// \brief Clone the component.
     /// \return A pointer to the component.
     public: virtual std::unique_ptr<BaseComponent> Clone() const = 0;
+
+    /// \brief Copy the data of another component into this component. This
+    /// allows component instances to be reused instead of reallocated, for
+    /// example by the EntityComponentManager's component pool.
+    /// By default no data is copied and false is returned; derived classes
+    /// override this function to support reuse.
+    /// \param[in] _other Component to copy data from. It must have the same
+    /// type ID as this component.
+    /// \return True if _other has the same type ID as this component and its
+    /// data was copied. False otherwise.
+    public: virtual bool CopyDataFrom(const BaseComponent &_other)
+    {
+      (void)_other;
+      return false;
+    }
+
+    /// \brief Get the shallow size in bytes of the most derived component
+    /// object. Memory owned by the component data through indirection
+    /// (strings, vectors, etc.) is not included.
+    /// \return Size of the component object in bytes.
+    public: virtual std::size_t SizeOf() const
+    {
+      return sizeof(BaseComponent);
+    }
   };
 
   /// \brief A component type that wraps any data type. The intention is for
@@ -358,6 +422,15 @@ namespace components
     // Documentation inherited
     public: void Deserialize(std::istream &_in) override;
 
+    // Documentation inherited
+    public: bool CopyDataFrom(const BaseComponent &_other) override;
+
+    // Documentation inherited
+    public: std::size_t SizeOf() const override
+    {
+      return sizeof(*this);
+    }
+
     /// \brief Get the mutable component data. This function will be
     /// deprecated in Gazebo 3, replaced by const DataType &Data() const.
     /// Use void SetData(const DataType &) to modify data.
@@ -427,6 +500,15 @@ namespace components
     // Documentation inherited
     public: void Deserialize(std::istream &_in) override;
 
+    // Documentation inherited
+    public: bool CopyDataFrom(const BaseComponent &_other) override;
+
+    // Documentation inherited
+    public: std::size_t SizeOf() const override
+    {
+      return sizeof(*this);
+    }
+
     /// \brief Unique ID for this component type. This is set through the
     /// Factory registration.
     public: inline static ComponentTypeId typeId{0};
@@ -517,6 +599,19 @@ namespace components
     return typeId;
   }
 
+  //////////////////////////////////////////////////
+  template <typename DataType, typename Identifier, typename Serializer>
+  bool Component<DataType, Identifier, Serializer>::CopyDataFrom(
+      const BaseComponent &_other)
+  {
+    if (this->TypeId() != _other.TypeId())
+      return false;
+
+    this->data = static_cast<
+        const Component<DataType, Identifier, Serializer> &>(_other).Data();
+    return true;
+  }
+
   //////////////////////////////////////////////////
   template <typename Identifier, typename Serializer>
   bool Component<NoData, Identifier, Serializer>::operator==(
@@ -548,6 +643,15 @@ namespace components
     return typeId;
   }
 
+  //////////////////////////////////////////////////
+  template <typename Identifier, typename Serializer>
+  bool Component<NoData, Identifier, Serializer>::CopyDataFrom(
+      const BaseComponent &_other)
+  {
+    // There is no data to copy; reuse succeeds whenever the types match.
+    return this->TypeId() == _other.TypeId();
+  }
+
   //////////////////////////////////////////////////
   template <typename Identifier, typename Serializer>
   void Component<NoData, Identifier, Serializer>::Serialize(
@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -421,9 +422,13 @@ namespace components
       std::vector<ComponentTypeId> types;
 
       // Return the list of all known component types.
+      types.reserve(this->compsById.size());
       for (const auto &comp : this->compsById)
         types.push_back(comp.first);
 
+      // Keep the order deterministic, since the storage is unordered.
+      std::sort(types.begin(), types.end());
+
       return types;
     }
 
@@ -449,14 +454,18 @@ namespace components
     private: Factory() = default;
     friend gz::utils::NeverDestroyed<Factory>;
     /// \brief A list of registered components where the key is its id.
-    private: std::map<ComponentTypeId, ComponentDescriptorQueue> compsById;
+    /// This is a hash map rather than an ordered map so that the New and
+    /// HasType calls on the state sync hot path cost a single integer hash
+    /// instead of a tree walk.
+    private: std::unordered_map<ComponentTypeId, ComponentDescriptorQueue>
+        compsById;
 
     /// \brief A list of IDs and their equivalent names.
-    public: std::map<ComponentTypeId, std::string> namesById;
+    public: std::unordered_map<ComponentTypeId, std::string> namesById;
 
     /// \brief Keep track of the runtime names for types and warn the user if
     /// they try to register different types with the same typeName.
-    public: std::map<ComponentTypeId, std::string>
+    public: std::unordered_map<ComponentTypeId, std::string>
         runtimeNamesById;
   };
 
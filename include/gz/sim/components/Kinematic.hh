@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_COMPONENTS_KINEMATIC_HH_
+#define GZ_SIM_COMPONENTS_KINEMATIC_HH_
+
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+  /// \brief A component used to indicate that a model is kinematic: it is
+  /// skipped by the physics engine entirely and its pose is integrated from
+  /// velocity commands by the Kinematics system. Useful for scripted
+  /// entities, such as crowds of actors, that don't need dynamics.
+  using Kinematic = Component<bool, class KinematicTag>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.Kinematic", Kinematic)
+}
+}
+}
+}
+
+#endif
@@ -36,14 +36,16 @@ namespace components
   /// \brief A component type that contains linear acceleration of an entity
   /// represented by gz::math::Vector3d.
   using LinearAcceleration =
-    Component<math::Vector3d, class LinearAccelerationTag>;
+    Component<math::Vector3d, class LinearAccelerationTag,
+    serializers::RawBytesSerializer<math::Vector3d>>;
   GZ_SIM_REGISTER_COMPONENT("gz_sim_components.LinearAcceleration",
       LinearAcceleration)
 
   /// \brief A component type that contains linear acceleration of an entity
   /// in the world frame represented by gz::math::Vector3d.
   using WorldLinearAcceleration =
-      Component<math::Vector3d, class WorldLinearAccelerationTag>;
+      Component<math::Vector3d, class WorldLinearAccelerationTag,
+      serializers::RawBytesSerializer<math::Vector3d>>;
   GZ_SIM_REGISTER_COMPONENT("gz_sim_components.WorldLinearAcceleration",
       WorldLinearAcceleration)
 }
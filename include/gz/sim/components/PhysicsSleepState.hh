@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_COMPONENTS_PHYSICSSLEEPSTATE_HH_
+#define GZ_SIM_COMPONENTS_PHYSICSSLEEPSTATE_HH_
+
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+  /// \brief A component holding whether a link is asleep (true) or awake
+  /// (false). Maintained by the physics system on links that have this
+  /// component: a link is put to sleep after its pose has been still for a
+  /// number of consecutive steps, and wakes as soon as its pose changes
+  /// again, for example because of a contact. While a link sleeps, the
+  /// physics system checks its pose less frequently, so the cost of a step
+  /// tracks the number of active bodies.
+  using PhysicsSleepState = Component<bool, class PhysicsSleepStateTag>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.PhysicsSleepState",
+      PhysicsSleepState)
+}
+}
+}
+}
+
+#endif
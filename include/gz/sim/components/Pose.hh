@@ -31,20 +31,24 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
 namespace components
 {
   /// \brief A component type that contains pose, gz::math::Pose3d,
-  /// information.
-  using Pose = Component<gz::math::Pose3d, class PoseTag>;
+  /// information. Poses change every step for every moving entity, so
+  /// they serialize via raw bytes rather than text streaming.
+  using Pose = Component<gz::math::Pose3d, class PoseTag,
+      serializers::RawBytesSerializer<gz::math::Pose3d>>;
   GZ_SIM_REGISTER_COMPONENT("gz_sim_components.Pose", Pose)
 
   /// \brief A component type that contains pose, gz::math::Pose3d,
   /// information in world frame.
-  using WorldPose = Component<gz::math::Pose3d, class WorldPoseTag>;
+  using WorldPose = Component<gz::math::Pose3d, class WorldPoseTag,
+      serializers::RawBytesSerializer<gz::math::Pose3d>>;
   GZ_SIM_REGISTER_COMPONENT(
       "gz_sim_components.WorldPose", WorldPose)
 
   /// \brief A component type that contains pose, gz::math::Pose3d,
   /// information within a trajectory.
   using TrajectoryPose =
-      Component<gz::math::Pose3d, class TrajectoryPoseTag>;
+      Component<gz::math::Pose3d, class TrajectoryPoseTag,
+      serializers::RawBytesSerializer<gz::math::Pose3d>>;
   GZ_SIM_REGISTER_COMPONENT(
       "gz_sim_components.TrajectoryPose", TrajectoryPose)
 }
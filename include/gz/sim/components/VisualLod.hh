@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_COMPONENTS_VISUALLOD_HH_
+#define GZ_SIM_COMPONENTS_VISUALLOD_HH_
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gz/math/Vector3.hh>
+#include <gz/sim/components/Factory.hh>
+#include <gz/sim/components/Component.hh>
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace components
+{
+  /// \brief A single level of detail band of a visual. The band becomes
+  /// active when the distance between the visual and the closest camera
+  /// is greater than or equal to minDistance, until the next band's
+  /// minDistance takes over. Distances below the first band's minDistance
+  /// show the visual's original geometry.
+  struct VisualLodBand
+  {
+    /// \brief Camera distance in meters at which this band becomes active.
+    double minDistance{0.0};
+
+    /// \brief URI of the reduced detail mesh to show in this band. The
+    /// mesh supplies its own materials. URIs with spaces are not
+    /// supported.
+    std::string meshUri;
+
+    /// \brief Optional submesh name within the mesh.
+    std::string submesh;
+
+    /// \brief Scale applied to the mesh.
+    math::Vector3d scale{math::Vector3d::One};
+
+    public: bool operator==(const VisualLodBand &_band) const
+    {
+      return (this->minDistance == _band.minDistance) &&
+             (this->meshUri == _band.meshUri) &&
+             (this->submesh == _band.submesh) &&
+             (this->scale == _band.scale);
+    }
+
+    public: bool operator!=(const VisualLodBand &_band) const
+    {
+      return !(*this == _band);
+    }
+  };
+}
+
+namespace serializers
+{
+  /// \brief Serializer for a vector of VisualLodBand objects
+  class VisualLodSerializer
+  {
+    /// \brief Serialization for `std::vector<VisualLodBand>`.
+    /// \param[in] _out Output stream.
+    /// \param[in] _bands Bands to stream
+    /// \return The stream.
+    public: static std::ostream &Serialize(
+                std::ostream &_out,
+                const std::vector<components::VisualLodBand> &_bands)
+    {
+      _out << _bands.size();
+      for (const auto &band : _bands)
+      {
+        _out << "\n" << band.minDistance << " " << band.scale << " "
+             << band.meshUri << " " << band.submesh;
+      }
+      return _out;
+    }
+
+    /// \brief Deserialization for `std::vector<VisualLodBand>`.
+    /// \param[in] _in Input stream.
+    /// \param[in] _bands Bands to populate
+    /// \return The stream.
+    public: static std::istream &Deserialize(
+                std::istream &_in,
+                std::vector<components::VisualLodBand> &_bands)
+    {
+      std::size_t count{0u};
+      _in >> count;
+      _bands.resize(count);
+      for (auto &band : _bands)
+      {
+        _in >> band.minDistance >> band.scale >> band.meshUri;
+        // the submesh may be empty, so read the rest of the line
+        std::string submesh;
+        std::getline(_in, submesh);
+        std::istringstream(submesh) >> band.submesh;
+      }
+      return _in;
+    }
+  };
+}
+
+namespace components
+{
+  /// \brief A component with the level of detail bands of a visual entity,
+  /// sorted by the SceneManager in ascending minDistance order. The render
+  /// thread swaps the visual's geometry to the band matching the distance
+  /// to the closest camera each frame, without recreating the visual.
+  using VisualLod = Component<std::vector<VisualLodBand>, class VisualLodTag,
+                              serializers::VisualLodSerializer>;
+  GZ_SIM_REGISTER_COMPONENT("gz_sim_components.VisualLod", VisualLod)
+}
+}
+}
+}
+
+#endif
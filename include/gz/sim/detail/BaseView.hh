@@ -136,6 +136,14 @@ class GZ_SIM_VISIBLE BaseView
   /// exist in the view.
   public: virtual bool RemoveEntity(const Entity _entity) = 0;
 
+  /// \brief Remove a batch of entities from the view in one pass. This is
+  /// equivalent to calling RemoveEntity for each entity, but lets derived
+  /// views process the whole batch at once, which matters when many
+  /// entities are removed in the same step (e.g. level unloads).
+  /// \param[in] _entities The entities to remove.
+  /// \return True if at least one entity was removed from the view.
+  public: virtual bool RemoveEntities(const std::vector<Entity> &_entities);
+
   /// \brief Add the entity to the list of entities to be removed
   /// \param[in] _entity The entity to add.
   /// \return True if the entity was added to the list, false if the entity
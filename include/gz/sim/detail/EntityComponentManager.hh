@@ -17,20 +17,26 @@
 #ifndef GZ_SIM_DETAIL_ENTITYCOMPONENTMANAGER_HH_
 #define GZ_SIM_DETAIL_ENTITYCOMPONENTMANAGER_HH_
 
+#include <atomic>
 #include <cstring>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <gz/common/Util.hh>
+#include <gz/common/WorkerPool.hh>
 #include <gz/math/Helpers.hh>
 
 #include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/components/Name.hh"
 
 namespace gz
 {
@@ -173,7 +179,17 @@ bool EntityComponentManager::SetComponentData(const Entity _entity,
     return true;
   }
 
-  return comp->SetData(_data, CompareData<typename ComponentTypeT::Type>);
+  const bool updated =
+      comp->SetData(_data, CompareData<typename ComponentTypeT::Type>);
+
+  // Renaming an entity in place has to be reflected in the name index.
+  if constexpr (std::is_same_v<ComponentTypeT, components::Name>)
+  {
+    if (updated)
+      this->RefreshNameIndex(_entity);
+  }
+
+  return updated;
 }
 
 //////////////////////////////////////////////////
@@ -181,37 +197,81 @@ template<typename ...ComponentTypeTs>
 Entity EntityComponentManager::EntityByComponents(
     const ComponentTypeTs &..._desiredComponents) const
 {
-  // Get all entities which have components of the desired types
-  const auto &view = this->FindView<ComponentTypeTs...>();
-
-  // Iterate over entities
-  Entity result{kNullEntity};
-  for (const Entity entity : view->Entities())
+  // Lookups keyed by name are common enough that the ECM maintains a name
+  // index; use it so the candidate set is the entities holding the desired
+  // name rather than every entity holding a Name component.
+  if constexpr ((std::is_same_v<ComponentTypeTs, components::Name> || ...))
   {
-    bool different{false};
-
-    // Iterate over desired components, comparing each of them to the
-    // equivalent component in the entity.
+    std::string desiredName;
     ForEach([&](const auto &_desiredComponent)
     {
-      auto entityComponent = this->Component<
-          std::remove_cv_t<std::remove_reference_t<
-              decltype(_desiredComponent)>>>(entity);
-
-      if (*entityComponent != _desiredComponent)
+      if constexpr (std::is_same_v<std::remove_cv_t<
+          std::remove_reference_t<decltype(_desiredComponent)>>,
+          components::Name>)
       {
-        different = true;
+        desiredName = _desiredComponent.Data();
       }
     }, _desiredComponents...);
 
-    if (!different)
+    for (const Entity entity : this->EntitiesByNameIndex(desiredName))
     {
-      result = entity;
-      break;
+      bool different{false};
+
+      // Unlike the view below, the index doesn't guarantee the entity has
+      // all the desired component types, so check for null components.
+      ForEach([&](const auto &_desiredComponent)
+      {
+        auto entityComponent = this->Component<
+            std::remove_cv_t<std::remove_reference_t<
+                decltype(_desiredComponent)>>>(entity);
+
+        if (nullptr == entityComponent ||
+            *entityComponent != _desiredComponent)
+        {
+          different = true;
+        }
+      }, _desiredComponents...);
+
+      if (!different)
+        return entity;
     }
+
+    return kNullEntity;
   }
+  else
+  {
+    // Get all entities which have components of the desired types
+    const auto &view = this->FindView<ComponentTypeTs...>();
 
-  return result;
+    // Iterate over entities
+    Entity result{kNullEntity};
+    for (const Entity entity : view->Entities())
+    {
+      bool different{false};
+
+      // Iterate over desired components, comparing each of them to the
+      // equivalent component in the entity.
+      ForEach([&](const auto &_desiredComponent)
+      {
+        auto entityComponent = this->Component<
+            std::remove_cv_t<std::remove_reference_t<
+                decltype(_desiredComponent)>>>(entity);
+
+        if (*entityComponent != _desiredComponent)
+        {
+          different = true;
+        }
+      }, _desiredComponents...);
+
+      if (!different)
+      {
+        result = entity;
+        break;
+      }
+    }
+
+    return result;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -219,36 +279,82 @@ template<typename ...ComponentTypeTs>
 std::vector<Entity> EntityComponentManager::EntitiesByComponents(
     const ComponentTypeTs &..._desiredComponents) const
 {
-  // Get all entities which have components of the desired types
-  const auto &view = this->FindView<ComponentTypeTs...>();
-
-  // Iterate over entities
-  std::vector<Entity> result;
-  for (const Entity entity : view->Entities())
+  // As in EntityByComponents, narrow the candidate set through the name
+  // index when one of the desired components is a Name.
+  if constexpr ((std::is_same_v<ComponentTypeTs, components::Name> || ...))
   {
-    bool different{false};
-
-    // Iterate over desired components, comparing each of them to the
-    // equivalent component in the entity.
+    std::string desiredName;
     ForEach([&](const auto &_desiredComponent)
     {
-      auto entityComponent = this->Component<
-          std::remove_cv_t<std::remove_reference_t<
-              decltype(_desiredComponent)>>>(entity);
-
-      if (*entityComponent != _desiredComponent)
+      if constexpr (std::is_same_v<std::remove_cv_t<
+          std::remove_reference_t<decltype(_desiredComponent)>>,
+          components::Name>)
       {
-        different = true;
+        desiredName = _desiredComponent.Data();
       }
     }, _desiredComponents...);
 
-    if (!different)
+    std::vector<Entity> result;
+    for (const Entity entity : this->EntitiesByNameIndex(desiredName))
     {
-      result.push_back(entity);
+      bool different{false};
+
+      // Unlike the view below, the index doesn't guarantee the entity has
+      // all the desired component types, so check for null components.
+      ForEach([&](const auto &_desiredComponent)
+      {
+        auto entityComponent = this->Component<
+            std::remove_cv_t<std::remove_reference_t<
+                decltype(_desiredComponent)>>>(entity);
+
+        if (nullptr == entityComponent ||
+            *entityComponent != _desiredComponent)
+        {
+          different = true;
+        }
+      }, _desiredComponents...);
+
+      if (!different)
+      {
+        result.push_back(entity);
+      }
     }
+
+    return result;
   }
+  else
+  {
+    // Get all entities which have components of the desired types
+    const auto &view = this->FindView<ComponentTypeTs...>();
 
-  return result;
+    // Iterate over entities
+    std::vector<Entity> result;
+    for (const Entity entity : view->Entities())
+    {
+      bool different{false};
+
+      // Iterate over desired components, comparing each of them to the
+      // equivalent component in the entity.
+      ForEach([&](const auto &_desiredComponent)
+      {
+        auto entityComponent = this->Component<
+            std::remove_cv_t<std::remove_reference_t<
+                decltype(_desiredComponent)>>>(entity);
+
+        if (*entityComponent != _desiredComponent)
+        {
+          different = true;
+        }
+      }, _desiredComponents...);
+
+      if (!different)
+      {
+        result.push_back(entity);
+      }
+    }
+
+    return result;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -386,6 +492,58 @@ constexpr bool applyFunction(const FuncT &_f, const Entity &_entity,
   return applyFunctionImpl<ComponentTypeTs...>(
       _f, _entity, _data, std::index_sequence_for<ComponentTypeTs...>{});
 }
+/// \brief Helper function that computes the number of worker threads to use
+/// for EachParallel. This defaults to the hardware concurrency, and can be
+/// limited with the GZ_SIM_ECM_THREAD_COUNT environment variable.
+/// \param[in] _entityCount Number of entities that will be processed. The
+/// worker count never exceeds this value.
+/// \return The number of worker threads to use.
+inline std::size_t EachParallelThreadCount(std::size_t _entityCount)
+{
+  std::size_t threadCount = std::thread::hardware_concurrency();
+  std::string threadCountEnv;
+  if (common::env("GZ_SIM_ECM_THREAD_COUNT", threadCountEnv) &&
+      !threadCountEnv.empty())
+  {
+    try
+    {
+      threadCount = std::stoul(threadCountEnv);
+    }
+    catch (const std::exception &)
+    {
+      gzwarn << "Invalid value in GZ_SIM_ECM_THREAD_COUNT ["
+             << threadCountEnv << "]. Using hardware concurrency.\n";
+    }
+  }
+  if (threadCount < 1)
+    threadCount = 1;
+  return std::min(threadCount, _entityCount);
+}
+
+/// \brief Helper template that invokes a callback for a contiguous range of
+/// entities of a view, used by EachParallel to run ranges on worker threads.
+/// \tparam ComponentTypeTs The actual types of each of the view's components.
+/// \tparam FuncT The type of the callback function.
+/// \param[in] _f The callback function.
+/// \param[in] _view The view the entities belong to.
+/// \param[in] _entities All of the view's entities.
+/// \param[in] _begin Index of the first entity in the range.
+/// \param[in] _end Index one past the last entity in the range.
+/// \param[in, out] _stop Flag shared between all workers. Set when a
+/// callback returns false, which stops all workers from starting new calls.
+template <typename... ComponentTypeTs, typename FuncT>
+void EachParallelRange(const FuncT &_f, const View *_view,
+    const std::vector<Entity> &_entities, std::size_t _begin,
+    std::size_t _end, std::atomic<bool> &_stop)
+{
+  for (std::size_t i = _begin; i < _end && !_stop.load(); ++i)
+  {
+    const Entity entity = _entities[i];
+    const auto &data = _view->EntityComponentData(entity);
+    if (!applyFunction<ComponentTypeTs...>(_f, entity, data))
+      _stop = true;
+  }
+}
 }  // namespace detail
 
 //////////////////////////////////////////////////
@@ -398,13 +556,28 @@ void EntityComponentManager::Each(typename identity<std::function<
   auto view = this->FindView<ComponentTypeTs...>();
 
   // Iterate over the entities in the view, and invoke the callback
-  // function.
-  for (const Entity entity : view->Entities())
+  // function. Single-component views are the most common pattern, so they
+  // iterate the view's storage directly instead of performing a data lookup
+  // per entity. Each makes no guarantee about iteration order either way.
+  if constexpr (sizeof...(ComponentTypeTs) == 1)
   {
-    const auto &data = view->EntityComponentData(entity);
-    if (!detail::applyFunction<const ComponentTypeTs...>(_f, entity, data))
+    for (const auto &[entity, data] : view->ValidData())
     {
-      break;
+      if (!detail::applyFunction<const ComponentTypeTs...>(_f, entity, data))
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    for (const Entity entity : view->Entities())
+    {
+      const auto &data = view->EntityComponentData(entity);
+      if (!detail::applyFunction<const ComponentTypeTs...>(_f, entity, data))
+      {
+        break;
+      }
     }
   }
 }
@@ -419,17 +592,125 @@ void EntityComponentManager::Each(typename identity<std::function<
   auto view = this->FindView<ComponentTypeTs...>();
 
   // Iterate over the entities in the view, and invoke the callback
-  // function.
-  for (const Entity entity : view->Entities())
+  // function. See the const overload above for why single-component views
+  // iterate the view's storage directly.
+  if constexpr (sizeof...(ComponentTypeTs) == 1)
   {
-    const auto &data = view->EntityComponentData(entity);
-    if (!detail::applyFunction<ComponentTypeTs...>(_f, entity, data))
+    for (const auto &[entity, data] : view->ValidData())
     {
-      break;
+      if (!detail::applyFunction<ComponentTypeTs...>(_f, entity, data))
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    for (const Entity entity : view->Entities())
+    {
+      const auto &data = view->EntityComponentData(entity);
+      if (!detail::applyFunction<ComponentTypeTs...>(_f, entity, data))
+      {
+        break;
+      }
     }
   }
 }
 
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void EntityComponentManager::EachParallel(typename identity<std::function<
+    bool(const Entity &_entity, const ComponentTypeTs *...)>>::type _f) const
+{
+  // Get the view. This will create a new view if one does not already
+  // exist.
+  auto view = this->FindView<ComponentTypeTs...>();
+
+  const auto &entitySet = view->Entities();
+  const std::vector<Entity> entities(entitySet.begin(), entitySet.end());
+  if (entities.empty())
+    return;
+
+  const std::size_t threadCount =
+      detail::EachParallelThreadCount(entities.size());
+
+  // A single range doesn't need the pool; run it on the calling thread.
+  std::atomic<bool> stop{false};
+  if (threadCount <= 1)
+  {
+    detail::EachParallelRange<const ComponentTypeTs...>(
+        _f, view, entities, 0, entities.size(), stop);
+    return;
+  }
+
+  // Partition the entities into one contiguous range per worker and run
+  // the ranges on the manager's persistent worker pool, so no threads are
+  // created or torn down per call.
+  auto &pool = this->EachParallelWorkerPool();
+  const std::size_t chunkSize =
+      (entities.size() + threadCount - 1) / threadCount;
+  for (std::size_t i = 0; i < threadCount; ++i)
+  {
+    const std::size_t begin = i * chunkSize;
+    const std::size_t end = std::min(begin + chunkSize, entities.size());
+    if (begin >= end)
+      break;
+    pool.AddWork([&, begin, end]()
+        {
+          detail::EachParallelRange<const ComponentTypeTs...>(
+              _f, view, entities, begin, end, stop);
+        });
+  }
+  pool.WaitForResults();
+}
+
+//////////////////////////////////////////////////
+template<typename ...ComponentTypeTs>
+void EntityComponentManager::EachParallel(typename identity<std::function<
+    bool(const Entity &_entity, ComponentTypeTs *...)>>::type _f)
+{
+  // Get the view. This will create a new view if one does not already
+  // exist.
+  auto view = this->FindView<ComponentTypeTs...>();
+
+  const auto &entitySet = view->Entities();
+  const std::vector<Entity> entities(entitySet.begin(), entitySet.end());
+  if (entities.empty())
+    return;
+
+  const std::size_t threadCount =
+      detail::EachParallelThreadCount(entities.size());
+
+  // A single range doesn't need the pool; run it on the calling thread.
+  std::atomic<bool> stop{false};
+  if (threadCount <= 1)
+  {
+    detail::EachParallelRange<ComponentTypeTs...>(
+        _f, view, entities, 0, entities.size(), stop);
+    return;
+  }
+
+  // Partition the entities into one contiguous range per worker and run
+  // the ranges on the manager's persistent worker pool, so no threads are
+  // created or torn down per call.
+  auto &pool = this->EachParallelWorkerPool();
+  const std::size_t chunkSize =
+      (entities.size() + threadCount - 1) / threadCount;
+  for (std::size_t i = 0; i < threadCount; ++i)
+  {
+    const std::size_t begin = i * chunkSize;
+    const std::size_t end = std::min(begin + chunkSize, entities.size());
+    if (begin >= end)
+      break;
+    pool.AddWork([&, begin, end]()
+        {
+          detail::EachParallelRange<ComponentTypeTs...>(
+              _f, view, entities, begin, end, stop);
+        });
+  }
+  pool.WaitForResults();
+}
+
 //////////////////////////////////////////////////
 template <class Function, class... ComponentTypeTs>
 void EntityComponentManager::ForEach(Function _f,
@@ -504,6 +785,68 @@ void EntityComponentManager::EachRemoved(typename identity<std::function<
   }
 }
 
+//////////////////////////////////////////////////
+template<typename ComponentTypeT>
+void EntityComponentManager::EachChanged(typename identity<std::function<
+    bool(const Entity &_entity, const ComponentTypeT *)>>::type _f) const
+{
+  const auto *bitset = this->ChangedBitset(ComponentTypeT::typeId);
+  if (nullptr == bitset)
+    return;
+
+  for (std::size_t word = 0; word < bitset->size(); ++word)
+  {
+    const uint64_t bits = (*bitset)[word];
+    if (bits == 0)
+      continue;
+    for (std::size_t bit = 0; bit < 64; ++bit)
+    {
+      if (!(bits & (1ull << bit)))
+        continue;
+      const Entity entity = word * 64 + bit;
+
+      // The bit may be stale if the entity was removed this step.
+      auto comp = this->Component<ComponentTypeT>(entity);
+      if (nullptr == comp)
+        continue;
+
+      if (!_f(entity, comp))
+        return;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+template<typename ComponentTypeT>
+void EntityComponentManager::EachChanged(typename identity<std::function<
+    bool(const Entity &_entity, ComponentTypeT *)>>::type _f)
+{
+  const auto *bitset = this->ChangedBitset(ComponentTypeT::typeId);
+  if (nullptr == bitset)
+    return;
+
+  for (std::size_t word = 0; word < bitset->size(); ++word)
+  {
+    const uint64_t bits = (*bitset)[word];
+    if (bits == 0)
+      continue;
+    for (std::size_t bit = 0; bit < 64; ++bit)
+    {
+      if (!(bits & (1ull << bit)))
+        continue;
+      const Entity entity = word * 64 + bit;
+
+      // The bit may be stale if the entity was removed this step.
+      auto comp = this->Component<ComponentTypeT>(entity);
+      if (nullptr == comp)
+        continue;
+
+      if (!_f(entity, comp))
+        return;
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 template<typename ...ComponentTypeTs>
 detail::View *EntityComponentManager::FindView() const
@@ -550,14 +893,9 @@ detail::View *EntityComponentManager::FindView() const
   // create a new view if one wasn't found
   detail::View view(std::set<ComponentTypeId>{ComponentTypeTs::typeId...});
 
-  for (const auto &vertex : this->Entities().Vertices())
+  // only add entities to the view that have all of the components in viewKey
+  for (const Entity entity : this->EntitiesMatching(view.ComponentTypes()))
   {
-    Entity entity = vertex.first;
-
-    // only add entities to the view that have all of the components in viewKey
-    if (!this->EntityMatches(entity, view.ComponentTypes()))
-      continue;
-
     view.AddEntityWithConstComps(entity, this->IsNewEntity(entity),
         this->Component<ComponentTypeTs>(entity)...);
     view.AddEntityWithComps(entity, this->IsNewEntity(entity),
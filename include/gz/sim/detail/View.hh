@@ -64,6 +64,9 @@ class GZ_SIM_VISIBLE View : public BaseView
   /// \brief Documentation inherited
   public: bool RemoveEntity(const Entity _entity) override;
 
+  /// \brief Documentation inherited
+  public: bool RemoveEntities(const std::vector<Entity> &_entities) override;
+
   /// \brief Get an entity and its component data. It is assumed that the entity
   /// being requested exists in the view.
   /// \param[_in] _entity The entity
@@ -79,6 +82,13 @@ class GZ_SIM_VISIBLE View : public BaseView
   /// component data are returned.
   public: const ComponentData &EntityComponentData(const Entity _entity) const;
 
+  /// \brief Get the map of all valid entities to their component data. This
+  /// allows iterating the view's storage directly, skipping the per-entity
+  /// data lookup when every entity in the view is being visited. Note that
+  /// iteration order over the map is unspecified.
+  /// \return The map of entities to their component data
+  public: const std::unordered_map<Entity, ComponentData> &ValidData() const;
+
   /// \brief Add an entity with its component data to the view. It is assumed
   /// that the entity to be added does not already exist in the view.
   /// \tparam ComponentTypeTs The component type(s) that are stored in this
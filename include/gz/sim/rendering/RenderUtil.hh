@@ -77,6 +77,16 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
                            EntityComponentManager &_ecm);
 
     /// \brief Helper PostUpdate function for updating the scene
+    ///
+    /// \note This is already the zero copy path: callers that hold the
+    /// server ECM, like the Sensors system, scan it directly with no
+    /// serialization in between. The GUI instead reconstructs its own
+    /// ECM from SceneBroadcaster state messages because the GUI runs in
+    /// a separate process; when both ends do share a process,
+    /// gz-transport delivers those messages by pointer without
+    /// serializing. Sharing one ECM across the process boundary would
+    /// need a shared memory snapshot layer in gz-transport, not
+    /// anything this class can provide.
     public: void UpdateFromECM(const UpdateInfo &_info,
                                const EntityComponentManager &_ecm);
 
@@ -142,6 +152,16 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     /// \brief Show grid view in the scene
     public: void ShowGrid();
 
+    /// \brief Set the period, in render updates, at which pose updates are
+    /// applied to entities outside every camera frustum. On-screen entities
+    /// are always updated at full rate. Off-screen pose updates are never
+    /// dropped; they are staggered across frames so each off-screen entity
+    /// is refreshed at least once per period. A period of 0 (the default)
+    /// applies every pose update immediately.
+    /// \param[in] _frames Number of render updates between pose
+    /// applications for off-screen entities.
+    public: void SetOffscreenPoseUpdatePeriod(unsigned int _frames);
+
     /// \brief Set whether to use the current GL context
     /// \param[in] _enable True to use the current GL context
     public: void SetUseCurrentGLContext(bool _enable);
@@ -213,6 +213,22 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
     /// \return Pointer to requested visual
     public: rendering::VisualPtr VisualById(Entity _id);
 
+    /// \brief Set the level of detail bands of a visual. Each band pairs
+    /// the camera distance at which it becomes active with the geometry
+    /// shown from that distance on. The first band is expected to be at
+    /// distance 0 with the geometry the visual was created with.
+    /// \param[in] _id Unique visual id
+    /// \param[in] _bands Bands, sorted by this call in ascending distance
+    /// order
+    public: void SetVisualLod(Entity _id,
+        const std::vector<std::pair<double, sdf::Geometry>> &_bands);
+
+    /// \brief Select the level of detail band of every visual registered
+    /// with SetVisualLod from its distance to the closest camera in the
+    /// scene, swapping the visual's geometry when the band changes.
+    /// Called by the render thread once per frame.
+    public: void UpdateLods();
+
     /// \brief Load Actor animations
     /// \param[in] _actor Actor
     /// \return Animation name to ID map
@@ -13,10 +13,20 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <vector>
 
 #include "EntityComponentManager.hh"
 
+#include "gz/sim/components/JointVelocityCmd.hh"
+#include "gz/sim/components/Pose.hh"
+#include "gz/sim/Util.hh"
+
+namespace py = pybind11;
+
 namespace gz
 {
 namespace sim
@@ -28,7 +38,92 @@ void defineSimEntityComponentManager(pybind11::object module)
 {
   pybind11::class_<gz::sim::EntityComponentManager>(
       module, "EntityComponentManager")
-  .def(pybind11::init<>());
+  .def(pybind11::init<>())
+  .def("poses",
+      [](gz::sim::EntityComponentManager &_self,
+         const std::vector<gz::sim::Entity> &_entities)
+      {
+        py::array_t<double> out({
+            static_cast<py::ssize_t>(_entities.size()),
+            static_cast<py::ssize_t>(7)});
+        auto buf = out.mutable_unchecked<2>();
+        for (std::size_t i = 0; i < _entities.size(); ++i)
+        {
+          math::Pose3d pose;
+          auto poseComp =
+              _self.Component<components::Pose>(_entities[i]);
+          if (poseComp)
+            pose = poseComp->Data();
+          buf(i, 0) = pose.Pos().X();
+          buf(i, 1) = pose.Pos().Y();
+          buf(i, 2) = pose.Pos().Z();
+          buf(i, 3) = pose.Rot().W();
+          buf(i, 4) = pose.Rot().X();
+          buf(i, 5) = pose.Rot().Y();
+          buf(i, 6) = pose.Rot().Z();
+        }
+        return out;
+      },
+      py::arg("entities"),
+      "Batch-read the pose component of each entity into an Nx7 array "
+      "of [x, y, z, qw, qx, qy, qz] rows, one call instead of one per "
+      "entity. Entities without a pose component yield an identity row.")
+  .def("world_poses",
+      [](gz::sim::EntityComponentManager &_self,
+         const std::vector<gz::sim::Entity> &_entities)
+      {
+        py::array_t<double> out({
+            static_cast<py::ssize_t>(_entities.size()),
+            static_cast<py::ssize_t>(7)});
+        auto buf = out.mutable_unchecked<2>();
+        for (std::size_t i = 0; i < _entities.size(); ++i)
+        {
+          const math::Pose3d pose = gz::sim::worldPose(_entities[i], _self);
+          buf(i, 0) = pose.Pos().X();
+          buf(i, 1) = pose.Pos().Y();
+          buf(i, 2) = pose.Pos().Z();
+          buf(i, 3) = pose.Rot().W();
+          buf(i, 4) = pose.Rot().X();
+          buf(i, 5) = pose.Rot().Y();
+          buf(i, 6) = pose.Rot().Z();
+        }
+        return out;
+      },
+      py::arg("entities"),
+      "Batch-compute the world pose of each entity into an Nx7 array of "
+      "[x, y, z, qw, qx, qy, qz] rows, one call instead of one per "
+      "entity.")
+  .def("set_joint_velocity_cmds",
+      [](gz::sim::EntityComponentManager &_self,
+         const std::vector<gz::sim::Entity> &_joints,
+         const py::array_t<double,
+            py::array::c_style | py::array::forcecast> &_velocities)
+      {
+        auto buf = _velocities.unchecked<1>();
+        if (static_cast<std::size_t>(buf.shape(0)) != _joints.size())
+        {
+          throw py::value_error(
+              "velocities length must match the number of joints");
+        }
+        for (std::size_t i = 0; i < _joints.size(); ++i)
+        {
+          auto cmd =
+              _self.Component<components::JointVelocityCmd>(_joints[i]);
+          if (!cmd)
+          {
+            _self.CreateComponent(_joints[i],
+                components::JointVelocityCmd({buf(i)}));
+          }
+          else
+          {
+            cmd->Data() = {buf(i)};
+          }
+        }
+      },
+      py::arg("joints"),
+      py::arg("velocities"),
+      "Batch-write velocity commands for the first axis of each joint "
+      "from a length-N array, one call instead of one per joint.");
 }
 }  // namespace python
 }  // namespace sim
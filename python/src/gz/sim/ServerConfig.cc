@@ -33,7 +33,13 @@ void defineSimServerConfig(pybind11::object module)
   .def(pybind11::init<>())
   .def(
     "set_sdf_file", &gz::sim::ServerConfig::SetSdfFile,
-    "Set an SDF file to be used with the server.");
+    "Set an SDF file to be used with the server.")
+  .def(
+    "set_world_replication", &gz::sim::ServerConfig::SetWorldReplication,
+    "Set the number of copies of each world to instantiate.")
+  .def(
+    "world_replication", &gz::sim::ServerConfig::WorldReplication,
+    "Get the number of copies of each world to instantiate.");
 }
 }  // namespace python
 }  // namespace sim
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+# Copyright (C) 2026 Open Source Robotics Foundation
+
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+
+#       http://www.apache.org/licenses/LICENSE-2.0
+
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import unittest
+
+try:
+    import numpy
+    HAVE_NUMPY = True
+except ImportError:
+    HAVE_NUMPY = False
+
+from gz_test_deps.common import set_verbosity
+from gz_test_deps.sim import (K_NULL_ENTITY, TestFixture, Joint, Model,
+                              World, world_entity)
+
+
+@unittest.skipUnless(HAVE_NUMPY, 'numpy is required for batched accessors')
+class TestEntityComponentManager(unittest.TestCase):
+    pre_iterations = 0
+
+    def test_batched_accessors(self):
+        set_verbosity(4)
+
+        file_path = os.path.dirname(os.path.realpath(__file__))
+        fixture = TestFixture(os.path.join(file_path, 'joint_test.sdf'))
+
+        def on_pre_udpate_cb(_info, _ecm):
+            self.pre_iterations += 1
+            world_e = world_entity(_ecm)
+            self.assertNotEqual(K_NULL_ENTITY, world_e)
+            w = World(world_e)
+            m = Model(w.model_by_name(_ecm, 'model_test'))
+            joint = Joint(m.joint_by_name(_ecm, 'joint_test'))
+
+            # Batched pose reads return one Nx7 row per entity.
+            poses = _ecm.poses([m.entity()])
+            self.assertEqual((1, 7), poses.shape)
+            world_poses = _ecm.world_poses([m.entity()])
+            self.assertEqual((1, 7), world_poses.shape)
+            # Quaternion rows are normalized.
+            self.assertAlmostEqual(
+                1.0, float(numpy.linalg.norm(poses[0, 3:])), places=6)
+
+            # Batched joint commands; mismatched lengths are rejected.
+            _ecm.set_joint_velocity_cmds(
+                [joint.entity()], numpy.array([1.0]))
+            with self.assertRaises(ValueError):
+                _ecm.set_joint_velocity_cmds(
+                    [joint.entity()], numpy.array([1.0, 2.0]))
+
+        fixture.on_pre_update(on_pre_udpate_cb)
+        fixture.finalize()
+
+        server = fixture.server()
+        server.run(True, 2, False)
+
+        self.assertEqual(2, self.pre_iterations)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -54,6 +54,15 @@ bool BaseView::RequiresComponent(const ComponentTypeId _typeId) const
   return this->componentTypes.find(_typeId) != this->componentTypes.end();
 }
 
+//////////////////////////////////////////////////
+bool BaseView::RemoveEntities(const std::vector<Entity> &_entities)
+{
+  bool removed = false;
+  for (const Entity entity : _entities)
+    removed = this->RemoveEntity(entity) || removed;
+  return removed;
+}
+
 //////////////////////////////////////////////////
 bool BaseView::MarkEntityToRemove(const Entity _entity)
 {
@@ -173,6 +173,15 @@ TEST_F(BaseViewTest, AddEntities)
   ASSERT_EQ(2u, e2Data.size());
   EXPECT_EQ(&e2ModelComp, e2Data[0]);
   EXPECT_EQ(&e2NameComp, e2Data[1]);
+
+  // The full data map should cover both entities and match the per-entity
+  // lookups.
+  const auto &validData = modelNameView.ValidData();
+  ASSERT_EQ(2u, validData.size());
+  ASSERT_NE(validData.find(e1), validData.end());
+  ASSERT_NE(validData.find(e2), validData.end());
+  EXPECT_EQ(modelNameView.EntityComponentData(e1), validData.at(e1));
+  EXPECT_EQ(modelNameView.EntityComponentData(e2), validData.at(e2));
 }
 
 /////////////////////////////////////////////////
@@ -223,6 +232,22 @@ TEST_F(BaseViewTest, RemoveEntities)
   EXPECT_TRUE(view.RemoveEntity(e1));
   EXPECT_EQ(0u, view.ToAddEntities().size());
   EXPECT_EQ(0u, view.ToRemoveEntities().size());
+
+  // batch removal should behave like individual removals
+  view.AddEntityWithComps(e1, isNewEntity, &e1ModelComp);
+  view.AddEntityWithConstComps(e1, isNewEntity, &e1ModelComp);
+  view.AddEntityWithComps(e2, isNewEntity, &e2ModelComp);
+  view.AddEntityWithConstComps(e2, isNewEntity, &e2ModelComp);
+  EXPECT_TRUE(view.HasEntity(e1));
+  EXPECT_TRUE(view.HasEntity(e2));
+  EXPECT_TRUE(view.RemoveEntities({e1, e2}));
+  EXPECT_FALSE(view.HasEntity(e1));
+  EXPECT_FALSE(view.HasEntity(e2));
+  EXPECT_FALSE(view.HasCachedComponentData(e1));
+  EXPECT_FALSE(view.HasCachedComponentData(e2));
+
+  // a batch with no entities from the view removes nothing
+  EXPECT_FALSE(view.RemoveEntities({e1, e2}));
 }
 
 /////////////////////////////////////////////////
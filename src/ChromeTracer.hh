@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_CHROMETRACER_HH_
+#define GZ_SIM_CHROMETRACER_HH_
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gz/sim/config.hh>
+
+namespace gz
+{
+  namespace sim
+  {
+    // Inline bracket to help doxygen filtering.
+    inline namespace GZ_SIM_VERSION_NAMESPACE {
+    /// \class ChromeTracer ChromeTracer.hh
+    /// \brief Process-wide tracer emitting Chrome trace event JSON, the
+    /// format read by chrome://tracing and Perfetto. Unlike GZ_PROFILE,
+    /// which needs the profiler to be compiled in and a custom viewer,
+    /// this is always built and toggled at runtime (--trace <file>), so
+    /// RTF drops in production can be correlated with specific systems
+    /// without rebuilding.
+    ///
+    /// Events are buffered in memory and written out on Stop, so tracing
+    /// adds a timestamp read and a vector append per span, not file I/O.
+    /// When tracing is off, the only cost at each trace point is one
+    /// relaxed atomic load.
+    class ChromeTracer
+    {
+      /// \brief Get the process-wide tracer.
+      public: static ChromeTracer &Instance();
+
+      /// \brief Start tracing. Only the first Start in a process wins;
+      /// later calls are ignored with a warning, since the buffer and
+      /// output file are process-wide.
+      /// \param[in] _path File to write the trace to on Stop.
+      /// \return True if tracing was started.
+      public: bool Start(const std::string &_path);
+
+      /// \brief Stop tracing and write all buffered events to the file
+      /// given to Start. No-op if tracing is not active.
+      public: void Stop();
+
+      /// \brief Whether tracing is active. Cheap enough to call on every
+      /// step; trace points should check this before building span names.
+      public: bool Active() const
+      {
+        return this->active.load(std::memory_order_relaxed);
+      }
+
+      /// \brief Record a complete ("X") event covering a duration.
+      /// \param[in] _name Span name, e.g. a system or phase name.
+      /// \param[in] _start When the span began.
+      /// \param[in] _elapsed How long it lasted.
+      public: void AddCompleteEvent(const std::string &_name,
+          const std::chrono::steady_clock::time_point &_start,
+          const std::chrono::steady_clock::duration &_elapsed);
+
+      /// \brief Record an instant ("i") event at the current time.
+      /// \param[in] _name Event name.
+      public: void AddInstantEvent(const std::string &_name);
+
+      /// \brief A buffered trace event; serialized to JSON on Stop.
+      private: struct Event
+      {
+        /// \brief Span or event name.
+        std::string name;
+
+        /// \brief Chrome trace phase: 'X' (complete) or 'i' (instant).
+        char phase;
+
+        /// \brief Start time in microseconds since Start.
+        int64_t tsUs;
+
+        /// \brief Duration in microseconds; unused for instant events.
+        int64_t durUs;
+
+        /// \brief Hashed std::thread::id of the recording thread.
+        uint64_t tid;
+      };
+
+      /// \brief Whether tracing is active; checked lock-free at every
+      /// trace point.
+      private: std::atomic<bool> active{false};
+
+      /// \brief Protects the fields below. Taken only while tracing.
+      private: std::mutex mutex;
+
+      /// \brief Output file path given to Start.
+      private: std::string path;
+
+      /// \brief Time origin; event timestamps are relative to this.
+      private: std::chrono::steady_clock::time_point epoch;
+
+      /// \brief Buffered events, flushed to disk on Stop.
+      private: std::vector<Event> events;
+    };
+
+    /// \class ChromeTraceSpan ChromeTracer.hh
+    /// \brief RAII span: records a complete event covering its lifetime.
+    /// Does nothing when tracing is inactive.
+    class ChromeTraceSpan
+    {
+      /// \brief Constructor, starts the span if tracing is active.
+      /// \param[in] _name Span name.
+      public: explicit ChromeTraceSpan(const char *_name)
+        : name(_name), tracing(ChromeTracer::Instance().Active())
+      {
+        if (this->tracing)
+          this->start = std::chrono::steady_clock::now();
+      }
+
+      /// \brief Destructor, records the event.
+      public: ~ChromeTraceSpan()
+      {
+        if (this->tracing)
+        {
+          ChromeTracer::Instance().AddCompleteEvent(this->name,
+              this->start, std::chrono::steady_clock::now() - this->start);
+        }
+      }
+
+      /// \brief Span name.
+      private: const char *name;
+
+      /// \brief Whether tracing was active when the span started.
+      private: bool tracing;
+
+      /// \brief When the span started; unset when not tracing.
+      private: std::chrono::steady_clock::time_point start;
+    };
+    }
+  }
+}
+#endif
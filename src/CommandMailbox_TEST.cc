@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "gz/sim/CommandMailbox.hh"
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+TEST(CommandMailbox, PopOnEmptyLeavesValueUntouched)
+{
+  CommandMailbox<int> mailbox;
+  int value = 42;
+  EXPECT_FALSE(mailbox.Pop(value));
+  EXPECT_EQ(42, value);
+}
+
+/////////////////////////////////////////////////
+TEST(CommandMailbox, LatestValueWins)
+{
+  CommandMailbox<int> mailbox;
+  mailbox.Push(1);
+  mailbox.Push(2);
+  mailbox.Push(3);
+
+  int value = 0;
+  EXPECT_TRUE(mailbox.Pop(value));
+  EXPECT_EQ(3, value);
+
+  // Nothing new since the last Pop.
+  EXPECT_FALSE(mailbox.Pop(value));
+  EXPECT_EQ(3, value);
+
+  mailbox.Push(4);
+  EXPECT_TRUE(mailbox.Pop(value));
+  EXPECT_EQ(4, value);
+}
+
+/////////////////////////////////////////////////
+TEST(CommandMailbox, ConcurrentProducerConsumer)
+{
+  CommandMailbox<int> mailbox;
+  constexpr int kCount = 100000;
+
+  std::thread producer([&mailbox]
+      {
+        for (int i = 1; i <= kCount; ++i)
+          mailbox.Push(i);
+      });
+
+  // Values retrieved while the producer runs must never go backwards.
+  int lastSeen = 0;
+  while (lastSeen < kCount)
+  {
+    int value = 0;
+    if (mailbox.Pop(value))
+    {
+      EXPECT_GT(value, lastSeen);
+      lastSeen = value;
+    }
+  }
+
+  producer.join();
+  EXPECT_EQ(kCount, lastSeen);
+}
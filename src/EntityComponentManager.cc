@@ -16,19 +16,27 @@
 */
 
 #include "gz/sim/EntityComponentManager.hh"
+#include "ChromeTracer.hh"
 #include "EntityComponentManagerDiff.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
+#include <gz/common/Util.hh>
+#include <gz/common/WorkerPool.hh>
 #include <gz/math/graph/GraphAlgorithms.hh>
 
 #include "gz/sim/components/CanonicalLink.hh"
@@ -40,6 +48,7 @@
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/ParentLinkName.hh"
+#include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/Recreate.hh"
 #include "gz/sim/components/World.hh"
 
@@ -113,6 +122,17 @@ class gz::sim::EntityComponentManagerPrivate
   public: bool ComponentMarkedAsRemoved(const Entity _entity,
               const ComponentTypeId _typeId) const;
 
+  /// \brief Record that _entity's Name component now holds _name, replacing
+  /// any previous entry for _entity in the name index.
+  /// \param[in] _entity The entity.
+  /// \param[in] _name Current data of the entity's Name component.
+  public: void SetEntityName(const Entity _entity, const std::string &_name);
+
+  /// \brief Drop _entity from the name index, e.g. when its Name component
+  /// or the entity itself is removed.
+  /// \param[in] _entity The entity.
+  public: void ClearEntityName(const Entity _entity);
+
   /// \brief Set a cloned joint's parent or child link name.
   /// \param[in] _joint The cloned joint.
   /// \param[in] _originalLink The original joint's parent or child link.
@@ -148,6 +168,44 @@ class gz::sim::EntityComponentManagerPrivate
   public: std::unordered_map<ComponentTypeId, std::unordered_set<Entity>>
             oneTimeChangedComponents;
 
+  /// \brief Dense per-type bitsets of changed entities, supplementing the
+  /// hash based change tracking above. A set bit at index `entity` means the
+  /// entity's component of the keyed type changed (periodically or one-time)
+  /// since the last call to SetAllComponentsUnchanged. The bitsets allow
+  /// EachChanged to walk only the changed entities of a type without any
+  /// hash lookups.
+  public: std::unordered_map<ComponentTypeId, std::vector<uint64_t>>
+            changedBitsets;
+
+  /// \brief Set the bit of an entity in the changed bitset of a component
+  /// type, growing the bitset if needed.
+  /// \param[in] _entity The entity whose component changed.
+  /// \param[in] _type The type of the changed component.
+  public: void SetChangedBit(const Entity _entity,
+              const ComponentTypeId _type)
+  {
+    auto &bitset = this->changedBitsets[_type];
+    const std::size_t word = _entity / 64;
+    if (word >= bitset.size())
+      bitset.resize(word + 1, 0u);
+    bitset[word] |= 1ull << (_entity % 64);
+  }
+
+  /// \brief Clear the bit of an entity in the changed bitset of a component
+  /// type, if the bitset exists and covers the entity.
+  /// \param[in] _entity The entity.
+  /// \param[in] _type The component type.
+  public: void ClearChangedBit(const Entity _entity,
+              const ComponentTypeId _type)
+  {
+    auto iter = this->changedBitsets.find(_type);
+    if (iter == this->changedBitsets.end())
+      return;
+    const std::size_t word = _entity / 64;
+    if (word < iter->second.size())
+      iter->second[word] &= ~(1ull << (_entity % 64));
+  }
+
   /// \brief Entities that have just been created
   public: std::unordered_set<Entity> newlyCreatedEntities;
 
@@ -186,14 +244,106 @@ class gz::sim::EntityComponentManagerPrivate
   /// new entities to them or not.
   public: bool lockAddEntitiesToViews{false};
 
+  /// \brief True while a component creation batch is active. During a batch
+  /// the per-component view matching in CreateComponentImplementation is
+  /// skipped; the affected entities are recorded and matched against views
+  /// once when the batch ends.
+  public: bool componentBatchActive{false};
+
+  /// \brief Entities that had components created while the current batch was
+  /// active.
+  public: std::unordered_set<Entity> batchTouchedEntities;
+
+  /// \brief Total number of components created per type since construction.
+  /// Together with componentsRemoved this gives the churn rate per type.
+  public: std::unordered_map<ComponentTypeId, uint64_t> componentsCreated;
+
+  /// \brief Total number of components removed per type since construction,
+  /// including components removed together with their entity.
+  public: std::unordered_map<ComponentTypeId, uint64_t> componentsRemoved;
+
+  /// \brief Index of views by required component type. When a component is
+  /// added to or removed from an entity, only the views that require the
+  /// component's type have to be patched, so entity churn doesn't pay for
+  /// views that cannot be affected by the change.
+  public: mutable std::unordered_map<ComponentTypeId,
+          std::vector<detail::BaseView *>> viewsByComponent;
+
+  /// \brief Index of entities by the data of their Name component, so that
+  /// name lookups such as EntityByComponents(components::Name(...)) don't
+  /// have to scan every named entity. Kept in sync by the component
+  /// creation, removal and deserialization paths. A multimap because entity
+  /// names are only unique among siblings.
+  public: std::unordered_multimap<std::string, Entity> nameIndex;
+
+  /// \brief Reverse of nameIndex: the name each entity is currently indexed
+  /// under, so a rename can drop the old entry without a full scan.
+  public: std::unordered_map<Entity, std::string> indexedNames;
+
+  /// \brief Cache of world poses computed by WorldPose, each stamped with
+  /// the value of worldPoseCacheGeneration at computation time. Guarded by
+  /// worldPoseCacheMutex because systems call WorldPose from parallel
+  /// PostUpdate threads.
+  public: mutable std::unordered_map<Entity,
+          std::pair<uint64_t, math::Pose3d>> worldPoseCache;
+
+  /// \brief Generation counter for worldPoseCache. Bumping it invalidates
+  /// every cached world pose at once; entries are refreshed lazily by the
+  /// next WorldPose call. Atomic so the pose-change hot paths don't have
+  /// to take worldPoseCacheMutex.
+  public: std::atomic<uint64_t> worldPoseCacheGeneration{0};
+
+  /// \brief Mutex protecting worldPoseCache.
+  public: mutable std::mutex worldPoseCacheMutex;
+
+  /// \brief Worker pool backing EachParallel. Created on first use so that
+  /// managers which never iterate in parallel don't spawn threads, then
+  /// kept for the lifetime of the manager so repeated EachParallel calls
+  /// don't pay for thread creation and teardown. The pool itself is thread
+  /// safe; only its lazy creation needs eachParallelPoolMutex.
+  public: mutable std::unique_ptr<common::WorkerPool> eachParallelPool;
+
+  /// \brief Mutex protecting the creation of eachParallelPool.
+  public: mutable std::mutex eachParallelPoolMutex;
+
   /// \brief Cache of previously queried descendants. The key is the parent
   /// entity for which descendants were queried, and the value are all its
   /// descendants.
   public: mutable std::unordered_map<Entity, std::unordered_set<Entity>>
           descendantCache;
 
-  /// \brief Keep track of entities already used to ensure uniqueness.
-  public: uint64_t entityCount{0};
+  /// \brief Observers registered through OnComponentChange, keyed by
+  /// entity then component type, each holding the observer id and its
+  /// callback. Only touched from the thread calling SetChanged, like the
+  /// rest of the change tracking state.
+  public: std::unordered_map<Entity, std::unordered_map<ComponentTypeId,
+          std::vector<std::pair<uint64_t, std::function<void(Entity,
+          ComponentTypeId, ComponentState)>>>>> componentChangeObservers;
+
+  /// \brief Id handed to the next component change observer.
+  public: uint64_t nextComponentChangeObserverId{1u};
+
+  /// \brief Keep track of entities already used to ensure uniqueness. This
+  /// is atomic so that entity IDs can be allotted from concurrent system
+  /// callbacks without taking a lock.
+  public: std::atomic<uint64_t> entityCount{0};
+
+  /// \brief Whether IDs of removed entities are recycled by CreateEntity.
+  /// Recycling is opt-in via the GZ_SIM_ECM_RECYCLE_ENTITY_IDS environment
+  /// variable, since consumers that hold on to removed entity IDs (e.g.
+  /// across log seek operations) must not see them reappear.
+  public: bool recycleEntityIds{false};
+
+  /// \brief IDs of removed entities that are available for reuse. This
+  /// vector is only mutated in ProcessRemoveEntityRequests, which runs
+  /// serially at the end of a step; concurrent entity creators consume
+  /// entries lock-free by advancing `recycledIdsHead`.
+  public: std::vector<Entity> recycledIds;
+
+  /// \brief Index of the next entry of `recycledIds` to hand out. May
+  /// transiently exceed the vector's size; it is clamped and the consumed
+  /// prefix erased in ProcessRemoveEntityRequests.
+  public: std::atomic<std::size_t> recycledIdsHead{0};
 
   /// \brief Unordered map of removed components. The key is the entity to
   /// which belongs the component, and the value is a set of the component types
@@ -214,6 +364,19 @@ class gz::sim::EntityComponentManagerPrivate
            std::vector<std::unique_ptr<components::BaseComponent>>>
              componentStorage;
 
+  /// \brief Pool of recycled component instances, keyed by component type.
+  /// When an entity is removed, its component instances are parked here
+  /// instead of being destroyed, and reused for subsequent component
+  /// creations of the same type. This avoids one heap allocation per
+  /// component during spawn storms.
+  public: std::unordered_map<ComponentTypeId,
+           std::vector<std::unique_ptr<components::BaseComponent>>>
+             componentPool;
+
+  /// \brief Maximum number of recycled component instances kept per
+  /// component type in `componentPool`.
+  public: static constexpr std::size_t kComponentPoolMaxSize{4096};
+
   /// \brief A map that keeps track of where each type of component is
   /// located in the componentStorage vector. Since the componentStorage vector
   /// is of type BaseComponent, we need to keep track of which component type
@@ -285,12 +448,119 @@ class gz::sim::EntityComponentManagerPrivate
 
   /// \brief Set of entities that are prevented from removal.
   public: std::unordered_set<Entity> pinnedEntities;
+
+  /// \brief Recompute the archetype (set of component types) of an entity
+  /// and move the entity to the matching archetype bucket. Components that
+  /// are marked as removed are not part of an entity's archetype.
+  /// This is a no-op if the archetype index is disabled.
+  /// \param[in] _entity Entity whose archetype may have changed.
+  public: void UpdateArchetype(const Entity _entity);
+
+  /// \brief Remove an entity from the archetype index.
+  /// This is a no-op if the archetype index is disabled.
+  /// \param[in] _entity Entity to be removed from the index.
+  public: void RemoveFromArchetype(const Entity _entity);
+
+  /// \brief Whether the archetype index is enabled. When enabled, entities
+  /// are grouped into buckets keyed on their full set of component types so
+  /// that view construction and rebuilds only visit entities from matching
+  /// buckets instead of scanning every entity. The index is enabled by
+  /// setting the GZ_SIM_ECM_ARCHETYPE_STORAGE environment variable to a
+  /// non-empty value before the world is loaded.
+  public: bool useArchetypeIndex{false};
+
+  /// \brief Entities grouped by archetype. The key is the sorted set of
+  /// component types attached to the entities in the bucket (excluding
+  /// components marked as removed), and the value holds all entities that
+  /// currently have exactly that set of component types.
+  public: std::map<std::vector<ComponentTypeId>, std::unordered_set<Entity>>
+            archetypes;
+
+  /// \brief The archetype each entity currently belongs to. Used to locate
+  /// the entity's bucket in `archetypes` when the entity's component set
+  /// changes.
+  public: std::unordered_map<Entity, std::vector<ComponentTypeId>>
+            entityArchetype;
 };
 
 //////////////////////////////////////////////////
 EntityComponentManager::EntityComponentManager()
   : dataPtr(new EntityComponentManagerPrivate)
 {
+  std::string archetypeEnv;
+  if (common::env("GZ_SIM_ECM_ARCHETYPE_STORAGE", archetypeEnv) &&
+      !archetypeEnv.empty() && archetypeEnv != "0")
+  {
+    this->dataPtr->useArchetypeIndex = true;
+  }
+
+  std::string recycleEnv;
+  if (common::env("GZ_SIM_ECM_RECYCLE_ENTITY_IDS", recycleEnv) &&
+      !recycleEnv.empty() && recycleEnv != "0")
+  {
+    this->dataPtr->recycleEntityIds = true;
+  }
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::UpdateArchetype(const Entity _entity)
+{
+  if (!this->useArchetypeIndex)
+    return;
+
+  // Compute the entity's current archetype: all attached component types
+  // that are not marked as removed, in sorted order.
+  std::vector<ComponentTypeId> signature;
+  auto typeMapIter = this->componentTypeIndex.find(_entity);
+  if (typeMapIter != this->componentTypeIndex.end())
+  {
+    signature.reserve(typeMapIter->second.size());
+    for (const auto &[typeId, index] : typeMapIter->second)
+    {
+      if (!this->ComponentMarkedAsRemoved(_entity, typeId))
+        signature.push_back(typeId);
+    }
+    std::sort(signature.begin(), signature.end());
+  }
+
+  auto archetypeIter = this->entityArchetype.find(_entity);
+  if (archetypeIter != this->entityArchetype.end())
+  {
+    if (archetypeIter->second == signature)
+      return;
+
+    // Move the entity out of its old bucket.
+    auto bucketIter = this->archetypes.find(archetypeIter->second);
+    if (bucketIter != this->archetypes.end())
+    {
+      bucketIter->second.erase(_entity);
+      if (bucketIter->second.empty())
+        this->archetypes.erase(bucketIter);
+    }
+  }
+
+  this->archetypes[signature].insert(_entity);
+  this->entityArchetype[_entity] = std::move(signature);
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::RemoveFromArchetype(const Entity _entity)
+{
+  if (!this->useArchetypeIndex)
+    return;
+
+  auto archetypeIter = this->entityArchetype.find(_entity);
+  if (archetypeIter == this->entityArchetype.end())
+    return;
+
+  auto bucketIter = this->archetypes.find(archetypeIter->second);
+  if (bucketIter != this->archetypes.end())
+  {
+    bucketIter->second.erase(_entity);
+    if (bucketIter->second.empty())
+      this->archetypes.erase(bucketIter);
+  }
+  this->entityArchetype.erase(archetypeIter);
 }
 
 //////////////////////////////////////////////////
@@ -304,16 +574,23 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->entities = _from.entities;
   this->periodicChangedComponents = _from.periodicChangedComponents;
   this->oneTimeChangedComponents = _from.oneTimeChangedComponents;
+  this->changedBitsets = _from.changedBitsets;
   this->newlyCreatedEntities = _from.newlyCreatedEntities;
   this->toRemoveEntities = _from.toRemoveEntities;
   this->modifiedComponents = _from.modifiedComponents;
   this->removeAllEntities = _from.removeAllEntities;
   this->views.clear();
+  this->viewsByComponent.clear();
   this->lockAddEntitiesToViews = _from.lockAddEntitiesToViews;
   this->descendantCache.clear();
-  this->entityCount = _from.entityCount;
+  this->entityCount = _from.entityCount.load();
+  this->recycleEntityIds = _from.recycleEntityIds;
+  this->recycledIds = _from.recycledIds;
+  this->recycledIdsHead = _from.recycledIdsHead.load();
   this->removedComponents = _from.removedComponents;
   this->componentsMarkedAsRemoved = _from.componentsMarkedAsRemoved;
+  this->componentsCreated = _from.componentsCreated;
+  this->componentsRemoved = _from.componentsRemoved;
 
   for (const auto &[entity, comps] : _from.componentStorage)
   {
@@ -326,6 +603,12 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->componentTypeIndex = _from.componentTypeIndex;
   this->componentTypeIndexIterators.clear();
   this->componentTypeIndexDirty = true;
+  this->useArchetypeIndex = _from.useArchetypeIndex;
+  this->archetypes = _from.archetypes;
+  this->entityArchetype = _from.entityArchetype;
+  this->nameIndex = _from.nameIndex;
+  this->indexedNames = _from.indexedNames;
+  this->worldPoseCache.clear();
 
   // Not copying maps related to cloning since they are transient variables
   // that are used as return values of some member functions.
@@ -333,6 +616,54 @@ void EntityComponentManagerPrivate::CopyFrom(
   this->pinnedEntities = _from.pinnedEntities;
 }
 
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::SetEntityName(const Entity _entity,
+    const std::string &_name)
+{
+  auto prevIter = this->indexedNames.find(_entity);
+  if (prevIter != this->indexedNames.end())
+  {
+    if (prevIter->second == _name)
+      return;
+
+    auto range = this->nameIndex.equal_range(prevIter->second);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      if (it->second == _entity)
+      {
+        this->nameIndex.erase(it);
+        break;
+      }
+    }
+    prevIter->second = _name;
+  }
+  else
+  {
+    this->indexedNames[_entity] = _name;
+  }
+
+  this->nameIndex.insert({_name, _entity});
+}
+
+//////////////////////////////////////////////////
+void EntityComponentManagerPrivate::ClearEntityName(const Entity _entity)
+{
+  auto prevIter = this->indexedNames.find(_entity);
+  if (prevIter == this->indexedNames.end())
+    return;
+
+  auto range = this->nameIndex.equal_range(prevIter->second);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    if (it->second == _entity)
+    {
+      this->nameIndex.erase(it);
+      break;
+    }
+  }
+  this->indexedNames.erase(prevIter);
+}
+
 //////////////////////////////////////////////////
 size_t EntityComponentManager::EntityCount() const
 {
@@ -342,7 +673,22 @@ size_t EntityComponentManager::EntityCount() const
 /////////////////////////////////////////////////
 Entity EntityComponentManager::CreateEntity()
 {
-  Entity entity = ++this->dataPtr->entityCount;
+  if (ChromeTracer::Instance().Active())
+    ChromeTracer::Instance().AddInstantEvent("ECM::CreateEntity");
+
+  Entity entity = kNullEntity;
+
+  // Try to reuse the ID of a removed entity before allotting a new one.
+  // fetch_add makes each concurrent creator claim a distinct entry.
+  if (this->dataPtr->recycleEntityIds)
+  {
+    const auto idx = this->dataPtr->recycledIdsHead.fetch_add(1);
+    if (idx < this->dataPtr->recycledIds.size())
+      entity = this->dataPtr->recycledIds[idx];
+  }
+
+  if (kNullEntity == entity)
+    entity = ++this->dataPtr->entityCount;
 
   if (entity == std::numeric_limits<uint64_t>::max())
   {
@@ -387,6 +733,8 @@ Entity EntityComponentManagerPrivate::CreateEntityImplementation(Entity _entity)
       << "type index.\n";
   }
 
+  this->UpdateArchetype(_entity);
+
   return _entity;
 }
 
@@ -701,6 +1049,9 @@ void EntityComponentManagerPrivate::EraseEntityRecursive(Entity _entity,
 void EntityComponentManager::RequestRemoveEntity(Entity _entity,
     bool _recursive)
 {
+  if (ChromeTracer::Instance().Active())
+    ChromeTracer::Instance().AddInstantEvent("ECM::RequestRemoveEntity");
+
   // Store the to-be-removed entities in a temporary set so we can call
   // UpdateViews on each of them
   std::unordered_set<Entity> tmpToRemoveEntities;
@@ -754,7 +1105,15 @@ void EntityComponentManager::RequestRemoveEntities()
       std::lock_guard<std::mutex> lock(this->dataPtr->entityRemoveMutex);
       this->dataPtr->removeAllEntities = true;
     }
-    this->RebuildViews();
+
+    // Patch the views in place instead of rebuilding them: every entity that
+    // is currently in a view is now marked for removal.
+    for (auto &viewPair : this->dataPtr->views)
+    {
+      auto &view = viewPair.second.first;
+      for (const Entity entity : view->Entities())
+        view->MarkEntityToRemove(entity);
+    }
   }
   else
   {
@@ -793,6 +1152,7 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
 {
   GZ_PROFILE("EntityComponentManager::ProcessRemoveEntityRequests");
   std::lock_guard<std::mutex> lock(this->dataPtr->entityRemoveMutex);
+  std::vector<Entity> removedEntities;
   // Short-cut if erasing all entities
   if (this->dataPtr->removeAllEntities)
   {
@@ -800,15 +1160,39 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
     this->dataPtr->removeAllEntities = false;
     this->dataPtr->entities = EntityGraph();
     this->dataPtr->toRemoveEntities.clear();
+
+    // Account for the dropped components in the per-type removal totals.
+    for (const auto &[entity, components] : this->dataPtr->componentStorage)
+    {
+      for (const auto &comp : components)
+      {
+        if (nullptr == comp ||
+            this->dataPtr->ComponentMarkedAsRemoved(entity, comp->TypeId()))
+        {
+          continue;
+        }
+        ++this->dataPtr->componentsRemoved[comp->TypeId()];
+      }
+    }
     this->dataPtr->componentsMarkedAsRemoved.clear();
 
     // reset the entity component storage
     this->dataPtr->componentStorage.clear();
     this->dataPtr->componentTypeIndex.clear();
     this->dataPtr->componentTypeIndexDirty = true;
+    this->dataPtr->archetypes.clear();
+    this->dataPtr->entityArchetype.clear();
+    this->dataPtr->nameIndex.clear();
+    this->dataPtr->indexedNames.clear();
+    {
+      std::lock_guard<std::mutex> poseLock(
+          this->dataPtr->worldPoseCacheMutex);
+      this->dataPtr->worldPoseCache.clear();
+    }
 
     // All views are now invalid.
     this->dataPtr->views.clear();
+    this->dataPtr->viewsByComponent.clear();
   }
   else
   {
@@ -823,19 +1207,67 @@ void EntityComponentManager::ProcessRemoveEntityRequests()
       // Remove from graph
       this->dataPtr->entities.RemoveVertex(entity);
 
+      // Park the entity's component instances in the pool so they can be
+      // reused by subsequent component creations.
+      auto storageIter = this->dataPtr->componentStorage.find(entity);
+      if (storageIter != this->dataPtr->componentStorage.end())
+      {
+        for (auto &comp : storageIter->second)
+        {
+          if (nullptr == comp)
+            continue;
+          // Components already marked as removed were counted when
+          // RemoveComponent was called.
+          if (!this->dataPtr->ComponentMarkedAsRemoved(entity, comp->TypeId()))
+            ++this->dataPtr->componentsRemoved[comp->TypeId()];
+          auto &pool = this->dataPtr->componentPool[comp->TypeId()];
+          if (pool.size() <
+              EntityComponentManagerPrivate::kComponentPoolMaxSize)
+            pool.push_back(std::move(comp));
+        }
+      }
+
       this->dataPtr->componentsMarkedAsRemoved.erase(entity);
       this->dataPtr->componentStorage.erase(entity);
       this->dataPtr->componentTypeIndex.erase(entity);
       this->dataPtr->componentTypeIndexDirty = true;
+      this->dataPtr->RemoveFromArchetype(entity);
+      this->dataPtr->ClearEntityName(entity);
 
-      // Remove the entity from views.
+      removedEntities.push_back(entity);
+    }
+    // Clear the set of entities to remove.
+    this->dataPtr->toRemoveEntities.clear();
+
+    // Remove the whole batch from each view in a single pass rather than
+    // visiting every view once per entity.
+    if (!removedEntities.empty())
+    {
       for (auto &view : this->dataPtr->views)
       {
-        view.second.first->RemoveEntity(entity);
+        view.second.first->RemoveEntities(removedEntities);
       }
     }
-    // Clear the set of entities to remove.
-    this->dataPtr->toRemoveEntities.clear();
+
+    // Drop the removed entities' cached world poses. Remaining entities
+    // keep theirs, since an entity cannot outlive one of its ancestors.
+    std::lock_guard<std::mutex> poseLock(this->dataPtr->worldPoseCacheMutex);
+    for (const Entity entity : removedEntities)
+      this->dataPtr->worldPoseCache.erase(entity);
+  }
+
+  // Maintain the recycled entity ID freelist. This runs serially, so it is
+  // safe to compact the vector and reset the consumption index here.
+  if (this->dataPtr->recycleEntityIds)
+  {
+    const auto consumed = std::min<std::size_t>(
+        this->dataPtr->recycledIdsHead.load(),
+        this->dataPtr->recycledIds.size());
+    this->dataPtr->recycledIds.erase(this->dataPtr->recycledIds.begin(),
+        this->dataPtr->recycledIds.begin() + consumed);
+    for (const Entity entity : removedEntities)
+      this->dataPtr->recycledIds.push_back(entity);
+    this->dataPtr->recycledIdsHead = 0;
   }
 
   // Reset descendants cache
@@ -867,14 +1299,24 @@ bool EntityComponentManager::RemoveComponent(
       this->dataPtr->periodicChangedComponents.erase(periodicIter);
   }
 
+  this->dataPtr->ClearChangedBit(_entity, _typeId);
+
   auto compPtr = this->ComponentImplementation(_entity, _typeId);
   if (compPtr)
   {
     this->dataPtr->componentsMarkedAsRemoved[_entity].insert(_typeId);
+    ++this->dataPtr->componentsRemoved[_typeId];
 
-    // update views to reflect the component removal
-    for (auto &viewPair : this->dataPtr->views)
-      viewPair.second.first->NotifyComponentRemoval(_entity, _typeId);
+    // update views to reflect the component removal. Only views that require
+    // the removed component type are affected.
+    auto viewsIter = this->dataPtr->viewsByComponent.find(_typeId);
+    if (viewsIter != this->dataPtr->viewsByComponent.end())
+    {
+      for (auto &view : viewsIter->second)
+        view->NotifyComponentRemoval(_entity, _typeId);
+    }
+
+    this->dataPtr->UpdateArchetype(_entity);
   }
 
   this->dataPtr->AddModifiedComponent(_entity);
@@ -885,6 +1327,15 @@ bool EntityComponentManager::RemoveComponent(
     this->dataPtr->removedComponents[_entity].insert(_typeId);
   }
 
+  if (_typeId == components::Name::typeId)
+    this->dataPtr->ClearEntityName(_entity);
+
+  if (_typeId == components::Pose::typeId ||
+      _typeId == components::ParentEntity::typeId)
+  {
+    ++this->dataPtr->worldPoseCacheGeneration;
+  }
+
   return true;
 }
 
@@ -1053,6 +1504,10 @@ Entity EntityComponentManager::ParentEntity(const Entity _entity) const
 bool EntityComponentManager::SetParentEntity(const Entity _child,
     const Entity _parent)
 {
+  // Reparenting changes the frame every descendant's world pose is
+  // composed in.
+  ++this->dataPtr->worldPoseCacheGeneration;
+
   // Remove current parent(s)
   auto parents = this->Entities().AdjacentsTo(_child);
   for (const auto &parent : parents)
@@ -1072,6 +1527,58 @@ bool EntityComponentManager::SetParentEntity(const Entity _child,
   return (math::graph::kNullId != edge.Id());
 }
 
+/////////////////////////////////////////////////
+math::Pose3d EntityComponentManager::WorldPose(const Entity _entity) const
+{
+  auto poseComp = this->Component<components::Pose>(_entity);
+  if (nullptr == poseComp)
+    return math::Pose3d();
+
+  const uint64_t generation = this->dataPtr->worldPoseCacheGeneration;
+
+  // Walk up the parent chain until an entity without a Pose component or
+  // with an up-to-date cached world pose is found.
+  math::Pose3d result;
+  bool haveBase{false};
+  std::vector<Entity> chain;
+  Entity current = _entity;
+  while (current != kNullEntity)
+  {
+    auto currentPose = this->Component<components::Pose>(current);
+    if (nullptr == currentPose)
+      break;
+
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->worldPoseCacheMutex);
+      auto iter = this->dataPtr->worldPoseCache.find(current);
+      if (iter != this->dataPtr->worldPoseCache.end() &&
+          iter->second.first == generation)
+      {
+        result = iter->second.second;
+        haveBase = true;
+        break;
+      }
+    }
+
+    chain.push_back(current);
+    auto parentComp = this->Component<components::ParentEntity>(current);
+    current = parentComp ? parentComp->Data() : kNullEntity;
+  }
+
+  // Compose world poses top-down, caching every entity on the way so that
+  // siblings sharing the same ancestors reuse them.
+  std::lock_guard<std::mutex> lock(this->dataPtr->worldPoseCacheMutex);
+  for (auto iter = chain.rbegin(); iter != chain.rend(); ++iter)
+  {
+    const auto &localPose = this->Component<components::Pose>(*iter)->Data();
+    result = haveBase ? result * localPose : localPose;
+    haveBase = true;
+    this->dataPtr->worldPoseCache[*iter] = {generation, result};
+  }
+
+  return result;
+}
+
 /////////////////////////////////////////////////
 bool EntityComponentManager::CreateComponentImplementation(
     const Entity _entity, const ComponentTypeId _componentTypeId,
@@ -1103,6 +1610,7 @@ bool EntityComponentManager::CreateComponentImplementation(
 
   this->dataPtr->AddModifiedComponent(_entity);
   this->dataPtr->oneTimeChangedComponents[_componentTypeId].insert(_entity);
+  this->dataPtr->SetChangedBit(_entity, _componentTypeId);
 
   // make sure the entity exists
   auto typeMapIter = this->dataPtr->componentTypeIndex.find(_entity);
@@ -1123,8 +1631,26 @@ bool EntityComponentManager::CreateComponentImplementation(
     return false;
   }
 
-  // Instantiate the new component.
-  auto newComp = components::Factory::Instance()->New(_componentTypeId, _data);
+  // Instantiate the new component, reusing a recycled instance of the same
+  // type if one is available.
+  std::unique_ptr<components::BaseComponent> newComp;
+  auto poolIter = this->dataPtr->componentPool.find(_componentTypeId);
+  if (poolIter != this->dataPtr->componentPool.end() &&
+      !poolIter->second.empty())
+  {
+    newComp = std::move(poolIter->second.back());
+    poolIter->second.pop_back();
+    if (nullptr == _data || !newComp->CopyDataFrom(*_data))
+    {
+      // The recycled instance couldn't take the new data, so fall back to
+      // allocating a fresh component.
+      newComp = components::Factory::Instance()->New(_componentTypeId, _data);
+    }
+  }
+  else
+  {
+    newComp = components::Factory::Instance()->New(_componentTypeId, _data);
+  }
 
   const auto compIdxIter = typeMapIter->second.find(_componentTypeId);
   // If entity has never had a component of this type
@@ -1134,13 +1660,28 @@ bool EntityComponentManager::CreateComponentImplementation(
     entityCompIter->second.push_back(std::move(newComp));
     this->dataPtr->componentTypeIndex[_entity][_componentTypeId] = vectorIdx;
     this->dataPtr->componentTypeIndexDirty = true;
+    ++this->dataPtr->componentsCreated[_componentTypeId];
 
     updateData = false;
-    for (auto &viewPair : this->dataPtr->views)
+    if (this->dataPtr->componentBatchActive)
     {
-      auto &view = viewPair.second.first;
-      if (this->EntityMatches(_entity, view->ComponentTypes()))
-        view->MarkEntityToAdd(_entity, this->IsNewEntity(_entity));
+      // View matching is deferred to EndComponentBatch, so creating many
+      // components on the same entity only pays for one view pass.
+      this->dataPtr->batchTouchedEntities.insert(_entity);
+    }
+    else
+    {
+      // Only views that require the added component type can gain this
+      // entity, so patch those views instead of checking every view.
+      auto viewsIter = this->dataPtr->viewsByComponent.find(_componentTypeId);
+      if (viewsIter != this->dataPtr->viewsByComponent.end())
+      {
+        for (auto &view : viewsIter->second)
+        {
+          if (this->EntityMatches(_entity, view->ComponentTypes()))
+            view->MarkEntityToAdd(_entity, this->IsNewEntity(_entity));
+        }
+      }
     }
   }
   else
@@ -1166,16 +1707,23 @@ bool EntityComponentManager::CreateComponentImplementation(
     else if (this->dataPtr->ComponentMarkedAsRemoved(_entity, _componentTypeId))
     {
       this->dataPtr->componentsMarkedAsRemoved[_entity].erase(_componentTypeId);
+      ++this->dataPtr->componentsCreated[_componentTypeId];
 
-      for (auto &viewPair : this->dataPtr->views)
+      // Only views that require the re-added component type are affected.
+      auto viewsIter = this->dataPtr->viewsByComponent.find(_componentTypeId);
+      if (viewsIter != this->dataPtr->viewsByComponent.end())
       {
-        viewPair.second.first->NotifyComponentAddition(_entity,
-            this->IsNewEntity(_entity), _componentTypeId);
+        for (auto &view : viewsIter->second)
+        {
+          view->NotifyComponentAddition(_entity,
+              this->IsNewEntity(_entity), _componentTypeId);
+        }
       }
     }
   }
 
   this->dataPtr->createdCompTypes.insert(_componentTypeId);
+  this->dataPtr->UpdateArchetype(_entity);
 
   // If the component is a components::ParentEntity, then make sure to
   // update the entities graph.
@@ -1185,6 +1733,23 @@ bool EntityComponentManager::CreateComponentImplementation(
     this->SetParentEntity(_entity, parentComp->Data());
   }
 
+  // If the component is a components::Name, keep the name index in step.
+  // The value is read from _data because, when the component already
+  // existed, the caller updates the stored component only after this call
+  // returns.
+  if (_componentTypeId == components::Name::typeId)
+  {
+    this->dataPtr->SetEntityName(_entity,
+        static_cast<const components::Name *>(_data)->Data());
+  }
+
+  // Pose and parenting changes invalidate every cached world pose.
+  if (_componentTypeId == components::Pose::typeId ||
+      _componentTypeId == components::ParentEntity::typeId)
+  {
+    ++this->dataPtr->worldPoseCacheGeneration;
+  }
+
   return updateData;
 }
 
@@ -1216,6 +1781,82 @@ bool EntityComponentManager::EntityMatches(Entity _entity,
   return true;
 }
 
+/////////////////////////////////////////////////
+void EntityComponentManager::BeginComponentBatch()
+{
+  if (this->dataPtr->componentBatchActive)
+  {
+    gzwarn << "BeginComponentBatch called while a component batch is already "
+           << "active. The batches will be merged." << std::endl;
+    return;
+  }
+  this->dataPtr->componentBatchActive = true;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::EndComponentBatch()
+{
+  if (!this->dataPtr->componentBatchActive)
+  {
+    gzwarn << "EndComponentBatch called without a matching "
+           << "BeginComponentBatch." << std::endl;
+    return;
+  }
+  this->dataPtr->componentBatchActive = false;
+  this->FlushComponentBatch();
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::FlushComponentBatch() const
+{
+  // Match each touched entity against the views once, now that all of its
+  // components have been created.
+  for (const Entity entity : this->dataPtr->batchTouchedEntities)
+  {
+    for (auto &viewPair : this->dataPtr->views)
+    {
+      auto &view = viewPair.second.first;
+      if (this->EntityMatches(entity, view->ComponentTypes()))
+        view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+    }
+  }
+  this->dataPtr->batchTouchedEntities.clear();
+}
+
+/////////////////////////////////////////////////
+std::vector<Entity> EntityComponentManager::EntitiesMatching(
+    const std::set<ComponentTypeId> &_types) const
+{
+  std::vector<Entity> result;
+
+  if (this->dataPtr->useArchetypeIndex)
+  {
+    // Only visit archetype buckets whose component set is a superset of
+    // _types. All entities in a matching bucket match by construction, since
+    // components marked as removed are excluded from an entity's archetype.
+    for (const auto &[signature, entities] : this->dataPtr->archetypes)
+    {
+      if (signature.size() < _types.size())
+        continue;
+
+      if (!std::includes(signature.begin(), signature.end(),
+            _types.begin(), _types.end()))
+        continue;
+
+      result.insert(result.end(), entities.begin(), entities.end());
+    }
+    return result;
+  }
+
+  for (const auto &vertex : this->dataPtr->entities.Vertices())
+  {
+    Entity entity = vertex.first;
+    if (this->EntityMatches(entity, _types))
+      result.push_back(entity);
+  }
+  return result;
+}
+
 /////////////////////////////////////////////////
 const components::BaseComponent
     *EntityComponentManager::ComponentImplementation(
@@ -1234,6 +1875,13 @@ const components::BaseComponent
     return nullptr;
 
   // get the pointer to the component
+#ifdef GZ_SIM_UNCHECKED
+  // Internal consistency checks compiled out: the entity is in
+  // componentTypeIndex, so its storage entry and the component instance
+  // must exist.
+  auto compPtr = this->dataPtr->componentStorage.find(_entity)
+      ->second[compIdxIter->second].get();
+#else
   const auto compVecIter = this->dataPtr->componentStorage.find(_entity);
   if (compVecIter == this->dataPtr->componentStorage.end())
   {
@@ -1252,6 +1900,7 @@ const components::BaseComponent
       << std::endl;
     return nullptr;
   }
+#endif
 
   // Return component if not marked as removed.
   if (!this->dataPtr->ComponentMarkedAsRemoved(_entity, _type))
@@ -1288,6 +1937,14 @@ const EntityGraph &EntityComponentManager::Entities() const
 std::pair<detail::BaseView *, std::mutex *> EntityComponentManager::FindView(
     const std::vector<ComponentTypeId> &_types) const
 {
+  // Views must reflect components created earlier in an active batch, so
+  // flush the pending entities before handing out a view.
+  if (this->dataPtr->componentBatchActive &&
+      !this->dataPtr->batchTouchedEntities.empty())
+  {
+    this->FlushComponentBatch();
+  }
+
   std::lock_guard<std::mutex> lockViews(this->dataPtr->viewsMutex);
   std::pair<detail::BaseView *, std::mutex *> viewMutexPair(nullptr, nullptr);
   auto iter = this->dataPtr->views.find(_types);
@@ -1307,10 +1964,31 @@ detail::BaseView *EntityComponentManager::AddView(
   // If the view already exists, then the map will return the iterator to
   // the location that prevented the insertion.
   std::lock_guard<std::mutex> lockViews(this->dataPtr->viewsMutex);
-  auto iter = this->dataPtr->views.insert(std::make_pair(_types,
+  auto result = this->dataPtr->views.insert(std::make_pair(_types,
         std::make_pair(std::move(_view),
-          std::make_unique<std::mutex>()))).first;
-  return iter->second.first.get();
+          std::make_unique<std::mutex>())));
+  auto *viewPtr = result.first->second.first.get();
+  if (result.second)
+  {
+    for (const auto &typeId : viewPtr->ComponentTypes())
+      this->dataPtr->viewsByComponent[typeId].push_back(viewPtr);
+  }
+  return viewPtr;
+}
+
+//////////////////////////////////////////////////
+common::WorkerPool &EntityComponentManager::EachParallelWorkerPool() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->eachParallelPoolMutex);
+  if (nullptr == this->dataPtr->eachParallelPool)
+  {
+    // Size the pool like the range partitioning does, so a limit set with
+    // GZ_SIM_ECM_THREAD_COUNT also bounds the number of pool threads.
+    this->dataPtr->eachParallelPool = std::make_unique<common::WorkerPool>(
+        static_cast<unsigned int>(detail::EachParallelThreadCount(
+            std::numeric_limits<std::size_t>::max())));
+  }
+  return *this->dataPtr->eachParallelPool;
 }
 
 //////////////////////////////////////////////////
@@ -1324,18 +2002,14 @@ void EntityComponentManager::RebuildViews()
 
     // Add all the entities that match the component types to the
     // view.
-    for (const auto &vertex : this->dataPtr->entities.Vertices())
+    for (const Entity entity : this->EntitiesMatching(view->ComponentTypes()))
     {
-      Entity entity = vertex.first;
-      if (this->EntityMatches(entity, view->ComponentTypes()))
-      {
-        view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
+      view->MarkEntityToAdd(entity, this->IsNewEntity(entity));
 
-        // If there is a request to delete this entity, update the view as
-        // well
-        if (this->IsMarkedForRemoval(entity))
-          view->MarkEntityToRemove(entity);
-      }
+      // If there is a request to delete this entity, update the view as
+      // well
+      if (this->IsMarkedForRemoval(entity))
+        view->MarkEntityToRemove(entity);
     }
   }
 }
@@ -1585,6 +2259,7 @@ void EntityComponentManager::AddEntityToMessage(msgs::SerializedStateMap &_msg,
 //////////////////////////////////////////////////
 msgs::SerializedState EntityComponentManager::ChangedState() const
 {
+  ChromeTraceSpan traceSpan{"ECM::ChangedState"};
   msgs::SerializedState stateMsg;
 
   // New entities
@@ -1612,6 +2287,7 @@ msgs::SerializedState EntityComponentManager::ChangedState() const
 void EntityComponentManager::ChangedState(
     msgs::SerializedStateMap &_state) const
 {
+  ChromeTraceSpan traceSpan{"ECM::ChangedState"};
   // New entities
   for (const auto &entity : this->dataPtr->newlyCreatedEntities)
   {
@@ -1682,6 +2358,7 @@ msgs::SerializedState EntityComponentManager::State(
     const std::unordered_set<Entity> &_entities,
     const std::unordered_set<ComponentTypeId> &_types) const
 {
+  ChromeTraceSpan traceSpan{"ECM::State"};
   msgs::SerializedState stateMsg;
   for (const auto &it : this->dataPtr->componentTypeIndex)
   {
@@ -1704,6 +2381,7 @@ void EntityComponentManager::State(
     const std::unordered_set<ComponentTypeId> &_types,
     bool _full) const
 {
+  ChromeTraceSpan traceSpan{"ECM::State"};
   std::mutex stateMapMutex;
   std::vector<std::thread> workers;
 
@@ -1881,6 +2559,12 @@ void EntityComponentManager::SetState(
         std::istringstream istr(compMsg.component());
         comp->Deserialize(istr);
         this->dataPtr->AddModifiedComponent(entity);
+
+        // Deserializing may have renamed or moved the entity in place.
+        if (type == components::Name::typeId)
+          this->RefreshNameIndex(entity);
+        if (type == components::Pose::typeId)
+          ++this->dataPtr->worldPoseCacheGeneration;
       }
     }
   }
@@ -2013,6 +2697,226 @@ void EntityComponentManager::SetAllComponentsUnchanged()
   this->dataPtr->periodicChangedComponents.clear();
   this->dataPtr->oneTimeChangedComponents.clear();
   this->dataPtr->modifiedComponents.clear();
+
+  // Zero the changed bitsets, keeping their allocations for the next step.
+  for (auto &[typeId, bitset] : this->dataPtr->changedBitsets)
+    std::fill(bitset.begin(), bitset.end(), 0u);
+}
+
+/////////////////////////////////////////////////
+const std::vector<uint64_t> *EntityComponentManager::ChangedBitset(
+    const ComponentTypeId _typeId) const
+{
+  auto iter = this->dataPtr->changedBitsets.find(_typeId);
+  if (iter == this->dataPtr->changedBitsets.end())
+    return nullptr;
+  return &iter->second;
+}
+
+namespace
+{
+/////////////////////////////////////////////////
+/// \brief Append an unsigned integer to a raw state buffer.
+/// \param[in, out] _buffer Buffer to append to.
+/// \param[in] _value Value to append.
+template <typename T>
+void AppendRaw(std::vector<char> &_buffer, const T _value)
+{
+  const auto offset = _buffer.size();
+  _buffer.resize(offset + sizeof(T));
+  std::memcpy(_buffer.data() + offset, &_value, sizeof(T));
+}
+
+/////////////////////////////////////////////////
+/// \brief Read an unsigned integer from a raw state buffer.
+/// \param[in] _buffer Buffer to read from.
+/// \param[in, out] _offset Read position, advanced past the value.
+/// \param[out] _value Value that was read.
+/// \return True if the buffer held enough bytes, false otherwise.
+template <typename T>
+bool ReadRaw(const std::vector<char> &_buffer, std::size_t &_offset, T &_value)
+{
+  if (_offset + sizeof(T) > _buffer.size())
+    return false;
+  std::memcpy(&_value, _buffer.data() + _offset, sizeof(T));
+  _offset += sizeof(T);
+  return true;
+}
+
+/// \brief Version of the raw binary state format produced by RawState.
+constexpr uint16_t kRawStateVersion{1};
+}
+
+/////////////////////////////////////////////////
+std::vector<char> EntityComponentManager::RawState(
+    const std::unordered_set<Entity> &_entities,
+    const std::unordered_set<ComponentTypeId> &_types) const
+{
+  GZ_PROFILE("EntityComponentManager::RawState");
+  std::vector<char> buffer;
+  AppendRaw(buffer, kRawStateVersion);
+
+  uint64_t entityCount = 0;
+  const auto countOffset = buffer.size();
+  AppendRaw(buffer, entityCount);
+
+  for (const auto &[entity, typeMap] : this->dataPtr->componentTypeIndex)
+  {
+    if (!_entities.empty() && _entities.find(entity) == _entities.end())
+      continue;
+
+    AppendRaw(buffer, static_cast<uint64_t>(entity));
+
+    uint32_t compCount = 0;
+    const auto compCountOffset = buffer.size();
+    AppendRaw(buffer, compCount);
+
+    for (const auto &[typeId, index] : typeMap)
+    {
+      if (!_types.empty() && _types.find(typeId) == _types.end())
+        continue;
+      if (this->dataPtr->ComponentMarkedAsRemoved(entity, typeId))
+        continue;
+
+      auto comp = this->ComponentImplementation(entity, typeId);
+      if (nullptr == comp)
+        continue;
+
+      std::ostringstream ostr;
+      comp->Serialize(ostr);
+      const std::string payload = ostr.str();
+
+      AppendRaw(buffer, static_cast<uint64_t>(typeId));
+      AppendRaw(buffer, static_cast<uint32_t>(payload.size()));
+      buffer.insert(buffer.end(), payload.begin(), payload.end());
+      ++compCount;
+    }
+
+    std::memcpy(buffer.data() + compCountOffset, &compCount,
+        sizeof(compCount));
+    ++entityCount;
+  }
+
+  std::memcpy(buffer.data() + countOffset, &entityCount, sizeof(entityCount));
+  return buffer;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::SetRawState(const std::vector<char> &_buffer)
+{
+  GZ_PROFILE("EntityComponentManager::SetRawState");
+  std::size_t offset = 0;
+
+  uint16_t version{0};
+  if (!ReadRaw(_buffer, offset, version) || version != kRawStateVersion)
+  {
+    gzerr << "Failed to set raw ECM state: unsupported format version ["
+          << version << "]." << std::endl;
+    return;
+  }
+
+  uint64_t entityCount{0};
+  if (!ReadRaw(_buffer, offset, entityCount))
+  {
+    gzerr << "Failed to set raw ECM state: truncated buffer." << std::endl;
+    return;
+  }
+
+  for (uint64_t e = 0; e < entityCount; ++e)
+  {
+    uint64_t entityId{0};
+    uint32_t compCount{0};
+    if (!ReadRaw(_buffer, offset, entityId) ||
+        !ReadRaw(_buffer, offset, compCount))
+    {
+      gzerr << "Failed to set raw ECM state: truncated buffer." << std::endl;
+      return;
+    }
+
+    const Entity entity{entityId};
+
+    // Create entity if it doesn't exist. Keep the id counter ahead of the
+    // restored ids so entities created afterwards don't collide with them.
+    if (!this->HasEntity(entity))
+    {
+      this->dataPtr->CreateEntityImplementation(entity);
+      this->dataPtr->entityCount =
+          std::max(this->dataPtr->entityCount, static_cast<uint64_t>(entity));
+    }
+
+    for (uint32_t c = 0; c < compCount; ++c)
+    {
+      uint64_t typeId{0};
+      uint32_t payloadSize{0};
+      if (!ReadRaw(_buffer, offset, typeId) ||
+          !ReadRaw(_buffer, offset, payloadSize) ||
+          offset + payloadSize > _buffer.size())
+      {
+        gzerr << "Failed to set raw ECM state: truncated buffer." << std::endl;
+        return;
+      }
+
+      const std::string payload(_buffer.data() + offset, payloadSize);
+      offset += payloadSize;
+
+      // Components which haven't been registered in this process can't be
+      // deserialized.
+      if (!components::Factory::Instance()->HasType(typeId))
+      {
+        static std::unordered_set<ComponentTypeId> printedComps;
+        if (printedComps.find(typeId) == printedComps.end())
+        {
+          printedComps.insert(typeId);
+          gzwarn << "Component type [" << typeId << "] has not been "
+                  << "registered in this process, so it can't be deserialized."
+                  << std::endl;
+        }
+        continue;
+      }
+
+      // Get Component
+      auto comp = this->ComponentImplementation(entity, typeId);
+
+      // Create if new
+      if (nullptr == comp)
+      {
+        auto newComp = components::Factory::Instance()->New(typeId);
+        if (nullptr == newComp)
+        {
+          gzerr << "Failed to create component type [" << typeId << "]"
+                << std::endl;
+          continue;
+        }
+
+        std::istringstream istr(payload);
+        newComp->Deserialize(istr);
+
+        auto updateData =
+          this->CreateComponentImplementation(entity, typeId, newComp.get());
+        if (updateData)
+        {
+          // Set comp so we deserialize the data below again
+          comp = this->ComponentImplementation(entity, typeId);
+        }
+      }
+
+      // Update component value
+      if (comp)
+      {
+        std::istringstream istr(payload);
+        comp->Deserialize(istr);
+        this->SetChanged(entity, typeId, ComponentState::OneTimeChange);
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::SetChanged(const std::vector<
+    std::tuple<Entity, ComponentTypeId, sim::ComponentState>> &_changes)
+{
+  for (const auto &[entity, type, state] : _changes)
+    this->SetChanged(entity, type, state);
 }
 
 /////////////////////////////////////////////////
@@ -2030,12 +2934,23 @@ void EntityComponentManager::SetChanged(
       this->dataPtr->ComponentMarkedAsRemoved(_entity, _type))
     return;
 
+  // A changed Name component may have been renamed in place, e.g. when a
+  // state message is deserialized into it; keep the name index in step.
+  if (_type == components::Name::typeId)
+    this->RefreshNameIndex(_entity);
+
+  // A changed Pose invalidates the cached world poses, which are refreshed
+  // lazily by the next WorldPose call.
+  if (_type == components::Pose::typeId)
+    ++this->dataPtr->worldPoseCacheGeneration;
+
   if (_c == ComponentState::PeriodicChange)
   {
     this->dataPtr->periodicChangedComponents[_type].insert(_entity);
     auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
     if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
       oneTimeIter->second.erase(_entity);
+    this->dataPtr->SetChangedBit(_entity, _type);
   }
   else if (_c == ComponentState::OneTimeChange)
   {
@@ -2043,6 +2958,7 @@ void EntityComponentManager::SetChanged(
     if (periodicIter != this->dataPtr->periodicChangedComponents.end())
       periodicIter->second.erase(_entity);
     this->dataPtr->oneTimeChangedComponents[_type].insert(_entity);
+    this->dataPtr->SetChangedBit(_entity, _type);
   }
   else
   {
@@ -2052,15 +2968,109 @@ void EntityComponentManager::SetChanged(
     auto oneTimeIter = this->dataPtr->oneTimeChangedComponents.find(_type);
     if (oneTimeIter != this->dataPtr->oneTimeChangedComponents.end())
       oneTimeIter->second.erase(_entity);
+    this->dataPtr->ClearChangedBit(_entity, _type);
 
     // the component state is flagged as no change, so don't mark the
     // corresponding entity as one with a modified component
     return;
   }
 
+  // Targeted observers: cost is one lookup plus the observers registered
+  // on exactly this entity and component.
+  if (!this->dataPtr->componentChangeObservers.empty())
+  {
+    auto obsEntityIter = this->dataPtr->componentChangeObservers.find(_entity);
+    if (obsEntityIter != this->dataPtr->componentChangeObservers.end())
+    {
+      auto obsTypeIter = obsEntityIter->second.find(_type);
+      if (obsTypeIter != obsEntityIter->second.end())
+      {
+        for (const auto &[observerId, callback] : obsTypeIter->second)
+          callback(_entity, _type, _c);
+      }
+    }
+  }
+
   this->dataPtr->AddModifiedComponent(_entity);
 }
 
+/////////////////////////////////////////////////
+uint64_t EntityComponentManager::OnComponentChange(
+    const Entity _entity, const ComponentTypeId _typeId,
+    std::function<void(Entity, ComponentTypeId,
+        sim::ComponentState)> _callback)
+{
+  const auto observerId = this->dataPtr->nextComponentChangeObserverId++;
+  this->dataPtr->componentChangeObservers[_entity][_typeId].emplace_back(
+      observerId, std::move(_callback));
+  return observerId;
+}
+
+/////////////////////////////////////////////////
+bool EntityComponentManager::RemoveComponentChangeObserver(
+    const uint64_t _observerId)
+{
+  for (auto entityIter = this->dataPtr->componentChangeObservers.begin();
+       entityIter != this->dataPtr->componentChangeObservers.end();
+       ++entityIter)
+  {
+    for (auto typeIter = entityIter->second.begin();
+         typeIter != entityIter->second.end(); ++typeIter)
+    {
+      auto &observers = typeIter->second;
+      for (auto obsIter = observers.begin(); obsIter != observers.end();
+           ++obsIter)
+      {
+        if (obsIter->first != _observerId)
+          continue;
+
+        observers.erase(obsIter);
+        if (observers.empty())
+          entityIter->second.erase(typeIter);
+        if (entityIter->second.empty())
+          this->dataPtr->componentChangeObservers.erase(entityIter);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/////////////////////////////////////////////////
+void EntityComponentManager::RefreshNameIndex(const Entity _entity) const
+{
+  auto nameComp = this->Component<components::Name>(_entity);
+  if (nameComp)
+    this->dataPtr->SetEntityName(_entity, nameComp->Data());
+  else
+    this->dataPtr->ClearEntityName(_entity);
+}
+
+/////////////////////////////////////////////////
+std::vector<Entity> EntityComponentManager::EntitiesByNameIndex(
+    const std::string &_name) const
+{
+  std::vector<Entity> result;
+  std::vector<Entity> stale;
+  auto range = this->dataPtr->nameIndex.equal_range(_name);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    auto nameComp = this->Component<components::Name>(it->second);
+    if (nameComp && nameComp->Data() == _name)
+      result.push_back(it->second);
+    else
+      stale.push_back(it->second);
+  }
+
+  // Entries can only go stale if a Name component was mutated through a raw
+  // component pointer without notifying the ECM; repair them here so the
+  // cost is paid when it actually happened, not on every lookup.
+  for (const Entity entity : stale)
+    this->RefreshNameIndex(entity);
+
+  return result;
+}
+
 /////////////////////////////////////////////////
 std::unordered_set<ComponentTypeId> EntityComponentManager::ComponentTypes(
     const Entity _entity) const
@@ -2079,6 +3089,50 @@ std::unordered_set<ComponentTypeId> EntityComponentManager::ComponentTypes(
   return result;
 }
 
+/////////////////////////////////////////////////
+std::map<ComponentTypeId, ComponentTypeStats>
+    EntityComponentManager::ComponentStats() const
+{
+  std::map<ComponentTypeId, ComponentTypeStats> stats;
+
+  for (const auto &[entity, components] : this->dataPtr->componentStorage)
+  {
+    for (const auto &comp : components)
+    {
+      if (nullptr == comp ||
+          this->dataPtr->ComponentMarkedAsRemoved(entity, comp->TypeId()))
+      {
+        continue;
+      }
+      auto &typeStats = stats[comp->TypeId()];
+      ++typeStats.count;
+      typeStats.bytes += comp->SizeOf();
+    }
+  }
+
+  for (const auto &[typeId, created] : this->dataPtr->componentsCreated)
+    stats[typeId].created = created;
+  for (const auto &[typeId, removed] : this->dataPtr->componentsRemoved)
+    stats[typeId].removed = removed;
+
+  return stats;
+}
+
+/////////////////////////////////////////////////
+std::size_t EntityComponentManager::ComponentCount(
+    const ComponentTypeId _typeId) const
+{
+  uint64_t created{0};
+  uint64_t removed{0};
+  auto createdIter = this->dataPtr->componentsCreated.find(_typeId);
+  if (createdIter != this->dataPtr->componentsCreated.end())
+    created = createdIter->second;
+  auto removedIter = this->dataPtr->componentsRemoved.find(_typeId);
+  if (removedIter != this->dataPtr->componentsRemoved.end())
+    removed = removedIter->second;
+  return created >= removed ? created - removed : 0;
+}
+
 /////////////////////////////////////////////////
 void EntityComponentManager::SetEntityCreateOffset(uint64_t _offset)
 {
@@ -2309,10 +3363,71 @@ void EntityComponentManager::ApplyEntityDiff(
 void EntityComponentManager::ResetTo(const EntityComponentManager &_other)
 {
   auto ecmDiff = this->ComputeEntityDiff(_other);
-  EntityComponentManager tmpCopy;
-  tmpCopy.CopyFrom(_other);
-  tmpCopy.ApplyEntityDiff(*this, ecmDiff);
-  this->CopyFrom(tmpCopy);
+
+  // Stash the state of entities that exist only in this ECM (i.e. created
+  // after `_other` was snapshotted) before it is overwritten below. Only
+  // these entities need to be carried over, so there's no need for a full
+  // intermediate copy of the ECM.
+  struct StashedEntity
+  {
+    Entity entity{kNullEntity};
+    Entity parent{kNullEntity};
+    std::vector<ComponentTypeId> types;
+    std::vector<std::unique_ptr<components::BaseComponent>> components;
+  };
+  std::vector<StashedEntity> stashedEntities;
+  for (const auto &entity : ecmDiff.RemovedEntities())
+  {
+    if (!this->HasEntity(entity))
+      continue;
+
+    StashedEntity stashed;
+    stashed.entity = entity;
+    stashed.parent = this->ParentEntity(entity);
+    for (const auto compTypeId : this->ComponentTypes(entity))
+    {
+      const components::BaseComponent *data =
+          this->ComponentImplementation(entity, compTypeId);
+      stashed.types.push_back(compTypeId);
+      stashed.components.push_back(data->Clone());
+    }
+    stashedEntities.push_back(std::move(stashed));
+  }
+
+  this->CopyFrom(_other);
+
+  // Entities in `_other` that were removed from this ECM are restored by the
+  // copy above. Entities created after the snapshot are re-added here and
+  // marked as removed so systems can clean them up.
+  for (const auto &stashed : stashedEntities)
+  {
+    this->dataPtr->CreateEntityImplementation(stashed.entity);
+    // We want to set this entity as "removed", but
+    // CreateEntityImplementation sets it as "newlyCreated",
+    // so remove it from that list.
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->entityCreatedMutex);
+      this->dataPtr->newlyCreatedEntities.erase(stashed.entity);
+    }
+    if (stashed.entity >= this->dataPtr->entityCount)
+    {
+      this->dataPtr->entityCount = stashed.entity;
+    }
+    // Copy components so that EachRemoved match correctly
+    for (std::size_t i = 0; i < stashed.types.size(); ++i)
+    {
+      this->CreateComponentImplementation(stashed.entity, stashed.types[i],
+          stashed.components[i].get());
+    }
+  }
+
+  // Parents are connected in a second pass so that a child whose parent was
+  // also created after the snapshot finds it in the entity graph.
+  for (const auto &stashed : stashedEntities)
+  {
+    this->SetParentEntity(stashed.entity, stashed.parent);
+    this->RequestRemoveEntity(stashed.entity, false);
+  }
 }
 
 /////////////////////////////////////////////////
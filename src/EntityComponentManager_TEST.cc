@@ -1513,6 +1513,85 @@ TEST_P(EntityComponentManagerFixture,
   EXPECT_EQ(1u, entities.size());
 }
 
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(EntityByComponentsNameIndex))
+{
+  // Lookups with a components::Name go through the maintained name index,
+  // so exercise the paths that have to keep it in sync.
+  Entity parent = manager.CreateEntity();
+  Entity childA = manager.CreateEntity();
+  Entity childB = manager.CreateEntity();
+  manager.CreateComponent(parent, components::Name("parent"));
+  manager.CreateComponent(childA, components::Name("child"));
+  manager.CreateComponent(childA, components::ParentEntity(parent));
+  manager.CreateComponent(childB, components::Name("child"));
+
+  // Lookup by name alone and combined with other components
+  EXPECT_EQ(parent, manager.EntityByComponents(components::Name("parent")));
+  EXPECT_EQ(childA, manager.EntityByComponents(components::Name("child"),
+      components::ParentEntity(parent)));
+  EXPECT_EQ(2u,
+      manager.EntitiesByComponents(components::Name("child")).size());
+  EXPECT_EQ(kNullEntity,
+      manager.EntityByComponents(components::Name("absent")));
+
+  // Renaming through SetComponentData re-indexes the entity
+  EXPECT_TRUE(manager.SetComponentData<components::Name>(parent, "renamed"));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(components::Name(
+      "parent")));
+  EXPECT_EQ(parent, manager.EntityByComponents(components::Name("renamed")));
+
+  // Renaming in place followed by SetChanged also re-indexes
+  manager.Component<components::Name>(childB)->Data() = "loner";
+  manager.SetChanged(childB, components::Name::typeId,
+      ComponentState::OneTimeChange);
+  EXPECT_EQ(childB, manager.EntityByComponents(components::Name("loner")));
+  EXPECT_EQ(1u,
+      manager.EntitiesByComponents(components::Name("child")).size());
+
+  // Removing the Name component drops the entity from the index
+  EXPECT_TRUE(manager.RemoveComponent<components::Name>(childB));
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(components::Name(
+      "loner")));
+
+  // Removing the entity drops it too
+  manager.RequestRemoveEntity(childA, false);
+  manager.ProcessEntityRemovals();
+  EXPECT_EQ(kNullEntity, manager.EntityByComponents(components::Name(
+      "child")));
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(WorldPoseCache))
+{
+  Entity model = manager.CreateEntity();
+  Entity link = manager.CreateEntity();
+  manager.CreateComponent(model, components::Pose({1, 0, 0, 0, 0, 0}));
+  manager.CreateComponent(link, components::Pose({0, 2, 0, 0, 0, 0}));
+  manager.CreateComponent(link, components::ParentEntity(model));
+
+  EXPECT_EQ(math::Pose3d(1, 0, 0, 0, 0, 0), manager.WorldPose(model));
+  EXPECT_EQ(math::Pose3d(1, 2, 0, 0, 0, 0), manager.WorldPose(link));
+  // Repeated calls hit the cache and return the same value
+  EXPECT_EQ(math::Pose3d(1, 2, 0, 0, 0, 0), manager.WorldPose(link));
+
+  // Updating a pose in place and marking it changed refreshes descendants
+  manager.Component<components::Pose>(model)->Data().Pos().X(5);
+  manager.SetChanged(model, components::Pose::typeId,
+      ComponentState::PeriodicChange);
+  EXPECT_EQ(math::Pose3d(5, 2, 0, 0, 0, 0), manager.WorldPose(link));
+
+  // So does creating the component again with new data
+  manager.CreateComponent(link, components::Pose({0, 3, 0, 0, 0, 0}));
+  EXPECT_EQ(math::Pose3d(5, 3, 0, 0, 0, 0), manager.WorldPose(link));
+
+  // An entity without a Pose component has an identity world pose
+  Entity poseless = manager.CreateEntity();
+  EXPECT_EQ(math::Pose3d(), manager.WorldPose(poseless));
+}
+
 /////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
        GZ_UTILS_TEST_DISABLED_ON_WIN32(EntityGraph))
@@ -2379,6 +2458,54 @@ TEST_P(EntityComponentManagerFixture,
       manager.ComponentState(e2, c2->TypeId()));
 }
 
+//////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(OnComponentChange))
+{
+  // Create entities with components
+  Entity e1 = manager.CreateEntity();
+  Entity e2 = manager.CreateEntity();
+  auto c1 = manager.CreateComponent<IntComponent>(e1, IntComponent(123));
+  ASSERT_NE(nullptr, c1);
+  auto c2 = manager.CreateComponent<IntComponent>(e2, IntComponent(456));
+  ASSERT_NE(nullptr, c2);
+
+  // Observe only e1's component
+  int callbackCount{0};
+  ComponentState lastState{ComponentState::NoChange};
+  auto observerId = manager.OnComponentChange(e1, IntComponent::typeId,
+      [&](Entity _entity, ComponentTypeId _typeId, ComponentState _state)
+      {
+        EXPECT_EQ(e1, _entity);
+        EXPECT_EQ(IntComponent::typeId, _typeId);
+        ++callbackCount;
+        lastState = _state;
+      });
+
+  // Changes on the observed entity fire the callback
+  manager.SetChanged(e1, c1->TypeId(), ComponentState::PeriodicChange);
+  EXPECT_EQ(1, callbackCount);
+  EXPECT_EQ(ComponentState::PeriodicChange, lastState);
+
+  manager.SetChanged(e1, c1->TypeId(), ComponentState::OneTimeChange);
+  EXPECT_EQ(2, callbackCount);
+  EXPECT_EQ(ComponentState::OneTimeChange, lastState);
+
+  // Changes on other entities and NoChange don't fire it
+  manager.SetChanged(e2, c2->TypeId(), ComponentState::OneTimeChange);
+  EXPECT_EQ(2, callbackCount);
+  manager.SetChanged(e1, c1->TypeId(), ComponentState::NoChange);
+  EXPECT_EQ(2, callbackCount);
+
+  // Removed observers stop firing
+  EXPECT_TRUE(manager.RemoveComponentChangeObserver(observerId));
+  manager.SetChanged(e1, c1->TypeId(), ComponentState::OneTimeChange);
+  EXPECT_EQ(2, callbackCount);
+
+  // Removing twice fails
+  EXPECT_FALSE(manager.RemoveComponentChangeObserver(observerId));
+}
+
 //////////////////////////////////////////////////
 TEST_P(EntityComponentManagerFixture,
     GZ_UTILS_TEST_DISABLED_ON_WIN32(SetEntityCreateOffset))
@@ -3438,6 +3565,298 @@ TEST_P(EntityComponentManagerFixture, EntityByName)
     *entityByName, true);
 }
 
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, RecycleEntityIds)
+{
+  // ID recycling has to be enabled before the ECM is constructed.
+  common::setenv("GZ_SIM_ECM_RECYCLE_ENTITY_IDS", "1");
+  EntityCompMgrTest recycleManager;
+  common::unsetenv("GZ_SIM_ECM_RECYCLE_ENTITY_IDS");
+
+  Entity e1 = recycleManager.CreateEntity();
+  Entity e2 = recycleManager.CreateEntity();
+  EXPECT_NE(e1, e2);
+
+  // Removed IDs become available again after removals are processed
+  recycleManager.RequestRemoveEntity(e1);
+  recycleManager.ProcessEntityRemovals();
+  EXPECT_FALSE(recycleManager.HasEntity(e1));
+
+  Entity e3 = recycleManager.CreateEntity();
+  EXPECT_EQ(e1, e3);
+  EXPECT_TRUE(recycleManager.HasEntity(e3));
+
+  // With the freelist drained, new IDs are allotted again
+  Entity e4 = recycleManager.CreateEntity();
+  EXPECT_NE(e1, e4);
+  EXPECT_NE(e2, e4);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, RawState)
+{
+  Entity e1 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(123));
+  manager.CreateComponent(e1, StringComponent("raw"));
+  Entity e2 = manager.CreateEntity();
+  manager.CreateComponent(e2, DoubleComponent(0.123));
+
+  auto buffer = manager.RawState();
+  EXPECT_FALSE(buffer.empty());
+
+  // Apply the snapshot onto a fresh ECM
+  EntityCompMgrTest other;
+  other.SetRawState(buffer);
+
+  EXPECT_EQ(2u, other.EntityCount());
+  ASSERT_NE(nullptr, other.Component<IntComponent>(e1));
+  EXPECT_EQ(123, other.Component<IntComponent>(e1)->Data());
+  ASSERT_NE(nullptr, other.Component<StringComponent>(e1));
+  EXPECT_EQ("raw", other.Component<StringComponent>(e1)->Data());
+  ASSERT_NE(nullptr, other.Component<DoubleComponent>(e2));
+  EXPECT_DOUBLE_EQ(0.123, other.Component<DoubleComponent>(e2)->Data());
+
+  // Applying the snapshot again updates components in place
+  manager.Component<IntComponent>(e1)->Data() = 456;
+  other.SetRawState(manager.RawState());
+  EXPECT_EQ(456, other.Component<IntComponent>(e1)->Data());
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, EachChanged)
+{
+  Entity e1 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(1));
+  Entity e2 = manager.CreateEntity();
+  manager.CreateComponent(e2, IntComponent(2));
+
+  // Newly created components count as one-time changes
+  std::set<Entity> changed;
+  manager.EachChanged<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        changed.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{e1, e2}), changed);
+
+  // The end of a step clears the changed bitsets
+  manager.RunSetAllComponentsUnchanged();
+  changed.clear();
+  manager.EachChanged<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        changed.insert(_entity);
+        return true;
+      });
+  EXPECT_TRUE(changed.empty());
+
+  // Periodic changes are reported as well
+  manager.SetChanged(e2, IntComponent::typeId,
+      ComponentState::PeriodicChange);
+  changed.clear();
+  manager.EachChanged<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        changed.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{e2}), changed);
+
+  // Marking a component as unchanged clears its bit
+  manager.SetChanged(e2, IntComponent::typeId, ComponentState::NoChange);
+  changed.clear();
+  manager.EachChanged<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        changed.insert(_entity);
+        return true;
+      });
+  EXPECT_TRUE(changed.empty());
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, EachParallel)
+{
+  const int count = 100;
+  for (int i = 0; i < count; ++i)
+  {
+    Entity entity = manager.CreateEntity();
+    manager.CreateComponent(entity, IntComponent(i));
+  }
+
+  // All matching entities should be visited exactly once, and writes to the
+  // visited entity's own components are allowed.
+  std::atomic<int> visited{0};
+  manager.EachParallel<IntComponent>(
+      [&](const Entity &, IntComponent *_value) -> bool
+      {
+        _value->Data() += 1;
+        ++visited;
+        return true;
+      });
+  EXPECT_EQ(count, visited);
+
+  // The const version should see the values written above.
+  std::atomic<int> sum{0};
+  const auto &constManager = manager;
+  constManager.EachParallel<IntComponent>(
+      [&](const Entity &, const IntComponent *_value) -> bool
+      {
+        sum += _value->Data();
+        return true;
+      });
+  // 1 + 2 + ... + count
+  EXPECT_EQ(count * (count + 1) / 2, sum);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, ArchetypeIndex)
+{
+  // The archetype index has to be enabled before the ECM is constructed.
+  common::setenv("GZ_SIM_ECM_ARCHETYPE_STORAGE", "1");
+  EntityCompMgrTest archetypeManager;
+  common::unsetenv("GZ_SIM_ECM_ARCHETYPE_STORAGE");
+
+  // Create entities with different component sets
+  Entity eInt = archetypeManager.CreateEntity();
+  archetypeManager.CreateComponent(eInt, IntComponent(1));
+
+  Entity eIntDouble = archetypeManager.CreateEntity();
+  archetypeManager.CreateComponent(eIntDouble, IntComponent(2));
+  archetypeManager.CreateComponent(eIntDouble, DoubleComponent(2.0));
+
+  Entity eDouble = archetypeManager.CreateEntity();
+  archetypeManager.CreateComponent(eDouble, DoubleComponent(3.0));
+
+  // Views should see the same entities as with the default storage
+  std::set<Entity> intEntities;
+  archetypeManager.Each<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        intEntities.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{eInt, eIntDouble}), intEntities);
+
+  std::set<Entity> intDoubleEntities;
+  archetypeManager.Each<IntComponent, DoubleComponent>(
+      [&](const Entity &_entity, const IntComponent *,
+          const DoubleComponent *) -> bool
+      {
+        intDoubleEntities.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{eIntDouble}), intDoubleEntities);
+
+  // Removing a component moves the entity to another archetype
+  EXPECT_TRUE(archetypeManager.RemoveComponent(eIntDouble,
+      IntComponent::typeId));
+  archetypeManager.RebuildViews();
+
+  intEntities.clear();
+  archetypeManager.Each<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        intEntities.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{eInt}), intEntities);
+
+  std::set<Entity> doubleEntities;
+  archetypeManager.Each<DoubleComponent>(
+      [&](const Entity &_entity, const DoubleComponent *) -> bool
+      {
+        doubleEntities.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{eIntDouble, eDouble}), doubleEntities);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, ComponentBatch)
+{
+  // Create a view before the batch so it has to be updated afterwards
+  manager.Each<IntComponent>(
+      [&](const Entity &, const IntComponent *) -> bool
+      {
+        return true;
+      });
+
+  manager.BeginComponentBatch();
+
+  Entity eInt = manager.CreateEntity();
+  manager.CreateComponent(eInt, IntComponent(1));
+  Entity eIntDouble = manager.CreateEntity();
+  manager.CreateComponent(eIntDouble, IntComponent(2));
+  manager.CreateComponent(eIntDouble, DoubleComponent(2.0));
+
+  // Querying a view mid-batch flushes the pending entities
+  std::set<Entity> midBatchEntities;
+  manager.Each<IntComponent>(
+      [&](const Entity &_entity, const IntComponent *) -> bool
+      {
+        midBatchEntities.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{eInt, eIntDouble}), midBatchEntities);
+
+  Entity eDouble = manager.CreateEntity();
+  manager.CreateComponent(eDouble, DoubleComponent(3.0));
+
+  manager.EndComponentBatch();
+
+  // Ending a batch without a matching begin only warns
+  manager.EndComponentBatch();
+
+  std::set<Entity> doubleEntities;
+  manager.Each<DoubleComponent>(
+      [&](const Entity &_entity, const DoubleComponent *) -> bool
+      {
+        doubleEntities.insert(_entity);
+        return true;
+      });
+  EXPECT_EQ((std::set<Entity>{eIntDouble, eDouble}), doubleEntities);
+}
+
+/////////////////////////////////////////////////
+TEST_P(EntityComponentManagerFixture, ComponentStats)
+{
+  Entity e1 = manager.CreateEntity();
+  manager.CreateComponent(e1, IntComponent(1));
+  manager.CreateComponent(e1, DoubleComponent(1.0));
+  Entity e2 = manager.CreateEntity();
+  manager.CreateComponent(e2, IntComponent(2));
+
+  auto stats = manager.ComponentStats();
+  ASSERT_NE(stats.end(), stats.find(IntComponent::typeId));
+  EXPECT_EQ(2u, stats[IntComponent::typeId].count);
+  EXPECT_EQ(2u, stats[IntComponent::typeId].created);
+  EXPECT_EQ(0u, stats[IntComponent::typeId].removed);
+  EXPECT_EQ(2u * sizeof(IntComponent), stats[IntComponent::typeId].bytes);
+  EXPECT_EQ(1u, stats[DoubleComponent::typeId].count);
+
+  // Removing a component updates count and churn but not created
+  EXPECT_TRUE(manager.RemoveComponent(e1, IntComponent::typeId));
+  stats = manager.ComponentStats();
+  EXPECT_EQ(1u, stats[IntComponent::typeId].count);
+  EXPECT_EQ(2u, stats[IntComponent::typeId].created);
+  EXPECT_EQ(1u, stats[IntComponent::typeId].removed);
+
+  // Removing an entity counts its remaining components as removed
+  manager.RequestRemoveEntity(e2);
+  manager.ProcessEntityRemovals();
+  stats = manager.ComponentStats();
+  EXPECT_EQ(0u, stats[IntComponent::typeId].count);
+  EXPECT_EQ(2u, stats[IntComponent::typeId].removed);
+
+  // Re-adding a removed component counts as a creation
+  manager.CreateComponent(e1, IntComponent(3));
+  stats = manager.ComponentStats();
+  EXPECT_EQ(1u, stats[IntComponent::typeId].count);
+  EXPECT_EQ(3u, stats[IntComponent::typeId].created);
+}
+
 // Run multiple times. We want to make sure that static globals don't cause
 // problems.
 INSTANTIATE_TEST_SUITE_P(EntityComponentManagerRepeat,
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <gz/msgs/stringmsg.pb.h>
+#include <gz/transport/Node.hh>
+
+#include "gz/sim/LazyPublisher.hh"
+
+using namespace gz;
+using namespace sim;
+
+//////////////////////////////////////////////////
+TEST(LazyPublisher, DefaultInvalid)
+{
+  LazyPublisher pub;
+  EXPECT_FALSE(pub.Valid());
+  EXPECT_FALSE(pub.HasConnections());
+
+  bool built{false};
+  EXPECT_FALSE(pub.Publish([&built]() -> msgs::StringMsg
+      {
+        built = true;
+        return msgs::StringMsg();
+      }));
+  EXPECT_FALSE(built);
+}
+
+//////////////////////////////////////////////////
+TEST(LazyPublisher, BuilderOnlyRunsWithSubscribers)
+{
+  transport::Node node;
+  LazyPublisher pub;
+  pub = node.Advertise<msgs::StringMsg>("/lazy_publisher_test");
+  EXPECT_TRUE(pub.Valid());
+
+  // No subscribers: the builder must not run.
+  bool built{false};
+  EXPECT_FALSE(pub.Publish([&built]() -> msgs::StringMsg
+      {
+        built = true;
+        return msgs::StringMsg();
+      }));
+  EXPECT_FALSE(built);
+
+  // Subscribe and wait for the connection to be visible.
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool received{false};
+  std::function<void(const msgs::StringMsg &)> cb =
+      [&](const msgs::StringMsg &_msg)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        received = "lazy" == _msg.data();
+        cv.notify_all();
+      };
+  ASSERT_TRUE(node.Subscribe("/lazy_publisher_test", cb));
+
+  for (int sleep = 0; sleep < 50 && !pub.HasConnections(); ++sleep)
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ASSERT_TRUE(pub.HasConnections());
+
+  // With a subscriber the builder runs and the message arrives.
+  EXPECT_TRUE(pub.Publish([&built]() -> msgs::StringMsg
+      {
+        built = true;
+        msgs::StringMsg msg;
+        msg.set_data("lazy");
+        return msg;
+      }));
+  EXPECT_TRUE(built);
+
+  std::unique_lock<std::mutex> lock(mutex);
+  cv.wait_for(lock, std::chrono::seconds(5), [&] { return received; });
+  EXPECT_TRUE(received);
+}
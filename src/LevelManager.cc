@@ -18,7 +18,10 @@
 #include "LevelManager.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 #include <sdf/Actor.hh>
 #include <sdf/Atmosphere.hh>
@@ -60,6 +63,25 @@
 using namespace gz;
 using namespace sim;
 
+namespace
+{
+/// \brief Hash a 3D grid cell into a single map key. Collisions are
+/// benign; they only add candidates that the exact intersection tests
+/// discard.
+uint64_t CellKey(int64_t _x, int64_t _y, int64_t _z)
+{
+  return static_cast<uint64_t>(_x) * 73856093u ^
+         static_cast<uint64_t>(_y) * 19349663u ^
+         static_cast<uint64_t>(_z) * 83492791u;
+}
+
+/// \brief Index of the grid cell containing a coordinate.
+int64_t CellIndex(double _coord, double _cellSize)
+{
+  return static_cast<int64_t>(std::floor(_coord / _cellSize));
+}
+}
+
 /////////////////////////////////////////////////
 LevelManager::LevelManager(SimulationRunner *_runner, const bool _useLevels)
     : runner(_runner), useLevels(_useLevels)
@@ -263,6 +285,23 @@ void LevelManager::ReadLevels(const sdf::Plugin &_plugin)
   if (sdf == nullptr)
     return;
 
+  this->prefetchTime = sdf->Get<double>("level_prefetch_time", 0.0).first;
+  if (this->prefetchTime < 0.0)
+  {
+    gzwarn << "The level_prefetch_time parameter cannot be a negative "
+            << "number. Setting to 0.0\n";
+    this->prefetchTime = 0.0;
+  }
+
+  int unloadBatch = sdf->Get<int>("level_unload_batch_size", 0).first;
+  if (unloadBatch < 0)
+  {
+    gzwarn << "The level_unload_batch_size parameter cannot be a negative "
+            << "number. Setting to 0\n";
+    unloadBatch = 0;
+  }
+  this->unloadBatchSize = static_cast<std::size_t>(unloadBatch);
+
   if (!sdf->HasElement("level"))
     return;
 
@@ -324,9 +363,90 @@ void LevelManager::ReadLevels(const sdf::Plugin &_plugin)
     this->UnloadLevel(levelEntity);
     this->entityCreator->SetParent(levelEntity, worldEntity);
 
+    // Levels don't move, so their volumes can be cached up front.
+    auto center = pose.Pos();
+    auto box = geometry.BoxShape();
+    this->levelVolumes[levelEntity] = {
+        math::AxisAlignedBox{center - box->Size() / 2,
+                             center + box->Size() / 2},
+        math::AxisAlignedBox{center - (box->Size() / 2 + buffer),
+                             center + (box->Size() / 2 + buffer)}};
+
     gzdbg << "Created level with name[" << name << "] and pose["
       << pose << "]\n";
   }
+
+  this->BuildLevelIndex();
+}
+
+/////////////////////////////////////////////////
+void LevelManager::BuildLevelIndex()
+{
+  this->levelGridCells.clear();
+  this->levelGridCellSize = 0.0;
+
+  // Sizing cells to the largest buffered level keeps every level within
+  // at most eight cells.
+  for (const auto &[levelEntity, volumes] : this->levelVolumes)
+  {
+    auto size = volumes.second.Size();
+    this->levelGridCellSize = std::max(
+        {this->levelGridCellSize, size.X(), size.Y(), size.Z()});
+  }
+
+  if (this->levelGridCellSize <= 0.0)
+    return;
+
+  for (const auto &[levelEntity, volumes] : this->levelVolumes)
+  {
+    const auto &outer = volumes.second;
+    for (int64_t x = CellIndex(outer.Min().X(), this->levelGridCellSize);
+         x <= CellIndex(outer.Max().X(), this->levelGridCellSize); ++x)
+    {
+      for (int64_t y = CellIndex(outer.Min().Y(), this->levelGridCellSize);
+           y <= CellIndex(outer.Max().Y(), this->levelGridCellSize); ++y)
+      {
+        for (int64_t z = CellIndex(outer.Min().Z(), this->levelGridCellSize);
+             z <= CellIndex(outer.Max().Z(), this->levelGridCellSize); ++z)
+        {
+          this->levelGridCells[CellKey(x, y, z)].push_back(levelEntity);
+        }
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+std::vector<Entity> LevelManager::LevelsIntersecting(
+    const math::AxisAlignedBox &_box) const
+{
+  std::vector<Entity> candidates;
+  if (this->levelGridCellSize <= 0.0)
+    return candidates;
+
+  for (int64_t x = CellIndex(_box.Min().X(), this->levelGridCellSize);
+       x <= CellIndex(_box.Max().X(), this->levelGridCellSize); ++x)
+  {
+    for (int64_t y = CellIndex(_box.Min().Y(), this->levelGridCellSize);
+         y <= CellIndex(_box.Max().Y(), this->levelGridCellSize); ++y)
+    {
+      for (int64_t z = CellIndex(_box.Min().Z(), this->levelGridCellSize);
+           z <= CellIndex(_box.Max().Z(), this->levelGridCellSize); ++z)
+      {
+        auto cell = this->levelGridCells.find(CellKey(x, y, z));
+        if (cell != this->levelGridCells.end())
+        {
+          candidates.insert(candidates.end(), cell->second.begin(),
+              cell->second.end());
+        }
+      }
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()),
+      candidates.end());
+  return candidates;
 }
 
 /////////////////////////////////////////////////
@@ -448,6 +568,8 @@ void LevelManager::UpdateLevelsState()
   std::vector<Entity> levelsToLoad;
   std::vector<Entity> levelsToUnload;
 
+  this->ProcessDeferredUnloads();
+
   {
     std::lock_guard<std::mutex> lock(this->performerToAddMutex);
     auto iter = this->performersToAdd.begin();
@@ -480,6 +602,8 @@ void LevelManager::UpdateLevelsState()
   // If levels are not being used, we only process the default level.
   if (this->useLevels)
   {
+    bool anyPerformer{false};
+
     this->runner->entityCompMgr.Each<
       components::Performer,
       components::PerformerLevels,
@@ -493,6 +617,8 @@ void LevelManager::UpdateLevelsState()
           {
           GZ_PROFILE("EachPerformer");
 
+          anyPerformer = true;
+
           auto pose = this->runner->entityCompMgr.Component<components::Pose>(
               _parent->Data());
 
@@ -509,66 +635,86 @@ void LevelManager::UpdateLevelsState()
             pose->Data().Pos() - perfBox->Size() / 2,
               pose->Data().Pos() + perfBox->Size() / 2};
 
+          // Sweep the performer volume along its velocity over the
+          // prefetch horizon, so levels it is about to enter start
+          // loading before it arrives.
+          math::AxisAlignedBox sweptVolume = performerVolume;
+          if (this->prefetchTime > 0.0)
+          {
+            math::Vector3d velocity = math::Vector3d::Zero;
+            auto worldVel = this->runner->entityCompMgr
+                .Component<components::WorldLinearVelocity>(_parent->Data());
+            if (worldVel)
+            {
+              velocity = worldVel->Data();
+            }
+            else
+            {
+              auto bodyVel = this->runner->entityCompMgr
+                  .Component<components::LinearVelocity>(_parent->Data());
+              if (bodyVel)
+                velocity = pose->Data().Rot() * bodyVel->Data();
+            }
+
+            auto offset = velocity * this->prefetchTime;
+            sweptVolume.Merge(math::AxisAlignedBox{
+                performerVolume.Min() + offset,
+                performerVolume.Max() + offset});
+          }
+
           std::set<Entity> newPerfLevels;
 
-          // loop through levels and check for intersections
-          // Add all levels with intersections to the levelsToLoad even if they
-          // are currently active.
-          this->runner->entityCompMgr.Each<components::Level, components::Pose,
-            components::Geometry,
-            components::LevelBuffer >(
-                [&](const Entity &_entity, const components::Level *,
-                  const components::Pose *_pose,
-                  const components::Geometry *_levelGeometry,
-                  const components::LevelBuffer *_levelBuffer) -> bool
-                {
-                GZ_PROFILE("CheckPerformerAgainstLevel");
-                // Check if the performer is in this level
-                // assume a box for now
-                auto box = _levelGeometry->Data().BoxShape();
-                if (nullptr == box)
-                {
-                gzerr << "Level [" << _entity
-                << "]'s geometry is not a box." << std::endl;
-                return true;
-                }
-                auto buffer = _levelBuffer->Data();
-                auto center = _pose->Data().Pos();
-                math::AxisAlignedBox region{center - box->Size() / 2,
-                center + box->Size() / 2};
-
-                math::AxisAlignedBox outerRegion{
-                  center - (box->Size() / 2 + buffer),
-                         center + (box->Size() / 2 + buffer)};
-
-                if (region.Intersects(performerVolume))
-                {
-                  newPerfLevels.insert(_entity);
-                  levelsToLoad.push_back(_entity);
-                }
-                else
-                {
-                  // If the level is active, check if the performer is
-                  // outside of the buffer of this level
-                  if (this->IsLevelActive(_entity))
-                  {
-                    if (outerRegion.Intersects(performerVolume))
-                    {
-                      newPerfLevels.insert(_entity);
-                      levelsToLoad.push_back(_entity);
-                      return true;
-                    }
-                    // Otherwise, mark the level to be unloaded
-                    levelsToUnload.push_back(_entity);
-                  }
-                }
-                return true;
-                });
+          // Check for intersections against the levels sharing a grid
+          // cell with the swept volume, instead of every level in the
+          // world. Add all levels with intersections to the levelsToLoad
+          // even if they are currently active.
+          for (const Entity levelEntity :
+              this->LevelsIntersecting(sweptVolume))
+          {
+            GZ_PROFILE("CheckPerformerAgainstLevel");
+            const auto &volumes = this->levelVolumes[levelEntity];
+            if (volumes.first.Intersects(performerVolume))
+            {
+              newPerfLevels.insert(levelEntity);
+              levelsToLoad.push_back(levelEntity);
+            }
+            else if (this->IsLevelActive(levelEntity) &&
+                volumes.second.Intersects(performerVolume))
+            {
+              // The level is active and the performer is still within its
+              // buffer, so keep it loaded.
+              newPerfLevels.insert(levelEntity);
+              levelsToLoad.push_back(levelEntity);
+            }
+            else if (this->prefetchTime > 0.0 &&
+                volumes.second.Intersects(sweptVolume))
+            {
+              // Predicted entry: load the level's entities now, but don't
+              // report the performer as being inside it yet.
+              levelsToLoad.push_back(levelEntity);
+            }
+          }
 
           *_perfLevels = components::PerformerLevels(newPerfLevels);
 
           return true;
           });
+
+    // Any active level no performer reached is out of range of all of
+    // them, so mark it to be unloaded. When there are no performers
+    // nothing is unloaded, matching the previous all-pairs behavior.
+    if (anyPerformer)
+    {
+      for (const auto &[levelEntity, volumes] : this->levelVolumes)
+      {
+        if (this->IsLevelActive(levelEntity) &&
+            std::find(levelsToLoad.begin(), levelsToLoad.end(),
+                levelEntity) == levelsToLoad.end())
+        {
+          levelsToUnload.push_back(levelEntity);
+        }
+      }
+    }
   }
 
   // Sort levelsToLoad and levelsToUnload so as to run std::unique on them.
@@ -658,6 +804,14 @@ void LevelManager::LoadActiveEntities(const std::set<std::string> &_namesToLoad)
     return;
   }
 
+  // Entities awaiting a deferred unload still exist, so reloading them
+  // just means cancelling the removal; the name checks below then skip
+  // recreating them.
+  for (const auto &name : _namesToLoad)
+  {
+    this->deferredUnloadNames.erase(name);
+  }
+
   // Models
   for (uint64_t modelIndex = 0;
        modelIndex < this->runner->sdfWorld.ModelCount(); ++modelIndex)
@@ -724,12 +878,54 @@ void LevelManager::LoadActiveEntities(const std::set<std::string> &_namesToLoad)
 /////////////////////////////////////////////////
 void LevelManager::UnloadInactiveEntities(
     const std::set<std::string> &_namesToUnload)
+{
+  for (const auto &name : _namesToUnload)
+  {
+    this->activeEntityNames.erase(name);
+  }
+
+  if (this->unloadBatchSize == 0u)
+  {
+    this->RequestRemoveEntities(_namesToUnload);
+    return;
+  }
+
+  // Defer the removal requests so ProcessRemoveEntityRequests never has
+  // to destroy more than a batch of entities in one step. The entities
+  // keep simulating until their batch comes up.
+  this->deferredUnloadNames.insert(_namesToUnload.begin(),
+      _namesToUnload.end());
+}
+
+/////////////////////////////////////////////////
+void LevelManager::ProcessDeferredUnloads()
+{
+  if (this->deferredUnloadNames.empty() || this->unloadBatchSize == 0u)
+    return;
+
+  GZ_PROFILE("LevelManager::ProcessDeferredUnloads");
+
+  std::set<std::string> batch;
+  auto iter = this->deferredUnloadNames.begin();
+  while (iter != this->deferredUnloadNames.end() &&
+      batch.size() < this->unloadBatchSize)
+  {
+    batch.insert(*iter);
+    iter = this->deferredUnloadNames.erase(iter);
+  }
+
+  this->RequestRemoveEntities(batch);
+}
+
+/////////////////////////////////////////////////
+void LevelManager::RequestRemoveEntities(
+    const std::set<std::string> &_namesToRemove)
 {
   this->runner->entityCompMgr.Each<components::Model, components::Name>(
       [&](const Entity &_entity, const components::Model *,
           const components::Name *_name) -> bool
       {
-        if (_namesToUnload.find(_name->Data()) != _namesToUnload.end())
+        if (_namesToRemove.find(_name->Data()) != _namesToRemove.end())
         {
           this->entityCreator->RequestRemoveEntity(_entity, true);
         }
@@ -740,7 +936,7 @@ void LevelManager::UnloadInactiveEntities(
       [&](const Entity &_entity, const components::Actor *,
           const components::Name *_name) -> bool
       {
-        if (_namesToUnload.find(_name->Data()) != _namesToUnload.end())
+        if (_namesToRemove.find(_name->Data()) != _namesToRemove.end())
         {
           this->entityCreator->RequestRemoveEntity(_entity, true);
         }
@@ -751,7 +947,7 @@ void LevelManager::UnloadInactiveEntities(
       [&](const Entity &_entity, const components::Light *,
           const components::Name *_name) -> bool
       {
-        if (_namesToUnload.find(_name->Data()) != _namesToUnload.end())
+        if (_namesToRemove.find(_name->Data()) != _namesToRemove.end())
         {
           this->entityCreator->RequestRemoveEntity(_entity, true);
         }
@@ -762,17 +958,12 @@ void LevelManager::UnloadInactiveEntities(
       [&](const Entity &_entity, const components::Joint *,
           const components::Name *_name) -> bool
       {
-        if (_namesToUnload.find(_name->Data()) != _namesToUnload.end())
+        if (_namesToRemove.find(_name->Data()) != _namesToRemove.end())
         {
           this->entityCreator->RequestRemoveEntity(_entity, true);
         }
         return true;
       });
-
-  for (const auto &name : _namesToUnload)
-  {
-    this->activeEntityNames.erase(name);
-  }
 }
 
 /////////////////////////////////////////////////
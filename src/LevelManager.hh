@@ -21,6 +21,8 @@
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <set>
@@ -31,6 +33,7 @@
 
 #include <sdf/Element.hh>
 #include <sdf/Geometry.hh>
+#include <gz/math/AxisAlignedBox.hh>
 #include <gz/transport/Node.hh>
 
 #include "gz/sim/config.hh"
@@ -98,15 +101,33 @@ namespace gz
       public: void ConfigureDefaultLevel();
 
       /// \brief Load entities that have been marked for loading.
+      /// Downstream systems pick the new entities up through the ECM's
+      /// newly-created queries, so for example physics only instantiates
+      /// collision objects once an entity's level becomes active.
       /// \param[in] _namesToLoad List of of entity names to load
       private: void LoadActiveEntities(
           const std::set<std::string> &_namesToLoad);
 
       /// \brief Unload entities that have been marked for unloading.
+      /// The names leave the active set immediately, but the removal
+      /// requests are either issued right away or spread over subsequent
+      /// updates in capped batches, depending on unloadBatchSize.
       /// \param[in] _namesToUnload List of entity names to unload
       private: void UnloadInactiveEntities(
           const std::set<std::string> &_namesToUnload);
 
+      /// \brief Request the removal of entities from the ECM, which in
+      /// turn makes systems tear down what they created for them, e.g.
+      /// physics drops the engine objects including collisions.
+      /// \param[in] _namesToRemove Names of the entities to remove
+      private: void RequestRemoveEntities(
+          const std::set<std::string> &_namesToRemove);
+
+      /// \brief Issue removal requests for up to unloadBatchSize deferred
+      /// entity names, bounding the work ProcessRemoveEntityRequests does
+      /// in any one step.
+      private: void ProcessDeferredUnloads();
+
       /// \brief Read information about performers from the sdf Element and
       /// create performer entities
       /// \param[in] _plugin sdf::Plugin of the gz::sim plugin tag
@@ -142,6 +163,24 @@ namespace gz
       private: int CreatePerformerEntity(const std::string &_name,
                    const sdf::Geometry &_geom);
 
+      /// \brief Build the spatial hash grid over the level volumes read
+      /// from SDF. Levels are static, so the grid is built once after
+      /// ReadLevels and containment checks only visit the levels sharing
+      /// a cell with a performer instead of every level in the world.
+      private: void BuildLevelIndex();
+
+      /// \brief Query the level index for candidate levels.
+      /// \param[in] _box Volume to query, e.g. a performer's bounding box.
+      /// \return Levels whose buffered volume may intersect _box. The set
+      /// is conservative; callers still need the exact intersection test.
+      private: std::vector<Entity> LevelsIntersecting(
+          const math::AxisAlignedBox &_box) const;
+
+      /// \brief Deactivate a level and unload its entities, except those
+      /// also belonging to a level marked to stay loaded.
+      /// \param[in] _entity Entity of the level to unload
+      /// \param[in] _entityNamesMarked Names of entities belonging to
+      /// levels that are marked to be loaded
       private: void UnloadLevel(const Entity &_entity,
                    const std::set<std::string> &_entityNamesMarked = {});
 
@@ -170,6 +209,40 @@ namespace gz
       /// \brief Transport node.
       private: gz::transport::Node node;
 
+      /// \brief Exact and buffered bounding volumes of each level, cached
+      /// at read time so they aren't rebuilt from pose and geometry
+      /// components every update.
+      private: std::unordered_map<Entity,
+          std::pair<math::AxisAlignedBox, math::AxisAlignedBox>> levelVolumes;
+
+      /// \brief Spatial hash grid mapping cell keys to the levels whose
+      /// buffered volume overlaps the cell.
+      private: std::unordered_map<uint64_t, std::vector<Entity>>
+          levelGridCells;
+
+      /// \brief Edge length of a grid cell, the largest buffered level
+      /// extent. Zero when there are no levels.
+      private: double levelGridCellSize{0.0};
+
+      /// \brief Maximum number of entity removal requests issued per
+      /// update when unloading levels. Read from
+      /// <level_unload_batch_size> in the gz::sim plugin element; zero,
+      /// the default, unloads a level's entities all at once.
+      private: std::size_t unloadBatchSize{0u};
+
+      /// \brief Names of entities whose removal has been deferred to a
+      /// later update. Entities here are no longer active, but still
+      /// exist until their batch is processed; reloading their level
+      /// cancels the removal.
+      private: std::set<std::string> deferredUnloadNames;
+
+      /// \brief Lookahead horizon in seconds for predictive level
+      /// loading. Performer volumes are swept along their linear velocity
+      /// over this horizon, so levels about to be entered load before the
+      /// performer arrives. Read from <level_prefetch_time> in the
+      /// gz::sim plugin element; zero disables prefetching.
+      private: double prefetchTime{0.0};
+
       /// \brief The list of performers to add.
       private: std::list<std::pair<std::string, sdf::Geometry>> performersToAdd;
 
@@ -454,21 +454,28 @@ void Link::AddWorldWrench(EntityComponentManager &_ecm,
                           const math::Vector3d &_torque,
                           const math::Vector3d &_offset) const
 {
-  math::Pose3d linkWorldPose;
-  auto worldPoseComp = _ecm.Component<components::WorldPose>(this->dataPtr->id);
-  if (worldPoseComp)
-  {
-    linkWorldPose = worldPoseComp->Data();
-  }
-  else
+  // We want the force to be applied at an offset from the link origin, so we
+  // must compute the resulting force and torque on the link origin. When the
+  // offset is zero the wrench already acts on the link origin and the link
+  // pose is not needed.
+  math::Vector3d torqueWithOffset = _torque;
+  if (_offset != math::Vector3d::Zero)
   {
-    linkWorldPose = worldPose(this->dataPtr->id, _ecm);
-  }
+    math::Pose3d linkWorldPose;
+    auto worldPoseComp =
+      _ecm.Component<components::WorldPose>(this->dataPtr->id);
+    if (worldPoseComp)
+    {
+      linkWorldPose = worldPoseComp->Data();
+    }
+    else
+    {
+      linkWorldPose = worldPose(this->dataPtr->id, _ecm);
+    }
 
-  // We want the force to be applied at an offset from the link origin, so we
-  // must compute the resulting force and torque on the link origin.
-  auto posComWorldCoord = linkWorldPose.Rot().RotateVector(_offset);
-  math::Vector3d torqueWithOffset = _torque + posComWorldCoord.Cross(_force);
+    auto posComWorldCoord = linkWorldPose.Rot().RotateVector(_offset);
+    torqueWithOffset += posComWorldCoord.Cross(_force);
+  }
 
   auto linkWrenchComp =
     _ecm.Component<components::ExternalWorldWrenchCmd>(this->dataPtr->id);
@@ -17,7 +17,20 @@
 
 #include "MeshInertiaCalculator.hh"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <mutex>
 #include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <sdf/CustomInertiaCalcProperties.hh>
@@ -25,9 +38,11 @@
 
 #include <gz/sim/Util.hh>
 
+#include <gz/common/Filesystem.hh>
 #include <gz/common/graphics.hh>
 #include <gz/common/Mesh.hh>
 #include <gz/common/MeshManager.hh>
+#include <gz/common/Util.hh>
 
 #include <gz/math/Vector3.hh>
 #include <gz/math/Pose3.hh>
@@ -38,6 +53,84 @@
 using namespace gz;
 using namespace sim;
 
+namespace
+{
+/// \brief Compute an FNV-1a hash of a file's contents so cached inertia
+/// values are invalidated when the mesh asset changes.
+/// \param[in] _path Full path of the file to hash.
+/// \return The hash, or nullopt if the file can't be read.
+std::optional<uint64_t> HashFileContents(const std::string &_path)
+{
+  std::ifstream file(_path, std::ios::in | std::ios::binary);
+  if (!file)
+    return std::nullopt;
+
+  uint64_t hash{14695981039346656037ull};
+  char buffer[4096];
+  while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+  {
+    for (std::streamsize i = 0; i < file.gcount(); ++i)
+    {
+      hash ^= static_cast<unsigned char>(buffer[i]);
+      hash *= 1099511628211ull;
+    }
+  }
+  return hash;
+}
+
+/// \brief Mutex protecting the in-memory inertia cache.
+std::mutex gInertiaCacheMutex;
+
+/// \brief Inertia values already computed in this process, keyed by mesh
+/// content hash, scale and density. Many instances of the same asset then
+/// only pay for one computation.
+std::unordered_map<std::string, math::Inertiald> gInertiaCache;
+
+/// \brief Read a cached inertia value from disk.
+/// \param[in] _path Cache file to read.
+/// \return The inertia value, or nullopt if the file is missing or invalid.
+std::optional<math::Inertiald> ReadCachedInertia(const std::string &_path)
+{
+  std::ifstream file(_path);
+  if (!file)
+    return std::nullopt;
+
+  double mass;
+  math::Vector3d ixxyyzz, ixyxzyz;
+  math::Pose3d pose;
+  if (!(file >> mass >> ixxyyzz >> ixyxzyz >> pose))
+  {
+    gzwarn << "Ignoring malformed mesh inertia cache file [" << _path << "]"
+           << std::endl;
+    return std::nullopt;
+  }
+
+  math::MassMatrix3d massMatrix(mass, ixxyyzz, ixyxzyz);
+  return math::Inertiald(massMatrix, pose);
+}
+
+/// \brief Write an inertia value to a disk cache file.
+/// \param[in] _path Cache file to write.
+/// \param[in] _inertial Inertia value to store.
+void WriteCachedInertia(const std::string &_path,
+    const math::Inertiald &_inertial)
+{
+  std::ofstream file(_path, std::ios::out | std::ios::trunc);
+  if (!file)
+  {
+    gzwarn << "Failed to write mesh inertia cache file [" << _path << "]"
+           << std::endl;
+    return;
+  }
+
+  file << std::setprecision(std::numeric_limits<double>::max_digits10)
+       << _inertial.MassMatrix().Mass() << std::endl
+       << _inertial.MassMatrix().DiagonalMoments() << std::endl
+       << _inertial.MassMatrix().OffDiagonalMoments() << std::endl
+       << _inertial.Pose() << std::endl;
+}
+}
+
 //////////////////////////////////////////////////
 void MeshInertiaCalculator::GetMeshTriangles(
   std::vector<Triangle> &_triangles,
@@ -88,65 +181,82 @@ void MeshInertiaCalculator::CalculateMassProperties(
   // Number of triangles of in the mesh
   std::size_t numTriangles = _triangles.size();
 
-  // Vector to store cross products of 2 vectors of the triangles
-  std::vector<gz::math::Vector3d> crosses(numTriangles);
-
-  // Caculating cross products of 2 vectors emerging from a common vertex
-  // This basically gives a vector normal to the plane of triangle
-  for (std::size_t i = 0; i < numTriangles; ++i)
+  // Partial sums of the integral terms over a range of triangles. Each
+  // triangle's subexpressions only depend on that triangle, so ranges can
+  // be integrated independently and summed.
+  auto integrate = [&_triangles](std::size_t _begin, std::size_t _end)
   {
-    crosses[i] =
-      (_triangles[i].v1 - _triangles[i].v0).Cross(
-        _triangles[i].v2 - _triangles[i].v0);
-  }
-
-  // Calculate subexpressions of the integral
-  std::vector<gz::math::Vector3d> f1(numTriangles), f2(numTriangles),
-  f3(numTriangles), g0(numTriangles), g1(numTriangles), g2(numTriangles);
-
-  for (std::size_t i = 0; i < numTriangles; ++i)
+    std::array<double, 10> sum{};
+    for (std::size_t i = _begin; i < _end; ++i)
+    {
+      const gz::math::Vector3d &v0 = _triangles[i].v0;
+      const gz::math::Vector3d &v1 = _triangles[i].v1;
+      const gz::math::Vector3d &v2 = _triangles[i].v2;
+
+      // Cross product of 2 vectors emerging from a common vertex
+      // This basically gives a vector normal to the plane of triangle
+      const gz::math::Vector3d cross = (v1 - v0).Cross(v2 - v0);
+
+      // Subexpressions of the integral
+      const gz::math::Vector3d f1 = v0 + v1 + v2;
+      const gz::math::Vector3d f2 =
+          v0 * v0 + v1 * v1 + v0 * v1 + v2 * f1;
+      const gz::math::Vector3d f3 =
+          v0 * v0 * v0 + v0 * v0 * v1 + v0 * v1 * v1 + v1 * v1 * v1 +
+          v2 * f2;
+      const gz::math::Vector3d g0 = f2 + (v0 + f1) * v0;
+      const gz::math::Vector3d g1 = f2 + (v1 + f1) * v1;
+      const gz::math::Vector3d g2 = f2 + (v2 + f1) * v2;
+
+      sum[0] += cross.X() * f1.X();
+      sum[1] += cross.X() * f2.X();
+      sum[2] += cross.Y() * f2.Y();
+      sum[3] += cross.Z() * f2.Z();
+      sum[4] += cross.X() * f3.X();
+      sum[5] += cross.Y() * f3.Y();
+      sum[6] += cross.Z() * f3.Z();
+      sum[7] += cross.X() *
+          (v0.Y() * g0.X() + v1.Y() * g1.X() + v2.Y() * g2.X());
+      sum[8] += cross.Y() *
+          (v0.Z() * g0.Y() + v1.Z() * g1.Y() + v2.Z() * g2.Y());
+      sum[9] += cross.Z() *
+          (v0.X() * g0.Z() + v1.X() * g1.Z() + v2.X() * g2.Z());
+    }
+    return sum;
+  };
+
+  // Spread large meshes across the hardware threads. Small meshes aren't
+  // worth the thread startup cost and keep their exact summation order.
+  constexpr std::size_t kParallelTriangleThreshold{20000u};
+  std::size_t numChunks = 1u;
+  if (numTriangles >= kParallelTriangleThreshold)
   {
-      f1[i] = _triangles[i].v0 + _triangles[i].v1 + _triangles[i].v2;
-      f2[i] = _triangles[i].v0 * _triangles[i].v0 +
-              _triangles[i].v1 * _triangles[i].v1 +
-              _triangles[i].v0 * _triangles[i].v1 +
-              _triangles[i].v2 * f1[i];
-      f3[i] = _triangles[i].v0 * _triangles[i].v0 * _triangles[i].v0 +
-              _triangles[i].v0 * _triangles[i].v0 * _triangles[i].v1 +
-              _triangles[i].v0 * _triangles[i].v1 * _triangles[i].v1 +
-              _triangles[i].v1 * _triangles[i].v1 * _triangles[i].v1 +
-              _triangles[i].v2 * f2[i];
-      g0[i] = f2[i] + (_triangles[i].v0 + f1[i]) * (_triangles[i].v0);
-      g1[i] = f2[i] + (_triangles[i].v1 + f1[i]) * (_triangles[i].v1);
-      g2[i] = f2[i] + (_triangles[i].v2 + f1[i]) * (_triangles[i].v2);
+    numChunks = std::max<std::size_t>(1u,
+        std::thread::hardware_concurrency());
   }
 
   // Calculate integral terms
   std::vector<double> integral(10);
-  for (std::size_t i = 0; i < numTriangles; ++i)
+  if (numChunks == 1u)
   {
-      double x0 = _triangles[i].v0.X();
-      double y0 = _triangles[i].v0.Y();
-      double z0 = _triangles[i].v0.Z();
-      double x1 = _triangles[i].v1.X();
-      double y1 = _triangles[i].v1.Y();
-      double z1 = _triangles[i].v1.Z();
-      double x2 = _triangles[i].v2.X();
-      double y2 = _triangles[i].v2.Y();
-      double z2 = _triangles[i].v2.Z();
-      integral[0] += crosses[i].X() * f1[i].X();
-      integral[1] += crosses[i].X() * f2[i].X();
-      integral[2] += crosses[i].Y() * f2[i].Y();
-      integral[3] += crosses[i].Z() * f2[i].Z();
-      integral[4] += crosses[i].X() * f3[i].X();
-      integral[5] += crosses[i].Y() * f3[i].Y();
-      integral[6] += crosses[i].Z() * f3[i].Z();
-      integral[7] += crosses[i].X() *
-        (y0 * g0[i].X() + y1 * g1[i].X() + y2 * g2[i].X());
-      integral[8] += crosses[i].Y() *
-        (z0 * g0[i].Y() + z1 * g1[i].Y() + z2 * g2[i].Y());
-      integral[9] += crosses[i].Z() *
-        (x0 * g0[i].Z() + x1 * g1[i].Z() + x2 * g2[i].Z());
+    const auto sum = integrate(0u, numTriangles);
+    std::copy(sum.begin(), sum.end(), integral.begin());
+  }
+  else
+  {
+    const std::size_t chunkSize = (numTriangles + numChunks - 1) / numChunks;
+    std::vector<std::future<std::array<double, 10>>> futures;
+    for (std::size_t begin = 0; begin < numTriangles; begin += chunkSize)
+    {
+      futures.push_back(std::async(std::launch::async, integrate, begin,
+          std::min(begin + chunkSize, numTriangles)));
+    }
+    for (auto &future : futures)
+    {
+      const auto sum = future.get();
+      for (std::size_t i = 0; i < sum.size(); ++i)
+        integral[i] += sum[i];
+    }
   }
 
   for (int i = 0; i < 10; ++i)
@@ -215,6 +325,43 @@ std::optional<gz::math::Inertiald> MeshInertiaCalculator::operator()
     return std::nullopt;
   }
 
+  // One cache entry per distinct mesh content, scale and density, so many
+  // instances of the same asset only pay for one computation. When the
+  // compiled world cache directory is set, entries are also persisted
+  // across runs.
+  std::string cacheKey;
+  std::string cacheFilePath;
+  if (auto contentHash = HashFileContents(fullPath))
+  {
+    std::ostringstream keyStream;
+    keyStream << std::hex << *contentHash << "|" << sdfMesh->Scale()
+              << "|" << density;
+    cacheKey = keyStream.str();
+
+    {
+      std::lock_guard<std::mutex> lock(gInertiaCacheMutex);
+      auto it = gInertiaCache.find(cacheKey);
+      if (it != gInertiaCache.end())
+        return it->second;
+    }
+
+    std::string cacheDir;
+    common::env(kCompiledWorldCachePathEnv, cacheDir);
+    if (!cacheDir.empty())
+    {
+      std::ostringstream fileName;
+      fileName << std::hex << std::hash<std::string>{}(cacheKey)
+               << ".meshinertia";
+      cacheFilePath = common::joinPaths(cacheDir, fileName.str());
+      if (auto cached = ReadCachedInertia(cacheFilePath))
+      {
+        std::lock_guard<std::mutex> lock(gInertiaCacheMutex);
+        gInertiaCache[cacheKey] = *cached;
+        return *cached;
+      }
+    }
+  }
+
   // Load the Mesh
   gz::common::MeshManager *meshManager = gz::common::MeshManager::Instance();
   mesh = meshManager->Load(fullPath);
@@ -243,6 +390,15 @@ std::optional<gz::math::Inertiald> MeshInertiaCalculator::operator()
   else
   {
     meshInertial.SetPose(centreOfMass);
+
+    if (!cacheKey.empty())
+    {
+      std::lock_guard<std::mutex> lock(gInertiaCacheMutex);
+      gInertiaCache[cacheKey] = meshInertial;
+    }
+    if (!cacheFilePath.empty())
+      WriteCachedInertia(cacheFilePath, meshInertial);
+
     return meshInertial;
   }
 }
@@ -15,6 +15,10 @@
  *
 */
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 #include <gz/common/Util.hh>
 #include <gz/common/Console.hh>
 #include "gz/sim/Primitives.hh"
@@ -22,6 +26,34 @@
 using namespace gz;
 using namespace sim;
 
+/////////////////////////////////////////////////
+/// \brief Parse a primitive SDF string once per process and return a clone
+/// of the cached root, so spawning many primitives doesn't re-parse the
+/// same snippet every time.
+/// \param[in] _sdf SDF string of the primitive. May be empty.
+/// \return A clone of the parsed root. An empty root if _sdf is empty or
+/// fails to parse.
+static sdf::Root clonedPrimitiveRoot(const std::string &_sdf)
+{
+  static std::mutex cacheMutex;
+  static std::unordered_map<std::string, sdf::Root> cache;
+
+  if (_sdf.empty())
+    return sdf::Root();
+
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  auto it = cache.find(_sdf);
+  if (it == cache.end())
+  {
+    sdf::Root root;
+    sdf::Errors errors = root.LoadSdfString(_sdf);
+    for (const auto &error : errors)
+      gzerr << error << std::endl;
+    it = cache.emplace(_sdf, std::move(root)).first;
+  }
+  return it->second.Clone();
+}
+
 /////////////////////////////////////////////////
 constexpr const char * kBoxSdf = R"(<?xml version="1.0"?>
 <sdf version="1.9">
@@ -410,3 +442,21 @@ std::string gz::sim::getPrimitive(const std::string &_typeName)
   gzwarn << " - spot\n";
   return "";
 }
+
+/////////////////////////////////////////////////
+sdf::Root gz::sim::getPrimitiveShapeRoot(const PrimitiveShape &_type)
+{
+  return clonedPrimitiveRoot(getPrimitiveShape(_type));
+}
+
+/////////////////////////////////////////////////
+sdf::Root gz::sim::getPrimitiveLightRoot(const PrimitiveLight &_type)
+{
+  return clonedPrimitiveRoot(getPrimitiveLight(_type));
+}
+
+/////////////////////////////////////////////////
+sdf::Root gz::sim::getPrimitiveRoot(const std::string &_typeName)
+{
+  return clonedPrimitiveRoot(getPrimitive(_typeName));
+}
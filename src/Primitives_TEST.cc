@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 
 #include <gz/sim/Primitives.hh>
+#include <sdf/Light.hh>
+#include <sdf/Model.hh>
 #include <sdf/Root.hh>
 
 using PrimitiveShape = gz::sim::PrimitiveShape;
@@ -93,3 +95,35 @@ TEST(Primitives, strings)
     EXPECT_TRUE(errors.empty()) << sdfString;
   }
 }
+
+/////////////////////////////////////////////////
+TEST(Primitives, cachedRoots)
+{
+  auto primitives = {
+    "box", "sphere", "cylinder", "cone", "capsule", "ellipsoid"
+  };
+
+  for (auto prim : primitives)
+  {
+    // Repeated calls clone from the cache and return the same model
+    auto root = gz::sim::getPrimitiveRoot(prim);
+    ASSERT_NE(nullptr, root.Model()) << prim;
+    EXPECT_EQ(prim, root.Model()->Name());
+
+    auto rootAgain = gz::sim::getPrimitiveRoot(prim);
+    ASSERT_NE(nullptr, rootAgain.Model()) << prim;
+    EXPECT_EQ(prim, rootAgain.Model()->Name());
+  }
+
+  auto lights = {"point", "directional", "spot"};
+  for (auto light : lights)
+  {
+    auto root = gz::sim::getPrimitiveRoot(light);
+    EXPECT_NE(nullptr, root.Light()) << light;
+  }
+
+  // Invalid types return an empty root
+  auto invalid = gz::sim::getPrimitiveRoot("foobar");
+  EXPECT_EQ(nullptr, invalid.Model());
+  EXPECT_EQ(nullptr, invalid.Light());
+}
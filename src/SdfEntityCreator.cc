@@ -19,10 +19,14 @@
 
 #include <gz/common/Console.hh>
 #include <gz/common/Profiler.hh>
+#include <gz/common/WorkerPool.hh>
+#include <sdf/Geometry.hh>
+#include <sdf/Mesh.hh>
 #include <sdf/Types.hh>
 
 #include "gz/sim/Events.hh"
 #include "gz/sim/SdfEntityCreator.hh"
+#include "gz/sim/Util.hh"
 
 #include "gz/sim/components/Actor.hh"
 #include "gz/sim/components/AirPressureSensor.hh"
@@ -117,8 +121,37 @@ class gz::sim::SdfEntityCreatorPrivate
 
   /// \brief Parse Gazebo defined materials for visuals
   public: MaterialParser materialParser;
+
+  /// \brief Start decoding a mesh geometry in the background so that
+  /// physics and rendering later find it already cached in
+  /// common::MeshManager instead of each parsing the file on demand.
+  /// \param[in] _geom Geometry that may reference a mesh, may be null.
+  public: void PrefetchMesh(const sdf::Geometry *_geom);
+
+  /// \brief Pool that decodes meshes while the remaining entities are
+  /// still being created. Entity creation itself stays on this thread:
+  /// entity ids are handed out sequentially by the entity component
+  /// manager and recorded in ParentEntity components as they go, so the
+  /// ECM walk cannot be split across threads. The expensive per-model
+  /// work that is independent - mesh parsing - is what runs in parallel.
+  public: common::WorkerPool meshPreloadPool{2u};
 };
 
+/////////////////////////////////////////////////
+void gz::sim::SdfEntityCreatorPrivate::PrefetchMesh(
+    const sdf::Geometry *_geom)
+{
+  if (nullptr != _geom && _geom->Type() == sdf::GeometryType::MESH &&
+      nullptr != _geom->MeshShape())
+  {
+    this->meshPreloadPool.AddWork(
+        [meshSdf = *_geom->MeshShape()]()
+        {
+          loadMesh(meshSdf);
+        });
+  }
+}
+
 using namespace gz;
 using namespace sim;
 
@@ -466,7 +499,12 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Model *_model)
 {
   GZ_PROFILE("SdfEntityCreator::CreateEntities(sdf::Model)");
 
+  // Defer matching the new entities against the views until the whole model
+  // subtree has been created, so each entity is matched once instead of once
+  // per component.
+  this->dataPtr->ecm->BeginComponentBatch();
   auto ent = this->CreateEntities(_model, false);
+  this->dataPtr->ecm->EndComponentBatch();
 
   // Load all model plugins afterwards, so we get scoped name for nested models.
   this->LoadModelPlugins();
@@ -921,6 +959,7 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Visual *_visual)
   {
     this->dataPtr->ecm->CreateComponent(visualEntity,
         components::Geometry(*_visual->Geom()));
+    this->dataPtr->PrefetchMesh(_visual->Geom());
   }
 
   // \todo(louise) Populate with default material if undefined
@@ -1054,6 +1093,7 @@ Entity SdfEntityCreator::CreateEntities(const sdf::Collision *_collision)
   {
     this->dataPtr->ecm->CreateComponent(collisionEntity,
         components::Geometry(*_collision->Geom()));
+    this->dataPtr->PrefetchMesh(_collision->Geom());
   }
 
   this->dataPtr->ecm->CreateComponent(collisionEntity,
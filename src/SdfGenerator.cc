@@ -19,6 +19,7 @@
 
 #include <ctype.h>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include <sdf/sdf.hh>
@@ -275,20 +276,83 @@ namespace sdf_generator
       const EntityComponentManager &_ecm, const Entity &_entity,
       const IncludeUriMap &_includeUriMap,
       const msgs::SdfGeneratorConfig &_config)
+  {
+    WorldGenCache cache;
+    return generateWorld(_ecm, _entity, cache, _includeUriMap, _config);
+  }
+
+  /////////////////////////////////////////////////
+  std::optional<std::string> generateWorld(
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      WorldGenCache &_cache,
+      const IncludeUriMap &_includeUriMap,
+      const msgs::SdfGeneratorConfig &_config)
   {
     sdf::ElementPtr elem = std::make_shared<sdf::Element>();
     sdf::initFile("root.sdf", elem);
     auto worldElem = elem->AddElement("world");
-    if (!updateWorldElement(worldElem, _ecm, _entity, _includeUriMap, _config))
+    if (!updateWorldElement(worldElem, _ecm, _entity, _cache, _includeUriMap,
+                            _config))
       return std::nullopt;
 
     return elem->ToString("");
   }
 
+  /////////////////////////////////////////////////
+  /// \brief Capture the model components that updateModelElement serializes
+  /// so cached model elements can be invalidated when any of them change.
+  /// \param[in] _ecm Immutable reference to the Entity Component Manager
+  /// \param[in] _entity Model entity
+  /// \returns Cache entry holding the current component values. The element
+  /// of the returned entry is left unset.
+  static WorldGenCache::ModelEntry modelCacheSignature(
+      const EntityComponentManager &_ecm, const Entity &_entity)
+  {
+    WorldGenCache::ModelEntry entry;
+
+    auto *nameComp = _ecm.Component<components::Name>(_entity);
+    if (nameComp)
+      entry.name = nameComp->Data();
+
+    auto *poseComp = _ecm.Component<components::Pose>(_entity);
+    if (poseComp)
+      entry.pose = poseComp->Data();
+
+    auto *staticComp = _ecm.Component<components::Static>(_entity);
+    if (staticComp)
+      entry.isStatic = staticComp->Data();
+
+    auto *selfCollideComp = _ecm.Component<components::SelfCollide>(_entity);
+    if (selfCollideComp)
+      entry.selfCollide = selfCollideComp->Data();
+
+    for (const auto &link :
+         _ecm.ChildrenByComponents(_entity, components::Link()))
+    {
+      auto *linkPose = _ecm.Component<components::Pose>(link);
+      entry.linkPoses.push_back(linkPose ? linkPose->Data() : math::Pose3d());
+    }
+
+    return entry;
+  }
+
+  /////////////////////////////////////////////////
+  bool updateWorldElement(sdf::ElementPtr _elem,
+                          const EntityComponentManager &_ecm,
+                          const Entity &_entity,
+                          const IncludeUriMap &_includeUriMap,
+                          const msgs::SdfGeneratorConfig &_config)
+  {
+    WorldGenCache cache;
+    return updateWorldElement(_elem, _ecm, _entity, cache, _includeUriMap,
+                              _config);
+  }
+
   /////////////////////////////////////////////////
   bool updateWorldElement(sdf::ElementPtr _elem,
                           const EntityComponentManager &_ecm,
                           const Entity &_entity,
+                          WorldGenCache &_cache,
                           const IncludeUriMap &_includeUriMap,
                           const msgs::SdfGeneratorConfig &_config)
   {
@@ -329,6 +393,19 @@ namespace sdf_generator
 
     auto worldDir = common::parentPath(worldSdf->Data().Element()->FilePath());
 
+    // Cached elements are only valid for the configuration they were
+    // generated with.
+    const std::string configSignature = _config.SerializeAsString();
+    if (configSignature != _cache.configSignature)
+    {
+      _cache.models.clear();
+      _cache.configSignature = configSignature;
+    }
+
+    // Models whose cache entries are still backed by an entity. Entries not
+    // in this set by the end of the model loop are pruned.
+    std::unordered_set<Entity> liveModels;
+
     // models
     _ecm.Each<components::Model, components::ModelSdf>(
         [&](const Entity &_modelEntity, const components::Model *,
@@ -360,6 +437,37 @@ namespace sdf_generator
 
           if (modelConfig.expand_include_tags().data() || !modelFromInclude)
           {
+            liveModels.insert(_modelEntity);
+
+            auto signature = modelCacheSignature(_ecm, _modelEntity);
+            auto cacheIt = _cache.models.find(_modelEntity);
+            if (cacheIt != _cache.models.end() &&
+                signature.name == cacheIt->second.name &&
+                signature.isStatic == cacheIt->second.isStatic &&
+                signature.selfCollide == cacheIt->second.selfCollide &&
+                signature.linkPoses == cacheIt->second.linkPoses)
+            {
+              // Only the model pose may differ; patch it in place instead of
+              // regenerating the whole element.
+              if (signature.pose != cacheIt->second.pose)
+              {
+                auto poseElem = cacheIt->second.elem->GetElement("pose");
+                for (const auto *attrName :
+                     {"relative_to", "degrees", "rotation_format"})
+                {
+                  sdf::ParamPtr attr = poseElem->GetAttribute(attrName);
+                  if (nullptr != attr)
+                  {
+                    attr->Reset();
+                  }
+                }
+                poseElem->Set(signature.pose);
+                cacheIt->second.pose = signature.pose;
+              }
+              _elem->InsertElement(cacheIt->second.elem);
+              return true;
+            }
+
             auto modelElem = _elem->AddElement("model");
             updateModelElement(modelElem, _ecm, _modelEntity);
 
@@ -369,6 +477,9 @@ namespace sdf_generator
               updateModelElementWithNestedInclude(modelElem,
                     modelConfig.save_fuel_version().data(), _includeUriMap);
             }
+
+            signature.elem = modelElem;
+            _cache.models[_modelEntity] = std::move(signature);
           }
           else if (uriMapIt != _includeUriMap.end())
           {
@@ -422,6 +533,16 @@ namespace sdf_generator
           return true;
         });
 
+    // Drop cache entries for models that were removed or are no longer
+    // generated inline.
+    for (auto iter = _cache.models.begin(); iter != _cache.models.end();)
+    {
+      if (liveModels.find(iter->first) == liveModels.end())
+        iter = _cache.models.erase(iter);
+      else
+        ++iter;
+    }
+
     // lights
     _ecm.Each<components::Light, components::ParentEntity>(
         [&](const Entity &_lightEntity,
@@ -23,6 +23,9 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+#include <gz/math/Pose3d.hh>
 
 #include "gz/sim/EntityComponentManager.hh"
 
@@ -37,6 +40,44 @@ namespace sdf_generator
 {
   using IncludeUriMap = std::unordered_map<std::string, std::string>;
 
+  /// \brief Cache of model elements generated by previous calls to
+  /// generateWorld. Callers that generate the same world repeatedly, such as
+  /// the generate_world_sdf service, can keep one of these between calls so
+  /// that only models that changed since the last call are regenerated.
+  struct WorldGenCache
+  {
+    /// \brief Cached element of one world-level model together with the
+    /// component values it was generated from.
+    struct ModelEntry
+    {
+      /// \brief Generated <model> element. Reinserted verbatim while the
+      /// captured component values still match the ECM.
+      sdf::ElementPtr elem;
+
+      /// \brief Model name at generation time.
+      std::string name;
+
+      /// \brief Model pose at generation time.
+      math::Pose3d pose;
+
+      /// \brief Static flag at generation time.
+      bool isStatic{false};
+
+      /// \brief Self collide flag at generation time.
+      bool selfCollide{false};
+
+      /// \brief Poses of the model's links at generation time.
+      std::vector<math::Pose3d> linkPoses;
+    };
+
+    /// \brief Cached model elements keyed by model entity.
+    std::unordered_map<Entity, ModelEntry> models;
+
+    /// \brief Serialized generator configuration the cache was built with.
+    /// The cache is discarded when the configuration changes.
+    std::string configSignature;
+  };
+
   /// \brief Generate the SDFormat representation of a world
   /// \input[in] _ecm Immutable reference to the Entity Component Manager
   /// \input[in] _entity World entity
@@ -51,6 +92,26 @@ namespace sdf_generator
       const IncludeUriMap &_includeUriMap = IncludeUriMap(),
       const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
 
+  /// \brief Generate the SDFormat representation of a world, reusing model
+  /// elements cached by a previous call for models that have not changed
+  /// since.
+  /// \input[in] _ecm Immutable reference to the Entity Component Manager
+  /// \input[in] _entity World entity
+  /// \input[in, out] _cache Cache of previously generated model elements,
+  /// updated to reflect this call. Cached elements are reparented into the
+  /// generated world, so the cache must not be shared between worlds.
+  /// \input[in] _includeUriMap Map from file paths to URIs used to preserve
+  /// included Fuel models
+  /// \input[in] _config Configuration for the world generator
+  /// \returns Generated world string if generation succeeded.
+  /// Otherwise, nullopt
+  GZ_SIM_VISIBLE
+  std::optional<std::string> generateWorld(
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      WorldGenCache &_cache,
+      const IncludeUriMap &_includeUriMap = IncludeUriMap(),
+      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
+
   /// \brief Update a sdf::Element of a world. Intended for internal use.
   /// \input[in, out] _elem sdf::Element to update
   /// \input[in] _ecm Immutable reference to the Entity Component Manager
@@ -65,6 +126,24 @@ namespace sdf_generator
       const IncludeUriMap &_includeUriMap = IncludeUriMap(),
       const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
 
+  /// \brief Update a sdf::Element of a world, reusing cached model elements
+  /// for models that have not changed. Intended for internal use.
+  /// \input[in, out] _elem sdf::Element to update
+  /// \input[in] _ecm Immutable reference to the Entity Component Manager
+  /// \input[in] _entity World entity
+  /// \input[in, out] _cache Cache of previously generated model elements,
+  /// updated to reflect this call
+  /// \input[in] _includeUriMap Map from file paths to URIs used to preserve
+  /// included Fuel models
+  /// \input[in] _config Configuration for the world generator
+  GZ_SIM_VISIBLE
+  bool updateWorldElement(
+      sdf::ElementPtr _elem,
+      const EntityComponentManager &_ecm, const Entity &_entity,
+      WorldGenCache &_cache,
+      const IncludeUriMap &_includeUriMap = IncludeUriMap(),
+      const msgs::SdfGeneratorConfig &_config = msgs::SdfGeneratorConfig());
+
   /// \brief Update a sdf::Element of an inlined model.
   /// Intended for internal use.
   /// \input[in, out] _elem sdf::Element to update
@@ -980,6 +980,52 @@ TEST_F(GenerateWorldFixture, ModelsInline)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(GenerateWorldFixture, CachedGeneration)
+{
+  this->LoadWorld(common::joinPaths("test", "worlds", "shapes.sdf"));
+  Entity worldEntity = this->ecm.EntityByComponents(components::World());
+  Entity boxEntity = this->ecm.EntityByComponents(
+      components::Model(), components::Name("box"));
+  ASSERT_NE(kNullEntity, boxEntity);
+
+  sdf_generator::WorldGenCache cache;
+  const auto first = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(cache.models.find(boxEntity) != cache.models.end());
+  const sdf::ElementPtr cachedElem = cache.models[boxEntity].elem;
+
+  // Nothing changed, so cached elements are reused and the output matches.
+  const auto second = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(*first, *second);
+  EXPECT_EQ(cachedElem, cache.models[boxEntity].elem);
+
+  // A pose change is patched into the cached element instead of
+  // regenerating it.
+  auto *poseComp = this->ecm.Component<components::Pose>(boxEntity);
+  math::Pose3d newPose{10, 20, 30, 0, 0, 0};
+  *poseComp = components::Pose(newPose);
+
+  const auto moved = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(moved.has_value());
+  EXPECT_NE(*second, *moved);
+  EXPECT_EQ(cachedElem, cache.models[boxEntity].elem);
+  EXPECT_EQ(newPose, cachedElem->Get<math::Pose3d>("pose"));
+
+  // Renaming invalidates the cached element.
+  auto *nameComp = this->ecm.Component<components::Name>(boxEntity);
+  *nameComp = components::Name("box_renamed");
+  const auto renamed = sdf_generator::generateWorld(
+      this->ecm, worldEntity, cache, this->includeUriMap, this->sdfGenConfig);
+  ASSERT_TRUE(renamed.has_value());
+  EXPECT_NE(cachedElem, cache.models[boxEntity].elem);
+  EXPECT_NE(renamed->find("box_renamed"), std::string::npos);
+}
+
 /////////////////////////////////////////////////
 TEST_F(GenerateWorldFixture, PoseWithAttributes)
 {
@@ -124,6 +124,9 @@ Server::Server(const ServerConfig &_config)
       sdfParserConfig.SetStoreResolvedURIs(true);
       sdfParserConfig.SetCalculateInertialConfiguration(
         sdf::ConfigureResolveAutoInertials::SKIP_CALCULATION_IN_LOAD);
+      // Download remote resources up front and in parallel, so the serial
+      // find callbacks used while parsing hit the local cache.
+      this->dataPtr->PrefetchResources("", _config.SdfString());
       errors = this->dataPtr->sdfRoot.LoadSdfString(
         _config.SdfString(), sdfParserConfig);
       this->dataPtr->sdfRoot.ResolveAutoInertials(errors, sdfParserConfig);
@@ -152,6 +155,10 @@ Server::Server(const ServerConfig &_config)
 
       MeshInertiaCalculator meshInertiaCalculator;
       sdfParserConfig.RegisterCustomInertiaCalc(meshInertiaCalculator);
+      // Download remote resources up front and in parallel, so the serial
+      // find callbacks used while parsing hit the local cache.
+      this->dataPtr->PrefetchResources(filePath, "");
+
       // \todo(nkoenig) Async resource download.
       // This call can block for a long period of time while
       // resources are downloaded. Blocking here causes the GUI to block with
@@ -283,6 +290,77 @@ bool Server::Run(const bool _blocking, const uint64_t _iterations,
   return false;
 }
 
+/////////////////////////////////////////////////
+std::future<bool> Server::RunAsync(const uint64_t _iterations,
+    const bool _paused)
+{
+  // Set the initial pause state of each simulation runner.
+  for (std::unique_ptr<SimulationRunner> &runner : this->dataPtr->simRunners)
+    runner->SetPaused(_paused);
+
+  std::promise<bool> promise;
+  std::future<bool> future = promise.get_future();
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->runMutex);
+  if (!this->dataPtr->sigHandler.Initialized())
+  {
+    gzerr << "Signal handlers were not created. The server won't run.\n";
+    promise.set_value(false);
+    return future;
+  }
+
+  // Do not allow running more than once.
+  if (this->dataPtr->running ||
+      this->dataPtr->runThread.get_id() != std::thread::id())
+  {
+    gzwarn << "The server is already running.\n";
+    promise.set_value(false);
+    return future;
+  }
+
+  // The caller observes completion through the future, so unlike
+  // Run(false, ...) there is no need to block until the run starts.
+  this->dataPtr->runThread = std::thread(
+      [runner = this->dataPtr.get(), _iterations,
+       runPromise = std::move(promise)]() mutable
+      {
+        runPromise.set_value(runner->Run(_iterations));
+      });
+
+  return future;
+}
+
+/////////////////////////////////////////////////
+bool Server::RunUntil(const std::function<
+    bool(const UpdateInfo &, const EntityComponentManager &)> &_condition,
+    const uint64_t _iterations, const unsigned int _worldIndex)
+{
+  if (!_condition)
+  {
+    gzerr << "An empty condition was passed to RunUntil. The server won't "
+      << "run." << std::endl;
+    return false;
+  }
+
+  if (_worldIndex >= this->dataPtr->simRunners.size())
+  {
+    gzerr << "World index [" << _worldIndex << "] is invalid. The server "
+      << "won't run." << std::endl;
+    return false;
+  }
+
+  auto &runner = this->dataPtr->simRunners[_worldIndex];
+  runner->SetStopCondition(_condition);
+
+  // Run in the current thread so the condition is evaluated in-process
+  // after every step, without any per-step round trips.
+  this->Run(true, _iterations, false);
+
+  const bool triggered = runner->StopConditionTriggered();
+  runner->SetStopCondition(nullptr);
+  return triggered;
+}
+
 /////////////////////////////////////////////////
 bool Server::RunOnce(const bool _paused)
 {
@@ -485,6 +563,26 @@ bool Server::RequestRemoveEntity(const Entity _entity,
   return false;
 }
 
+//////////////////////////////////////////////////
+bool Server::SaveCheckpoint(const std::string &_name,
+    const unsigned int _worldIndex)
+{
+  if (_worldIndex < this->dataPtr->simRunners.size())
+    return this->dataPtr->simRunners[_worldIndex]->SaveCheckpoint(_name);
+
+  return false;
+}
+
+//////////////////////////////////////////////////
+bool Server::RestoreCheckpoint(const std::string &_name,
+    const unsigned int _worldIndex)
+{
+  if (_worldIndex < this->dataPtr->simRunners.size())
+    return this->dataPtr->simRunners[_worldIndex]->RestoreCheckpoint(_name);
+
+  return false;
+}
+
 //////////////////////////////////////////////////
 void Server::Stop()
 {
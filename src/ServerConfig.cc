@@ -18,6 +18,8 @@
 
 #include <tinyxml2.h>
 
+#include <algorithm>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Util.hh>
@@ -190,6 +192,11 @@ class gz::sim::ServerConfigPrivate
             updateRate(_cfg->updateRate),
             initialSimTime(_cfg->initialSimTime),
             useLevels(_cfg->useLevels),
+            profileSystems(_cfg->profileSystems),
+            tracePath(_cfg->tracePath),
+            stepBatchSize(_cfg->stepBatchSize),
+            worldReplication(_cfg->worldReplication),
+            postUpdateCpuAffinity(_cfg->postUpdateCpuAffinity),
             useLogRecord(_cfg->useLogRecord),
             logRecordPath(_cfg->logRecordPath),
             logRecordPeriod(_cfg->logRecordPeriod),
@@ -226,6 +233,23 @@ class gz::sim::ServerConfigPrivate
   /// \brief Use the level system
   public: bool useLevels{false};
 
+  /// \brief Record per-system update timing and publish it on the world's
+  /// system_timing topic
+  public: bool profileSystems{false};
+
+  /// \brief File to write Chrome-trace output to; empty disables tracing
+  public: std::string tracePath{""};
+
+  /// \brief Number of simulation steps between runs of per-step housekeeping
+  public: unsigned int stepBatchSize{1u};
+
+  /// \brief Number of copies of each world to instantiate
+  public: unsigned int worldReplication{1u};
+
+  /// \brief CPUs to pin PostUpdate worker threads to; empty leaves
+  /// placement to the scheduler
+  public: std::vector<unsigned int> postUpdateCpuAffinity;
+
   /// \brief Use the logging system to record states
   public: bool useLogRecord{false};
 
@@ -400,6 +424,67 @@ void ServerConfig::SetUseLevels(const bool _levels)
   this->dataPtr->useLevels = _levels;
 }
 
+/////////////////////////////////////////////////
+bool ServerConfig::ProfileSystems() const
+{
+  return this->dataPtr->profileSystems;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetProfileSystems(const bool _profile)
+{
+  this->dataPtr->profileSystems = _profile;
+}
+
+/////////////////////////////////////////////////
+std::string ServerConfig::TracePath() const
+{
+  return this->dataPtr->tracePath;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetTracePath(const std::string &_path)
+{
+  this->dataPtr->tracePath = _path;
+}
+
+/////////////////////////////////////////////////
+unsigned int ServerConfig::StepBatchSize() const
+{
+  return this->dataPtr->stepBatchSize;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetStepBatchSize(const unsigned int _size)
+{
+  this->dataPtr->stepBatchSize = std::max(1u, _size);
+}
+
+/////////////////////////////////////////////////
+unsigned int ServerConfig::WorldReplication() const
+{
+  return this->dataPtr->worldReplication;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetWorldReplication(const unsigned int _count)
+{
+  this->dataPtr->worldReplication = std::max(1u, _count);
+}
+
+/////////////////////////////////////////////////
+const std::vector<unsigned int> &ServerConfig::PostUpdateCpuAffinity() const
+{
+  return this->dataPtr->postUpdateCpuAffinity;
+}
+
+/////////////////////////////////////////////////
+void ServerConfig::SetPostUpdateCpuAffinity(
+    const std::vector<unsigned int> &_cpus)
+{
+  this->dataPtr->postUpdateCpuAffinity = _cpus;
+}
+
 /////////////////////////////////////////////////
 void ServerConfig::SetNetworkSecondaries(unsigned int _secondaries)
 {
@@ -18,6 +18,9 @@
 
 #include <tinyxml2.h>
 
+#include <functional>
+#include <unordered_set>
+
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/server_control.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
@@ -27,6 +30,7 @@
 #include <sdf/World.hh>
 
 #include <gz/common/Console.hh>
+#include <gz/common/Profiler.hh>
 #include <gz/common/Util.hh>
 
 #include <gz/fuel_tools/Interface.hh>
@@ -89,9 +93,40 @@ struct LoggingPlugin
   }
 };
 
+namespace {
+//////////////////////////////////////////////////
+/// \brief Get a SystemLoader shared by all servers in this process, so
+/// plugin libraries are loaded once no matter how many worlds use them.
+SystemLoaderPtr ProcessSystemLoader()
+{
+  static std::mutex loaderMutex;
+  static std::weak_ptr<SystemLoader> processLoader;
+
+  std::lock_guard<std::mutex> lock(loaderMutex);
+  auto loader = processLoader.lock();
+  if (!loader)
+  {
+    loader = std::make_shared<SystemLoader>();
+    processLoader = loader;
+  }
+  return loader;
+}
+
+//////////////////////////////////////////////////
+/// \brief Check whether servers in this process should share immutable
+/// resources, set with the GZ_SIM_SHARED_RESOURCES environment variable.
+bool UseSharedResources()
+{
+  std::string sharedEnv;
+  return common::env("GZ_SIM_SHARED_RESOURCES", sharedEnv) &&
+      !sharedEnv.empty() && sharedEnv != "0";
+}
+}
+
 //////////////////////////////////////////////////
 ServerPrivate::ServerPrivate()
-: systemLoader(std::make_shared<SystemLoader>())
+: systemLoader(UseSharedResources() ? ProcessSystemLoader()
+                                    : std::make_shared<SystemLoader>())
 {
   // Add the signal handler
   this->sigHandler.AddCallback(
@@ -307,20 +342,34 @@ void ServerPrivate::AddRecordPlugin(const ServerConfig &_config)
 //////////////////////////////////////////////////
 void ServerPrivate::CreateEntities()
 {
-  // Create a simulation runner for each world.
+  const unsigned int replicas = this->config.WorldReplication();
+
+  // Create a simulation runner for each world. When world replication is
+  // enabled, each world is instantiated multiple times under a suffixed
+  // name; the copies are independent and are stepped in parallel by the
+  // worker pool in ServerPrivate::Run.
   for (uint64_t worldIndex = 0; worldIndex <
        this->sdfRoot.WorldCount(); ++worldIndex)
   {
     sdf::World *world = this->sdfRoot.WorldByIndex(worldIndex);
 
+    for (unsigned int replica = 0; replica < replicas; ++replica)
     {
-      std::lock_guard<std::mutex> lock(this->worldsMutex);
-      this->worldNames.push_back(world->Name());
+      sdf::World replicaWorld = *world;
+      if (replicas > 1)
+      {
+        replicaWorld.SetName(world->Name() + "_" + std::to_string(replica));
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(this->worldsMutex);
+        this->worldNames.push_back(replicaWorld.Name());
+      }
+      auto runner = std::make_unique<SimulationRunner>(
+          replicaWorld, this->systemLoader, this->config);
+      runner->SetFuelUriMap(this->fuelUriMap);
+      this->simRunners.push_back(std::move(runner));
     }
-    auto runner = std::make_unique<SimulationRunner>(
-        *world, this->systemLoader, this->config);
-    runner->SetFuelUriMap(this->fuelUriMap);
-    this->simRunners.push_back(std::move(runner));
   }
 }
 
@@ -576,10 +625,19 @@ std::string ServerPrivate::FetchResource(const std::string &_uri)
   if (_uri == kClassicMaterialScriptUri)
     return _uri;
 
+  {
+    std::lock_guard<std::mutex> lock(this->fetchMutex);
+    auto it = this->fetchCache.find(_uri);
+    if (it != this->fetchCache.end())
+      return it->second;
+  }
+
   // Fetch resource from fuel
   auto path =
       fuel_tools::fetchResourceWithClient(_uri, *this->fuelClient.get());
 
+  std::lock_guard<std::mutex> lock(this->fetchMutex);
+  this->fetchCache[_uri] = path;
   if (!path.empty())
   {
     for (auto &runner : this->simRunners)
@@ -596,3 +654,67 @@ std::string ServerPrivate::FetchResourceUri(const common::URI &_uri)
 {
   return this->FetchResource(_uri.Str());
 }
+
+//////////////////////////////////////////////////
+void ServerPrivate::PrefetchResources(const std::string &_sdfFile,
+    const std::string &_sdfString)
+{
+  GZ_PROFILE("ServerPrivate::PrefetchResources");
+
+  tinyxml2::XMLDocument doc;
+  if (!_sdfFile.empty())
+  {
+    if (doc.LoadFile(_sdfFile.c_str()) != tinyxml2::XML_SUCCESS)
+      return;
+  }
+  else if (doc.Parse(_sdfString.c_str()) != tinyxml2::XML_SUCCESS)
+  {
+    return;
+  }
+
+  // Collect the distinct remote URIs referenced by the document. Local
+  // model:// and file:// references resolve without the network, so they
+  // are left to the regular find callbacks.
+  std::unordered_set<std::string> uris;
+  std::function<void(const tinyxml2::XMLElement *)> collectUris =
+      [&uris, &collectUris](const tinyxml2::XMLElement *_elem)
+      {
+        for (auto el = _elem->FirstChildElement(); nullptr != el;
+            el = el->NextSiblingElement())
+        {
+          if (std::string("uri") == el->Name() && nullptr != el->GetText())
+          {
+            const std::string uri = common::trimmed(el->GetText());
+            if (uri.rfind("http://", 0) == 0 ||
+                uri.rfind("https://", 0) == 0 ||
+                uri.rfind("fuel://", 0) == 0)
+            {
+              uris.insert(uri);
+            }
+          }
+          collectUris(el);
+        }
+      };
+  if (nullptr != doc.RootElement())
+    collectUris(doc.RootElement());
+
+  if (uris.empty())
+    return;
+
+  gzmsg << "Prefetching [" << uris.size() << "] remote resource(s)."
+        << std::endl;
+
+  // Fetch with bounded parallelism. FetchResource memoizes each result, so
+  // the find callbacks used while parsing the document afterwards resolve
+  // from the local cache. Resources referenced only by the downloaded
+  // models themselves are still fetched serially during the parse.
+  common::WorkerPool pool(4u);
+  for (const std::string &uri : uris)
+  {
+    pool.AddWork([this, uri]()
+        {
+          this->FetchResource(uri);
+        });
+  }
+  pool.WaitForResults();
+}
@@ -99,6 +99,17 @@ namespace gz
       /// \return Path to the downloaded resource, empty on error.
       public: std::string FetchResourceUri(const common::URI &_uri);
 
+      /// \brief Scan an SDF document for remote resource URIs and fetch
+      /// them concurrently with bounded parallelism, before the document is
+      /// parsed. The results are memoized, so the serial find callbacks
+      /// invoked during parsing then resolve from the local cache instead
+      /// of making network round trips one at a time.
+      /// \param[in] _sdfFile Path to an SDF file to scan. Takes precedence
+      /// over _sdfString when not empty.
+      /// \param[in] _sdfString SDF XML string to scan.
+      public: void PrefetchResources(const std::string &_sdfFile,
+          const std::string &_sdfString);
+
       /// \brief Signal handler callback
       /// \param[in] _sig The signal number
       private: void OnSignal(int _sig);
@@ -173,7 +184,9 @@ namespace gz
       /// terminate the server where checking `running` is not sufficient.
       public: std::atomic<bool> signalReceived{false};
 
-      /// \brief Our system loader.
+      /// \brief Our system loader. Shared with every SimulationRunner in
+      /// this server, and with all other servers in the process when the
+      /// GZ_SIM_SHARED_RESOURCES environment variable is set.
       public: SystemLoaderPtr systemLoader;
 
       /// \brief The SDF root object.
@@ -191,6 +204,15 @@ namespace gz
       /// Server. It is used in the SDFormat world generator when saving worlds
       public: std::unordered_map<std::string, std::string> fuelUriMap;
 
+      /// \brief Mutex protecting fetchCache and fuelUriMap, which are
+      /// touched concurrently while resources are being prefetched.
+      public: std::mutex fetchMutex;
+
+      /// \brief Memoized FetchResource results keyed by URI, including
+      /// failed lookups, so each URI is resolved over the network at most
+      /// once per process.
+      public: std::unordered_map<std::string, std::string> fetchCache;
+
       /// \brief Gazebo classic material URI string
       /// A URI matching this string indicates that it is a gazebo classic
       /// material.
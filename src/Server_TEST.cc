@@ -23,6 +23,7 @@
 #include <gz/msgs/stringmsg_v.pb.h>
 
 #include <csignal>
+#include <future>
 #include <vector>
 #include <gz/common/StringUtils.hh>
 #include <gz/common/Util.hh>
@@ -514,6 +515,34 @@ TEST_P(ServerFixture, SdfStringServerConfig)
   EXPECT_EQ(2u, *server.SystemCount());
 }
 
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, WorldReplication)
+{
+  ServerConfig serverConfig;
+  serverConfig.SetSdfFile(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+  serverConfig.SetWorldReplication(3);
+  EXPECT_EQ(3u, serverConfig.WorldReplication());
+
+  sim::Server server(serverConfig);
+  server.SetUpdatePeriod(1ns);
+
+  // Each world copy is an independent simulation runner.
+  for (unsigned int worldIndex = 0; worldIndex < 3; ++worldIndex)
+  {
+    EXPECT_TRUE(server.HasEntity("box", worldIndex));
+    EXPECT_EQ(0u, *server.IterationCount(worldIndex));
+  }
+  EXPECT_FALSE(server.IterationCount(3).has_value());
+
+  // All copies are stepped when the server runs.
+  EXPECT_TRUE(server.Run(true, 5, false));
+  for (unsigned int worldIndex = 0; worldIndex < 3; ++worldIndex)
+  {
+    EXPECT_EQ(5u, *server.IterationCount(worldIndex));
+  }
+}
+
 /////////////////////////////////////////////////
 TEST_P(ServerFixture, RunBlocking)
 {
@@ -540,6 +569,44 @@ TEST_P(ServerFixture, RunBlocking)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, RunUntil)
+{
+  sim::Server server;
+  EXPECT_FALSE(server.Running());
+  EXPECT_EQ(0u, *server.IterationCount());
+
+  // Make the server run fast.
+  server.SetUpdatePeriod(1ns);
+
+  // An empty condition should refuse to run.
+  EXPECT_FALSE(server.RunUntil(nullptr));
+
+  // An invalid world index should refuse to run.
+  EXPECT_FALSE(server.RunUntil([](const UpdateInfo &,
+      const EntityComponentManager &)
+      {
+        return true;
+      }, 0, 1));
+
+  // Run until a number of iterations is reached.
+  EXPECT_TRUE(server.RunUntil([](const UpdateInfo &_info,
+      const EntityComponentManager &)
+      {
+        return _info.iterations >= 10;
+      }));
+  EXPECT_FALSE(server.Running());
+  EXPECT_EQ(10u, *server.IterationCount());
+
+  // The iteration limit stops the run before the condition triggers.
+  EXPECT_FALSE(server.RunUntil([](const UpdateInfo &_info,
+      const EntityComponentManager &)
+      {
+        return _info.iterations >= 1000;
+      }, 5));
+  EXPECT_EQ(15u, *server.IterationCount());
+}
+
 /////////////////////////////////////////////////
 TEST_P(ServerFixture, RunNonBlockingPaused)
 {
@@ -610,6 +677,31 @@ TEST_P(ServerFixture, RunNonBlocking)
   EXPECT_FALSE(*server.Running(0));
 }
 
+/////////////////////////////////////////////////
+TEST_P(ServerFixture, RunAsync)
+{
+  sim::Server server;
+  EXPECT_FALSE(server.Running());
+  EXPECT_EQ(0u, *server.IterationCount());
+
+  // Make the server run fast.
+  server.SetUpdatePeriod(1ns);
+
+  std::future<bool> future = server.RunAsync(100, false);
+  EXPECT_TRUE(future.valid());
+  EXPECT_TRUE(future.get());
+
+  EXPECT_EQ(100u, *server.IterationCount());
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  // As with Run(false, ...), a server can only be run once, so a second
+  // request yields an immediately-ready future holding false.
+  std::future<bool> again = server.RunAsync(100, false);
+  EXPECT_TRUE(again.valid());
+  EXPECT_FALSE(again.get());
+}
+
 /////////////////////////////////////////////////
 TEST_P(ServerFixture, GZ_UTILS_TEST_DISABLED_ON_WIN32(RunOnceUnpaused))
 {
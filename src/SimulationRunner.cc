@@ -17,8 +17,20 @@
 
 #include "SimulationRunner.hh"
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
 #include <unordered_set>
+#include <utility>
 #ifdef HAVE_PYBIND11
 #include <pybind11/pybind11.h>
 #endif
@@ -36,8 +48,13 @@
 #include <sdf/Root.hh>
 #include <vector>
 
+#include "ChromeTracer.hh"
+#include "gz/common/Filesystem.hh"
 #include "gz/common/Profiler.hh"
+#include "gz/common/Util.hh"
 #include "gz/sim/Constants.hh"
+#include "gz/sim/Conversions.hh"
+#include "gz/sim/components/Factory.hh"
 #include "gz/sim/components/Model.hh"
 #include "gz/sim/components/Name.hh"
 #include "gz/sim/components/Sensor.hh"
@@ -51,6 +68,7 @@
 #include "gz/sim/components/RenderEngineGuiPlugin.hh"
 #include "gz/sim/components/RenderEngineServerHeadless.hh"
 #include "gz/sim/components/RenderEngineServerPlugin.hh"
+#include "gz/sim/components/SystemPluginInfo.hh"
 #include "gz/sim/Events.hh"
 #include "gz/sim/ServerConfig.hh"
 #include "gz/sim/SdfEntityCreator.hh"
@@ -65,6 +83,10 @@ using namespace sim;
 using StringSet = std::unordered_set<std::string>;
 
 namespace {
+/// \brief Magic bytes identifying a compiled world cache file. The payload
+/// carries its own format version, checked by SetRawState.
+constexpr char kCompiledWorldMagic[] = "GZSIMWLD";
+
 #ifdef HAVE_PYBIND11
 // Helper struct to maybe do a scoped release of the Python GIL. There are a
 // number of ways where releasing and acquiring the GIL is not necessary:
@@ -93,6 +115,55 @@ struct MaybeGilScopedRelease
     MaybeGilScopedRelease(){}
   };
 #endif
+
+/// \brief Match a glob pattern supporting `*` and `?` against a string.
+/// \param[in] _pattern Glob pattern.
+/// \param[in] _text Text to match.
+/// \return True if the pattern matches the whole text.
+bool GlobMatch(const std::string &_pattern, const std::string &_text)
+{
+  std::size_t p = 0;
+  std::size_t t = 0;
+  std::size_t star = std::string::npos;
+  std::size_t starText = 0;
+  while (t < _text.size())
+  {
+    if (p < _pattern.size() &&
+        (_pattern[p] == '?' || _pattern[p] == _text[t]))
+    {
+      ++p;
+      ++t;
+    }
+    else if (p < _pattern.size() && _pattern[p] == '*')
+    {
+      star = p++;
+      starText = t;
+    }
+    else if (star != std::string::npos)
+    {
+      p = star + 1;
+      t = ++starText;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  while (p < _pattern.size() && _pattern[p] == '*')
+    ++p;
+  return p == _pattern.size();
+}
+
+/// \brief Serialize a model DOM so changed models can be detected on
+/// SDF reload.
+/// \param[in] _model Model to serialize.
+/// \return The model's SDF description, or an empty string if the model
+/// has no backing element.
+std::string ModelSdfString(const sdf::Model &_model)
+{
+  auto elem = _model.Element();
+  return elem ? elem->ToString("") : std::string();
+}
 }
 
 
@@ -116,6 +187,39 @@ SimulationRunner::SimulationRunner(const sdf::World &_world,
     gz::transport::parameters::ParametersRegistry>(
       std::string{"world/"} + this->worldName);
 
+  std::string parallelEnv;
+  if (common::env("GZ_SIM_PARALLEL_SYSTEM_UPDATE", parallelEnv) &&
+      !parallelEnv.empty() && parallelEnv != "0")
+  {
+    this->parallelSystemUpdate = true;
+  }
+
+  std::string historyEnv;
+  if (common::env(kStepHistoryEnv, historyEnv) && !historyEnv.empty())
+  {
+    try
+    {
+      this->stepHistorySize = std::stoul(historyEnv);
+    }
+    catch (const std::exception &)
+    {
+      gzerr << "Invalid " << kStepHistoryEnv << " value [" << historyEnv
+            << "]. Step history disabled." << std::endl;
+    }
+  }
+
+  this->profileSystems = _config.ProfileSystems();
+  this->stepBatchSize = std::max(1u, _config.StepBatchSize());
+  this->postUpdateCpuAffinity = _config.PostUpdateCpuAffinity();
+
+  if (!_config.TracePath().empty())
+  {
+    // The tracer is process-wide; only the runner that started it stops
+    // it, so a second world in the same process doesn't truncate the
+    // first one's trace.
+    this->startedTrace = ChromeTracer::Instance().Start(_config.TracePath());
+  }
+
   // Get the physics profile
   // TODO(luca): remove duplicated logic in SdfEntityCreator and LevelManager
   const sdf::Physics *physics = _world.PhysicsByIndex(0);
@@ -295,12 +399,50 @@ SimulationRunner::SimulationRunner(const sdf::World &_world,
 
   gzmsg << "Serving world SDF generation service on [" << opts.NameSpace()
          << "/" << genWorldSdfService << "]" << std::endl;
+
+  std::string ecmStatsService{"ecm/stats"};
+  this->node->Advertise(
+      ecmStatsService, &SimulationRunner::EcmStatsService, this);
+
+  gzmsg << "Serving ECM statistics on [" << opts.NameSpace() << "/"
+         << ecmStatsService << "]" << std::endl;
+
+  std::string entityQueryService{"entity/query"};
+  this->node->Advertise(
+      entityQueryService, &SimulationRunner::EntityQueryService, this);
+
+  gzmsg << "Serving entity queries on [" << opts.NameSpace() << "/"
+         << entityQueryService << "]" << std::endl;
+
+  // Record the description of each model loaded from the world file so
+  // that a reload only touches models whose description changed.
+  for (uint64_t i = 0; i < this->sdfWorld.ModelCount(); ++i)
+  {
+    const sdf::Model *model = this->sdfWorld.ModelByIndex(i);
+    this->reloadModelStrings[model->Name()] = ModelSdfString(*model);
+  }
+
+  std::string reloadService{"reload_sdf"};
+  this->node->Advertise(reloadService, &SimulationRunner::OnReloadSdf, this);
+
+  gzmsg << "Serving SDF reload on [" << opts.NameSpace() << "/"
+         << reloadService << "]" << std::endl;
+
+  if (this->profileSystems)
+  {
+    this->systemTimingPub =
+        this->node->Advertise<msgs::StringMsg>("system_timing");
+    gzmsg << "Publishing system timing on [" << opts.NameSpace()
+           << "/system_timing]" << std::endl;
+  }
 }
 
 //////////////////////////////////////////////////
 SimulationRunner::~SimulationRunner()
 {
   this->StopWorkerThreads();
+  if (this->startedTrace)
+    ChromeTracer::Instance().Stop();
 }
 
 /////////////////////////////////////////////////
@@ -324,6 +466,9 @@ void SimulationRunner::UpdateCurrentInfo()
     this->resetInitiated = true;
     this->requestedRewind = false;
 
+    // Retained step snapshots describe the abandoned timeline.
+    this->stepHistory.clear();
+
     return;
   }
 
@@ -335,9 +480,21 @@ void SimulationRunner::UpdateCurrentInfo()
 
     this->realTimeFactor = 0;
 
-    this->currentInfo.dt = this->requestedSeek.value() -
-      this->currentInfo.simTime;
-    this->currentInfo.simTime = this->requestedSeek.value();
+    auto target = this->requestedSeek.value();
+
+    // Backward seeks within the retained step history restore the nearest
+    // snapshot, so short rewinds are a state swap instead of a full reset
+    // and replay. Outside the horizon the seek only moves the clock, as
+    // before.
+    if (target < this->currentInfo.simTime)
+    {
+      auto restored = this->RestoreStepHistory(target);
+      if (restored)
+        target = *restored;
+    }
+
+    this->currentInfo.dt = target - this->currentInfo.simTime;
+    this->currentInfo.simTime = target;
     this->currentInfo.iterations = 0;
 
     this->currentInfo.realTime = this->realTimeWatch.ElapsedRunTime();
@@ -466,6 +623,16 @@ void SimulationRunner::PublishStats()
     msg.set_stepping(true);
   }
 
+  // Expose the measured sleep oversleep so rate-keeping accuracy can be
+  // monitored externally.
+  {
+    auto headerData = msg.mutable_header()->add_data();
+    headerData->set_key("sleep_offset_ns");
+    headerData->add_value(std::to_string(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            this->sleepOffset).count()));
+  }
+
   // Publish the stats message. The stats message is throttled.
   this->statsPub.Publish(msg);
 
@@ -491,6 +658,25 @@ void SimulationRunner::PublishStats()
 
 namespace {
 
+/// \brief Look up the name of the active system owning one of the given
+/// update interface pointers, for timing output.
+/// \param[in] _systems Active systems.
+/// \param[in] _iface One of a system's update interface pointers.
+/// \return The system's name, or a placeholder if it has none.
+std::string SystemNameFor(const std::vector<SystemInternal> &_systems,
+    const void *_iface)
+{
+  for (const auto &system : _systems)
+  {
+    if (system.preupdate == _iface || system.update == _iface ||
+        system.postupdate == _iface)
+    {
+      return system.name.empty() ? std::string("<unnamed>") : system.name;
+    }
+  }
+  return "<unknown>";
+}
+
 // Create an sdf::ElementPtr that corresponds to an empty `<plugin>` element.
 sdf::ElementPtr createEmptyPluginElement()
 {
@@ -548,11 +734,27 @@ void SimulationRunner::ProcessSystemQueue()
   this->postUpdateThreadsRunning = true;
   int id = 0;
 
+  if (this->profileSystems)
+  {
+    const auto count = this->systemMgr->SystemsPostUpdate().size();
+    this->postUpdateTimingsMs.assign(count, 0.0);
+    this->postUpdateTimingNames.clear();
+    for (const auto &system : this->systemMgr->SystemsPostUpdate())
+    {
+      this->postUpdateTimingNames.push_back(
+          SystemNameFor(this->systemMgr->ActiveSystems(), system));
+    }
+  }
+
   for (auto &system : this->systemMgr->SystemsPostUpdate())
   {
     gzdbg << "Creating postupdate worker thread (" << id << ")" << std::endl;
 
-    this->postUpdateThreads.push_back(std::thread([&, id]()
+    // Resolved once here so tracing doesn't pay a name lookup per step.
+    const std::string sysName =
+        SystemNameFor(this->systemMgr->ActiveSystems(), system);
+
+    this->postUpdateThreads.push_back(std::thread([&, id, sysName]()
     {
       std::stringstream ss;
       ss << "PostUpdateThread: " << id;
@@ -562,17 +764,170 @@ void SimulationRunner::ProcessSystemQueue()
         this->postUpdateStartBarrier->Wait();
         if (this->postUpdateThreadsRunning)
         {
-          system->PostUpdate(this->currentInfo, this->entityCompMgr);
+          const bool tracing = ChromeTracer::Instance().Active();
+          if (this->profileSystems || tracing)
+          {
+            const auto start = std::chrono::steady_clock::now();
+            system->PostUpdate(this->currentInfo, this->entityCompMgr);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            if (this->profileSystems)
+            {
+              this->postUpdateTimingsMs[id] =
+                  std::chrono::duration<double, std::milli>(elapsed).count();
+            }
+            if (tracing)
+            {
+              ChromeTracer::Instance().AddCompleteEvent(
+                  "PostUpdate " + sysName, start, elapsed);
+            }
+          }
+          else
+          {
+            system->PostUpdate(this->currentInfo, this->entityCompMgr);
+          }
         }
         this->postUpdateStopBarrier->Wait();
       }
       gzdbg << "Exiting postupdate worker thread ("
         << id << ")" << std::endl;
     }));
+
+    if (!this->postUpdateCpuAffinity.empty())
+    {
+#ifdef __linux__
+      const unsigned int cpu = this->postUpdateCpuAffinity[
+          id % this->postUpdateCpuAffinity.size()];
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      CPU_SET(cpu, &cpuSet);
+      const int err = pthread_setaffinity_np(
+          this->postUpdateThreads.back().native_handle(),
+          sizeof(cpuSet), &cpuSet);
+      if (err != 0)
+      {
+        gzwarn << "Failed to pin postupdate worker thread (" << id
+               << ") to CPU [" << cpu << "]: " << std::strerror(err)
+               << std::endl;
+      }
+#else
+      static bool informed{false};
+      if (!informed)
+      {
+        gzwarn << "PostUpdate CPU affinity is only supported on Linux. "
+               << "Worker threads won't be pinned." << std::endl;
+        informed = true;
+      }
+#endif
+    }
     id++;
   }
 }
 
+/////////////////////////////////////////////////
+namespace
+{
+/// \brief Return true if a system's declared component accesses conflict
+/// with the accumulated accesses of the systems already in a batch. Two
+/// systems conflict if one writes a component type the other reads or
+/// writes.
+bool AccessConflicts(const std::unordered_set<ComponentTypeId> &_reads,
+    const std::unordered_set<ComponentTypeId> &_writes,
+    const std::unordered_set<ComponentTypeId> &_batchReads,
+    const std::unordered_set<ComponentTypeId> &_batchWrites)
+{
+  for (const auto typeId : _writes)
+  {
+    if (_batchReads.count(typeId) || _batchWrites.count(typeId))
+      return true;
+  }
+  for (const auto typeId : _reads)
+  {
+    if (_batchWrites.count(typeId))
+      return true;
+  }
+  return false;
+}
+
+/// \brief Compute the batch plan for one priority level: the exclusive end
+/// index of each run of consecutive systems whose declared component
+/// accesses do not conflict. Systems that do not implement
+/// ISystemComponentAccess act as barriers and form single-system batches,
+/// so the update order of conflicting systems is preserved. Walking the
+/// declared access sets is too expensive for every step, so the plan is
+/// computed once per change of the system lists.
+/// \param[in] _systems Systems of a single priority level, in update order.
+/// \return Exclusive batch end indices covering all of _systems.
+template <typename SystemT>
+std::vector<std::size_t> ComputeSystemBatches(
+    const std::vector<SystemT *> &_systems)
+{
+  std::vector<std::size_t> batchEnds;
+  std::size_t i = 0;
+  while (i < _systems.size())
+  {
+    auto *access = dynamic_cast<ISystemComponentAccess *>(_systems[i]);
+    if (nullptr == access)
+    {
+      batchEnds.push_back(++i);
+      continue;
+    }
+
+    // Greedily extend the batch with the following declared systems whose
+    // accesses do not conflict with the batch so far.
+    auto batchReads = access->ReadComponents();
+    auto batchWrites = access->WriteComponents();
+    std::size_t batchEnd = i + 1;
+    while (batchEnd < _systems.size())
+    {
+      auto *nextAccess =
+          dynamic_cast<ISystemComponentAccess *>(_systems[batchEnd]);
+      if (nullptr == nextAccess)
+        break;
+      const auto reads = nextAccess->ReadComponents();
+      const auto writes = nextAccess->WriteComponents();
+      if (AccessConflicts(reads, writes, batchReads, batchWrites))
+        break;
+      batchReads.insert(reads.begin(), reads.end());
+      batchWrites.insert(writes.begin(), writes.end());
+      ++batchEnd;
+    }
+
+    batchEnds.push_back(batchEnd);
+    i = batchEnd;
+  }
+  return batchEnds;
+}
+
+/// \brief Run one priority level's systems following a precomputed batch
+/// plan, running the systems of each multi-system batch concurrently.
+/// \param[in] _systems Systems of a single priority level, in update order.
+/// \param[in] _batchEnds Batch plan from ComputeSystemBatches.
+/// \param[in] _update Callback invoking the phase on one system.
+template <typename SystemT, typename UpdateFnT>
+void UpdateSystemsBatched(const std::vector<SystemT *> &_systems,
+    const std::vector<std::size_t> &_batchEnds, UpdateFnT _update)
+{
+  std::size_t i = 0;
+  for (const auto batchEnd : _batchEnds)
+  {
+    if (batchEnd == i + 1)
+    {
+      _update(_systems[i]);
+    }
+    else
+    {
+      std::vector<std::thread> workers;
+      workers.reserve(batchEnd - i);
+      for (std::size_t s = i; s < batchEnd; ++s)
+        workers.emplace_back([&, s]() { _update(_systems[s]); });
+      for (auto &worker : workers)
+        worker.join();
+    }
+    i = batchEnd;
+  }
+}
+}  // namespace
+
 /////////////////////////////////////////////////
 void SimulationRunner::UpdateSystems()
 {
@@ -590,12 +945,70 @@ void SimulationRunner::UpdateSystems()
     return;
   }
 
+  // Only pay for per-system clocks and formatting while somebody is
+  // listening on the timing topic, so profiling costs nothing when the
+  // overlay or other subscribers are closed.
+  const bool recordTimings = this->profileSystems &&
+      this->systemTimingPub.Valid() && this->systemTimingPub.HasConnections();
+
+  // Per-system spans share the timing branch below with recordTimings;
+  // resolving system names costs a map walk, so only pay it while a
+  // trace is being captured.
+  const bool tracing = ChromeTracer::Instance().Active();
+
+  if (recordTimings)
+    this->systemTimingLines.clear();
+
+  // Release the GIL for the whole update so no C++ system runs while
+  // holding it. PythonSystemLoader re-acquires it around actual Python
+  // calls, which lets Python worker threads spawned by user systems make
+  // progress while physics and other C++ systems execute.
+  MaybeGilScopedRelease gilRelease;
+
+  // Repack the parallel batch plans when the system lists changed.
+  if (this->parallelSystemUpdate &&
+      this->systemBatchGeneration != this->systemMgr->Generation())
+  {
+    this->preUpdateBatches.clear();
+    for (auto &[priority, systems] : this->systemMgr->SystemsPreUpdate())
+      this->preUpdateBatches[priority] = ComputeSystemBatches(systems);
+    this->updateBatches.clear();
+    for (auto &[priority, systems] : this->systemMgr->SystemsUpdate())
+      this->updateBatches[priority] = ComputeSystemBatches(systems);
+    this->systemBatchGeneration = this->systemMgr->Generation();
+  }
+
   {
     GZ_PROFILE("PreUpdate");
+    ChromeTraceSpan tracePhase{"PreUpdate"};
     for (auto& [priority, systems] : this->systemMgr->SystemsPreUpdate())
     {
+      if (this->parallelSystemUpdate)
+      {
+        UpdateSystemsBatched(systems, this->preUpdateBatches[priority],
+            [this](ISystemPreUpdate *_system)
+            {
+              _system->PreUpdate(this->currentInfo, this->entityCompMgr);
+            });
+        continue;
+      }
       for (auto& system : systems)
       {
+        if (recordTimings || tracing)
+        {
+          const auto start = std::chrono::steady_clock::now();
+          system->PreUpdate(this->currentInfo, this->entityCompMgr);
+          const auto elapsed = std::chrono::steady_clock::now() - start;
+          if (recordTimings)
+            this->RecordSystemTiming("PreUpdate", system, elapsed);
+          if (tracing)
+          {
+            ChromeTracer::Instance().AddCompleteEvent("PreUpdate " +
+                SystemNameFor(this->systemMgr->ActiveSystems(), system),
+                start, elapsed);
+          }
+          continue;
+        }
         system->PreUpdate(this->currentInfo, this->entityCompMgr);
       }
     }
@@ -603,10 +1016,35 @@ void SimulationRunner::UpdateSystems()
 
   {
     GZ_PROFILE("Update");
+    ChromeTraceSpan tracePhase{"Update"};
     for (auto& [priority, systems] : this->systemMgr->SystemsUpdate())
     {
+      if (this->parallelSystemUpdate)
+      {
+        UpdateSystemsBatched(systems, this->updateBatches[priority],
+            [this](ISystemUpdate *_system)
+            {
+              _system->Update(this->currentInfo, this->entityCompMgr);
+            });
+        continue;
+      }
       for (auto& system : systems)
       {
+        if (recordTimings || tracing)
+        {
+          const auto start = std::chrono::steady_clock::now();
+          system->Update(this->currentInfo, this->entityCompMgr);
+          const auto elapsed = std::chrono::steady_clock::now() - start;
+          if (recordTimings)
+            this->RecordSystemTiming("Update", system, elapsed);
+          if (tracing)
+          {
+            ChromeTracer::Instance().AddCompleteEvent("Update " +
+                SystemNameFor(this->systemMgr->ActiveSystems(), system),
+                start, elapsed);
+          }
+          continue;
+        }
         system->Update(this->currentInfo, this->entityCompMgr);
       }
     }
@@ -614,20 +1052,45 @@ void SimulationRunner::UpdateSystems()
 
   {
     GZ_PROFILE("PostUpdate");
+    ChromeTraceSpan tracePhase{"PostUpdate"};
     this->entityCompMgr.LockAddingEntitiesToViews(true);
     // If no systems implementing PostUpdate have been added, then
     // the barriers will be uninitialized, so guard against that condition.
     if (this->postUpdateStartBarrier && this->postUpdateStopBarrier)
     {
-      // Release the GIL from the main thread to run PostUpdate threads which
-      // might be calling into python. The system that does call into python
-      // needs to lock the GIL from its thread.
-      MaybeGilScopedRelease release;
+      // The GIL was already released above, so PostUpdate threads that
+      // call into python can lock it from their own thread.
       this->postUpdateStartBarrier->Wait();
       this->postUpdateStopBarrier->Wait();
     }
     this->entityCompMgr.LockAddingEntitiesToViews(false);
   }
+
+  if (recordTimings)
+  {
+    std::ostringstream out;
+    for (const auto &line : this->systemTimingLines)
+      out << line << "\n";
+    for (std::size_t i = 0; i < this->postUpdateTimingsMs.size(); ++i)
+    {
+      out << "PostUpdate " << this->postUpdateTimingNames[i] << " "
+          << this->postUpdateTimingsMs[i] << "\n";
+    }
+    msgs::StringMsg msg;
+    msg.set_data(out.str());
+    this->systemTimingPub.Publish(msg);
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::RecordSystemTiming(const std::string &_phase,
+    const void *_iface, const std::chrono::steady_clock::duration _elapsed)
+{
+  std::ostringstream line;
+  line << _phase << " "
+       << SystemNameFor(this->systemMgr->ActiveSystems(), _iface) << " "
+       << std::chrono::duration<double, std::milli>(_elapsed).count();
+  this->systemTimingLines.push_back(line.str());
 }
 
 /////////////////////////////////////////////////
@@ -799,26 +1262,36 @@ bool SimulationRunner::Run(const uint64_t _iterations)
     sleepTime = 0ns;
     actualSleep = 0ns;
 
-    sleepTime = std::max(0ns, this->prevUpdateRealTime +
-        this->updatePeriod - std::chrono::steady_clock::now() -
-        this->sleepOffset);
+    const auto wakeTime = this->prevUpdateRealTime + this->updatePeriod;
+    sleepTime = std::max(0ns, wakeTime - std::chrono::steady_clock::now());
 
     // Only sleep if needed.
     if (sleepTime > 0ns)
     {
       GZ_PROFILE("Sleep");
-      // Get the current time, sleep for the duration needed to match the
-      // updatePeriod, and then record the actual time slept.
+      // The kernel tends to oversleep, so sleep short by the measured
+      // oversleep of previous iterations and spin the remainder. This
+      // keeps iterations from overshooting their deadline without
+      // spinning for the whole period.
+      const auto requestedSleep = std::max(0ns,
+          sleepTime - this->sleepOffset);
       startTime = std::chrono::steady_clock::now();
-      std::this_thread::sleep_for(sleepTime);
+      if (requestedSleep > 0ns)
+        std::this_thread::sleep_for(requestedSleep);
       actualSleep = std::chrono::steady_clock::now() - startTime;
-    }
 
-    // Exponentially average out the difference between expected sleep time
-    // and actual sleep time.
-    this->sleepOffset =
-      std::chrono::duration_cast<std::chrono::nanoseconds>(
-          (actualSleep - sleepTime) * 0.01 + this->sleepOffset * 0.99);
+      // Exponentially average out the difference between expected sleep
+      // time and actual sleep time.
+      this->sleepOffset =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::max(0ns, actualSleep - requestedSleep) * 0.01 +
+            this->sleepOffset * 0.99);
+
+      // Spin away whatever the sleep left of the period.
+      while (std::chrono::steady_clock::now() < wakeTime)
+      {
+      }
+    }
 
     // Update time information. This will update the iteration count, RTF,
     // and other values.
@@ -865,14 +1338,34 @@ bool SimulationRunner::Run(const uint64_t _iterations)
 void SimulationRunner::Step(const UpdateInfo &_info)
 {
   GZ_PROFILE("SimulationRunner::Step");
+  ChromeTraceSpan traceStep{"SimulationRunner::Step"};
   this->currentInfo = _info;
 
+  // Execute checkpoint requests first, while no system is touching the
+  // ECM. Runs every iteration so rollout branching isn't delayed by the
+  // housekeeping batching below.
+  this->ProcessCheckpointRequests();
+
+  // Per-step housekeeping only runs once per step batch so that headless
+  // faster-than-realtime runs don't pay its fixed cost on every iteration.
+  // It always runs while paused to keep the server responsive.
+  const bool runHousekeeping = this->currentInfo.paused ||
+      this->currentInfo.iterations % this->stepBatchSize == 0;
+
   // Process new ECM state information, typically sent from the GUI after
   // a change was made to the GUI's ECM.
-  this->ProcessNewWorldControlState();
+  if (runHousekeeping)
+    this->ProcessNewWorldControlState();
+
+  // Apply a requested SDF reload, if any. This marks changed and removed
+  // models for removal; their replacements are created at the end of the
+  // step by ProcessSdfReloadCreate.
+  if (runHousekeeping)
+    this->ProcessSdfReload();
 
   // Publish info
-  this->PublishStats();
+  if (runHousekeeping)
+    this->PublishStats();
 
   // Record when the update step starts.
   this->prevUpdateRealTime = std::chrono::steady_clock::now();
@@ -902,6 +1395,14 @@ void SimulationRunner::Step(const UpdateInfo &_info)
     this->requestedRunToSimTime = {};
   }
 
+  // Evaluate the run-until stop condition, if one is set.
+  if (this->stopCondition &&
+      this->stopCondition(this->currentInfo, this->entityCompMgr))
+  {
+    this->stopConditionTriggered = true;
+    this->running = false;
+  }
+
   if (!this->Paused() && this->pendingSimIterations > 0)
   {
     // Decrement the pending sim iterations, if there are any.
@@ -915,7 +1416,8 @@ void SimulationRunner::Step(const UpdateInfo &_info)
   }
 
   // Process world control messages.
-  this->ProcessMessages();
+  if (runHousekeeping)
+    this->ProcessMessages();
 
   // Clear all new entities
   this->entityCompMgr.ClearNewlyCreatedEntities();
@@ -926,6 +1428,9 @@ void SimulationRunner::Step(const UpdateInfo &_info)
   // cloned entities will loose their "New" state.
   this->ProcessRecreateEntitiesCreate();
 
+  // Create the entities of models queued by an SDF reload.
+  this->ProcessSdfReloadCreate();
+
   // Process entity removals.
   this->systemMgr->ProcessRemovedEntities(this->entityCompMgr,
     this->threadsNeedCleanUp);
@@ -937,6 +1442,135 @@ void SimulationRunner::Step(const UpdateInfo &_info)
   // Each network manager takes care of marking its components as unchanged
   if (!this->networkMgr)
     this->entityCompMgr.SetAllComponentsUnchanged();
+
+  // Retain a bounded ring of per-step state snapshots for fast backward
+  // seeks, see RestoreStepHistory.
+  if (this->stepHistorySize > 0u && !this->currentInfo.paused)
+  {
+    this->stepHistory.emplace_back(this->currentInfo.simTime,
+        this->entityCompMgr.RawState());
+    while (this->stepHistory.size() > this->stepHistorySize)
+      this->stepHistory.pop_front();
+  }
+}
+
+/////////////////////////////////////////////////
+std::optional<std::chrono::steady_clock::duration>
+SimulationRunner::RestoreStepHistory(
+    const std::chrono::steady_clock::duration &_simTime)
+{
+  // Find the newest snapshot at or before the target time.
+  auto iter = this->stepHistory.rbegin();
+  for (; iter != this->stepHistory.rend(); ++iter)
+  {
+    if (iter->first <= _simTime)
+      break;
+  }
+  if (iter == this->stepHistory.rend())
+    return std::nullopt;
+
+  const auto restoredTime = iter->first;
+  this->entityCompMgr.SetRawState(iter->second);
+
+  // Snapshots newer than the restored point describe the abandoned
+  // timeline; the run branches from here.
+  this->stepHistory.erase(iter.base(), this->stepHistory.end());
+
+  return restoredTime;
+}
+
+/////////////////////////////////////////////////
+bool SimulationRunner::SaveCheckpoint(const std::string &_name)
+{
+  if (_name.empty())
+  {
+    gzerr << "Checkpoint name can't be empty." << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(this->checkpointMutex);
+  if (this->running)
+  {
+    this->pendingCheckpointSaves.push_back(_name);
+    return true;
+  }
+
+  this->TakeCheckpoint(_name);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool SimulationRunner::RestoreCheckpoint(const std::string &_name)
+{
+  std::lock_guard<std::mutex> lock(this->checkpointMutex);
+  if (this->checkpoints.find(_name) == this->checkpoints.end())
+  {
+    gzerr << "No checkpoint named [" << _name << "] to restore."
+          << std::endl;
+    return false;
+  }
+
+  if (this->running)
+  {
+    this->pendingCheckpointRestore = _name;
+    return true;
+  }
+
+  return this->ApplyCheckpoint(_name);
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::ProcessCheckpointRequests()
+{
+  std::lock_guard<std::mutex> lock(this->checkpointMutex);
+  for (const auto &name : this->pendingCheckpointSaves)
+    this->TakeCheckpoint(name);
+  this->pendingCheckpointSaves.clear();
+
+  if (!this->pendingCheckpointRestore.empty())
+  {
+    this->ApplyCheckpoint(this->pendingCheckpointRestore);
+    this->pendingCheckpointRestore.clear();
+  }
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::TakeCheckpoint(const std::string &_name)
+{
+  Checkpoint checkpoint;
+  checkpoint.buffer = this->entityCompMgr.RawState();
+  const auto &entities = this->entityCompMgr.Entities().Vertices();
+  for (const auto &entity : entities)
+    checkpoint.entities.insert(Entity(entity.first));
+  this->checkpoints[_name] = std::move(checkpoint);
+}
+
+/////////////////////////////////////////////////
+bool SimulationRunner::ApplyCheckpoint(const std::string &_name)
+{
+  auto iter = this->checkpoints.find(_name);
+  if (iter == this->checkpoints.end())
+  {
+    gzerr << "No checkpoint named [" << _name << "] to restore."
+          << std::endl;
+    return false;
+  }
+
+  // Entities created after the checkpoint aren't part of it. Request their
+  // removal so the restored world matches what was saved; the requests are
+  // processed at the end of the step like any other removal.
+  const auto &entities = this->entityCompMgr.Entities().Vertices();
+  for (const auto &entity : entities)
+  {
+    if (iter->second.entities.find(Entity(entity.first)) ==
+        iter->second.entities.end())
+    {
+      this->entityCompMgr.RequestRemoveEntity(Entity(entity.first), false);
+    }
+  }
+
+  this->entityCompMgr.SetRawState(iter->second.buffer);
+  return true;
 }
 
 //////////////////////////////////////////////////
@@ -1165,6 +1799,20 @@ void SimulationRunner::SetRunToSimTime(
   }
 }
 
+/////////////////////////////////////////////////
+void SimulationRunner::SetStopCondition(std::function<
+    bool(const UpdateInfo &, const EntityComponentManager &)> _condition)
+{
+  this->stopCondition = std::move(_condition);
+  this->stopConditionTriggered = false;
+}
+
+/////////////////////////////////////////////////
+bool SimulationRunner::StopConditionTriggered() const
+{
+  return this->stopConditionTriggered;
+}
+
 /////////////////////////////////////////////////
 bool SimulationRunner::OnWorldControl(const msgs::WorldControl &_req,
     msgs::Boolean &_res)
@@ -1241,6 +1889,142 @@ void SimulationRunner::ProcessNewWorldControlState()
   // were any?
 }
 
+/////////////////////////////////////////////////
+bool SimulationRunner::OnReloadSdf(const msgs::StringMsg &_req,
+    msgs::Boolean &_res)
+{
+  std::string path = _req.data();
+  if (path.empty())
+    path = this->serverConfig.SdfFile();
+
+  if (path.empty() || !common::exists(path))
+  {
+    gzerr << "Cannot reload SDF: no file found at [" << path << "]."
+           << std::endl;
+    _res.set_data(false);
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lock(this->msgBufferMutex);
+  this->requestedReloadPath = path;
+
+  _res.set_data(true);
+  return true;
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::ProcessSdfReload()
+{
+  std::string path;
+  {
+    std::lock_guard<std::mutex> lock(this->msgBufferMutex);
+    if (!this->requestedReloadPath.has_value())
+      return;
+    path = *this->requestedReloadPath;
+    this->requestedReloadPath.reset();
+  }
+
+  GZ_PROFILE("SimulationRunner::ProcessSdfReload");
+
+  sdf::Root root;
+  sdf::Errors errors = root.Load(path);
+  if (!errors.empty())
+  {
+    for (const auto &error : errors)
+      gzerr << error << std::endl;
+    gzerr << "Failed to parse [" << path << "]. The world was left "
+           << "unchanged." << std::endl;
+    return;
+  }
+
+  const sdf::World *world = nullptr;
+  for (uint64_t i = 0; i < root.WorldCount(); ++i)
+  {
+    if (root.WorldByIndex(i)->Name() == this->sdfWorld.Name())
+    {
+      world = root.WorldByIndex(i);
+      break;
+    }
+  }
+  // Replicated worlds run under a suffixed name; fall back to the only
+  // world in the file.
+  if (nullptr == world && root.WorldCount() == 1)
+    world = root.WorldByIndex(0);
+
+  if (nullptr == world)
+  {
+    gzerr << "No world named [" << this->sdfWorld.Name() << "] in ["
+           << path << "]. The world was left unchanged." << std::endl;
+    return;
+  }
+
+  std::unordered_map<std::string, const sdf::Model *> newModels;
+  for (uint64_t i = 0; i < world->ModelCount(); ++i)
+  {
+    const sdf::Model *model = world->ModelByIndex(i);
+    newModels[model->Name()] = model;
+  }
+
+  // Models that disappeared or changed lose their entities. Unchanged
+  // models are not touched and keep their state.
+  std::size_t removedCount = 0;
+  for (const auto &[name, description] : this->reloadModelStrings)
+  {
+    auto iter = newModels.find(name);
+    if (iter != newModels.end() &&
+        ModelSdfString(*iter->second) == description)
+      continue;
+
+    Entity entity = this->entityCompMgr.EntityByComponents(
+        components::Name(name), components::Model());
+    if (kNullEntity != entity)
+    {
+      this->entityCompMgr.RequestRemoveEntity(entity, true);
+      removedCount++;
+    }
+  }
+
+  // Models that appeared or changed are queued for creation, which
+  // happens after systems have processed the removals so that names can
+  // be reused. See ProcessSdfReloadCreate.
+  for (const auto &[name, model] : newModels)
+  {
+    auto iter = this->reloadModelStrings.find(name);
+    if (iter != this->reloadModelStrings.end() &&
+        ModelSdfString(*model) == iter->second)
+      continue;
+
+    this->reloadModelsToCreate.push_back(*model);
+  }
+
+  this->reloadModelStrings.clear();
+  for (const auto &[name, model] : newModels)
+    this->reloadModelStrings[name] = ModelSdfString(*model);
+
+  gzmsg << "Reloading [" << path << "]: removing [" << removedCount
+         << "] and creating [" << this->reloadModelsToCreate.size()
+         << "] models." << std::endl;
+}
+
+/////////////////////////////////////////////////
+void SimulationRunner::ProcessSdfReloadCreate()
+{
+  if (this->reloadModelsToCreate.empty())
+    return;
+
+  GZ_PROFILE("SimulationRunner::ProcessSdfReloadCreate");
+
+  Entity worldEntity =
+      this->entityCompMgr.EntityByComponents(components::World());
+  SdfEntityCreator creator(this->entityCompMgr, this->eventMgr);
+  for (auto &model : this->reloadModelsToCreate)
+  {
+    Entity entity = creator.CreateEntities(&model);
+    creator.SetParent(entity, worldEntity);
+  }
+  this->reloadModelsToCreate.clear();
+}
+
 /////////////////////////////////////////////////
 bool SimulationRunner::OnPlaybackControl(const msgs::LogPlaybackControl &_req,
     msgs::Boolean &_res)
@@ -1500,6 +2284,161 @@ bool SimulationRunner::GuiInfoService(msgs::GUI &_res)
   return true;
 }
 
+//////////////////////////////////////////////////
+bool SimulationRunner::EcmStatsService(msgs::StringMsg &_res)
+{
+  const auto stats = this->entityCompMgr.ComponentStats();
+
+  std::ostringstream out;
+  out << "entities: " << this->entityCompMgr.EntityCount() << "\n";
+  for (const auto &[typeId, typeStats] : stats)
+  {
+    auto name = components::Factory::Instance()->Name(typeId);
+    if (name.empty())
+      name = std::to_string(typeId);
+    out << name << " count: " << typeStats.count
+        << " bytes: " << typeStats.bytes
+        << " created: " << typeStats.created
+        << " removed: " << typeStats.removed << "\n";
+  }
+
+  _res.set_data(out.str());
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool SimulationRunner::EntityQueryService(const msgs::StringMsg &_req,
+                                          msgs::SerializedStateMap &_res)
+{
+  // TODO(anyone) Like GenerateWorldSdf, this reads the ECM from a transport
+  // thread.
+  auto typeIdByName = [](const std::string &_name) -> ComponentTypeId
+  {
+    for (const auto typeId : components::Factory::Instance()->TypeIds())
+    {
+      if (components::Factory::Instance()->Name(typeId) == _name)
+        return typeId;
+    }
+    return kComponentTypeIdInvalid;
+  };
+
+  std::string nameGlob;
+  std::vector<ComponentTypeId> requiredTypes;
+  std::unordered_set<ComponentTypeId> selectedTypes;
+  std::optional<Entity> scopeEntity;
+  std::optional<math::Vector3d> regionCenter;
+  double regionRadius{0.0};
+
+  std::istringstream input(_req.data());
+  std::string clause;
+  while (input >> clause)
+  {
+    const auto eq = clause.find('=');
+    if (eq == std::string::npos)
+    {
+      gzwarn << "Invalid query clause [" << clause << "], expected key=value."
+             << std::endl;
+      return false;
+    }
+    const std::string key = clause.substr(0, eq);
+    const std::string value = clause.substr(eq + 1);
+
+    if (key == "name")
+    {
+      nameGlob = value;
+    }
+    else if (key == "has" || key == "select")
+    {
+      std::istringstream typeNames(value);
+      std::string typeName;
+      while (std::getline(typeNames, typeName, ','))
+      {
+        const auto typeId = typeIdByName(typeName);
+        if (kComponentTypeIdInvalid == typeId)
+        {
+          gzwarn << "Unknown component type [" << typeName << "] in query."
+                 << std::endl;
+          return false;
+        }
+        if (key == "has")
+          requiredTypes.push_back(typeId);
+        else
+          selectedTypes.insert(typeId);
+      }
+    }
+    else if (key == "parent")
+    {
+      const auto entity = this->entityCompMgr.EntityByName(value);
+      if (!entity.has_value())
+      {
+        gzwarn << "Unknown parent entity [" << value << "] in query."
+               << std::endl;
+        return false;
+      }
+      scopeEntity = *entity;
+    }
+    else if (key == "within")
+    {
+      double x, y, z;
+      char sep;
+      std::istringstream region(value);
+      region >> x >> sep >> y >> sep >> z >> sep >> regionRadius;
+      if (region.fail())
+      {
+        gzwarn << "Invalid region [" << value << "] in query, expected "
+               << "x,y,z,radius." << std::endl;
+        return false;
+      }
+      regionCenter = math::Vector3d(x, y, z);
+    }
+    else
+    {
+      gzwarn << "Unknown query key [" << key << "]." << std::endl;
+      return false;
+    }
+  }
+
+  std::unordered_set<Entity> scopeSet;
+  if (scopeEntity.has_value())
+    scopeSet = this->entityCompMgr.Descendants(*scopeEntity);
+
+  std::unordered_set<Entity> matched;
+  this->entityCompMgr.Each<components::Name>(
+      [&](const Entity &_entity, const components::Name *_name) -> bool
+      {
+        if (!nameGlob.empty() && !GlobMatch(nameGlob, _name->Data()))
+          return true;
+
+        if (scopeEntity.has_value() &&
+            scopeSet.find(_entity) == scopeSet.end())
+          return true;
+
+        for (const auto typeId : requiredTypes)
+        {
+          if (!this->entityCompMgr.EntityHasComponentType(_entity, typeId))
+            return true;
+        }
+
+        if (regionCenter.has_value())
+        {
+          const auto pos = worldPose(_entity, this->entityCompMgr).Pos();
+          if (pos.Distance(*regionCenter) > regionRadius)
+            return true;
+        }
+
+        matched.insert(_entity);
+        return true;
+      });
+
+  if (matched.empty())
+    return true;
+
+  // Always include the name component so results are identifiable.
+  selectedTypes.insert(components::Name::typeId);
+  this->entityCompMgr.State(_res, matched, selectedTypes, true);
+  return true;
+}
+
 //////////////////////////////////////////////////
 bool SimulationRunner::GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
                                         msgs::StringMsg &_res)
@@ -1508,7 +2447,7 @@ bool SimulationRunner::GenerateWorldSdf(const msgs::SdfGeneratorConfig &_req,
   // ECM.
   Entity world = this->entityCompMgr.EntityByComponents(components::World());
   std::optional<std::string> genString = sdf_generator::generateWorld(
-      this->entityCompMgr, world, this->fuelUriMap, _req);
+      this->entityCompMgr, world, this->worldGenCache, this->fuelUriMap, _req);
   if (genString.has_value())
   {
     _res.set_data(*genString);
@@ -1543,6 +2482,145 @@ void SimulationRunner::SetNextStepAsBlockingPaused(const bool value)
   this->blockingPausedStepPending = value;
 }
 
+//////////////////////////////////////////////////
+std::string SimulationRunner::CompiledWorldCachePath() const
+{
+  std::string cacheDir;
+  common::env(kCompiledWorldCachePathEnv, cacheDir);
+  if (cacheDir.empty())
+    return std::string();
+
+  // Levels and log playback create and remove entities outside of the
+  // initial creation pass, so a cached snapshot of that pass would not be
+  // representative.
+  if (this->serverConfig.UseLevels() ||
+      !this->serverConfig.LogPlaybackPath().empty())
+  {
+    gzwarn << "The compiled world cache is not supported with levels or "
+           << "log playback. Creating entities from SDF." << std::endl;
+    return std::string();
+  }
+
+  auto elem = this->sdfWorld.Element();
+  if (!elem)
+    return std::string();
+
+  // Key the cache on the world's full SDF description so that any edit
+  // invalidates it.
+  const std::size_t hash = std::hash<std::string>{}(elem->ToString(""));
+  std::ostringstream fileName;
+  fileName << this->sdfWorld.Name() << "-" << std::hex << hash << ".ecmstate";
+  return common::joinPaths(cacheDir, fileName.str());
+}
+
+//////////////////////////////////////////////////
+bool SimulationRunner::RestoreCompiledWorld(const std::string &_path,
+    Entity _worldEntity)
+{
+  GZ_PROFILE("SimulationRunner::RestoreCompiledWorld");
+
+  std::ifstream file(_path, std::ios::in | std::ios::binary);
+  if (!file)
+    return false;
+
+  char magic[sizeof(kCompiledWorldMagic) - 1];
+  uint64_t payloadSize{0};
+  if (!file.read(magic, sizeof(magic)) ||
+      0 != std::memcmp(magic, kCompiledWorldMagic, sizeof(magic)) ||
+      !file.read(reinterpret_cast<char *>(&payloadSize), sizeof(payloadSize)))
+  {
+    gzwarn << "Ignoring compiled world cache [" << _path
+           << "]: unrecognized header." << std::endl;
+    return false;
+  }
+
+  std::vector<char> buffer(payloadSize);
+  if (!file.read(buffer.data(), payloadSize) ||
+      file.peek() != std::ifstream::traits_type::eof())
+  {
+    gzwarn << "Ignoring compiled world cache [" << _path
+           << "]: file size doesn't match its header." << std::endl;
+    return false;
+  }
+
+  const auto entityCountBefore = this->entityCompMgr.EntityCount();
+  this->entityCompMgr.SetRawState(buffer);
+  if (this->entityCompMgr.EntityCount() <= entityCountBefore)
+  {
+    gzwarn << "Ignoring compiled world cache [" << _path
+           << "]: no entities restored." << std::endl;
+    return false;
+  }
+
+  // The world SDF DOM component doesn't round-trip through serialization,
+  // so rebuild it from the freshly parsed world.
+  this->entityCompMgr.SetComponentData<components::WorldSdf>(_worldEntity,
+      this->sdfWorld);
+
+  // Reload the system plugins recorded in the cached state. The system
+  // manager rebuilds the SystemPluginInfo components as each plugin is
+  // added back, so drop the restored copies first to avoid duplicating
+  // their entries.
+  std::vector<std::pair<Entity, msgs::Plugin_V>> pluginInfo;
+  this->entityCompMgr.Each<components::SystemPluginInfo>(
+      [&pluginInfo](const Entity &_entity,
+          const components::SystemPluginInfo *_comp) -> bool
+      {
+        pluginInfo.emplace_back(_entity, _comp->Data());
+        return true;
+      });
+
+  // Load in creation order: the world first, then each model before its
+  // sensors and visuals.
+  std::sort(pluginInfo.begin(), pluginInfo.end(),
+      [](const auto &_a, const auto &_b)
+      {
+        return _a.first < _b.first;
+      });
+
+  for (const auto &[entity, plugins] : pluginInfo)
+  {
+    this->entityCompMgr.RemoveComponent<components::SystemPluginInfo>(entity);
+    this->eventMgr.Emit<events::LoadSdfPlugins>(entity,
+        convert<sdf::Plugins>(plugins));
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+void SimulationRunner::WriteCompiledWorld(const std::string &_path) const
+{
+  GZ_PROFILE("SimulationRunner::WriteCompiledWorld");
+
+  const std::vector<char> buffer = this->entityCompMgr.RawState();
+  const uint64_t payloadSize = buffer.size();
+
+  // Write to a temporary file and move it into place so an interrupted run
+  // can't leave a truncated cache behind.
+  const std::string tmpPath = _path + ".tmp";
+  std::ofstream file(tmpPath,
+      std::ios::out | std::ios::binary | std::ios::trunc);
+  if (file)
+  {
+    file.write(kCompiledWorldMagic, sizeof(kCompiledWorldMagic) - 1);
+    file.write(reinterpret_cast<const char *>(&payloadSize),
+        sizeof(payloadSize));
+    file.write(buffer.data(), buffer.size());
+    file.close();
+  }
+
+  if (!file || !common::moveFile(tmpPath, _path))
+  {
+    gzwarn << "Failed to write compiled world cache [" << _path << "]"
+           << std::endl;
+    common::removeFile(tmpPath);
+    return;
+  }
+
+  gzmsg << "Wrote compiled world cache [" << _path << "]" << std::endl;
+}
+
 //////////////////////////////////////////////////
 void SimulationRunner::CreateEntities(const sdf::World &_world)
 {
@@ -1586,15 +2664,28 @@ void SimulationRunner::CreateEntities(const sdf::World &_world)
       components::RenderEngineGuiPlugin(
       this->serverConfig.RenderEngineGui()));
 
-  // Load the world entities from SDF
-  creator->CreateEntities(&this->sdfWorld, worldEntity);
+  // Load the world entities from SDF, unless an identical world was
+  // compiled before and its initial state can be restored from cache.
+  const std::string cachePath = this->CompiledWorldCachePath();
+  if (!cachePath.empty() && this->RestoreCompiledWorld(cachePath, worldEntity))
+  {
+    gzmsg << "Restored world [" << this->sdfWorld.Name()
+          << "] from compiled world cache [" << cachePath << "]" << std::endl;
+  }
+  else
+  {
+    creator->CreateEntities(&this->sdfWorld, worldEntity);
+
+    // Load the active levels
+    this->levelMgr->UpdateLevelsState();
 
-  // Load the active levels
-  this->levelMgr->UpdateLevelsState();
+    // Some entities and component should be removed based on the levels.
+    this->entityCompMgr.ProcessRemoveEntityRequests();
+    this->entityCompMgr.ClearRemovedComponents();
 
-  // Some entities and component should be removed based on the levels.
-  this->entityCompMgr.ProcessRemoveEntityRequests();
-  this->entityCompMgr.ClearRemovedComponents();
+    if (!cachePath.empty())
+      this->WriteCompiledWorld(cachePath);
+  }
 
   this->LoadLoggingPlugins(this->serverConfig);
 
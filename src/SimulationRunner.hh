@@ -21,15 +21,21 @@
 #include <gz/msgs/gui.pb.h>
 #include <gz/msgs/log_playback_control.pb.h>
 #include <gz/msgs/sdf_generator_config.pb.h>
+#include <gz/msgs/serialized_map.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/world_control.pb.h>
 #include <gz/msgs/world_control_state.pb.h>
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -38,6 +44,7 @@
 #include <utility>
 #include <vector>
 
+#include <sdf/Model.hh>
 #include <sdf/World.hh>
 
 #include <gz/common/Event.hh>
@@ -56,6 +63,7 @@
 
 #include "network/NetworkManager.hh"
 #include "LevelManager.hh"
+#include "SdfGenerator.hh"
 #include "SystemManager.hh"
 #include "Barrier.hh"
 #include "WorldControl.hh"
@@ -165,6 +173,28 @@ namespace gz
       /// \return True if the server is running.
       public: bool Running() const;
 
+      /// \brief Save a named in-memory checkpoint of the current world
+      /// state, captured as a raw binary ECM snapshot. Much cheaper than a
+      /// full State() serialization, so it can be called every few steps,
+      /// e.g. to branch rollouts. While the runner is running, the capture
+      /// is deferred to the start of the next step so it doesn't race the
+      /// sim thread; otherwise it happens immediately. Saving to an
+      /// existing name overwrites that checkpoint.
+      /// \param[in] _name Name identifying the checkpoint.
+      /// \return True if the checkpoint was saved or scheduled.
+      public: bool SaveCheckpoint(const std::string &_name);
+
+      /// \brief Restore a checkpoint previously saved with SaveCheckpoint.
+      /// Entities created after the checkpoint are removed and restored
+      /// components are marked as one-time changes, so systems pick up the
+      /// new state. Sim time and iterations are not rewound. While the
+      /// runner is running, the restore is deferred to the start of the
+      /// next step.
+      /// \param[in] _name Name of the checkpoint to restore.
+      /// \return True if the checkpoint exists and was restored or
+      /// scheduled.
+      public: bool RestoreCheckpoint(const std::string &_name);
+
       /// \brief Get whether the runner has received a stop event
       /// \return True if the event has been received.
       public: bool StopReceived() const;
@@ -226,6 +256,20 @@ namespace gz
       public: void SetRunToSimTime(
                   const std::chrono::steady_clock::duration &_time);
 
+      /// \brief Set a condition that stops the run loop. The condition is
+      /// evaluated after each step with the step's update information and
+      /// the entity component manager; when it returns true the run loop
+      /// exits. Pass an empty function to clear the condition.
+      /// \param[in] _condition The stop condition.
+      public: void SetStopCondition(std::function<
+                  bool(const UpdateInfo &, const EntityComponentManager &)>
+                  _condition);
+
+      /// \brief Get whether the stop condition set with SetStopCondition
+      /// fired during the last run.
+      /// \return True if the stop condition stopped the run loop.
+      public: bool StopConditionTriggered() const;
+
       /// \brief Get the EntityComponentManager
       /// \return Reference to the entity component manager.
       public: const EntityComponentManager &EntityCompMgr() const;
@@ -324,6 +368,34 @@ namespace gz
       /// \return True if successful.
       private: bool GuiInfoService(gz::msgs::GUI &_res);
 
+      /// \brief Callback for the ECM statistics service. Reports per
+      /// component type count, shallow bytes and creation / removal totals,
+      /// formatted as one line per type.
+      /// \param[out] _res Response containing the formatted statistics.
+      /// \return True if successful.
+      private: bool EcmStatsService(msgs::StringMsg &_res);
+
+      /// \brief Callback for the entity query service. The request holds a
+      /// whitespace-separated list of `key=value` clauses that are ANDed:
+      ///
+      /// * `name=<glob>`: entity name matches the glob (`*`, `?`).
+      /// * `has=<ComponentType>`: entity has the component, by registered
+      ///   type name (as printed by the ecm/stats service). Repeatable.
+      /// * `parent=<name>`: entity is a descendant of the named entity.
+      /// * `within=<x>,<y>,<z>,<radius>`: entity's world position lies
+      ///   within `radius` meters of the given point.
+      /// * `select=<Type1>,<Type2>`: components to include in the
+      ///   response; when omitted only the name component is included.
+      ///
+      /// Matching covers named entities. The response carries the matched
+      /// entities with the selected components serialized, so one query
+      /// replaces a round-trip per entity.
+      /// \param[in] _req Query expression.
+      /// \param[out] _res Serialized matched entities and components.
+      /// \return True if the query parsed and executed.
+      private: bool EntityQueryService(const msgs::StringMsg &_req,
+                                       msgs::SerializedStateMap &_res);
+
       /// \brief Calculate real time factor and populate currentInfo.
       private: void UpdateCurrentInfo();
 
@@ -378,6 +450,58 @@ namespace gz
       /// \param[in] _world SDF world created entities from.
       public: void CreateEntities(const sdf::World &_world);
 
+      /// \brief Compute the compiled world cache file path for the current
+      /// world. Caching is enabled by setting the directory to use in the
+      /// GZ_SIM_WORLD_CACHE_PATH environment variable; the file name is
+      /// keyed on a hash of the world's full SDF description so any edit
+      /// invalidates the cache.
+      /// \return Full path of the cache file, or an empty string when
+      /// caching is disabled or not supported for this world.
+      private: std::string CompiledWorldCachePath() const;
+
+      /// \brief Restore the initial entity component state from a compiled
+      /// world cache file and reload the system plugins recorded in it,
+      /// instead of creating the entities from SDF.
+      /// \param[in] _path Cache file to read.
+      /// \param[in] _worldEntity The already-created world entity.
+      /// \return True if the state was restored.
+      private: bool RestoreCompiledWorld(const std::string &_path,
+          Entity _worldEntity);
+
+      /// \brief Serialize the initial entity component state to a compiled
+      /// world cache file so later runs of the same world can skip entity
+      /// creation.
+      /// \param[in] _path Cache file to write.
+      private: void WriteCompiledWorld(const std::string &_path) const;
+
+      /// \brief Execute checkpoint saves and restores requested since the
+      /// last step. Runs on the sim thread at the start of each step, when
+      /// no system is touching the ECM.
+      private: void ProcessCheckpointRequests();
+
+      /// \brief Capture the current ECM state into the named checkpoint.
+      /// The caller must hold checkpointMutex or be at a safe point.
+      /// \param[in] _name Name identifying the checkpoint.
+      private: void TakeCheckpoint(const std::string &_name);
+
+      /// \brief Apply the named checkpoint to the ECM, see
+      /// RestoreCheckpoint. The caller must hold checkpointMutex or be at
+      /// a safe point.
+      /// \param[in] _name Name of the checkpoint to restore.
+      /// \return True if the checkpoint exists.
+      private: bool ApplyCheckpoint(const std::string &_name);
+
+      /// \brief Restore the newest retained step snapshot no later than
+      /// the given sim time, making short backward seeks a state swap
+      /// instead of a full reset and replay. Must be called on the sim
+      /// thread between steps.
+      /// \param[in] _simTime Target sim time of the seek.
+      /// \return The sim time of the restored snapshot, or nullopt when
+      /// the target is outside the retained horizon.
+      private: std::optional<std::chrono::steady_clock::duration>
+          RestoreStepHistory(
+          const std::chrono::steady_clock::duration &_simTime);
+
       /// \brief Process entities with the components::Recreate component.
       /// Put in a request to make them as removed
       private: void ProcessRecreateEntitiesRemove();
@@ -390,6 +514,29 @@ namespace gz
       /// See the newWorldControlState variable below.
       private: void ProcessNewWorldControlState();
 
+      /// \brief Process a pending SDF reload request, if one was received.
+      /// Re-parses the world file, diffs its models against the loaded
+      /// descriptions, and requests the removal of models that changed or
+      /// disappeared. Changed and added models are queued for creation by
+      /// ProcessSdfReloadCreate. Unchanged models keep their entities and
+      /// state.
+      private: void ProcessSdfReload();
+
+      /// \brief Create the entities of models queued by ProcessSdfReload.
+      /// Called after ClearNewlyCreatedEntities, like
+      /// ProcessRecreateEntitiesCreate, so the entities keep their "new"
+      /// state for the next update.
+      private: void ProcessSdfReloadCreate();
+
+      /// \brief Callback for the SDF reload service. Stores the request,
+      /// which is then processed between updates by ProcessSdfReload.
+      /// \param[in] _req Path of the SDF file to reload. An empty path
+      /// reloads the file the server was started with.
+      /// \param[out] _res Response to client, true if a reload was queued.
+      /// \return True for success.
+      private: bool OnReloadSdf(const msgs::StringMsg &_req,
+                                msgs::Boolean &_res);
+
       /// \brief This is used to indicate that a stop event has been received.
       private: std::atomic<bool> stopReceived{false};
 
@@ -397,6 +544,44 @@ namespace gz
       /// server is in the run state.
       private: std::atomic<bool> running{false};
 
+      /// \brief An in-memory snapshot of the world state, see
+      /// SaveCheckpoint.
+      private: struct Checkpoint
+      {
+        /// \brief Raw binary ECM state, see
+        /// EntityComponentManager::RawState.
+        std::vector<char> buffer;
+
+        /// \brief Entities alive when the checkpoint was taken, used to
+        /// remove entities created afterwards on restore.
+        std::unordered_set<Entity> entities;
+      };
+
+      /// \brief Saved checkpoints by name. Protected by checkpointMutex.
+      private: std::unordered_map<std::string, Checkpoint> checkpoints;
+
+      /// \brief Checkpoint names waiting to be captured at the next safe
+      /// point. Protected by checkpointMutex.
+      private: std::vector<std::string> pendingCheckpointSaves;
+
+      /// \brief Checkpoint name waiting to be restored at the next safe
+      /// point, empty for none. Protected by checkpointMutex.
+      private: std::string pendingCheckpointRestore;
+
+      /// \brief Protects the checkpoint storage and pending requests.
+      private: mutable std::mutex checkpointMutex;
+
+      /// \brief Number of recent steps retained as state snapshots for
+      /// bounded-horizon rewind, from GZ_SIM_STEP_HISTORY. Zero disables
+      /// retention.
+      private: std::size_t stepHistorySize{0u};
+
+      /// \brief Ring buffer of the sim time and raw ECM state of the last
+      /// stepHistorySize unpaused steps, newest at the back. Only touched
+      /// on the sim thread.
+      private: std::deque<std::pair<std::chrono::steady_clock::duration,
+          std::vector<char>>> stepHistory;
+
       /// \brief Manager of all systems.
       /// Note: must be before EntityComponentManager
       /// Note: must be before EventMgr
@@ -433,8 +618,10 @@ namespace gz
       /// \brief Wall time of the previous update.
       private: std::chrono::steady_clock::time_point prevUpdateRealTime;
 
-      /// \brief A duration used to account for inaccuracies associated with
-      /// sleep durations.
+      /// \brief Exponential average of how much the kernel oversleeps a
+      /// requested sleep. The run loop sleeps short by this much and spins
+      /// the remainder of the update period. Published in the stats message
+      /// header under the sleep_offset_ns key.
       private: std::chrono::steady_clock::duration sleepOffset{0};
 
       /// \brief This is the rate at which the systems are updated.
@@ -504,6 +691,15 @@ namespace gz
       private: std::optional<std::chrono::steady_clock::duration>
         requestedRunToSimTime;
 
+      /// \brief Condition evaluated after each step; stops the run loop
+      /// when it returns true. See SetStopCondition.
+      private: std::function<
+        bool(const UpdateInfo &, const EntityComponentManager &)>
+        stopCondition;
+
+      /// \brief True if stopCondition fired during the last run.
+      private: bool stopConditionTriggered{false};
+
       /// \brief Keeps the latest simulation info.
       private: UpdateInfo currentInfo;
 
@@ -525,6 +721,78 @@ namespace gz
       /// \brief Flag to indicate running status of PostUpdate threads
       private: std::atomic<bool> postUpdateThreadsRunning{false};
 
+      /// \brief True if consecutive PreUpdate/Update systems with
+      /// non-conflicting declared component accesses should run
+      /// concurrently. Set with the GZ_SIM_PARALLEL_SYSTEM_UPDATE
+      /// environment variable.
+      /// \sa ISystemComponentAccess
+      private: bool parallelSystemUpdate{false};
+
+      /// \brief Batch boundaries for the parallel PreUpdate dispatch, one
+      /// vector of exclusive end indices per priority level. Computing the
+      /// batches walks every system's declared component accesses, so the
+      /// plan is packed once when the system lists change instead of every
+      /// step.
+      private: std::map<System::PriorityType, std::vector<std::size_t>>
+          preUpdateBatches;
+
+      /// \brief Batch boundaries for the parallel Update dispatch, indexed
+      /// like preUpdateBatches.
+      private: std::map<System::PriorityType, std::vector<std::size_t>>
+          updateBatches;
+
+      /// \brief Generation of the SystemManager's system lists the batch
+      /// plans were computed for. Zero forces the first computation.
+      private: uint64_t systemBatchGeneration{0};
+
+      /// \brief Append a timing line for one system update to the current
+      /// step's timing output.
+      /// \param[in] _phase Phase name, e.g. "PreUpdate".
+      /// \param[in] _iface The system's update interface pointer, used to
+      /// look up its name.
+      /// \param[in] _elapsed Wall time the update took.
+      private: void RecordSystemTiming(const std::string &_phase,
+                   const void *_iface,
+                   const std::chrono::steady_clock::duration _elapsed);
+
+      /// \brief True if per-system update timing should be recorded and
+      /// published on the world's system_timing topic. Set with
+      /// ServerConfig::SetProfileSystems (--profile-systems).
+      private: bool profileSystems{false};
+
+      /// \brief True if this runner started the process-wide Chrome
+      /// tracer and is responsible for stopping it. Set with
+      /// ServerConfig::SetTracePath (--trace).
+      private: bool startedTrace{false};
+
+      /// \brief Publisher of per-system update timing.
+      private: transport::Node::Publisher systemTimingPub;
+
+      /// \brief Per-step timing lines for the PreUpdate and Update phases,
+      /// only filled on the main thread while profiling is enabled.
+      private: std::vector<std::string> systemTimingLines;
+
+      /// \brief Wall time in milliseconds of each PostUpdate system's last
+      /// update, one slot per worker thread. A worker writes its slot
+      /// between the start and stop barriers and the main thread reads it
+      /// after the stop barrier, so no locking is needed.
+      private: std::vector<double> postUpdateTimingsMs;
+
+      /// \brief Names of the PostUpdate systems, indexed like
+      /// postUpdateTimingsMs.
+      private: std::vector<std::string> postUpdateTimingNames;
+
+      /// \brief Number of simulation steps between runs of per-step
+      /// housekeeping (stats and clock publication, world control message
+      /// processing). Housekeeping always runs while paused. Set with
+      /// ServerConfig::SetStepBatchSize.
+      private: unsigned int stepBatchSize{1u};
+
+      /// \brief CPUs that PostUpdate worker threads are pinned to,
+      /// round-robin. Empty leaves placement to the scheduler. Set with
+      /// ServerConfig::SetPostUpdateCpuAffinity.
+      private: std::vector<unsigned int> postUpdateCpuAffinity;
+
       /// \brief Barrier to signal beginning of PostUpdate thread execution
       private: std::unique_ptr<Barrier> postUpdateStartBarrier;
 
@@ -534,6 +802,10 @@ namespace gz
       /// \brief Map from file paths to Fuel URIs.
       private: std::unordered_map<std::string, std::string> fuelUriMap;
 
+      /// \brief Cache of generated model elements so repeated
+      /// generate_world_sdf calls only regenerate models that changed.
+      private: sdf_generator::WorldGenCache worldGenCache;
+
       /// \brief True if Server::RunOnce triggered a blocking paused step
       private: bool blockingPausedStepPending{false};
 
@@ -544,6 +816,19 @@ namespace gz
       /// \brief A set of entities that need to be recreated
       private: std::set<Entity> entitiesToRecreate;
 
+      /// \brief Path of a requested SDF reload, set by OnReloadSdf and
+      /// consumed by ProcessSdfReload. Protected by msgBufferMutex.
+      private: std::optional<std::string> requestedReloadPath;
+
+      /// \brief Models queued for creation by a reload, see
+      /// ProcessSdfReloadCreate.
+      private: std::vector<sdf::Model> reloadModelsToCreate;
+
+      /// \brief SDF description of each model loaded from the world file,
+      /// keyed by model name, used to detect changed models on reload.
+      private: std::unordered_map<std::string, std::string>
+          reloadModelStrings;
+
       /// \brief Holds new world state information so that it can be processed
       /// at the appropriate time.
       private: std::unique_ptr<msgs::WorldControlState> newWorldControlState;
@@ -24,6 +24,7 @@
 #include <gz/msgs/stringmsg.pb.h>
 
 #include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
 #include <gz/common/Util.hh>
 #include <gz/transport/Node.hh>
 #include <gz/utils/ExtraTestMacros.hh>
@@ -1652,6 +1653,98 @@ TEST_P(SimulationRunnerTest, GeneratedSdfHasNoSpuriousPlugins)
   EXPECT_TRUE(checkForSpuriousPlugins(newRoot.Element()));
 }
 
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, CompiledWorldCache)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  const auto cacheDir = common::joinPaths(common::tempDirectoryPath(),
+      "gz_sim_compiled_world_cache");
+  common::removeAll(cacheDir);
+  ASSERT_TRUE(common::createDirectories(cacheDir));
+  ASSERT_TRUE(common::setenv(kCompiledWorldCachePathEnv, cacheDir));
+
+  std::size_t entityCount = 0u;
+  {
+    // The first run creates the entities from SDF and writes the cache.
+    auto systemLoader = std::make_shared<SystemLoader>();
+    SimulationRunner runner(*root.WorldByIndex(0), systemLoader);
+    entityCount = runner.EntityCompMgr().EntityCount();
+    EXPECT_LT(0u, entityCount);
+  }
+
+  // A cache file should now exist for the world.
+  unsigned int cacheFileCount = 0u;
+  for (common::DirIter it(cacheDir); it != common::DirIter(); ++it)
+    ++cacheFileCount;
+  EXPECT_EQ(1u, cacheFileCount);
+
+  {
+    // The second run restores the same entities from the cache.
+    auto systemLoader = std::make_shared<SystemLoader>();
+    SimulationRunner runner(*root.WorldByIndex(0), systemLoader);
+    EXPECT_EQ(entityCount, runner.EntityCompMgr().EntityCount());
+
+    // Restored entities keep their names and components.
+    EXPECT_NE(kNullEntity, runner.EntityCompMgr().EntityByComponents(
+        components::Name("box"), Model()));
+    EXPECT_NE(kNullEntity, runner.EntityCompMgr().EntityByComponents(
+        components::Name("box_visual"), Visual()));
+    EXPECT_NE(kNullEntity, runner.EntityCompMgr().EntityByComponents(
+        components::Name("box_collision"), Collision()));
+  }
+
+  EXPECT_TRUE(common::unsetenv(kCompiledWorldCachePathEnv));
+  common::removeAll(cacheDir);
+}
+
+/////////////////////////////////////////////////
+TEST_P(SimulationRunnerTest, Checkpoint)
+{
+  // Load SDF file
+  sdf::Root root;
+  root.Load(common::joinPaths(PROJECT_SOURCE_PATH,
+      "test", "worlds", "shapes.sdf"));
+
+  ASSERT_EQ(1u, root.WorldCount());
+
+  // Create simulation runner
+  auto systemLoader = std::make_shared<SystemLoader>();
+  SimulationRunner runner(*root.WorldByIndex(0), systemLoader);
+
+  auto &ecm = const_cast<EntityComponentManager &>(runner.EntityCompMgr());
+  auto boxEntity = ecm.EntityByComponents(components::Name("box"), Model());
+  ASSERT_NE(kNullEntity, boxEntity);
+  const auto originalPose = ecm.Component<components::Pose>(boxEntity)->Data();
+
+  // Empty names are rejected and unknown checkpoints can't be restored.
+  EXPECT_FALSE(runner.SaveCheckpoint(""));
+  EXPECT_FALSE(runner.RestoreCheckpoint("unknown"));
+
+  // The runner isn't running, so the checkpoint is captured immediately.
+  EXPECT_TRUE(runner.SaveCheckpoint("start"));
+
+  // Diverge from the checkpoint: move the box and add an entity.
+  ecm.SetComponentData<components::Pose>(boxEntity,
+      math::Pose3d(10, 20, 30, 0, 0, 0));
+  auto extraEntity = ecm.CreateEntity();
+  ecm.CreateComponent(extraEntity, components::Name("extra"));
+  const auto entityCount = ecm.EntityCount();
+
+  EXPECT_TRUE(runner.RestoreCheckpoint("start"));
+  ecm.ProcessRemoveEntityRequests();
+
+  // The pose is back and the entity created after the checkpoint is gone.
+  EXPECT_EQ(originalPose, ecm.Component<components::Pose>(boxEntity)->Data());
+  EXPECT_FALSE(ecm.HasEntity(extraEntity));
+  EXPECT_EQ(entityCount - 1, ecm.EntityCount());
+}
+
 // Run multiple times. We want to make sure that static globals don't cause
 // problems.
 INSTANTIATE_TEST_SUITE_P(ServerRepeat, SimulationRunnerTest,
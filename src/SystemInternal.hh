@@ -20,6 +20,7 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -34,6 +35,155 @@ namespace gz
     // Inline bracket to help doxygen filtering.
     inline namespace GZ_SIM_VERSION_NAMESPACE {
 
+    /// \brief Wrapper that forwards a system's update callbacks only on
+    /// iterations that are a multiple of a rate divisor, parsed from the
+    /// System::kRateDivisorElementName plugin element. This lets a slow
+    /// system (e.g. a 50 Hz controller in a 1 kHz world) skip most steps
+    /// without wrapper boilerplate in the system itself.
+    class RateDecimatedSystem :
+        public ISystemPreUpdate,
+        public ISystemUpdate,
+        public ISystemPostUpdate
+    {
+      /// \brief Constructor
+      /// \param[in] _divisor Update rate divisor, expected to be > 1.
+      /// \param[in] _preupdate Wrapped PreUpdate interface, may be nullptr.
+      /// \param[in] _update Wrapped Update interface, may be nullptr.
+      /// \param[in] _postupdate Wrapped PostUpdate interface, may be nullptr.
+      public: RateDecimatedSystem(uint64_t _divisor,
+          ISystemPreUpdate *_preupdate,
+          ISystemUpdate *_update,
+          ISystemPostUpdate *_postupdate)
+              : divisor(_divisor),
+                preupdate(_preupdate),
+                update(_update),
+                postupdate(_postupdate)
+      {
+      }
+
+      // Documentation inherited
+      public: void PreUpdate(const UpdateInfo &_info,
+          EntityComponentManager &_ecm) override
+      {
+        if (this->preupdate && this->ShouldRun(_info))
+          this->preupdate->PreUpdate(_info, _ecm);
+      }
+
+      // Documentation inherited
+      public: void Update(const UpdateInfo &_info,
+          EntityComponentManager &_ecm) override
+      {
+        if (this->update && this->ShouldRun(_info))
+          this->update->Update(_info, _ecm);
+      }
+
+      // Documentation inherited
+      public: void PostUpdate(const UpdateInfo &_info,
+          const EntityComponentManager &_ecm) override
+      {
+        if (this->postupdate && this->ShouldRun(_info))
+          this->postupdate->PostUpdate(_info, _ecm);
+      }
+
+      /// \brief Whether the wrapped system should run on this iteration.
+      /// \param[in] _info Update information for the current step.
+      /// \return True if the iteration count is a multiple of the divisor.
+      private: bool ShouldRun(const UpdateInfo &_info) const
+      {
+        return this->divisor <= 1 || (_info.iterations % this->divisor) == 0;
+      }
+
+      /// \brief Update rate divisor.
+      private: uint64_t divisor{1};
+
+      /// \brief Wrapped PreUpdate interface.
+      private: ISystemPreUpdate *preupdate{nullptr};
+
+      /// \brief Wrapped Update interface.
+      private: ISystemUpdate *update{nullptr};
+
+      /// \brief Wrapped PostUpdate interface.
+      private: ISystemPostUpdate *postupdate{nullptr};
+    };
+
+    /// \brief Wrapper that forwards a system's update callbacks only while
+    /// at least one of its declared trigger component types is attached to
+    /// an entity. See ISystemTriggerComponents.
+    class ComponentGatedSystem :
+        public ISystemPreUpdate,
+        public ISystemUpdate,
+        public ISystemPostUpdate
+    {
+      /// \brief Constructor
+      /// \param[in] _triggers Trigger component types, expected non-empty.
+      /// \param[in] _preupdate Wrapped PreUpdate interface, may be nullptr.
+      /// \param[in] _update Wrapped Update interface, may be nullptr.
+      /// \param[in] _postupdate Wrapped PostUpdate interface, may be nullptr.
+      public: ComponentGatedSystem(
+          std::unordered_set<ComponentTypeId> _triggers,
+          ISystemPreUpdate *_preupdate,
+          ISystemUpdate *_update,
+          ISystemPostUpdate *_postupdate)
+              : triggers(std::move(_triggers)),
+                preupdate(_preupdate),
+                update(_update),
+                postupdate(_postupdate)
+      {
+      }
+
+      // Documentation inherited
+      public: void PreUpdate(const UpdateInfo &_info,
+          EntityComponentManager &_ecm) override
+      {
+        if (this->preupdate && this->ShouldRun(_ecm))
+          this->preupdate->PreUpdate(_info, _ecm);
+      }
+
+      // Documentation inherited
+      public: void Update(const UpdateInfo &_info,
+          EntityComponentManager &_ecm) override
+      {
+        if (this->update && this->ShouldRun(_ecm))
+          this->update->Update(_info, _ecm);
+      }
+
+      // Documentation inherited
+      public: void PostUpdate(const UpdateInfo &_info,
+          const EntityComponentManager &_ecm) override
+      {
+        if (this->postupdate && this->ShouldRun(_ecm))
+          this->postupdate->PostUpdate(_info, _ecm);
+      }
+
+      /// \brief Whether the wrapped system should run.
+      /// \param[in] _ecm Entity component manager to query.
+      /// \return True if any trigger component type is present, or if no
+      /// trigger types were declared.
+      private: bool ShouldRun(const EntityComponentManager &_ecm) const
+      {
+        if (this->triggers.empty())
+          return true;
+        for (const auto typeId : this->triggers)
+        {
+          if (_ecm.ComponentCount(typeId) > 0)
+            return true;
+        }
+        return false;
+      }
+
+      /// \brief Trigger component types.
+      private: std::unordered_set<ComponentTypeId> triggers;
+
+      /// \brief Wrapped PreUpdate interface.
+      private: ISystemPreUpdate *preupdate{nullptr};
+
+      /// \brief Wrapped Update interface.
+      private: ISystemUpdate *update{nullptr};
+
+      /// \brief Wrapped PostUpdate interface.
+      private: ISystemPostUpdate *postupdate{nullptr};
+    };
+
     /// \brief Class to hold systems internally. It supports systems loaded
     /// from plugins, as well as systems created at runtime.
     class SystemInternal
@@ -54,6 +204,8 @@ namespace gz
                 preupdate(systemPlugin->QueryInterface<ISystemPreUpdate>()),
                 update(systemPlugin->QueryInterface<ISystemUpdate>()),
                 postupdate(systemPlugin->QueryInterface<ISystemPostUpdate>()),
+                triggerComponents(
+                  systemPlugin->QueryInterface<ISystemTriggerComponents>()),
                 parentEntity(_entity)
       {
       }
@@ -74,6 +226,8 @@ namespace gz
                 preupdate(dynamic_cast<ISystemPreUpdate *>(_system.get())),
                 update(dynamic_cast<ISystemUpdate *>(_system.get())),
                 postupdate(dynamic_cast<ISystemPostUpdate *>(_system.get())),
+                triggerComponents(
+                  dynamic_cast<ISystemTriggerComponents *>(_system.get())),
                 parentEntity(_entity)
       {
       }
@@ -120,6 +274,11 @@ namespace gz
       /// Will be nullptr if the System doesn't implement this interface.
       public: ISystemPostUpdate *postupdate = nullptr;
 
+      /// \brief Access this system via the ISystemTriggerComponents
+      ///   interface.
+      /// Will be nullptr if the System doesn't implement this interface.
+      public: ISystemTriggerComponents *triggerComponents = nullptr;
+
       /// \brief Entity that the system is attached to. It's passed to the
       /// system during the `Configure` call.
       public: Entity parentEntity = {kNullEntity};
@@ -136,6 +295,18 @@ namespace gz
       /// Useful for if a system needs to be reconfigured at runtime
       public: std::shared_ptr<const sdf::Element> configureSdf = nullptr;
 
+      /// \brief Rate decimation wrapper, set when the system's plugin sdf
+      /// specifies an update rate divisor greater than one. When set, the
+      /// preupdate/update/postupdate pointers above point at this wrapper.
+      /// Shared so SystemInternal stays copyable.
+      public: std::shared_ptr<RateDecimatedSystem> rateDecimator = nullptr;
+
+      /// \brief Component presence gate, set when the system declares
+      /// trigger component types. When set, the preupdate/update/postupdate
+      /// pointers above point at this wrapper. Shared so SystemInternal
+      /// stays copyable.
+      public: std::shared_ptr<ComponentGatedSystem> componentGate = nullptr;
+
       /// \brief Vector of queries and callbacks
       public: std::vector<EntityQueryCallback> updates;
     };
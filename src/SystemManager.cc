@@ -22,6 +22,7 @@
 #include <unordered_set>
 
 #include <gz/common/StringUtils.hh>
+#include <gz/common/Util.hh>
 
 #include "SystemInternal.hh"
 #include "gz/sim/components/SystemPluginInfo.hh"
@@ -57,12 +58,47 @@ SystemManager::SystemManager(
   std::string entitySystemInfoService{"system/info"};
   this->node->Advertise(entitySystemInfoService,
       &SystemManager::EntitySystemInfoService, this);
+
+  std::string asyncEnv;
+  if (common::env("GZ_SIM_ASYNC_SYSTEM_LOADING", asyncEnv) &&
+      !asyncEnv.empty() && asyncEnv != "0")
+  {
+    this->asyncSystemLoading = true;
+  }
+}
+
+//////////////////////////////////////////////////
+SystemManager::~SystemManager()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->asyncLoadMutex);
+    this->asyncLoadRunning = false;
+  }
+  this->asyncLoadCv.notify_all();
+  if (this->asyncLoadThread.joinable())
+    this->asyncLoadThread.join();
 }
 
 //////////////////////////////////////////////////
 void SystemManager::LoadPlugin(const Entity _entity,
                                const sdf::Plugin &_plugin)
 {
+  if (this->asyncSystemLoading)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->asyncLoadMutex);
+      this->asyncLoadRequests.emplace_back(_entity, _plugin);
+      if (!this->asyncLoadThread.joinable())
+      {
+        this->asyncLoadRunning = true;
+        this->asyncLoadThread =
+            std::thread(&SystemManager::AsyncLoadLoop, this);
+      }
+    }
+    this->asyncLoadCv.notify_one();
+    return;
+  }
+
   std::optional<SystemPluginPtr> system;
   {
     std::lock_guard<std::mutex> lock(this->systemLoaderMutex);
@@ -82,6 +118,69 @@ void SystemManager::LoadPlugin(const Entity _entity,
   }
 }
 
+//////////////////////////////////////////////////
+void SystemManager::AsyncLoadLoop()
+{
+  while (true)
+  {
+    std::pair<Entity, sdf::Plugin> request;
+    {
+      std::unique_lock<std::mutex> lock(this->asyncLoadMutex);
+      this->asyncLoadCv.wait(lock, [this]()
+          {
+            return !this->asyncLoadRequests.empty() ||
+                !this->asyncLoadRunning;
+          });
+      if (this->asyncLoadRequests.empty())
+        return;
+      request = std::move(this->asyncLoadRequests.front());
+      this->asyncLoadRequests.erase(this->asyncLoadRequests.begin());
+    }
+
+    const auto &[entity, plugin] = request;
+    std::optional<SystemPluginPtr> system;
+    {
+      std::lock_guard<std::mutex> lock(this->systemLoaderMutex);
+      system = this->systemLoader->LoadPlugin(plugin);
+    }
+
+    if (system)
+    {
+      SystemInternal ss(system.value(), entity);
+      ss.fname = plugin.Filename();
+      ss.name = plugin.Name();
+      ss.configureSdf = plugin.ToElement();
+      std::lock_guard<std::mutex> lock(this->asyncLoadMutex);
+      this->asyncLoadedSystems.push_back(ss);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void SystemManager::ProcessAsyncSystemLoads()
+{
+  std::vector<SystemInternal> loaded;
+  {
+    std::lock_guard<std::mutex> lock(this->asyncLoadMutex);
+    loaded.swap(this->asyncLoadedSystems);
+  }
+
+  // Configure on the simulation thread, where ECM access is safe, and queue
+  // the systems so they are activated with the other pending systems.
+  for (auto &ss : loaded)
+  {
+    this->AddSystemImpl(ss, ss.configureSdf);
+    gzdbg << "Loaded system [" << ss.name
+           << "] for entity [" << ss.parentEntity << "]" << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+const std::vector<SystemInternal> &SystemManager::ActiveSystems() const
+{
+  return this->systems;
+}
+
 //////////////////////////////////////////////////
 size_t SystemManager::TotalCount() const
 {
@@ -104,6 +203,9 @@ size_t SystemManager::PendingCount() const
 //////////////////////////////////////////////////
 size_t SystemManager::ActivatePendingSystems()
 {
+  // Splice in any systems that finished loading on the background thread.
+  this->ProcessAsyncSystemLoads();
+
   std::lock_guard<std::mutex> lock(this->pendingSystemsMutex);
 
   auto count = this->pendingSystems.size();
@@ -111,6 +213,54 @@ size_t SystemManager::ActivatePendingSystems()
   for (const auto& system : this->pendingSystems)
   {
     this->systems.push_back(system);
+    auto &added = this->systems.back();
+
+    const std::string kRateDivisorElementName
+        {gz::sim::System::kRateDivisorElementName};
+    if (added.configureSdf &&
+        added.configureSdf->HasElement(kRateDivisorElementName))
+    {
+      auto divisor =
+          added.configureSdf->Get<int64_t>(kRateDivisorElementName);
+      if (divisor < 1)
+      {
+        gzwarn << "Ignoring invalid update rate divisor {" << divisor
+               << "} for system [" << added.name << "]\n";
+      }
+      else if (divisor > 1 &&
+          (added.preupdate || added.update || added.postupdate))
+      {
+        gzdbg << "System [" << added.name << "] will update every {"
+              << divisor << "} iterations\n";
+        added.rateDecimator = std::make_shared<RateDecimatedSystem>(
+            static_cast<uint64_t>(divisor), added.preupdate, added.update,
+            added.postupdate);
+        if (added.preupdate)
+          added.preupdate = added.rateDecimator.get();
+        if (added.update)
+          added.update = added.rateDecimator.get();
+        if (added.postupdate)
+          added.postupdate = added.rateDecimator.get();
+      }
+    }
+
+    if (added.triggerComponents &&
+        (added.preupdate || added.update || added.postupdate))
+    {
+      auto triggers = added.triggerComponents->TriggerComponents();
+      if (!triggers.empty())
+      {
+        added.componentGate = std::make_shared<ComponentGatedSystem>(
+            std::move(triggers), added.preupdate, added.update,
+            added.postupdate);
+        if (added.preupdate)
+          added.preupdate = added.componentGate.get();
+        if (added.update)
+          added.update = added.componentGate.get();
+        if (added.postupdate)
+          added.postupdate = added.componentGate.get();
+      }
+    }
 
     PriorityType p {System::kDefaultPriority};
     if (system.configurePriority)
@@ -139,25 +289,27 @@ size_t SystemManager::ActivatePendingSystems()
     if (system.reset)
       this->systemsReset.push_back(system.reset);
 
-    if (system.preupdate)
+    if (added.preupdate)
     {
       this->systemsPreupdate.try_emplace(p);
-      this->systemsPreupdate[p].push_back(system.preupdate);
+      this->systemsPreupdate[p].push_back(added.preupdate);
     }
 
-    if (system.update)
+    if (added.update)
     {
       this->systemsUpdate.try_emplace(p);
-      this->systemsUpdate[p].push_back(system.update);
+      this->systemsUpdate[p].push_back(added.update);
     }
 
-    if (system.postupdate)
+    if (added.postupdate)
     {
-      this->systemsPostupdate.push_back(system.postupdate);
+      this->systemsPostupdate.push_back(added.postupdate);
     }
   }
 
   this->pendingSystems.clear();
+  if (count > 0)
+    ++this->generation;
   return count;
 }
 
@@ -188,6 +340,7 @@ void SystemManager::Reset(const UpdateInfo &_info, EntityComponentManager &_ecm)
   this->systemsPreupdate.clear();
   this->systemsUpdate.clear();
   this->systemsPostupdate.clear();
+  ++this->generation;
 
   std::vector<PluginInfo> pluginsToBeLoaded;
 
@@ -347,6 +500,12 @@ const std::vector<ISystemPostUpdate *>& SystemManager::SystemsPostUpdate()
   return this->systemsPostupdate;
 }
 
+//////////////////////////////////////////////////
+uint64_t SystemManager::Generation() const
+{
+  return this->generation;
+}
+
 //////////////////////////////////////////////////
 std::vector<SystemInternal> SystemManager::TotalByEntity(Entity _entity)
 {
@@ -600,6 +759,13 @@ void SystemManager::ProcessRemovedEntities(
       return _ecm.IsMarkedForRemoval(_arg.parentEntity);
     });
 
+  if (!preupdateSystemsToBeRemoved.empty() ||
+      !updateSystemsToBeRemoved.empty() ||
+      !postupdateSystemsToBeRemoved.empty())
+  {
+    ++this->generation;
+  }
+
   std::lock_guard lock(this->pendingSystemsMutex);
   RemoveFromVectorIf(this->pendingSystems,
     [&](const SystemInternal& _system) {
@@ -19,10 +19,14 @@
 
 #include <gz/msgs/entity_plugin_v.pb.h>
 
+#include <condition_variable>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <sdf/Plugin.hh>
@@ -70,7 +74,16 @@ namespace gz
         gz::transport::parameters::ParametersRegistry *
           _parametersRegistry = nullptr);
 
+      /// \brief Destructor. Stops the asynchronous plugin loading thread if
+      /// it was started.
+      public: ~SystemManager();
+
       /// \brief Load system plugin for a given entity.
+      /// When asynchronous loading is enabled (see the
+      /// GZ_SIM_ASYNC_SYSTEM_LOADING environment variable), the plugin is
+      /// opened and instantiated on a background thread and the system is
+      /// configured and spliced into the update loop at the next call to
+      /// ActivatePendingSystems, so heavy plugin loads don't stall stepping.
       /// \param[in] _entity Entity
       /// \param[in] _plugin Plugin to load
       public: void LoadPlugin(const Entity _entity,
@@ -150,10 +163,22 @@ namespace gz
       /// \return Vector of systems's post-update interfaces.
       public: const std::vector<ISystemPostUpdate *>& SystemsPostUpdate();
 
+      /// \brief Get the generation of the per-phase system lists. The
+      /// generation is incremented whenever the lists change (activation,
+      /// reset, entity removal), so callers that derive state from the
+      /// lists, such as the parallel update batch plan, can cache it and
+      /// recompute only when the generation moves.
+      /// \return The current generation, starting at 1.
+      public: uint64_t Generation() const;
+
       /// \brief Get a vector of all systems attached to a given entity.
       /// \return Vector of systems.
       public: std::vector<SystemInternal> TotalByEntity(Entity _entity);
 
+      /// \brief Get all active systems.
+      /// \return Vector of active systems.
+      public: const std::vector<SystemInternal> &ActiveSystems() const;
+
       /// \brief Process system messages and add systems to entities
       public: void ProcessPendingEntitySystems();
 
@@ -225,6 +250,10 @@ namespace gz
       /// \brief Systems implementing PostUpdate
       private: std::vector<ISystemPostUpdate *> systemsPostupdate;
 
+      /// \brief Generation of the per-phase system lists, incremented on
+      /// every change. See Generation().
+      private: uint64_t generation{1};
+
       /// \brief System loader, for loading system plugins.
       private: SystemLoaderPtr systemLoader;
 
@@ -246,6 +275,38 @@ namespace gz
       /// \brief Node for communication.
       private: std::unique_ptr<transport::Node> node{nullptr};
 
+      /// \brief Configure and queue the systems loaded by the asynchronous
+      /// loading thread since the last call. Runs on the simulation thread.
+      private: void ProcessAsyncSystemLoads();
+
+      /// \brief Body of the asynchronous plugin loading thread.
+      private: void AsyncLoadLoop();
+
+      /// \brief True if plugins should be loaded on a background thread.
+      /// Set with the GZ_SIM_ASYNC_SYSTEM_LOADING environment variable.
+      private: bool asyncSystemLoading{false};
+
+      /// \brief Plugin load requests waiting for the background thread.
+      private: std::vector<std::pair<Entity, sdf::Plugin>> asyncLoadRequests;
+
+      /// \brief Systems instantiated by the background thread, waiting to be
+      /// configured and queued on the simulation thread.
+      private: std::vector<SystemInternal> asyncLoadedSystems;
+
+      /// \brief Protects asyncLoadRequests and asyncLoadedSystems.
+      private: std::mutex asyncLoadMutex;
+
+      /// \brief Signals the background thread that a request arrived or
+      /// that it should exit.
+      private: std::condition_variable asyncLoadCv;
+
+      /// \brief True while the background thread should keep running.
+      private: bool asyncLoadRunning{false};
+
+      /// \brief Background plugin loading thread, started lazily on the
+      /// first asynchronous load request.
+      private: std::thread asyncLoadThread;
+
       /// \brief Pointer to associated parameters registry
       private: gz::transport::parameters::ParametersRegistry *
         parametersRegistry;
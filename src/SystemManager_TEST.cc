@@ -17,10 +17,13 @@
 
 #include <gtest/gtest.h>
 
+#include <unordered_set>
+
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/System.hh"
 #include "gz/sim/SystemLoader.hh"
 #include "gz/sim/Types.hh"
+#include "gz/sim/components/Name.hh"
 #include "gz/sim/components/SystemPluginInfo.hh"
 #include "test_config.hh"  // NOLINT(build/include)
 
@@ -81,6 +84,30 @@ class SystemWithPrioritizedUpdates:
                 { return kPriority; }
 };
 
+/////////////////////////////////////////////////
+class SystemWithCountedUpdates:
+  public System,
+  public ISystemPreUpdate,
+  public ISystemUpdate,
+  public ISystemPostUpdate
+{
+  // Documentation inherited
+  public: void PreUpdate(const UpdateInfo &,
+                EntityComponentManager &) override { preUpdates++; };
+
+  // Documentation inherited
+  public: void Update(const UpdateInfo &,
+                EntityComponentManager &) override { updates++; };
+
+  // Documentation inherited
+  public: void PostUpdate(const UpdateInfo &,
+                const EntityComponentManager &) override { postUpdates++; };
+
+  public: int preUpdates = 0;
+  public: int updates = 0;
+  public: int postUpdates = 0;
+};
+
 /////////////////////////////////////////////////
 TEST(SystemManager, Constructor)
 {
@@ -389,3 +416,113 @@ TEST(SystemManager, AddSystemWithInfo)
       });
   EXPECT_EQ(1, entityCount);
 }
+
+/////////////////////////////////////////////////
+TEST(SystemManager, RateDivisor)
+{
+  auto loader = std::make_shared<SystemLoader>();
+
+  EntityComponentManager ecm;
+  auto eventManager = EventManager();
+  SystemManager systemMgr(loader, &ecm, &eventManager);
+
+  auto pluginElem = std::make_shared<sdf::Element>();
+  sdf::initFile("plugin.sdf", pluginElem);
+  sdf::readString("<?xml version='1.0'?><sdf version='1.6'>"
+      "  <plugin filename='plum' name='peach'>"
+      "    <gz:system_rate_divisor>4</gz:system_rate_divisor>"
+      "  </plugin>"
+      "</sdf>", pluginElem);
+
+  auto system = std::make_shared<SystemWithCountedUpdates>();
+  systemMgr.AddSystem(system, kNullEntity, pluginElem);
+  systemMgr.ActivatePendingSystems();
+
+  UpdateInfo info;
+  for (uint64_t iteration = 1; iteration <= 8; ++iteration)
+  {
+    info.iterations = iteration;
+    for (auto &[priority, systems] : systemMgr.SystemsPreUpdate())
+    {
+      for (auto &preupdate : systems)
+        preupdate->PreUpdate(info, ecm);
+    }
+    for (auto &[priority, systems] : systemMgr.SystemsUpdate())
+    {
+      for (auto &update : systems)
+        update->Update(info, ecm);
+    }
+    for (auto &postupdate : systemMgr.SystemsPostUpdate())
+      postupdate->PostUpdate(info, ecm);
+  }
+
+  // With a divisor of 4, only iterations 4 and 8 run the system.
+  EXPECT_EQ(2, system->preUpdates);
+  EXPECT_EQ(2, system->updates);
+  EXPECT_EQ(2, system->postUpdates);
+}
+
+/////////////////////////////////////////////////
+class SystemWithTriggerComponents:
+  public SystemWithCountedUpdates,
+  public ISystemTriggerComponents
+{
+  // Documentation inherited
+  public: std::unordered_set<ComponentTypeId> TriggerComponents()
+      const override
+  {
+    return {components::Name::typeId};
+  }
+};
+
+/////////////////////////////////////////////////
+TEST(SystemManager, TriggerComponents)
+{
+  auto loader = std::make_shared<SystemLoader>();
+
+  EntityComponentManager ecm;
+  auto eventManager = EventManager();
+  SystemManager systemMgr(loader, &ecm, &eventManager);
+
+  auto system = std::make_shared<SystemWithTriggerComponents>();
+  systemMgr.AddSystem(system, kNullEntity, nullptr);
+  systemMgr.ActivatePendingSystems();
+
+  auto step = [&]()
+  {
+    UpdateInfo info;
+    for (auto &[priority, systems] : systemMgr.SystemsPreUpdate())
+    {
+      for (auto &preupdate : systems)
+        preupdate->PreUpdate(info, ecm);
+    }
+    for (auto &[priority, systems] : systemMgr.SystemsUpdate())
+    {
+      for (auto &update : systems)
+        update->Update(info, ecm);
+    }
+    for (auto &postupdate : systemMgr.SystemsPostUpdate())
+      postupdate->PostUpdate(info, ecm);
+  };
+
+  // No entity has a Name component yet, so the system is dormant.
+  step();
+  EXPECT_EQ(0, system->preUpdates);
+  EXPECT_EQ(0, system->updates);
+  EXPECT_EQ(0, system->postUpdates);
+
+  // Creating a matching component activates the system.
+  auto entity = ecm.CreateEntity();
+  ecm.CreateComponent(entity, components::Name("trigger"));
+  step();
+  EXPECT_EQ(1, system->preUpdates);
+  EXPECT_EQ(1, system->updates);
+  EXPECT_EQ(1, system->postUpdates);
+
+  // Removing the component puts the system back to sleep.
+  EXPECT_TRUE(ecm.RemoveComponent(entity, components::Name::typeId));
+  step();
+  EXPECT_EQ(1, system->preUpdates);
+  EXPECT_EQ(1, system->updates);
+  EXPECT_EQ(1, system->postUpdates);
+}
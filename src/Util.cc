@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/msgs/entity.pb.h>
@@ -78,21 +79,10 @@ math::Pose3d worldPose(const Entity &_entity,
     return math::Pose3d();
   }
 
-  // work out pose in world frame
-  math::Pose3d pose = poseComp->Data();
-  auto p = _ecm.Component<components::ParentEntity>(_entity);
-  while (p)
-  {
-    // get pose of parent entity
-    auto parentPose = _ecm.Component<components::Pose>(p->Data());
-    if (!parentPose)
-      break;
-    // transform pose
-    pose = parentPose->Data() * pose;
-    // keep going up the tree
-    p = _ecm.Component<components::ParentEntity>(p->Data());
-  }
-  return pose;
+  // work out pose in world frame; the composition with ancestor poses is
+  // cached in the ECM, so repeated calls within a step don't walk the
+  // parent chain again
+  return _ecm.WorldPose(_entity);
 }
 
 //////////////////////////////////////////////////
@@ -108,19 +98,7 @@ math::Vector3d relativeVel(const Entity &_entity,
   }
 
   // work out pose in world frame
-  math::Pose3d pose = poseComp->Data();
-  auto p = _ecm.Component<components::ParentEntity>(_entity);
-  while (p)
-  {
-    // get pose of parent entity
-    auto parentPose = _ecm.Component<components::Pose>(p->Data());
-    if (!parentPose)
-      break;
-    // transform pose
-    pose = parentPose->Data() * pose;
-    // keep going up the tree
-    p = _ecm.Component<components::ParentEntity>(p->Data());
-  }
+  math::Pose3d pose = _ecm.WorldPose(_entity);
 
   auto worldLinVel = _ecm.Component<components::WorldLinearVelocity>(_entity);
   if (nullptr == worldLinVel)
@@ -139,7 +117,11 @@ std::string scopedName(const Entity &_entity,
     const EntityComponentManager &_ecm, const std::string &_delim,
     bool _includePrefix)
 {
-  std::string result;
+  // Collect the (type prefix, name) segments from the entity up to the root,
+  // then assemble the result in one pass. Inserting each segment at the front
+  // of the result string copies the tail over and over, which adds up during
+  // setup bursts that resolve many deeply nested entities.
+  std::vector<std::pair<std::string, std::string>> segments;
 
   auto entity = _entity;
 
@@ -162,24 +144,38 @@ std::string scopedName(const Entity &_entity,
 
     auto parentComp = _ecm.Component<components::ParentEntity>(entity);
     if (!prefix.empty())
-    {
-      result.insert(0, name);
-      if (_includePrefix)
-      {
-        result.insert(0, _delim);
-        result.insert(0, prefix);
-      }
-    }
+      segments.emplace_back(std::move(prefix), std::move(name));
 
     if (nullptr == parentComp)
       break;
 
-    if (!prefix.empty())
-      result.insert(0, _delim);
-
     entity = parentComp->Data();
   }
 
+  std::size_t resultSize = 0;
+  for (const auto &[prefix, name] : segments)
+  {
+    if (resultSize > 0)
+      resultSize += _delim.size();
+    if (_includePrefix)
+      resultSize += prefix.size() + _delim.size();
+    resultSize += name.size();
+  }
+
+  std::string result;
+  result.reserve(resultSize);
+  for (auto it = segments.rbegin(); it != segments.rend(); ++it)
+  {
+    if (!result.empty())
+      result += _delim;
+    if (_includePrefix)
+    {
+      result += it->first;
+      result += _delim;
+    }
+    result += it->second;
+  }
+
   return result;
 }
 
@@ -35,14 +35,31 @@ View::View(const std::set<ComponentTypeId>& _compIds)
 const std::vector<const components::BaseComponent *>
     &View::EntityComponentConstData(const Entity _entity) const
 {
+  // The caller guarantees the entity is in the view (see the header doc);
+  // the throwing lookup only defends against a broken caller.
+#ifdef GZ_SIM_UNCHECKED
+  return this->validConstData.find(_entity)->second;
+#else
   return this->validConstData.at(_entity);
+#endif
 }
 
 //////////////////////////////////////////////////
 const std::vector<components::BaseComponent *> &View::EntityComponentData(
     const Entity _entity) const
 {
+#ifdef GZ_SIM_UNCHECKED
+  return this->validData.find(_entity)->second;
+#else
   return this->validData.at(_entity);
+#endif
+}
+
+//////////////////////////////////////////////////
+const std::unordered_map<Entity, std::vector<components::BaseComponent *>>
+    &View::ValidData() const
+{
+  return this->validData;
 }
 
 //////////////////////////////////////////////////
@@ -89,6 +106,28 @@ bool View::RemoveEntity(const Entity _entity)
   return true;
 }
 
+//////////////////////////////////////////////////
+bool View::RemoveEntities(const std::vector<Entity> &_entities)
+{
+  bool removed = false;
+  for (const Entity entity : _entities)
+  {
+    // Erasing keys that aren't present is a no-op, so the per-entity
+    // membership checks done by RemoveEntity can be skipped for the batch.
+    this->invalidData.erase(entity);
+    this->invalidConstData.erase(entity);
+    this->missingCompTracker.erase(entity);
+
+    removed = this->entities.erase(entity) != 0 || removed;
+    this->newEntities.erase(entity);
+    this->toRemoveEntities.erase(entity);
+    removed = this->toAddEntities.erase(entity) != 0 || removed;
+    this->validData.erase(entity);
+    this->validConstData.erase(entity);
+  }
+  return removed;
+}
+
 //////////////////////////////////////////////////
 bool View::NotifyComponentAddition(const Entity _entity,
     bool _newEntity, const ComponentTypeId _typeId)
@@ -23,6 +23,8 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gz/transport/Node.hh>
 #include "gz/sim/comms/Broker.hh"
@@ -39,6 +41,15 @@ class gz::sim::comms::Broker::Implementation
   /// \brief Protect data from races.
   public: std::mutex mutex;
 
+  /// \brief Messages received from the clients since the last step, waiting
+  /// to be dispatched to the outbound queues. Staging them here keeps the
+  /// transport callback off the main mutex, which the comms model holds for
+  /// the whole step.
+  public: std::vector<msgs::DataframeSharedPtr> stagedMsgs;
+
+  /// \brief Protect stagedMsgs from races.
+  public: std::mutex stagedMsgsMutex;
+
   /// \brief Topic used to centralize all messages sent from the agents.
   public: std::string msgTopic = "/broker/msgs";
 
@@ -182,16 +193,31 @@ void Broker::OnUnbind(const gz::msgs::StringMsg_V &_req)
 //////////////////////////////////////////////////
 void Broker::OnMsg(const gz::msgs::Dataframe &_msg)
 {
-  // Place the message in the outbound queue of the sender.
+  // This is the only copy of the payload; from here on the message travels
+  // by shared pointer. Stage it for the next step instead of touching the
+  // outbound queues, so this callback never contends with the comms model.
   auto msgPtr = std::make_shared<gz::msgs::Dataframe>(_msg);
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::lock_guard<std::mutex> lock(this->dataPtr->stagedMsgsMutex);
+  this->dataPtr->stagedMsgs.push_back(std::move(msgPtr));
+}
 
-  // Stamp the time.
-  msgPtr->mutable_header()->mutable_stamp()->CopyFrom(
-      sim::convert<msgs::Time>(this->dataPtr->time));
+//////////////////////////////////////////////////
+void Broker::DispatchStagedMsgs()
+{
+  std::vector<msgs::DataframeSharedPtr> msgs;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->stagedMsgsMutex);
+    std::swap(msgs, this->dataPtr->stagedMsgs);
+  }
 
-  this->DataManager().AddOutbound(_msg.src_address(), msgPtr);
+  for (auto &msg : msgs)
+  {
+    // Stamp the time.
+    sim::set(msg->mutable_header()->mutable_stamp(), this->dataPtr->time);
+
+    this->DataManager().AddOutbound(msg->src_address(), msg);
+  }
 }
 
 //////////////////////////////////////////////////
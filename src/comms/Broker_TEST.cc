@@ -64,11 +64,14 @@ TEST_F(BrokerTest, Broker)
   EXPECT_NE(allData["addr1"].subscriptions.end(),
       allData["addr1"].subscriptions.find("topic"));
 
-  // Test manually adding a msg.
+  // Test manually adding a msg. The message is staged until the next
+  // dispatch, so the outbound queue is only populated afterwards.
   EXPECT_TRUE(allData["addr1"].outboundMsgs.empty());
   msgs::Dataframe msg;
   msg.set_src_address("addr1");
   broker.OnMsg(msg);
+  EXPECT_TRUE(allData["addr1"].outboundMsgs.empty());
+  broker.DispatchStagedMsgs();
   EXPECT_EQ(1u, allData["addr1"].outboundMsgs.size());
   EXPECT_EQ("addr1", allData["addr1"].outboundMsgs[0u]->src_address());
 
@@ -15,6 +15,7 @@
  *
 */
 
+#include <cstdlib>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -22,6 +23,7 @@
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/serialized_map.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
+#include <gz/msgs/uint64.pb.h>
 #include <gz/msgs/world_control_state.pb.h>
 
 #include <gz/common/Console.hh>
@@ -61,6 +63,16 @@ class gz::sim::GuiRunner::Implementation
   /// \brief Topic to request state
   public: std::string stateTopic;
 
+  /// \brief Service to query the server's scene graph version.
+  public: std::string sceneVersionService;
+
+  /// \brief Scene graph version stamped on the last full state response,
+  /// or 0 if none was received yet. The stored value is only refreshed by
+  /// full states, so entity changes streamed in between make the next
+  /// version check miss and fall back to a full request, never the other
+  /// way around.
+  public: uint64_t sceneGraphVersion{0};
+
   /// \brief Latest update info
   public: UpdateInfo updateInfo;
 
@@ -141,6 +153,9 @@ GuiRunner::GuiRunner(const std::string &_worldName)
     return;
   }
 
+  this->dataPtr->sceneVersionService = transport::TopicUtils::AsValidTopic(
+      "/world/" + _worldName + "/scene/version");
+
   common::addFindFileURICallback([] (common::URI _uri)
   {
     return fuel_tools::fetchResource(_uri.Str());
@@ -220,6 +235,27 @@ bool GuiRunner::eventFilter(QObject *_obj, QEvent *_event)
 /////////////////////////////////////////////////
 void GuiRunner::RequestState()
 {
+  // After the initial full state, check the server's scene graph version
+  // first. If it matches the version from the last full state, no entities
+  // were added or removed since then and the periodic state stream has kept
+  // this ECM current, so re-requesting and deserializing the whole world
+  // can be skipped.
+  if (this->dataPtr->receivedInitialState &&
+      this->dataPtr->sceneGraphVersion != 0u &&
+      !this->dataPtr->sceneVersionService.empty())
+  {
+    msgs::UInt64 version;
+    bool result{false};
+    if (this->dataPtr->node.Request(this->dataPtr->sceneVersionService, 1000u,
+        version, result) && result &&
+        version.data() == this->dataPtr->sceneGraphVersion)
+    {
+      gzdbg << "Scene graph version [" << version.data()
+             << "] unchanged, skipping full state request." << std::endl;
+      return;
+    }
+  }
+
   // set up service for async state response callback
   std::string id = std::to_string(gz::gui::App()->applicationPid());
   std::string reqSrv =
@@ -299,6 +335,17 @@ void GuiRunner::OnStateQt(const msgs::SerializedStepMap &_msg)
   GZ_PROFILE("GuiRunner::Update");
   this->dataPtr->ecm.SetState(_msg.state());
 
+  // Full state responses carry the server's scene graph version in the
+  // stats header; periodic updates don't.
+  for (const auto &data : _msg.stats().header().data())
+  {
+    if (data.key() == "scene_graph_version" && data.value_size() > 0)
+    {
+      this->dataPtr->sceneGraphVersion =
+          std::strtoull(data.value(0).c_str(), nullptr, 10);
+    }
+  }
+
   // Update all plugins
   this->dataPtr->updateInfo = convert<UpdateInfo>(_msg.stats());
   this->UpdatePlugins();
@@ -383,9 +383,12 @@ void ApplyForceTorque::Update(const UpdateInfo &/*_info*/,
     }
   }
 
+  bool entityDirty{false};
+  bool indexDirty{false};
   if (this->dataPtr->changedEntity)
   {
     this->dataPtr->changedEntity = false;
+    entityDirty = true;
 
     this->dataPtr->modelName = "";
     this->dataPtr->linkNameList.clear();
@@ -433,6 +436,7 @@ void ApplyForceTorque::Update(const UpdateInfo &/*_info*/,
   if (this->dataPtr->changedIndex)
   {
     this->dataPtr->changedIndex = false;
+    indexDirty = true;
 
     if (this->dataPtr->selectedEntity.has_value())
     {
@@ -456,9 +460,16 @@ void ApplyForceTorque::Update(const UpdateInfo &/*_info*/,
     }
   }
 
-  emit this->ModelNameChanged();
-  emit this->LinkNameListChanged();
-  emit this->LinkIndexChanged();
+  // Only notify the view when the selection actually changed. Update runs
+  // on every GUI state update, and unconditional emits made QML re-evaluate
+  // the bindings at that rate even while the user wasn't interacting.
+  if (entityDirty)
+  {
+    emit this->ModelNameChanged();
+    emit this->LinkNameListChanged();
+  }
+  if (entityDirty || indexDirty)
+    emit this->LinkIndexChanged();
 }
 
 /////////////////////////////////////////////////
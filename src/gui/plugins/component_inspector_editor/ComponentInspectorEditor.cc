@@ -18,7 +18,10 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <mutex>
+#include <optional>
 #include <regex>
+#include <utility>
 #include <vector>
 
 #include <QColorDialog>
@@ -95,6 +98,79 @@
 
 namespace gz::sim
 {
+  /// \brief Coalesces the service requests of one command channel. The
+  /// first request is sent immediately; while it is in flight newer
+  /// requests replace one another and only the newest is sent once the
+  /// response arrives. A burst of widget edits thus keeps at most one
+  /// request in flight and the final widget state always lands last,
+  /// instead of queueing one request per change event on the server.
+  template <typename MsgT>
+  class CoalescedCommand
+  {
+    /// \brief Send a request, or stage it if one is already in flight.
+    /// \param[in] _node Transport node to request through. Must outlive
+    /// this object.
+    /// \param[in] _service Service to request.
+    /// \param[in] _req Request message.
+    /// \param[in] _errorMsg Message printed when the server reports
+    /// failure.
+    public: void Send(transport::Node &_node, const std::string &_service,
+                const MsgT &_req, const std::string &_errorMsg)
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->inFlight)
+        {
+          this->pending = _req;
+          return;
+        }
+        this->inFlight = true;
+      }
+      this->Request(_node, _service, _req, _errorMsg);
+    }
+
+    /// \brief Issue the actual service request. The response callback
+    /// sends the staged request, if any, or clears the in-flight flag.
+    private: void Request(transport::Node &_node, const std::string &_service,
+                 const MsgT &_req, const std::string &_errorMsg)
+    {
+      std::function<void(const msgs::Boolean &, const bool)> cb =
+          [this, &_node, _service, _errorMsg](const msgs::Boolean &/*_rep*/,
+              const bool _result)
+      {
+        if (!_result)
+          gzerr << _errorMsg << std::endl;
+
+        std::optional<MsgT> next;
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          if (this->pending.has_value())
+          {
+            next = std::move(this->pending);
+            this->pending.reset();
+          }
+          else
+          {
+            this->inFlight = false;
+          }
+        }
+        if (next.has_value())
+          this->Request(_node, _service, *next, _errorMsg);
+      };
+      _node.Request(_service, _req, cb);
+    }
+
+    /// \brief Protects inFlight and pending; the response callback runs
+    /// on a transport thread.
+    private: std::mutex mutex;
+
+    /// \brief True while a request is awaiting its response.
+    private: bool inFlight{false};
+
+    /// \brief Newest request staged while one was in flight.
+    private: std::optional<MsgT> pending;
+  };
+
   class ComponentInspectorEditorPrivate
   {
     /// \brief Model holding all the current components.
@@ -133,6 +209,18 @@ namespace gz::sim
     /// \brief Transport node for making command requests
     public: transport::Node node;
 
+    /// \brief Coalesced light configuration commands.
+    public: CoalescedCommand<msgs::Light> lightCmd;
+
+    /// \brief Coalesced physics parameter commands.
+    public: CoalescedCommand<msgs::Physics> physicsCmd;
+
+    /// \brief Coalesced visual material commands.
+    public: CoalescedCommand<msgs::Visual> materialCmd;
+
+    /// \brief Coalesced spherical coordinates commands.
+    public: CoalescedCommand<msgs::SphericalCoordinates> sphericalCoordsCmd;
+
     /// \brief Transport node for making command requests
     public: ModelEditor modelEditor;
 
@@ -1118,13 +1206,6 @@ void ComponentInspectorEditor::OnLight(
   double _directionY, double _directionZ, double _innerAngle,
   double _outerAngle, double _falloff, double _intensity, int _type)
 {
-  std::function<void(const gz::msgs::Boolean &, const bool)> cb =
-      [](const gz::msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-      gzerr << "Error setting light configuration" << std::endl;
-  };
-
   gz::msgs::Light req;
   req.set_name(this->dataPtr->entityName);
   req.set_id(this->dataPtr->entity);
@@ -1167,20 +1248,14 @@ void ComponentInspectorEditor::OnLight(
     gzerr << "Invalid light command service topic provided" << std::endl;
     return;
   }
-  this->dataPtr->node.Request(lightConfigService, req, cb);
+  this->dataPtr->lightCmd.Send(this->dataPtr->node, lightConfigService, req,
+      "Error setting light configuration");
 }
 
 /////////////////////////////////////////////////
 void ComponentInspectorEditor::OnPhysics(double _stepSize,
     double _realTimeFactor)
 {
-  std::function<void(const gz::msgs::Boolean &, const bool)> cb =
-      [](const gz::msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-        gzerr << "Error setting physics parameters" << std::endl;
-  };
-
   gz::msgs::Physics req;
   req.set_max_step_size(_stepSize);
   req.set_real_time_factor(_realTimeFactor);
@@ -1192,7 +1267,8 @@ void ComponentInspectorEditor::OnPhysics(double _stepSize,
     gzerr << "Invalid physics command service topic provided" << std::endl;
     return;
   }
-  this->dataPtr->node.Request(physicsCmdService, req, cb);
+  this->dataPtr->physicsCmd.Send(this->dataPtr->node, physicsCmdService, req,
+      "Error setting physics parameters");
 }
 
 /////////////////////////////////////////////////
@@ -1250,14 +1326,6 @@ void ComponentInspectorEditor::OnMaterialColor(
     }
   }
 
-  std::function<void(const gz::msgs::Boolean &, const bool)> cb =
-      [](const gz::msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-      gzerr << "Error setting material color configuration"
-             << " on visual" << std::endl;
-  };
-
   msgs::Visual req;
   req.set_id(this->dataPtr->entity);
 
@@ -1282,7 +1350,8 @@ void ComponentInspectorEditor::OnMaterialColor(
     gzerr << "Invalid material command service topic provided" << std::endl;
     return;
   }
-  this->dataPtr->node.Request(materialCmdService, req, cb);
+  this->dataPtr->materialCmd.Send(this->dataPtr->node, materialCmdService,
+      req, "Error setting material color configuration on visual");
 }
 
 /////////////////////////////////////////////////
@@ -1297,13 +1366,6 @@ void ComponentInspectorEditor::OnSphericalCoordinates(QString _surface,
     return;
   }
 
-  std::function<void(const msgs::Boolean &, const bool)> cb =
-      [](const msgs::Boolean &/*_rep*/, const bool _result)
-  {
-    if (!_result)
-      gzerr << "Error setting spherical coordinates." << std::endl;
-  };
-
   msgs::SphericalCoordinates req;
   req.set_surface_model(msgs::SphericalCoordinates::EARTH_WGS84);
   req.set_latitude_deg(_latitude);
@@ -1320,7 +1382,8 @@ void ComponentInspectorEditor::OnSphericalCoordinates(QString _surface,
     gzerr << "Invalid spherical coordinates service" << std::endl;
     return;
   }
-  this->dataPtr->node.Request(sphericalCoordsCmdService, req, cb);
+  this->dataPtr->sphericalCoordsCmd.Send(this->dataPtr->node,
+      sphericalCoordsCmdService, req, "Error setting spherical coordinates.");
 }
 
 /////////////////////////////////////////////////
@@ -22,6 +22,8 @@
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <gz/common/Console.hh>
@@ -78,6 +80,15 @@ namespace gz::sim
 using namespace gz;
 using namespace sim;
 
+namespace
+{
+  // Role IDs returned by TreeModel::roleNames. Kept as constants so per-item
+  // code doesn't rebuild the role hash for every lookup.
+  constexpr int kEntityNameRole{100};
+  constexpr int kEntityRole{101};
+  constexpr int kTypeRole{102};
+}
+
 //////////////////////////////////////////////////
 QString entityType(Entity _entity,
     const EntityComponentManager &_ecm)
@@ -159,10 +170,9 @@ void TreeModel::AddEntity(Entity _entity, const QString &_entityName,
 
   // New entity item
   auto entityItem = new QStandardItem(_entityName);
-  entityItem->setData(_entityName, this->roleNames().key("entityName"));
-  entityItem->setData(QString::number(_entity),
-      this->roleNames().key("entity"));
-  entityItem->setData(_type, this->roleNames().key("type"));
+  entityItem->setData(_entityName, kEntityNameRole);
+  entityItem->setData(QString::number(_entity), kEntityRole);
+  entityItem->setData(_type, kTypeRole);
 
   parentItem->appendRow(entityItem);
 
@@ -182,6 +192,101 @@ void TreeModel::AddEntity(Entity _entity, const QString &_entityName,
   this->pendingEntities.erase(sep, this->pendingEntities.end());
 }
 
+/////////////////////////////////////////////////
+void TreeModel::AddEntities(const std::vector<EntityInfo> &_entities)
+{
+  GZ_PROFILE_THREAD_NAME("Qt thread");
+  GZ_PROFILE("TreeModel::AddEntities");
+
+  // Rows to attach to parents that are already part of the model, grouped
+  // so each parent gets a single insertion span. Parents are also kept in
+  // arrival order so spans are attached deterministically.
+  std::unordered_map<QStandardItem *, QList<QStandardItem *>> newRows;
+  std::vector<QStandardItem *> newRowParents;
+
+  // Items created by this batch. They stay detached from the model until
+  // the spans are attached below, so their children can be appended to
+  // them directly and enter the model together with their subtree root.
+  std::unordered_set<QStandardItem *> batchItems;
+
+  for (const auto &info : _entities)
+  {
+    // check if entity has already been added or not.
+    if (this->entityItems.find(info.entity) != this->entityItems.end())
+      continue;
+
+    QStandardItem *parentItem{nullptr};
+
+    // Root
+    if (info.parentEntity == kNullEntity)
+    {
+      parentItem = this->invisibleRootItem();
+    }
+
+    // Nested
+    auto item = this->entityItems.find(info.parentEntity);
+    if (item != this->entityItems.end())
+    {
+      parentItem = item->second;
+    }
+
+    if (nullptr == parentItem)
+    {
+      this->pendingEntities.push_back(info);
+      continue;
+    }
+
+    auto entityItem = new QStandardItem(info.name);
+    entityItem->setData(info.name, kEntityNameRole);
+    entityItem->setData(QString::number(info.entity), kEntityRole);
+    entityItem->setData(info.type, kTypeRole);
+    this->entityItems[info.entity] = entityItem;
+    batchItems.insert(entityItem);
+
+    if (batchItems.find(parentItem) != batchItems.end())
+    {
+      // The parent is still detached; the child rides along when its
+      // subtree root is attached.
+      parentItem->appendRow(entityItem);
+    }
+    else
+    {
+      auto rowsIt = newRows.find(parentItem);
+      if (rowsIt == newRows.end())
+      {
+        rowsIt = newRows.emplace(parentItem, QList<QStandardItem *>()).first;
+        newRowParents.push_back(parentItem);
+      }
+      rowsIt->second.append(entityItem);
+    }
+  }
+
+  for (auto parentItem : newRowParents)
+    parentItem->appendRows(newRows[parentItem]);
+
+  // Attach any previously pending entities whose parent arrived in this
+  // batch. AddEntity recursively resolves further pending children.
+  auto sep = std::partition(this->pendingEntities.begin(),
+      this->pendingEntities.end(), [this](const EntityInfo &_info)
+      {
+        return this->entityItems.find(_info.parentEntity) ==
+            this->entityItems.end();
+      });
+  const std::vector<EntityInfo> readyEntities(sep,
+      this->pendingEntities.end());
+  this->pendingEntities.erase(sep, this->pendingEntities.end());
+  for (const auto &info : readyEntities)
+    this->AddEntity(info.entity, info.name, info.parentEntity, info.type);
+}
+
+/////////////////////////////////////////////////
+void TreeModel::RemoveEntities(const std::vector<Entity> &_entities)
+{
+  GZ_PROFILE("TreeModel::RemoveEntities");
+  for (auto entity : _entities)
+    this->RemoveEntity(entity);
+}
+
 /////////////////////////////////////////////////
 void TreeModel::RemoveEntity(Entity _entity)
 {
@@ -214,8 +319,7 @@ void TreeModel::RemoveEntity(Entity _entity)
     {
       auto childItem = _item->child(i);
       removeChildren(childItem);
-      this->entityItems.erase(childItem->data(
-          this->roleNames().key("entity")).toUInt());
+      this->entityItems.erase(childItem->data(kEntityRole).toUInt());
     }
   };
   this->entityItems.erase(_entity);
@@ -236,7 +340,7 @@ QString TreeModel::EntityType(const QModelIndex &_index) const
   if (!item)
     return type;
 
-  QVariant typeVar  = item->data(this->roleNames().key("type"));
+  QVariant typeVar  = item->data(kTypeRole);
   if (!typeVar.isValid())
     return type;
 
@@ -272,7 +376,7 @@ Entity TreeModel::EntityId(const QModelIndex &_index) const
   if (!item)
     return entity;
 
-  QVariant entityVar  = item->data(this->roleNames().key("entity"));
+  QVariant entityVar  = item->data(kEntityRole);
   if (!entityVar.isValid())
     return entity;
 
@@ -282,9 +386,9 @@ Entity TreeModel::EntityId(const QModelIndex &_index) const
 /////////////////////////////////////////////////
 QHash<int, QByteArray> TreeModel::roleNames() const
 {
-  return {std::pair(100, "entityName"),
-          std::pair(101, "entity"),
-          std::pair(102, "type")};
+  return {std::pair(kEntityNameRole, "entityName"),
+          std::pair(kEntityRole, "entity"),
+          std::pair(kTypeRole, "type")};
 }
 
 /////////////////////////////////////////////////
@@ -313,6 +417,13 @@ void EntityTree::LoadConfig(const tinyxml2::XMLElement *)
 void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
 {
   GZ_PROFILE("EntityTree::Update");
+
+  // Entities added and removed this update. They are shipped to the Qt
+  // thread in one queued call per batch instead of one per entity, so
+  // loading a large world doesn't flood the event loop.
+  std::vector<TreeModel::EntityInfo> addedBatch;
+  std::vector<Entity> removedBatch;
+
   // Treat all pre-existent entities as new at startup
   if (!this->dataPtr->initialized)
   {
@@ -345,12 +456,8 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, _entity),
-          Q_ARG(QString, QString::fromStdString(_name->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(_entity, _ecm)));
+      addedBatch.push_back({_entity, QString::fromStdString(_name->Data()),
+          parentEntity, entityType(_entity, _ecm)});
       return true;
     });
 
@@ -375,12 +482,8 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, _entity),
-          Q_ARG(QString, QString::fromStdString(_name->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(_entity, _ecm)));
+      addedBatch.push_back({_entity, QString::fromStdString(_name->Data()),
+          parentEntity, entityType(_entity, _ecm)});
       return true;
     });
   }
@@ -389,9 +492,7 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
     [&](const Entity &_entity,
         const components::Name *)->bool
   {
-    QMetaObject::invokeMethod(&this->dataPtr->treeModel, "RemoveEntity",
-        Qt::QueuedConnection,
-        Q_ARG(Entity, _entity));
+    removedBatch.push_back(_entity);
     return true;
   });
 
@@ -425,24 +526,37 @@ void EntityTree::Update(const UpdateInfo &, EntityComponentManager &_ecm)
         parentEntity = kNullEntity;
       }
 
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "AddEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, entity),
-          Q_ARG(QString, QString::fromStdString(nameComp->Data())),
-          Q_ARG(Entity, parentEntity),
-          Q_ARG(QString, entityType(entity, _ecm)));
+      addedBatch.push_back({entity, QString::fromStdString(nameComp->Data()),
+          parentEntity, entityType(entity, _ecm)});
     }
 
-    for (auto entity : this->dataPtr->removedEntities)
-    {
-      QMetaObject::invokeMethod(&this->dataPtr->treeModel, "RemoveEntity",
-          Qt::QueuedConnection,
-          Q_ARG(Entity, entity));
-    }
+    removedBatch.insert(removedBatch.end(),
+        this->dataPtr->removedEntities.begin(),
+        this->dataPtr->removedEntities.end());
 
     this->dataPtr->newEntities.clear();
     this->dataPtr->removedEntities.clear();
   }
+
+  if (!addedBatch.empty())
+  {
+    auto *treeModel = &this->dataPtr->treeModel;
+    QMetaObject::invokeMethod(treeModel,
+        [treeModel, addedBatch]()
+        {
+          treeModel->AddEntities(addedBatch);
+        }, Qt::QueuedConnection);
+  }
+
+  if (!removedBatch.empty())
+  {
+    auto *treeModel = &this->dataPtr->treeModel;
+    QMetaObject::invokeMethod(treeModel,
+        [treeModel, removedBatch]()
+        {
+          treeModel->RemoveEntities(removedBatch);
+        }, Qt::QueuedConnection);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -45,6 +45,37 @@ namespace sim
     // Documentation inherited
     public: QHash<int, QByteArray> roleNames() const override;
 
+    /// \brief Entity information used to batch and queue entities
+    public: struct EntityInfo
+    {
+      /// \brief Entity ID
+      // cppcheck-suppress unmatchedSuppression
+      // cppcheck-suppress unusedStructMember
+      Entity entity;
+
+      /// \brief Entity name
+      QString name;
+
+      /// \brief Parent ID
+      // cppcheck-suppress unmatchedSuppression
+      // cppcheck-suppress unusedStructMember
+      Entity parentEntity;
+
+      /// \brief Entity type
+      QString type;
+    };
+
+    /// \brief Add a batch of entities to the tree. Equivalent to calling
+    /// AddEntity for each element, but entities sharing a parent are
+    /// attached with a single insertion span, so the view processes one
+    /// model update per parent instead of one per entity.
+    /// \param[in] _entities Entities to be added, in arrival order.
+    public: void AddEntities(const std::vector<EntityInfo> &_entities);
+
+    /// \brief Remove a batch of entities from the tree.
+    /// \param[in] _entities Entities to be removed.
+    public: void RemoveEntities(const std::vector<Entity> &_entities);
+
     /// \brief Add an entity to the tree.
     /// \param[in] _entity Entity to be added
     /// \param[in] _entityName Name of entity to be added
@@ -78,26 +109,6 @@ namespace sim
     /// \brief Keep track of which item corresponds to which entity.
     private: std::map<Entity, QStandardItem *> entityItems;
 
-    /// \brief Entity information used to queue the pending entities
-    struct EntityInfo
-    {
-      /// \brief Entity ID
-      // cppcheck-suppress unmatchedSuppression
-      // cppcheck-suppress unusedStructMember
-      Entity entity;
-
-      /// \brief Entity name
-      QString name;
-
-      /// \brief Parent ID
-      // cppcheck-suppress unmatchedSuppression
-      // cppcheck-suppress unusedStructMember
-      Entity parentEntity;
-
-      /// \brief Entity type
-      QString type;
-    };
-
     /// \brief If an entity is added before its parent, we queue it in this
     /// vector until their parent shows up or they are deleted.
     private: std::vector<EntityInfo> pendingEntities;
@@ -17,8 +17,11 @@
 
 #include <gz/msgs/marker.pb.h>
 
+#include <algorithm>
+#include <deque>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include <gz/plugin/Register.hh>
 
@@ -62,9 +65,25 @@ namespace gz::sim::gui
     /// \brief Whether the target name has been changed.
     public: bool targetNameDirty{false};
 
-    /// \brief Current marker message.
+    /// \brief Marker message holding the currently open chunk. The
+    /// trajectory is split across several line strip markers so that adding
+    /// a point only re-sends the open chunk instead of the whole trajectory.
     public: msgs::Marker markerMsg;
 
+    /// \brief Number of points per chunk. Each chunk is uploaded to the GPU
+    /// as its own line strip, so the per-point update cost is bounded by
+    /// this size regardless of the trajectory length.
+    public: int chunkSize{100};
+
+    /// \brief Closed chunks currently displayed, oldest first. Each entry
+    /// holds the chunk's marker ID and its point count, so old points can
+    /// be retired a whole chunk at a time.
+    public: std::deque<std::pair<uint64_t, int>> chunks;
+
+    /// \brief Marker ID assigned to the open chunk. IDs are sequential
+    /// within the plot's namespace and restart for each new target.
+    public: uint64_t chunkId{1};
+
     /// \brief Marker color.
     public: math::Color color{math::Color::Blue};
 
@@ -162,11 +181,15 @@ void Plot3D::LoadConfig(const tinyxml2::XMLElement *_pluginElem)
 /////////////////////////////////////////////////
 void Plot3D::ClearPlot()
 {
-  // Clear previous plot
-  if (this->dataPtr->markerMsg.point().size() > 0)
+  // Clear previous plot: delete every chunk in this plot's namespace
+  if (this->dataPtr->markerMsg.point().size() > 0 ||
+      !this->dataPtr->chunks.empty())
   {
-    this->dataPtr->markerMsg.set_action(msgs::Marker::DELETE_MARKER);
-    this->dataPtr->node.Request("/marker", this->dataPtr->markerMsg);
+    msgs::Marker deleteMsg;
+    deleteMsg.set_ns(this->dataPtr->markerMsg.ns());
+    deleteMsg.set_action(msgs::Marker::DELETE_ALL);
+    this->dataPtr->node.Request("/marker", deleteMsg);
+    this->dataPtr->chunks.clear();
   }
 }
 
@@ -223,7 +246,8 @@ void Plot3D::Update(const UpdateInfo &, EntityComponentManager &_ecm)
     // Reset message
     this->dataPtr->markerMsg.Clear();
     this->dataPtr->markerMsg.set_ns("plot_" + this->dataPtr->targetName);
-    this->dataPtr->markerMsg.set_id(this->dataPtr->targetEntity);
+    this->dataPtr->chunkId = 1;
+    this->dataPtr->markerMsg.set_id(this->dataPtr->chunkId);
     this->dataPtr->markerMsg.set_action(msgs::Marker::ADD_MODIFY);
     this->dataPtr->markerMsg.set_type(msgs::Marker::LINE_STRIP);
     this->dataPtr->markerMsg.set_visibility(msgs::Marker::GUI);
@@ -247,10 +271,6 @@ void Plot3D::Update(const UpdateInfo &, EntityComponentManager &_ecm)
   this->dataPtr->prevPos = point;
   msgs::Set(this->dataPtr->markerMsg.add_point(), point);
 
-  // Reduce message array
-  if (this->dataPtr->markerMsg.point_size() > this->dataPtr->maxPoints)
-    this->dataPtr->markerMsg.mutable_point()->DeleteSubrange(0, 5);
-
   msgs::Set(this->dataPtr->markerMsg.mutable_material()->mutable_ambient(),
     this->dataPtr->color);
   msgs::Set(this->dataPtr->markerMsg.mutable_material()->mutable_diffuse(),
@@ -258,6 +278,37 @@ void Plot3D::Update(const UpdateInfo &, EntityComponentManager &_ecm)
 
   // Request
   this->dataPtr->node.Request("/marker", this->dataPtr->markerMsg);
+
+  // Close the chunk once it's full and open a new one, repeating the
+  // boundary point so the line strip stays connected.
+  int chunkCapacity = std::max(2,
+      std::min(this->dataPtr->chunkSize, this->dataPtr->maxPoints));
+  if (this->dataPtr->markerMsg.point_size() >= chunkCapacity)
+  {
+    this->dataPtr->chunks.push_back({this->dataPtr->markerMsg.id(),
+        this->dataPtr->markerMsg.point_size()});
+    this->dataPtr->markerMsg.set_id(++this->dataPtr->chunkId);
+    this->dataPtr->markerMsg.clear_point();
+    msgs::Set(this->dataPtr->markerMsg.add_point(), point);
+  }
+
+  // Retire whole chunks once the total exceeds the maximum, oldest first
+  int totalPoints = this->dataPtr->markerMsg.point_size();
+  for (const auto &chunk : this->dataPtr->chunks)
+    totalPoints += chunk.second;
+
+  while (totalPoints > this->dataPtr->maxPoints &&
+      !this->dataPtr->chunks.empty())
+  {
+    msgs::Marker deleteMsg;
+    deleteMsg.set_ns(this->dataPtr->markerMsg.ns());
+    deleteMsg.set_id(this->dataPtr->chunks.front().first);
+    deleteMsg.set_action(msgs::Marker::DELETE_MARKER);
+    this->dataPtr->node.Request("/marker", deleteMsg);
+
+    totalPoints -= this->dataPtr->chunks.front().second;
+    this->dataPtr->chunks.pop_front();
+  }
 }
 
 /////////////////////////////////////////////////
@@ -66,8 +66,8 @@ namespace gui
   /// this distance from the previous point. Defaults to 0.05 m.
   ///
   /// * `<maximum_points> (optional)`: Maximum number of points on the plot.
-  /// After this number is reached, the older points start being deleted.
-  /// Defaults to 1000.
+  /// After this number is reached, the older points start being deleted, a
+  /// whole chunk of the trajectory at a time. Defaults to 1000.
   ///
   class Plot3D_EXPORTS_API Plot3D : public gz::sim::GuiSystem
   {
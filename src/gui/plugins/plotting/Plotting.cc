@@ -17,6 +17,8 @@
 
 #include "Plotting.hh"
 
+#include <algorithm>
+
 #include <gz/math/Pose3.hh>
 #include <gz/math/SphericalCoordinates.hh>
 #include <gz/math/Vector3.hh>
@@ -56,6 +58,36 @@ namespace gz::sim
 
     /// \brief Mutex to protect the components map.
     public: std::recursive_mutex componentsMutex;
+
+    /// \brief Min/max envelope of the samples accumulated for one attribute
+    /// during the current decimation bucket.
+    public: struct SampleBucket
+    {
+      /// \brief True while the bucket holds at least one sample.
+      bool valid{false};
+
+      /// \brief Sim time (seconds) of the first sample in the bucket.
+      double start{0.0};
+
+      /// \brief Smallest sample value seen and its sim time.
+      double minValue{0.0};
+      double minTime{0.0};
+
+      /// \brief Largest sample value seen and its sim time.
+      double maxValue{0.0};
+      double maxTime{0.0};
+    };
+
+    /// \brief Decimation buckets, keyed like the plotted attribute name:
+    /// EntityID + "," + ComponentID + "," + attribute.
+    public: std::map<std::string, SampleBucket> buckets;
+
+    /// \brief Width of a decimation bucket in seconds of sim time. Instead
+    /// of forwarding one point per simulation step to the charts, each
+    /// attribute forwards the min and max of the samples collected over
+    /// this period, preserving the signal envelope while bounding how fast
+    /// chart series grow. Zero forwards every sample.
+    public: double samplePeriod{0.05};
   };
 
   class PlotComponentPrivate
@@ -235,10 +267,20 @@ Plotting::~Plotting()
 }
 
 //////////////////////////////////////////
-void Plotting::LoadConfig(const tinyxml2::XMLElement *)
+void Plotting::LoadConfig(const tinyxml2::XMLElement *_pluginElem)
 {
   if (this->title.empty())
     this->title = "Plotting";
+
+  if (_pluginElem)
+  {
+    if (auto elem = _pluginElem->FirstChildElement("sample_period_ms"))
+    {
+      double periodMs{this->dataPtr->samplePeriod * 1e3};
+      elem->QueryDoubleText(&periodMs);
+      this->dataPtr->samplePeriod = std::max(periodMs, 0.0) * 1e-3;
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -382,7 +424,18 @@ void Plotting::UnRegisterChartFromComponent(uint64_t _entity, uint64_t _typeId,
   this->dataPtr->components[id]->UnRegisterChart(_attribute, _chart);
 
   if (!this->dataPtr->components[id]->HasCharts())
+  {
     this->dataPtr->components.erase(id);
+
+    // Drop the decimation buckets of all attributes of this component
+    const std::string prefix = id + ",";
+    for (auto it = this->dataPtr->buckets.lower_bound(prefix);
+        it != this->dataPtr->buckets.end() &&
+        it->first.compare(0, prefix.size(), prefix) == 0;)
+    {
+      it = this->dataPtr->buckets.erase(it);
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -538,16 +591,71 @@ void Plotting::Update(const gz::sim::UpdateInfo &_info,
 
     for (auto attribute : component.second->Data())
     {
-      for (auto chart : attribute.second->Charts())
+      if (attribute.second->ChartCount() == 0)
+        continue;
+
+      const std::string key = component.first + "," + attribute.first;
+      QString attributeName = QString::fromStdString(key);
+      double y = attribute.second->Value();
+
+      double x = _info.simTime.count() * std::pow(10, -9);
+
+      if (this->dataPtr->samplePeriod <= 0.0)
+      {
+        for (auto chart : attribute.second->Charts())
+        {
+          emit this->dataPtr->plottingIface->plot(chart, attributeName, x, y);
+        }
+        continue;
+      }
+
+      // Fold the sample into the current decimation bucket; when the bucket
+      // closes, forward its min/max envelope instead of every sample.
+      auto &bucket = this->dataPtr->buckets[key];
+      if (!bucket.valid || x < bucket.start)
+      {
+        bucket = {true, x, y, x, y, x};
+      }
+      else
       {
-        QString attributeName = QString::fromStdString(
-                    component.first + "," + attribute.first);
-        double y = attribute.second->Value();
+        if (y < bucket.minValue)
+        {
+          bucket.minValue = y;
+          bucket.minTime = x;
+        }
+        if (y > bucket.maxValue)
+        {
+          bucket.maxValue = y;
+          bucket.maxTime = x;
+        }
+      }
 
-        double x = _info.simTime.count() * std::pow(10, -9);
+      if (x - bucket.start < this->dataPtr->samplePeriod)
+        continue;
 
-        emit this->dataPtr->plottingIface->plot(chart, attributeName, x, y);
+      for (auto chart : attribute.second->Charts())
+      {
+        if (bucket.minTime == bucket.maxTime)
+        {
+          emit this->dataPtr->plottingIface->plot(chart, attributeName,
+              bucket.minTime, bucket.minValue);
+        }
+        else if (bucket.minTime < bucket.maxTime)
+        {
+          emit this->dataPtr->plottingIface->plot(chart, attributeName,
+              bucket.minTime, bucket.minValue);
+          emit this->dataPtr->plottingIface->plot(chart, attributeName,
+              bucket.maxTime, bucket.maxValue);
+        }
+        else
+        {
+          emit this->dataPtr->plottingIface->plot(chart, attributeName,
+              bucket.maxTime, bucket.maxValue);
+          emit this->dataPtr->plottingIface->plot(chart, attributeName,
+              bucket.minTime, bucket.minValue);
+        }
       }
+      bucket.valid = false;
     }
   }
 }
@@ -95,6 +95,14 @@ class PlottingPrivate;
 
 /// \brief Physics data plotting handler that keeps track of the
 /// registered components, update them and update the plot
+///
+/// ## Configuration
+///
+/// - `<sample_period_ms>`: Width, in milliseconds of sim time, of the
+///   decimation bucket applied to each plotted attribute. Only the min and
+///   max of the samples collected during a bucket are forwarded to the
+///   charts, preserving the signal envelope while keeping long sessions
+///   responsive. Defaults to 50. Set to 0 to forward every sample.
 class Plotting : public gz::sim::GuiSystem
 {
   Q_OBJECT
@@ -95,11 +95,26 @@ GzSceneManager::GzSceneManager()
 GzSceneManager::~GzSceneManager() = default;
 
 /////////////////////////////////////////////////
-void GzSceneManager::LoadConfig(const tinyxml2::XMLElement *)
+void GzSceneManager::LoadConfig(const tinyxml2::XMLElement *_pluginElem)
 {
   if (this->title.empty())
     this->title = "Scene Manager";
 
+  if (_pluginElem)
+  {
+    if (auto elem = _pluginElem->FirstChildElement(
+        "offscreen_pose_update_period"))
+    {
+      int period{0};
+      elem->QueryIntText(&period);
+      if (period > 0)
+      {
+        this->dataPtr->renderUtil.SetOffscreenPoseUpdatePeriod(
+            static_cast<unsigned int>(period));
+      }
+    }
+  }
+
   static bool done{false};
   if (done)
   {
@@ -36,6 +36,15 @@ inline namespace GZ_SIM_VERSION_NAMESPACE {
   /// scene to the window, such as `gz::gui::plugins::MinimalScene`.
   ///
   /// Only one GzSceneManager can be used at a time.
+  ///
+  /// ## Configuration
+  ///
+  /// - `<offscreen_pose_update_period>`: Number of render updates between
+  ///   pose applications for entities outside the camera frustum.
+  ///   Entities in view are always updated at full rate, and off-screen
+  ///   updates are staggered rather than dropped. Helps keep the GUI
+  ///   responsive in worlds with many thousands of entities. Defaults to
+  ///   0, which applies every pose update immediately.
   class GzSceneManager : public GuiSystem
   {
     Q_OBJECT
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2024 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "SystemTiming.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Console.hh>
+#include <gz/gui/Application.hh>
+#include <gz/gui/Helpers.hh>
+#include <gz/gui/MainWindow.hh>
+#include <gz/plugin/Register.hh>
+#include <gz/transport/Node.hh>
+
+namespace gz::sim
+{
+  /// \brief Private data class for SystemTiming
+  class SystemTimingPrivate
+  {
+    /// \brief One overlay row, built from the samples accumulated over a
+    /// refresh period.
+    public: struct TimingRow
+    {
+      /// \brief Update phase and system name, as published by the server.
+      public: std::string label;
+
+      /// \brief Average update time over the refresh period, in ms.
+      public: double ms{0.0};
+
+      /// \brief Share of the summed system time of this refresh.
+      public: double frac{0.0};
+
+      /// \brief Averages of past refresh periods, oldest first.
+      public: std::vector<double> history;
+    };
+
+    /// \brief Number of refresh periods kept for the sparklines.
+    public: static constexpr std::size_t kHistorySize{60};
+
+    /// \brief Transport node
+    public: transport::Node node;
+
+    /// \brief Accumulated milliseconds and sample count per row label since
+    /// the last refresh. Protected by mutex.
+    public: std::map<std::string, std::pair<double, uint64_t>> accum;
+
+    /// \brief Average milliseconds of past refresh periods per row label,
+    /// capped at kHistorySize. Protected by mutex.
+    public: std::map<std::string, std::deque<double>> history;
+
+    /// \brief Wall clock time of the last overlay refresh.
+    public: std::chrono::steady_clock::time_point lastRefresh;
+
+    /// \brief Period between overlay refreshes.
+    public: std::chrono::milliseconds refreshPeriod{250};
+
+    /// \brief Timing entries exposed to QML. Only touched from the Qt
+    /// thread.
+    public: QVariantList entries;
+
+    /// \brief Protects accum and history, which are filled from the
+    /// transport thread.
+    public: std::mutex mutex;
+  };
+}
+
+using namespace gz;
+using namespace sim;
+
+/////////////////////////////////////////////////
+SystemTiming::SystemTiming()
+  : dataPtr(std::make_unique<SystemTimingPrivate>())
+{
+}
+
+/////////////////////////////////////////////////
+SystemTiming::~SystemTiming() = default;
+
+/////////////////////////////////////////////////
+void SystemTiming::LoadConfig(const tinyxml2::XMLElement *_pluginElem)
+{
+  if (this->title.empty())
+    this->title = "System timing";
+
+  if (_pluginElem)
+  {
+    auto periodElem = _pluginElem->FirstChildElement("refresh_period_ms");
+    if (nullptr != periodElem && nullptr != periodElem->GetText())
+    {
+      int periodMs{0};
+      periodElem->QueryIntText(&periodMs);
+      if (periodMs > 0)
+      {
+        this->dataPtr->refreshPeriod = std::chrono::milliseconds(periodMs);
+      }
+    }
+  }
+
+  // TODO(anyone) Only one world is supported for now
+  auto worldNames = gz::gui::worldNames();
+  if (worldNames.empty())
+  {
+    gzerr << "Failed to get world name, system timing plugin won't work."
+           << std::endl;
+    return;
+  }
+
+  auto topic = transport::TopicUtils::AsValidTopic(
+      "/world/" + worldNames[0].toStdString() + "/system_timing");
+  if (topic.empty())
+  {
+    gzerr << "Failed to generate valid topic for world ["
+           << worldNames[0].toStdString() << "]" << std::endl;
+    return;
+  }
+
+  if (!this->dataPtr->node.Subscribe(topic, &SystemTiming::OnTimingMsg, this))
+  {
+    gzerr << "Unable to subscribe to topic [" << topic << "]" << std::endl;
+    return;
+  }
+  gzmsg << "Subscribed to " << topic << std::endl;
+
+  this->dataPtr->lastRefresh = std::chrono::steady_clock::now();
+}
+
+/////////////////////////////////////////////////
+QVariantList SystemTiming::Entries() const
+{
+  return this->dataPtr->entries;
+}
+
+/////////////////////////////////////////////////
+void SystemTiming::OnTimingMsg(const msgs::StringMsg &_msg)
+{
+  std::vector<SystemTimingPrivate::TimingRow> rows;
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+    // Each line holds the update phase, the system name and the elapsed
+    // milliseconds, separated by spaces.
+    std::istringstream input(_msg.data());
+    std::string line;
+    while (std::getline(input, line))
+    {
+      auto lastSpace = line.rfind(' ');
+      if (lastSpace == std::string::npos)
+        continue;
+
+      const auto label = line.substr(0, lastSpace);
+      double ms{0.0};
+      try
+      {
+        ms = std::stod(line.substr(lastSpace + 1));
+      }
+      catch (const std::exception &)
+      {
+        continue;
+      }
+
+      auto &entry = this->dataPtr->accum[label];
+      entry.first += ms;
+      ++entry.second;
+    }
+
+    // Refresh the overlay once per period, averaging the samples received
+    // in between so fast-stepping servers don't flood the GUI.
+    const auto now = std::chrono::steady_clock::now();
+    if (now - this->dataPtr->lastRefresh < this->dataPtr->refreshPeriod)
+      return;
+    this->dataPtr->lastRefresh = now;
+
+    double totalMs{0.0};
+    for (const auto &[label, sample] : this->dataPtr->accum)
+    {
+      if (sample.second == 0u)
+        continue;
+
+      SystemTimingPrivate::TimingRow row;
+      row.label = label;
+      row.ms = sample.first / static_cast<double>(sample.second);
+      totalMs += row.ms;
+
+      auto &hist = this->dataPtr->history[label];
+      hist.push_back(row.ms);
+      while (hist.size() > SystemTimingPrivate::kHistorySize)
+        hist.pop_front();
+      row.history.assign(hist.begin(), hist.end());
+
+      rows.push_back(std::move(row));
+    }
+    this->dataPtr->accum.clear();
+
+    if (totalMs > 0.0)
+    {
+      for (auto &row : rows)
+        row.frac = row.ms / totalMs;
+    }
+
+    std::sort(rows.begin(), rows.end(),
+        [](const auto &_a, const auto &_b)
+        {
+          return _a.ms > _b.ms;
+        });
+  }
+
+  // Hand the snapshot to the Qt thread, which owns the entries property.
+  QMetaObject::invokeMethod(this, [this, rows]()
+      {
+        QVariantList list;
+        for (const auto &row : rows)
+        {
+          QVariantMap map;
+          map["label"] = QString::fromStdString(row.label);
+          map["ms"] = row.ms;
+          map["frac"] = row.frac;
+          QVariantList hist;
+          for (auto value : row.history)
+            hist.append(value);
+          map["history"] = hist;
+          list.append(map);
+        }
+        this->dataPtr->entries = list;
+        this->EntriesChanged();
+      }, Qt::QueuedConnection);
+}
+
+// Register this plugin
+GZ_ADD_PLUGIN(gz::sim::SystemTiming,
+              gz::gui::Plugin)
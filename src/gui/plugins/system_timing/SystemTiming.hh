@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef GZ_SIM_GUI_SYSTEMTIMING_HH_
+#define GZ_SIM_GUI_SYSTEMTIMING_HH_
+
+#include <gz/msgs/stringmsg.pb.h>
+
+#include <memory>
+
+#include <gz/gui/Plugin.hh>
+
+namespace gz
+{
+namespace sim
+{
+  class SystemTimingPrivate;
+
+  /// \brief Displays live per-system update times published by the server
+  /// on the world's `system_timing` topic, as a bar per system plus a
+  /// sparkline of its recent history.
+  ///
+  /// The server only records and publishes timing when it was started with
+  /// the `--profile-systems` option and while a subscriber is connected, so
+  /// there is no cost when this plugin is closed.
+  ///
+  /// ## Configuration
+  ///
+  /// - `<refresh_period_ms>`: Period between overlay refreshes, in
+  ///   milliseconds of wall clock time. Timing samples received in between
+  ///   are averaged. Defaults to 250.
+  class SystemTiming : public gz::gui::Plugin
+  {
+    Q_OBJECT
+
+    /// \brief Timing entries displayed by the overlay
+    Q_PROPERTY(
+      QVariantList entries
+      READ Entries
+      NOTIFY EntriesChanged
+    )
+
+    /// \brief Constructor
+    public: SystemTiming();
+
+    /// \brief Destructor
+    public: ~SystemTiming() override;
+
+    // Documentation inherited
+    public: void LoadConfig(const tinyxml2::XMLElement *_pluginElem) override;
+
+    /// \brief Get the timing entries. Each entry is a map with the keys
+    /// `label` (update phase and system name), `ms` (average update time
+    /// over the last refresh period), `frac` (share of the summed system
+    /// time) and `history` (averages of past refresh periods).
+    /// \return List of timing entries, slowest system first.
+    public: Q_INVOKABLE QVariantList Entries() const;
+
+    /// \brief Notify that the timing entries changed.
+    signals: void EntriesChanged();
+
+    /// \brief Callback for the timing messages from the server.
+    /// \param[in] _msg Message with one line per system update.
+    public: void OnTimingMsg(const msgs::StringMsg &_msg);
+
+    /// \internal
+    /// \brief Pointer to private data.
+    private: std::unique_ptr<SystemTimingPrivate> dataPtr;
+  };
+}
+}
+
+#endif
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2024 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+import QtQuick 2.9
+import QtQuick.Controls 2.1
+import QtQuick.Layouts 1.3
+
+ColumnLayout {
+  Layout.minimumWidth: 350
+  Layout.minimumHeight: 300
+  anchors.fill: parent
+  anchors.margins: 10
+  spacing: 4
+
+  Label {
+    text: qsTr("Per-system update time")
+    font.bold: true
+  }
+
+  Label {
+    visible: SystemTiming.entries.length === 0
+    text: qsTr("No timing data received. Start the server with " +
+               "--profile-systems 1 to enable profiling.")
+    wrapMode: Text.WordWrap
+    color: "dimgrey"
+    Layout.fillWidth: true
+  }
+
+  ListView {
+    id: timingList
+    Layout.fillWidth: true
+    Layout.fillHeight: true
+    clip: true
+    model: SystemTiming.entries
+    ScrollBar.vertical: ScrollBar {
+      active: true
+    }
+
+    delegate: Column {
+      width: timingList.width
+      spacing: 2
+
+      RowLayout {
+        width: parent.width
+
+        Label {
+          text: modelData.label
+          elide: Text.ElideMiddle
+          Layout.fillWidth: true
+        }
+
+        Label {
+          text: modelData.ms.toFixed(3) + " ms"
+          color: "dimgrey"
+        }
+      }
+
+      // Share of the summed system time for this refresh
+      Rectangle {
+        width: parent.width * modelData.frac
+        height: 4
+        color: "#21618c"
+      }
+
+      // Sparkline of the recent history, scaled to its own maximum
+      Canvas {
+        width: parent.width
+        height: 16
+        property var points: modelData.history
+        onPointsChanged: requestPaint()
+        onPaint: {
+          var ctx = getContext("2d")
+          ctx.clearRect(0, 0, width, height)
+          if (points.length < 2)
+            return
+          var maxVal = 1e-6
+          for (var i = 0; i < points.length; ++i)
+            maxVal = Math.max(maxVal, points[i])
+          ctx.strokeStyle = "#5dade2"
+          ctx.beginPath()
+          for (i = 0; i < points.length; ++i) {
+            var x = i * width / (points.length - 1)
+            var y = height - (points[i] / maxVal) * (height - 1)
+            if (i === 0)
+              ctx.moveTo(x, y)
+            else
+              ctx.lineTo(x, y)
+          }
+          ctx.stroke()
+        }
+      }
+
+      Item {
+        width: 1
+        height: 6
+      }
+    }
+  }
+}
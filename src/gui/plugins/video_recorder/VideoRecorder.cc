@@ -20,8 +20,14 @@
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/video_record.pb.h>
 
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -46,12 +52,34 @@ namespace gz::sim
 {
   class VideoRecorderPrivate
   {
+    /// \brief Destructor. Shuts down the encoder thread.
+    public: ~VideoRecorderPrivate();
+
     /// \brief Capture a video frame in the render thread.
     public: void OnRender();
 
     /// \brief Initialize rendering and transport.
     public: void Initialize();
 
+    /// \brief Encoder thread loop. Pulls captured frames off the queue and
+    /// feeds them to the video encoder, so the render thread only pays for
+    /// the GPU readback.
+    public: void EncodeLoop();
+
+    /// \brief Number of capture buffers cycled between the render thread
+    /// and the encoder thread.
+    public: static constexpr unsigned int kFrameBufferCount{4u};
+
+    /// \brief A captured frame waiting to be encoded.
+    public: struct CaptureFrame
+    {
+      /// \brief Captured image data.
+      rendering::Image image;
+
+      /// \brief Encoder timestamp of the frame.
+      std::chrono::steady_clock::time_point stamp;
+    };
+
     /// \brief Gazebo communication node.
     public: transport::Node node;
 
@@ -64,8 +92,38 @@ namespace gz::sim
     /// \brief Video encoder
     public: common::VideoEncoder videoEncoder;
 
-    /// \brief Image from user camera
-    public: rendering::Image cameraImage;
+    /// \brief Frames captured and waiting to be encoded, oldest first.
+    /// Protected by frameMutex.
+    public: std::deque<CaptureFrame> pendingFrames;
+
+    /// \brief Capture buffers returned by the encoder thread, ready for
+    /// reuse. Protected by frameMutex.
+    public: std::vector<rendering::Image> freeImages;
+
+    /// \brief Number of capture buffers allocated so far, bounded by
+    /// kFrameBufferCount. Protected by frameMutex.
+    public: unsigned int allocatedImages{0u};
+
+    /// \brief Protects the frame queue, the free buffers and the encoder
+    /// thread flags.
+    public: std::mutex frameMutex;
+
+    /// \brief Signals the encoder thread that frames or a stop request are
+    /// available.
+    public: std::condition_variable frameCv;
+
+    /// \brief Signals the render thread that a capture buffer was freed.
+    public: std::condition_variable freeImageCv;
+
+    /// \brief Keeps the encoder thread loop alive. Protected by frameMutex.
+    public: bool encoderRunning{false};
+
+    /// \brief Set when recording stops so the encoder thread finalizes the
+    /// video once the queue is drained. Protected by frameMutex.
+    public: bool stopRequested{false};
+
+    /// \brief Thread that encodes captured frames.
+    public: std::thread encoderThread;
 
     /// \brief True to record a video from the user camera
     public: bool recordVideo = false;
@@ -114,6 +172,81 @@ namespace gz::sim
 using namespace gz;
 using namespace sim;
 
+/////////////////////////////////////////////////
+VideoRecorderPrivate::~VideoRecorderPrivate()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->frameMutex);
+    this->encoderRunning = false;
+  }
+  this->frameCv.notify_all();
+  this->freeImageCv.notify_all();
+  if (this->encoderThread.joinable())
+    this->encoderThread.join();
+}
+
+/////////////////////////////////////////////////
+void VideoRecorderPrivate::EncodeLoop()
+{
+  std::unique_lock<std::mutex> lock(this->frameMutex);
+  while (true)
+  {
+    this->frameCv.wait(lock, [this]
+    {
+      return !this->encoderRunning || !this->pendingFrames.empty() ||
+          this->stopRequested;
+    });
+
+    if (!this->encoderRunning)
+      break;
+
+    if (!this->pendingFrames.empty())
+    {
+      auto frame = std::move(this->pendingFrames.front());
+      this->pendingFrames.pop_front();
+      lock.unlock();
+
+      bool frameAdded = this->videoEncoder.AddFrame(
+          frame.image.Data<unsigned char>(), frame.image.Width(),
+          frame.image.Height(), frame.stamp);
+
+      if (frameAdded)
+      {
+        // publish recorder stats
+        if (this->startTime ==
+            std::chrono::steady_clock::time_point(
+            std::chrono::duration(std::chrono::seconds(0))))
+        {
+          // start time, i.e. time when first frame is added
+          this->startTime = frame.stamp;
+        }
+
+        std::chrono::steady_clock::duration dt;
+        dt = frame.stamp - this->startTime;
+        int64_t sec, nsec;
+        std::tie(sec, nsec) = gz::math::durationToSecNsec(dt);
+        msgs::Time msg;
+        msg.set_sec(sec);
+        msg.set_nsec(nsec);
+        this->recorderStatsPub.Publish(msg);
+      }
+
+      lock.lock();
+      this->freeImages.push_back(std::move(frame.image));
+      this->freeImageCv.notify_one();
+      continue;
+    }
+
+    if (this->stopRequested)
+    {
+      this->stopRequested = false;
+      lock.unlock();
+      this->videoEncoder.Stop();
+      lock.lock();
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 void VideoRecorderPrivate::Initialize()
 {
@@ -165,46 +298,64 @@ void VideoRecorderPrivate::OnRender()
       unsigned int width = this->camera->ImageWidth();
       unsigned int height = this->camera->ImageHeight();
 
-      if (this->cameraImage.Width() != width ||
-          this->cameraImage.Height() != height)
-      {
-        this->cameraImage = this->camera->CreateImage();
-      }
-
       // Video recorder is on. Add more frames to it
       if (this->videoEncoder.IsEncoding())
       {
-        this->camera->Copy(this->cameraImage);
-
-        std::chrono::steady_clock::time_point t =
-            std::chrono::steady_clock::now();
-        if (this->useSimTime)
+        // Grab a capture buffer. Encoding happens on the encoder thread,
+        // so this thread only pays for the GPU readback.
+        rendering::Image frame;
+        bool haveBuffer = false;
         {
-          t = std::chrono::steady_clock::time_point(
-              this->simTime);
+          std::unique_lock<std::mutex> lock(this->frameMutex);
+          if (!this->freeImages.empty())
+          {
+            frame = std::move(this->freeImages.back());
+            this->freeImages.pop_back();
+            haveBuffer = true;
+          }
+          else if (this->allocatedImages < kFrameBufferCount)
+          {
+            ++this->allocatedImages;
+            haveBuffer = true;
+          }
+          else if (this->lockstep)
+          {
+            // In lockstep mode every frame matters, so wait for the
+            // encoder to free a buffer instead of dropping the frame.
+            this->freeImageCv.wait(lock, [this]
+            {
+              return !this->freeImages.empty() || !this->encoderRunning;
+            });
+            if (!this->freeImages.empty())
+            {
+              frame = std::move(this->freeImages.back());
+              this->freeImages.pop_back();
+              haveBuffer = true;
+            }
+          }
+          // otherwise the encoder is behind; drop this frame
         }
-        bool frameAdded = this->videoEncoder.AddFrame(
-            this->cameraImage.Data<unsigned char>(), width, height, t);
 
-        if (frameAdded)
+        if (haveBuffer)
         {
-          // publish recorder stats
-          if (this->startTime ==
-              std::chrono::steady_clock::time_point(
-              std::chrono::duration(std::chrono::seconds(0))))
+          if (frame.Width() != width || frame.Height() != height)
+            frame = this->camera->CreateImage();
+
+          this->camera->Copy(frame);
+
+          std::chrono::steady_clock::time_point t =
+              std::chrono::steady_clock::now();
+          if (this->useSimTime)
           {
-            // start time, i.e. time when first frame is added
-            this->startTime = t;
+            t = std::chrono::steady_clock::time_point(
+                this->simTime);
           }
 
-          std::chrono::steady_clock::duration dt;
-          dt = t - this->startTime;
-          int64_t sec, nsec;
-          std::tie(sec, nsec) = gz::math::durationToSecNsec(dt);
-          msgs::Time msg;
-          msg.set_sec(sec);
-          msg.set_nsec(nsec);
-          this->recorderStatsPub.Publish(msg);
+          {
+            std::lock_guard<std::mutex> lock(this->frameMutex);
+            this->pendingFrames.push_back({std::move(frame), t});
+          }
+          this->frameCv.notify_one();
         }
       }
       // Video recorder is idle. Start recording.
@@ -228,11 +379,22 @@ void VideoRecorderPrivate::OnRender()
             this->bitrate);
         this->startTime = std::chrono::steady_clock::time_point(
             std::chrono::duration(std::chrono::seconds(0)));
+
+        if (!this->encoderThread.joinable())
+        {
+          std::lock_guard<std::mutex> lock(this->frameMutex);
+          this->encoderRunning = true;
+          this->encoderThread = std::thread(
+              &VideoRecorderPrivate::EncodeLoop, this);
+        }
       }
     }
     else if (this->videoEncoder.IsEncoding())
     {
-      this->videoEncoder.Stop();
+      // The encoder thread finalizes the video once the queue is drained
+      std::lock_guard<std::mutex> lock(this->frameMutex);
+      this->stopRequested = true;
+      this->frameCv.notify_one();
     }
   }
   // only has an effect in video recording lockstep mode
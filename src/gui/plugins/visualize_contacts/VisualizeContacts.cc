@@ -22,8 +22,13 @@
 #include <gz/msgs/contacts.pb.h>
 #include <gz/msgs/entity.pb.h>
 #include <gz/msgs/marker.pb.h>
+#include <gz/msgs/marker_v.pb.h>
 
+#include <algorithm>
+#include <cmath>
+#include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <sdf/Link.hh>
@@ -68,6 +73,10 @@ inline namespace GZ_SIM_VERSION_NAMESPACE
     /// \brief Transport node
     public: transport::Node node;
 
+    /// \brief Publisher for submitting all contact markers of an update in
+    /// one bulk message instead of one service request per contact.
+    public: transport::Node::Publisher markerArrayPub;
+
     /// \brief Current state of the checkbox
     public: bool checkboxState{false};
 
@@ -151,6 +160,9 @@ void VisualizeContacts::LoadConfig(const tinyxml2::XMLElement *)
     gz::math::Vector3d(this->dataPtr->contactRadius,
     this->dataPtr->contactRadius,
     this->dataPtr->contactRadius));
+
+  this->dataPtr->markerArrayPub =
+    this->dataPtr->node.Advertise<gz::msgs::Marker_V>("/marker_array");
 }
 
 /////////////////////////////////////////////////
@@ -224,6 +236,14 @@ void VisualizeContacts::Update(const UpdateInfo &_info,
   // Since we are setting a lifetime for the markers, we get all the
   // contacts instead of getting new and removed ones
 
+  // Markers are batched into a single bulk message, and contacts that
+  // quantize to the same cell of a uniform grid matching the contact radius
+  // are merged into one marker. IDs restart at 1 every cycle, so existing
+  // marker visuals are updated in place rather than recreated.
+  gz::msgs::Marker_V markerArray;
+  std::set<std::tuple<int64_t, int64_t, int64_t>> cells;
+  const double cellSize = std::max(this->dataPtr->contactRadius, 1e-3);
+
   // Variable for setting the markers id through the iteration
   int markerID = 1;
   _ecm.Each<components::ContactSensorData>(
@@ -234,19 +254,34 @@ void VisualizeContacts::Update(const UpdateInfo &_info,
       {
         for (int i = 0; i < contact.position_size(); ++i)
         {
-          // Set marker id, poses and request service
+          auto cell = std::make_tuple(
+            static_cast<int64_t>(
+              std::floor(contact.position(i).x() / cellSize)),
+            static_cast<int64_t>(
+              std::floor(contact.position(i).y() / cellSize)),
+            static_cast<int64_t>(
+              std::floor(contact.position(i).z() / cellSize)));
+
+          // Skip contacts merged into an already occupied cell
+          if (!cells.insert(cell).second)
+            continue;
+
+          // Set marker id and pose, and append it to the bulk message
           this->dataPtr->positionMarkerMsg.set_id(markerID++);
           gz::msgs::Set(this->dataPtr->positionMarkerMsg.mutable_pose(),
             gz::math::Pose3d(contact.position(i).x(),
               contact.position(i).y(), contact.position(i).z(),
               0, 0, 0));
 
-          this->dataPtr->node.Request(
-            "/marker", this->dataPtr->positionMarkerMsg);
+          markerArray.add_marker()->CopyFrom(
+            this->dataPtr->positionMarkerMsg);
         }
       }
       return true;
     });
+
+  if (markerArray.marker_size() > 0)
+    this->dataPtr->markerArrayPub.Publish(markerArray);
 }
 
 //////////////////////////////////////////////////
@@ -82,9 +82,17 @@ inline namespace GZ_SIM_VERSION_NAMESPACE
     public: rendering::LidarVisualType visualType{
                             rendering::LidarVisualType::LVT_TRIANGLE_STRIPS};
 
-    /// \brief LaserScan message from sensor
+    /// \brief Latest LaserScan message from the sensor. Only stashed by the
+    /// transport callback; the conversion and upload to the visual happen
+    /// once per rendered frame on the render thread, so scans arriving
+    /// faster than the frame rate are coalesced.
     public: msgs::LaserScan msg;
 
+    /// \brief Reusable buffer handed to the lidar visual. Kept as a member
+    /// so uploading a scan reuses one allocation instead of building a
+    /// fresh vector per scan.
+    public: std::vector<double> pointBuffer;
+
     /// \brief Pose of the lidar visual
     public: math::Pose3d lidarPose{math::Pose3d::Zero};
 
@@ -238,6 +246,33 @@ bool VisualizeLidar::eventFilter(QObject *_obj, QEvent *_event)
       }
       if (this->dataPtr->visualDirty)
       {
+        const auto &msg = this->dataPtr->msg;
+        this->dataPtr->lidar->SetVerticalRayCount(msg.vertical_count());
+        this->dataPtr->lidar->SetHorizontalRayCount(msg.count());
+        this->dataPtr->lidar->SetMinHorizontalAngle(msg.angle_min());
+        this->dataPtr->lidar->SetMaxHorizontalAngle(msg.angle_max());
+        this->dataPtr->lidar->SetMinVerticalAngle(
+            msg.vertical_angle_min());
+        this->dataPtr->lidar->SetMaxVerticalAngle(
+            msg.vertical_angle_max());
+
+        this->dataPtr->pointBuffer.assign(msg.ranges().begin(),
+            msg.ranges().end());
+        this->dataPtr->lidar->SetPoints(this->dataPtr->pointBuffer);
+
+        if (!math::equal(this->dataPtr->maxVisualRange, msg.range_max()))
+        {
+          this->dataPtr->maxVisualRange = msg.range_max();
+          this->dataPtr->lidar->SetMaxRange(this->dataPtr->maxVisualRange);
+          this->MaxRangeChanged();
+        }
+        if (!math::equal(this->dataPtr->minVisualRange, msg.range_min()))
+        {
+          this->dataPtr->minVisualRange = msg.range_min();
+          this->dataPtr->lidar->SetMinRange(this->dataPtr->minVisualRange);
+          this->MinRangeChanged();
+        }
+
         this->dataPtr->lidar->SetWorldPose(this->dataPtr->lidarPose);
         this->dataPtr->lidar->Update();
         this->dataPtr->visualDirty = false;
@@ -453,39 +488,11 @@ void VisualizeLidar::OnScan(const msgs::LaserScan &_msg)
   std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
   if (this->dataPtr->initialized)
   {
+    // Only stash the scan here: this callback runs on the transport
+    // thread, and the upload to the visual happens on the render thread.
+    // If several scans arrive before the next frame, only the latest one
+    // is uploaded.
     this->dataPtr->msg = std::move(_msg);
-    this->dataPtr->lidar->SetVerticalRayCount(
-                                  this->dataPtr->msg.vertical_count());
-    this->dataPtr->lidar->SetHorizontalRayCount(
-                                  this->dataPtr->msg.count());
-    this->dataPtr->lidar->SetMinHorizontalAngle(
-                                  this->dataPtr->msg.angle_min());
-    this->dataPtr->lidar->SetMaxHorizontalAngle(
-                                  this->dataPtr->msg.angle_max());
-    this->dataPtr->lidar->SetMinVerticalAngle(
-                                  this->dataPtr->msg.vertical_angle_min());
-    this->dataPtr->lidar->SetMaxVerticalAngle(
-                                  this->dataPtr->msg.vertical_angle_max());
-
-    this->dataPtr->lidar->SetPoints(std::vector<double>(
-                                  this->dataPtr->msg.ranges().begin(),
-                                  this->dataPtr->msg.ranges().end()));
-
-    if (!math::equal(this->dataPtr->maxVisualRange,
-        this->dataPtr->msg.range_max()))
-    {
-      this->dataPtr->maxVisualRange = this->dataPtr->msg.range_max();
-      this->dataPtr->lidar->SetMaxRange(this->dataPtr->maxVisualRange);
-      this->MaxRangeChanged();
-    }
-    if (!math::equal(this->dataPtr->minVisualRange,
-        this->dataPtr->msg.range_min()))
-    {
-      this->dataPtr->minVisualRange = this->dataPtr->msg.range_min();
-      this->dataPtr->lidar->SetMinRange(this->dataPtr->minVisualRange);
-      this->MinRangeChanged();
-    }
-
     this->dataPtr->visualDirty = true;
   }
 }
@@ -140,7 +140,8 @@ extern "C" int runServer(const char *_sdfString,
     const char *_renderEngineServer, const char *_renderEngineServerApiBackend,
     const char *_renderEngineGui, const char *_renderEngineGuiApiBackend,
     const char *_file, const char *_recordTopics, int _waitGui,
-    int _headless, float _recordPeriod, int _seed)
+    int _headless, float _recordPeriod, int _seed, int _profileSystems,
+    const char *_trace)
 {
   std::string startingWorldPath{""};
   sim::ServerConfig serverConfig;
@@ -425,6 +426,16 @@ extern "C" int runServer(const char *_sdfString,
     gzmsg << "Setting seed value: " << _seed << "\n";
   }
 
+  if (_profileSystems > 0)
+  {
+    serverConfig.SetProfileSystems(true);
+  }
+
+  if (_trace != nullptr && std::strlen(_trace) > 0)
+  {
+    serverConfig.SetTracePath(_trace);
+  }
+
   // Create the Gazebo server
   sim::Server server(serverConfig);
 
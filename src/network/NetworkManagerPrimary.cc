@@ -17,6 +17,7 @@
 
 #include "NetworkManagerPrimary.hh"
 
+#include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/world_stats.pb.h>
 #include <gz/msgs/serialized_map.pb.h>
 #include "gz/sim/private_msgs/peer_control.pb.h"
@@ -25,6 +26,7 @@
 #include <algorithm>
 #include <future>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -32,6 +34,7 @@
 #include <gz/common/Util.hh>
 #include <gz/common/Profiler.hh>
 
+#include "gz/sim/components/ParentEntity.hh"
 #include "gz/sim/components/PerformerAffinity.hh"
 #include "gz/sim/components/PerformerLevels.hh"
 #include "gz/sim/Conversions.hh"
@@ -57,6 +60,26 @@ NetworkManagerPrimary::NetworkManagerPrimary(
   this->simStepPub = this->node.Advertise<private_msgs::SimulationStep>("step");
 
   this->node.Subscribe("step_ack", &NetworkManagerPrimary::OnStepAck, this);
+
+  this->diagnosticsPub =
+      this->node.Advertise<msgs::StringMsg>("/distributed/diagnostics");
+
+  std::string rebalanceEnv;
+  if (common::env("GZ_SIM_NETWORK_REBALANCE", rebalanceEnv) &&
+      rebalanceEnv != "0" && rebalanceEnv != "false")
+  {
+    this->rebalanceEnabled = true;
+    gzmsg << "Runtime performer re-balancing enabled." << std::endl;
+  }
+
+  std::string pipelineEnv;
+  if (common::env("GZ_SIM_NETWORK_PIPELINE", pipelineEnv) &&
+      pipelineEnv != "0" && pipelineEnv != "false")
+  {
+    this->pipelined = true;
+    gzmsg << "Pipelined network stepping enabled: secondary states are "
+           << "merged one step late." << std::endl;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -144,12 +167,33 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
     return false;
   }
 
+  // Merge the secondary states from the previous pipelined step now, so
+  // the change flags they set are visible to this step's systems.
+  if (!this->pendingStates.empty())
+  {
+    GZ_PROFILE("Updating primary state");
+    for (const auto &msg : this->pendingStates)
+    {
+      this->dataPtr->ecm->SetState(msg);
+    }
+    this->pendingStates.clear();
+  }
+
   // Send step to all secondaries
   this->secondaryStates.clear();
   this->secondaryStatesPromise = std::promise<void>{};
   auto future = this->secondaryStatesPromise.get_future();
+  this->stepSentTime = std::chrono::steady_clock::now();
   this->simStepPub.Publish(step);
 
+  // Pipelined mode: run this primary's systems while the secondaries
+  // compute the same step, so the barrier below only waits for whatever
+  // network latency the local update didn't already cover.
+  if (this->pipelined)
+  {
+    this->dataPtr->stepFunction(_info);
+  }
+
   // Block until all secondaries are done
   {
     GZ_PROFILE("Waiting for secondaries");
@@ -167,21 +211,32 @@ bool NetworkManagerPrimary::Step(const UpdateInfo &_info)
     }
   }
 
-  // Update primary state with states received from secondaries
+  if (this->pipelined)
   {
+    // Hold the received states until the next step. Applying them now
+    // would mark components changed right before the flags are cleared
+    // below, hiding the updates from diff-based consumers.
+    this->pendingStates = std::move(this->secondaryStates);
+    this->secondaryStates.clear();
+  }
+  else
+  {
+    // Update primary state with states received from secondaries
     GZ_PROFILE("Updating primary state");
     for (const auto &msg : this->secondaryStates)
     {
       this->dataPtr->ecm->SetState(msg);
     }
     this->secondaryStates.clear();
-  }
 
-  // Step all systems
-  this->dataPtr->stepFunction(_info);
+    // Step all systems
+    this->dataPtr->stepFunction(_info);
+  }
 
   this->dataPtr->ecm->SetAllComponentsUnchanged();
 
+  this->PublishDiagnostics();
+
   return true;
 }
 
@@ -199,15 +254,107 @@ std::map<std::string, SecondaryControl::Ptr>
 }
 
 //////////////////////////////////////////////////
-void NetworkManagerPrimary::OnStepAck(const msgs::SerializedStateMap &_msg)
+void NetworkManagerPrimary::OnStepAck(const private_msgs::SecondaryStep &_msg)
 {
-  this->secondaryStates.push_back(_msg);
+  auto rtt = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - this->stepSentTime).count();
+
+  {
+    std::lock_guard<std::mutex> lock(this->stepTimesMutex);
+    this->secondaryStepTimes[_msg.stats().prefix()] =
+        _msg.stats().step_duration_ns();
+
+    auto &diag = this->secondaryDiagnostics[_msg.stats().prefix()];
+    diag.ackCount++;
+    diag.lastRttNs = rtt;
+    diag.minRttNs = std::min(diag.minRttNs, rtt);
+    diag.maxRttNs = std::max(diag.maxRttNs, rtt);
+    diag.sumRttNs += rtt;
+
+    // Power-of-two millisecond buckets.
+    const int64_t rttMs = rtt / 1000000;
+    std::size_t bucket = 0u;
+    while (bucket + 1 < diag.rttHistogram.size() &&
+        rttMs >= (int64_t(1) << bucket))
+    {
+      ++bucket;
+    }
+    diag.rttHistogram[bucket]++;
+
+    diag.lastStateBytes = _msg.state().ByteSizeLong();
+    diag.sumStateBytes += diag.lastStateBytes;
+  }
+
+  this->secondaryStates.push_back(_msg.state());
   if (this->secondaryStates.size() == this->secondaries.size())
   {
     this->secondaryStatesPromise.set_value();
   }
 }
 
+//////////////////////////////////////////////////
+void NetworkManagerPrimary::PublishDiagnostics()
+{
+  auto now = std::chrono::steady_clock::now();
+  if (now - this->lastDiagnosticsTime < 1s)
+    return;
+  this->lastDiagnosticsTime = now;
+
+  if (!this->diagnosticsPub.HasConnections())
+    return;
+
+  // Clock offsets are keyed by peer id; diagnostics by prefix.
+  std::map<std::string, std::chrono::nanoseconds> offsets;
+  for (const auto &[id, offset] : this->dataPtr->tracker->ClockOffsets())
+  {
+    offsets[id.substr(0, 8)] = offset;
+  }
+
+  std::ostringstream csv;
+  csv << "prefix,acks,last_rtt_ms,avg_rtt_ms,min_rtt_ms,max_rtt_ms,"
+      << "last_state_bytes,avg_state_bytes,last_step_ms,clock_offset_ms";
+  for (std::size_t i = 0; i < SecondaryDiagnostics().rttHistogram.size(); ++i)
+  {
+    csv << ",rtt_bucket_" << i;
+  }
+  csv << "\n";
+
+  std::lock_guard<std::mutex> lock(this->stepTimesMutex);
+  for (const auto &[prefix, diag] : this->secondaryDiagnostics)
+  {
+    const double toMs = 1e-6;
+    csv << prefix
+        << "," << diag.ackCount
+        << "," << diag.lastRttNs * toMs
+        << "," << (diag.ackCount == 0u ? 0.0 :
+            static_cast<double>(diag.sumRttNs) /
+            static_cast<double>(diag.ackCount) * toMs)
+        << "," << diag.minRttNs * toMs
+        << "," << diag.maxRttNs * toMs
+        << "," << diag.lastStateBytes
+        << "," << (diag.ackCount == 0u ? 0u :
+            diag.sumStateBytes / diag.ackCount);
+
+    auto stepIt = this->secondaryStepTimes.find(prefix);
+    csv << "," << (stepIt == this->secondaryStepTimes.end() ?
+        0.0 : stepIt->second * toMs);
+
+    auto offsetIt = offsets.find(prefix);
+    csv << "," << (offsetIt == offsets.end() ?
+        0.0 : offsetIt->second.count() * toMs);
+
+    for (const auto &count : diag.rttHistogram)
+    {
+      csv << "," << count;
+    }
+    csv << "\n";
+  }
+
+  msgs::StringMsg msg;
+  msg.set_data(csv.str());
+  this->diagnosticsPub.Publish(msg);
+}
+
 //////////////////////////////////////////////////
 bool NetworkManagerPrimary::SecondariesCanStep() const
 {
@@ -303,6 +450,84 @@ void NetworkManagerPrimary::PopulateAffinities(
   }
 
   // TODO(louise) Process level changes
+
+  this->Rebalance(_msg, pToSPrevious);
+}
+
+//////////////////////////////////////////////////
+void NetworkManagerPrimary::Rebalance(private_msgs::SimulationStep &_msg,
+    const std::map<Entity, std::string> &_pToS)
+{
+  // Steps to wait after a migration before considering another one.
+  static const uint64_t kRebalanceCooldown{500u};
+
+  if (!this->rebalanceEnabled)
+    return;
+
+  if (this->rebalanceCooldown > 0u)
+  {
+    --this->rebalanceCooldown;
+    return;
+  }
+
+  std::map<std::string, int64_t> stepTimes;
+  {
+    std::lock_guard<std::mutex> lock(this->stepTimesMutex);
+    stepTimes = this->secondaryStepTimes;
+  }
+
+  // Wait until every secondary has reported at least once.
+  if (stepTimes.size() < this->secondaries.size() || stepTimes.size() < 2u)
+    return;
+
+  auto fastest = stepTimes.begin();
+  auto slowest = stepTimes.begin();
+  for (auto iter = stepTimes.begin(); iter != stepTimes.end(); ++iter)
+  {
+    if (iter->second < fastest->second)
+      fastest = iter;
+    if (iter->second > slowest->second)
+      slowest = iter;
+  }
+
+  // Require a meaningful gap before paying for a migration.
+  if (slowest->second * 2 < fastest->second * 3)
+    return;
+
+  Entity candidate{kNullEntity};
+  std::size_t slowestCount{0u};
+  for (const auto &[performer, prefix] : _pToS)
+  {
+    if (prefix == slowest->first)
+    {
+      ++slowestCount;
+      if (kNullEntity == candidate)
+        candidate = performer;
+    }
+  }
+
+  // Moving a lone performer would only move the hot spot.
+  if (slowestCount < 2u || kNullEntity == candidate)
+    return;
+
+  auto parent =
+      this->dataPtr->ecm->Component<components::ParentEntity>(candidate);
+  if (nullptr == parent)
+    return;
+
+  // Ship the full model subtree along with the new affinity, so the
+  // gaining secondary can reconstruct entities it doesn't have.
+  auto descendants = this->dataPtr->ecm->Descendants(parent->Data());
+
+  auto *affinityMsg = _msg.add_affinity();
+  this->SetAffinity(candidate, fastest->first, affinityMsg);
+  this->dataPtr->ecm->State(
+      *affinityMsg->mutable_state(), descendants, {}, true);
+
+  this->rebalanceCooldown = kRebalanceCooldown;
+
+  gzmsg << "Migrating performer [" << candidate << "] from secondary ["
+         << slowest->first << "] to [" << fastest->first << "]" << std::endl;
 }
 
 //////////////////////////////////////////////////
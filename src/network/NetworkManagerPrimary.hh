@@ -18,12 +18,18 @@
 #define GZ_SIM_NETWORK_NETWORKMANAGERPRIMARY_HH_
 
 #include <gz/msgs/serialized_map.pb.h>
+#include "gz/sim/private_msgs/secondary_stats.pb.h"
 #include "gz/sim/private_msgs/simulation_step.pb.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <future>
+#include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -56,6 +62,37 @@ namespace gz
       using Ptr = std::unique_ptr<SecondaryControl>;
     };
 
+    /// \brief Per-secondary step diagnostics accumulated by the primary.
+    struct SecondaryDiagnostics
+    {
+      /// \brief Number of step acks received.
+      uint64_t ackCount{0u};
+
+      /// \brief Round-trip time of the latest step send->ack, in
+      /// nanoseconds.
+      int64_t lastRttNs{0};
+
+      /// \brief Smallest observed round-trip time, in nanoseconds.
+      int64_t minRttNs{std::numeric_limits<int64_t>::max()};
+
+      /// \brief Largest observed round-trip time, in nanoseconds.
+      int64_t maxRttNs{0};
+
+      /// \brief Sum of all observed round-trip times, in nanoseconds.
+      int64_t sumRttNs{0};
+
+      /// \brief Round-trip time histogram with power-of-two millisecond
+      /// buckets: bucket 0 counts acks under 1 ms, bucket i acks in
+      /// [2^(i-1), 2^i) ms, and the last bucket everything slower.
+      std::array<uint64_t, 10> rttHistogram{};
+
+      /// \brief Serialized size of the latest state payload, in bytes.
+      uint64_t lastStateBytes{0u};
+
+      /// \brief Sum of all received state payload sizes, in bytes.
+      uint64_t sumStateBytes{0u};
+    };
+
     /// \class NetworkManagerPrimary NetworkManagerPrimary.hh
     ///   gz/sim/network/NetworkManagerPrimary.hh
     /// \brief Simulation primary specific behaviors
@@ -91,8 +128,9 @@ namespace gz
       public: std::map<std::string, SecondaryControl::Ptr>& Secondaries();
 
       /// \brief Callback for step ack messages.
-      /// \param[in] _msg Message containing secondary's updated state.
-      private: void OnStepAck(const msgs::SerializedStateMap &_msg);
+      /// \param[in] _msg Message containing the secondary's identity,
+      /// measured step time and updated state.
+      private: void OnStepAck(const private_msgs::SecondaryStep &_msg);
 
       /// \brief Check if the step publisher has connections.
       private: bool SecondariesCanStep() const;
@@ -109,6 +147,15 @@ namespace gz
       private: void SetAffinity(Entity _performer,
           const std::string &_secondary, private_msgs::PerformerAffinity *_msg);
 
+      /// \brief Migrate a performer off the slowest secondary when the
+      /// measured step times diverge enough, populating the step message
+      /// with the new affinity and the performer's model subtree state.
+      /// Only runs when GZ_SIM_NETWORK_REBALANCE is set.
+      /// \param[in] _msg Step message.
+      /// \param[in] _pToS Current performer-to-secondary mapping.
+      private: void Rebalance(private_msgs::SimulationStep &_msg,
+          const std::map<Entity, std::string> &_pToS);
+
       /// \brief Container of currently used secondary peers
       private: std::map<std::string, SecondaryControl::Ptr> secondaries;
 
@@ -123,6 +170,55 @@ namespace gz
 
       /// \brief Promise used to notify when all secondaryStates where received.
       private: std::promise<void> secondaryStatesPromise;
+
+      /// \brief True when pipelined stepping is enabled through the
+      /// GZ_SIM_NETWORK_PIPELINE environment variable. The primary then
+      /// runs its own systems while the secondaries compute the same
+      /// step, and merges their states at the start of the next step,
+      /// trading one step of state latency for overlapping the barrier
+      /// wait with computation.
+      private: bool pipelined{false};
+
+      /// \brief States received from the secondaries for the previous
+      /// pipelined step, waiting to be merged at the start of this one.
+      private: std::vector<msgs::SerializedStateMap> pendingStates;
+
+      /// \brief True when runtime performer re-balancing is enabled
+      /// through the GZ_SIM_NETWORK_REBALANCE environment variable.
+      private: bool rebalanceEnabled{false};
+
+      /// \brief Steps to wait before considering another migration, so
+      /// the cluster settles between moves.
+      private: uint64_t rebalanceCooldown{0u};
+
+      /// \brief Latest step duration reported by each secondary, in
+      /// nanoseconds, keyed by prefix. Protected by stepTimesMutex.
+      private: std::map<std::string, int64_t> secondaryStepTimes;
+
+      /// \brief Mutex protecting secondaryStepTimes and
+      /// secondaryDiagnostics.
+      private: std::mutex stepTimesMutex;
+
+      /// \brief Publish the accumulated per-secondary diagnostics as a CSV
+      /// table on /distributed/diagnostics, at most once per second and
+      /// only when there are subscribers. Each message is a complete table
+      /// with a header row, so echoing the topic yields a CSV dump.
+      private: void PublishDiagnostics();
+
+      /// \brief Accumulated diagnostics per secondary, keyed by prefix.
+      /// Protected by stepTimesMutex.
+      private: std::map<std::string, SecondaryDiagnostics>
+          secondaryDiagnostics;
+
+      /// \brief Time at which the current step command was published, used
+      /// to measure the send->ack round trip.
+      private: std::chrono::steady_clock::time_point stepSentTime;
+
+      /// \brief Publisher for the per-secondary diagnostics.
+      private: gz::transport::Node::Publisher diagnosticsPub;
+
+      /// \brief Last time diagnostics were published.
+      private: std::chrono::steady_clock::time_point lastDiagnosticsTime;
     };
     }
   }  // namespace sim
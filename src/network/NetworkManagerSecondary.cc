@@ -17,10 +17,14 @@
 
 #include <gz/msgs/serialized_map.pb.h>
 #include "gz/sim/private_msgs/peer_control.pb.h"
+#include "gz/sim/private_msgs/secondary_stats.pb.h"
 #include "gz/sim/private_msgs/simulation_step.pb.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
@@ -63,7 +67,8 @@ NetworkManagerSecondary::NetworkManagerSecondary(
 
   this->node.Subscribe("step", &NetworkManagerSecondary::OnStep, this);
 
-  this->stepAckPub = this->node.Advertise<msgs::SerializedStateMap>("step_ack");
+  this->stepAckPub =
+      this->node.Advertise<private_msgs::SecondaryStep>("step_ack");
 }
 
 //////////////////////////////////////////////////
@@ -121,6 +126,14 @@ void NetworkManagerSecondary::OnStep(
     {
       this->performers.insert(entityId);
 
+      // A migrated performer arrives with its model subtree's state, so a
+      // secondary that removed the model when it lost, or never had, the
+      // affinity can reconstruct it.
+      if (!affinityMsg.state().entities().empty())
+      {
+        this->dataPtr->ecm->SetState(affinityMsg.state());
+      }
+
       gzmsg << "Secondary [" << this->Namespace()
              << "] assigned affinity to performer [" << entityId << "]."
              << std::endl;
@@ -130,7 +143,12 @@ void NetworkManagerSecondary::OnStep(
     {
       auto parent =
           this->dataPtr->ecm->Component<components::ParentEntity>(entityId);
-      this->dataPtr->ecm->RequestRemoveEntity(parent->Data());
+      // The performer may not exist here at all, e.g. when it migrates
+      // between two other secondaries.
+      if (parent != nullptr)
+      {
+        this->dataPtr->ecm->RequestRemoveEntity(parent->Data());
+      }
 
       if (this->performers.find(entityId) != this->performers.end())
       {
@@ -146,7 +164,9 @@ void NetworkManagerSecondary::OnStep(
   auto info = convert<UpdateInfo>(_msg.stats());
 
   // Step runner
+  auto stepStart = std::chrono::steady_clock::now();
   this->dataPtr->stepFunction(info);
+  auto stepDuration = std::chrono::steady_clock::now() - stepStart;
 
   // Update state with all the performer's entities
   std::unordered_set<Entity> entities;
@@ -169,10 +189,79 @@ void NetworkManagerSecondary::OnStep(
   msgs::SerializedStateMap stateMsg;
   if (!entities.empty())
     this->dataPtr->ecm->State(stateMsg, entities);
+  this->FilterUnchangedComponents(stateMsg);
   stateMsg.set_has_one_time_component_changes(
     this->dataPtr->ecm->HasOneTimeComponentChanges());
 
-  this->stepAckPub.Publish(stateMsg);
+  // Acknowledge with identity, measured load and updated state in one
+  // message, so each step costs a single message on the ack path.
+  private_msgs::SecondaryStep ackMsg;
+  auto *stats = ackMsg.mutable_stats();
+  stats->set_prefix(this->Namespace());
+  stats->set_iterations(_msg.stats().iterations());
+  stats->set_step_duration_ns(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          stepDuration).count());
+  ackMsg.mutable_state()->Swap(&stateMsg);
+  this->stepAckPub.Publish(ackMsg);
 
   this->dataPtr->ecm->SetAllComponentsUnchanged();
 }
+
+/////////////////////////////////////////////////
+void NetworkManagerSecondary::FilterUnchangedComponents(
+    msgs::SerializedStateMap &_msg)
+{
+  GZ_PROFILE("NetworkManagerSecondary::FilterUnchangedComponents");
+
+  std::vector<uint64_t> entitiesToDrop;
+  for (auto &entityPair : *_msg.mutable_entities())
+  {
+    auto &entityMsg = entityPair.second;
+    if (entityMsg.remove())
+    {
+      // The whole entity is going away; forget its baseline.
+      this->lastSentComponents.erase(entityPair.first);
+      continue;
+    }
+
+    auto &baseline = this->lastSentComponents[entityPair.first];
+
+    std::vector<int64_t> componentsToDrop;
+    for (auto &compPair : *entityMsg.mutable_components())
+    {
+      const auto &compMsg = compPair.second;
+      if (compMsg.remove())
+      {
+        baseline.erase(compPair.first);
+        continue;
+      }
+
+      auto baseIter = baseline.find(compPair.first);
+      if (baseIter != baseline.end() &&
+          baseIter->second == compMsg.component())
+      {
+        componentsToDrop.push_back(compPair.first);
+      }
+      else
+      {
+        baseline[compPair.first] = compMsg.component();
+      }
+    }
+
+    for (const auto &key : componentsToDrop)
+    {
+      entityMsg.mutable_components()->erase(key);
+    }
+
+    // An entity whose components were all dropped is already fully known
+    // to the primary.
+    if (entityMsg.components().empty())
+      entitiesToDrop.push_back(entityPair.first);
+  }
+
+  for (const auto &key : entitiesToDrop)
+  {
+    _msg.mutable_entities()->erase(key);
+  }
+}
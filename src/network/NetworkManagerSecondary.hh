@@ -18,10 +18,14 @@
 #define GZ_SIM_NETWORK_NETWORKMANAGERSECONDARY_HH_
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
+#include <gz/msgs/serialized_map.pb.h>
+
 #include <gz/sim/config.hh>
 #include <gz/sim/Export.hh>
 #include <gz/transport/Node.hh>
@@ -70,6 +74,14 @@ namespace gz
       /// \param[in] _msg Step message.
       private: void OnStep(const private_msgs::SimulationStep &_msg);
 
+      /// \brief Drop components from a state message whose serialized
+      /// payload matches what was already sent to the primary, and update
+      /// the sent baseline with whatever remains. Physics marks poses of
+      /// resting bodies changed every step, so without this every ack
+      /// carries the full pose set of all assigned performers.
+      /// \param[in, out] _msg State message about to be published.
+      private: void FilterUnchangedComponents(msgs::SerializedStateMap &_msg);
+
       /// \brief Flag to control enabling/disabling simulation secondary.
       private: std::atomic<bool> enableSim {false};
 
@@ -81,6 +93,14 @@ namespace gz
 
       /// \brief Collection of performers associated with this secondary.
       private: std::unordered_set<Entity> performers;
+
+      /// \brief Serialized payloads last sent to the primary, keyed by
+      /// entity and component type. This is the baseline for the
+      /// differential sync: gz-transport delivery is reliable, so a
+      /// payload published once doesn't need to be re-sent until its
+      /// bytes change.
+      private: std::unordered_map<Entity,
+          std::unordered_map<int64_t, std::string>> lastSentComponents;
     };
     }
   }  // namespace sim
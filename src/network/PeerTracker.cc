@@ -125,7 +125,18 @@ void PeerTracker::HeartbeatLoop()
   while (this->heartbeatRunning)
   {
     lastUpdateTime = Clock::now();
-    this->heartbeatPub.Publish(toProto(this->info));
+
+    // Stamp the heartbeat with the wall clock, so receivers can estimate
+    // this peer's clock offset.
+    auto proto = toProto(this->info);
+    auto wall = std::chrono::system_clock::now().time_since_epoch();
+    auto sec = std::chrono::duration_cast<std::chrono::seconds>(wall);
+    auto nsec =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(wall - sec);
+    proto.mutable_header()->mutable_stamp()->set_sec(sec.count());
+    proto.mutable_header()->mutable_stamp()->set_nsec(
+        static_cast<int32_t>(nsec.count()));
+    this->heartbeatPub.Publish(proto);
 
     std::vector<PeerInfo> toRemove;
     for (auto peer : this->peers)
@@ -220,6 +231,32 @@ void PeerTracker::OnPeerHeartbeat(const private_msgs::PeerInfo &_info)
   peerState.lastHeader = std::chrono::steady_clock::time_point(
       std::chrono::seconds(_info.header().stamp().sec()) +
       std::chrono::nanoseconds(_info.header().stamp().nsec()));
+
+  // Estimate the peer's wall clock offset from the heartbeat stamp. The
+  // estimate includes the one-way transport latency.
+  if (_info.header().stamp().sec() != 0 || _info.header().stamp().nsec() != 0)
+  {
+    auto recvWall = std::chrono::system_clock::now().time_since_epoch();
+    auto sentWall = std::chrono::seconds(_info.header().stamp().sec()) +
+        std::chrono::nanoseconds(_info.header().stamp().nsec());
+    peerState.clockOffset =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+        recvWall - sentWall);
+  }
+}
+
+/////////////////////////////////////////////////
+std::map<std::string, std::chrono::nanoseconds>
+    PeerTracker::ClockOffsets() const
+{
+  auto lock = PeerLock(this->peersMutex);
+
+  std::map<std::string, std::chrono::nanoseconds> offsets;
+  for (const auto &peer : this->peers)
+  {
+    offsets[peer.first] = peer.second.clockOffset;
+  }
+  return offsets;
 }
 
 /////////////////////////////////////////////////
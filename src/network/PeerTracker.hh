@@ -17,6 +17,7 @@
 #ifndef GZ_SIM_NETWORK_PEERTRACKER_HH_
 #define GZ_SIM_NETWORK_PEERTRACKER_HH_
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <string>
@@ -136,6 +137,17 @@ namespace gz
                 return ret;
               }
 
+      /// \brief Retrieve the estimated wall clock offset of each discovered
+      /// peer, keyed by peer id.
+      ///
+      /// Heartbeats are stamped with the sender's wall clock, so the offset
+      /// is the receive time minus the send stamp. It includes the one-way
+      /// transport latency and is meant for coarse diagnostics, not for
+      /// clock synchronization.
+      /// \return Estimated offset per peer in nanoseconds.
+      public: std::map<std::string, std::chrono::nanoseconds>
+              ClockOffsets() const;
+
       /// \brief Internal loop to announce and check stale peers.
       private: void HeartbeatLoop();
 
@@ -175,6 +187,10 @@ namespace gz
 
         /// \brief Keep last time heartbeat was received
         std::chrono::steady_clock::time_point lastSeen;
+
+        /// \brief Estimated offset of the peer's wall clock, computed as
+        /// the local receive time minus the heartbeat's send stamp.
+        std::chrono::nanoseconds clockOffset{0};
       };
 
       /// \brief Convenience type alias
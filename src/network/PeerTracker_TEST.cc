@@ -187,6 +187,38 @@ TEST(PeerTracker, GZ_UTILS_TEST_DISABLED_ON_MAC(PeerTrackerStale))
   // received from stale peer
 }
 
+//////////////////////////////////////////////////
+TEST(PeerTracker, ClockOffsets)
+{
+  gz::common::Console::SetVerbosity(4);
+  EventManager eventMgr;
+
+  auto tracker1 = std::make_shared<PeerTracker>(
+      PeerInfo(NetworkRole::SimulationPrimary), &eventMgr);
+  tracker1->SetHeartbeatPeriod(std::chrono::milliseconds(10));
+
+  auto info2 = PeerInfo(NetworkRole::SimulationSecondary);
+  auto tracker2 = std::make_shared<PeerTracker>(info2);
+  tracker2->SetHeartbeatPeriod(std::chrono::milliseconds(10));
+
+  // Wait until a stamped heartbeat has been processed.
+  int maxSleep{100};
+  int sleep{0};
+  for (; sleep < maxSleep && tracker1->ClockOffsets().empty(); ++sleep)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_LT(sleep, maxSleep);
+
+  auto offsets = tracker1->ClockOffsets();
+  ASSERT_EQ(1u, offsets.count(info2.id));
+
+  // Both peers share the same clock here, so the estimate reduces to the
+  // transport latency: non-negative and well under a second.
+  EXPECT_GE(offsets[info2.id], std::chrono::nanoseconds(0));
+  EXPECT_LT(offsets[info2.id], std::chrono::seconds(1));
+}
+
 //////////////////////////////////////////////////
 TEST(PeerTracker, Partitioned)
 {
@@ -20,6 +20,8 @@
 #include <map>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gz/msgs/boolean.pb.h>
 #include <gz/msgs/marker.pb.h>
@@ -79,6 +81,18 @@ class gz::sim::MarkerManagerPrivate
   public: bool OnMarkerMsgArray(const msgs::Marker_V &_req,
               msgs::Boolean &_res);
 
+  /// \brief Callback that receives multiple marker messages on a topic,
+  /// without the round trip of the array service. Markers received here
+  /// are not echoed back on the marker topic since they are already on
+  /// the wire.
+  /// \param[in] _req The vector of marker messages
+  public: void OnMarkerVMsg(const msgs::Marker_V &_req);
+
+  /// \brief Detach a marker visual from the scene and park it in the
+  /// pool for reuse instead of destroying it.
+  /// \param[in] _visual The marker visual to release.
+  public: void ReleaseVisual(const rendering::VisualPtr &_visual);
+
   /// \brief Services callback that returns a list of markers.
   /// \param[out] _rep Service reply
   /// \return True on success.
@@ -110,8 +124,15 @@ class gz::sim::MarkerManagerPrivate
   public: std::map<std::string,
       std::map<uint64_t, rendering::VisualPtr>> visuals;
 
-  /// \brief List of marker message to process.
-  public: std::list<msgs::Marker> markerMsgs;
+  /// \brief List of marker messages to process, paired with whether the
+  /// processed message should be echoed on the marker topic.
+  public: std::list<std::pair<msgs::Marker, bool>> markerMsgs;
+
+  /// \brief Pool of detached marker visuals available for reuse. Debug
+  /// overlays that churn thousands of markers per frame reuse these
+  /// instead of destroying and recreating scene visuals. Pooled visuals
+  /// keep the name they were created with.
+  public: std::vector<rendering::VisualPtr> visualPool;
 
   /// \brief Pointer to the scene
   public: rendering::ScenePtr scene;
@@ -200,6 +221,15 @@ bool MarkerManager::Init(const rendering::ScenePtr &_scene)
            << "_array service.\n";
   }
 
+  // Subscribe to the marker_array topic for bulk submission without a
+  // service round trip
+  if (!this->dataPtr->node.Subscribe(this->dataPtr->topicName + "_array",
+        &MarkerManagerPrivate::OnMarkerVMsg, this->dataPtr.get()))
+  {
+    gzerr << "Unable to subscribe to the " << this->dataPtr->topicName
+           << "_array topic.\n";
+  }
+
   this->dataPtr->markerPub =
     this->dataPtr->node.Advertise<msgs::Marker>(this->dataPtr->topicName);
 
@@ -228,8 +258,9 @@ void MarkerManagerPrivate::Update()
   for (auto markerIter = this->markerMsgs.begin();
        markerIter != this->markerMsgs.end();)
   {
-    this->ProcessMarkerMsg(*markerIter);
-    this->markerPub.Publish(*markerIter);
+    this->ProcessMarkerMsg(markerIter->first);
+    if (markerIter->second)
+      this->markerPub.Publish(markerIter->first);
     this->markerMsgs.erase(markerIter++);
   }
 
@@ -253,7 +284,7 @@ void MarkerManagerPrivate::Update()
             (markerPtr->Lifetime() <= simTime ||
             this->simTime < this->lastSimTime))
         {
-          this->scene->DestroyVisual(it->second);
+          this->ReleaseVisual(it->second);
           it = mit->second.erase(it);
           break;
         }
@@ -515,15 +546,38 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
     // Otherwise create a new marker
     else
     {
-      // Create the name for the marker
-      std::string name = "__GZ_MARKER_VISUAL_" + ns + "_" +
-                         std::to_string(id);
+      rendering::VisualPtr visualPtr;
+      rendering::MarkerPtr markerPtr;
 
-      // Create the new marker
-      rendering::VisualPtr visualPtr = this->scene->CreateVisual(name);
+      // Reuse a pooled visual and its marker if one is available
+      while (!this->visualPool.empty() && !markerPtr)
+      {
+        visualPtr = this->visualPool.back();
+        this->visualPool.pop_back();
+        markerPtr = std::dynamic_pointer_cast<rendering::Marker>(
+            visualPtr->GeometryByIndex(0u));
+        if (!markerPtr)
+        {
+          this->scene->DestroyVisual(visualPtr);
+          visualPtr = nullptr;
+        }
+      }
+      if (markerPtr)
+      {
+        visualPtr->RemoveGeometryByIndex(0u);
+      }
+      else
+      {
+        // Create the name for the marker
+        std::string name = "__GZ_MARKER_VISUAL_" + ns + "_" +
+                           std::to_string(id);
+
+        // Create the new marker
+        visualPtr = this->scene->CreateVisual(name);
 
-      // Create and load the marker
-      rendering::MarkerPtr markerPtr = this->scene->CreateMarker();
+        // Create and load the marker
+        markerPtr = this->scene->CreateMarker();
+      }
 
       // Set the visual values from the Marker Message
       this->SetVisual(_msg, visualPtr);
@@ -551,7 +605,7 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
     if (nsIter != this->visuals.end() &&
         visualIter != nsIter->second.end())
     {
-      this->scene->DestroyVisual(visualIter->second);
+      this->ReleaseVisual(visualIter->second);
       this->visuals[ns].erase(visualIter);
 
       // Remove namespace if empty
@@ -580,7 +634,7 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
     {
       for (auto it : nsIter->second)
       {
-        this->scene->DestroyVisual(it.second);
+        this->ReleaseVisual(it.second);
       }
       nsIter->second.clear();
       this->visuals.erase(nsIter);
@@ -593,7 +647,7 @@ bool MarkerManagerPrivate::ProcessMarkerMsg(const msgs::Marker &_msg)
       {
         for (auto it : nsIter->second)
         {
-          this->scene->DestroyVisual(it.second);
+          this->ReleaseVisual(it.second);
         }
       }
       this->visuals.clear();
@@ -633,7 +687,7 @@ bool MarkerManagerPrivate::OnList(msgs::Marker_V &_rep)
 void MarkerManagerPrivate::OnMarkerMsg(const msgs::Marker &_req)
 {
   std::lock_guard<std::mutex> lock(this->mutex);
-  this->markerMsgs.push_back(_req);
+  this->markerMsgs.emplace_back(_req, true);
 }
 
 /////////////////////////////////////////////////
@@ -641,16 +695,33 @@ bool MarkerManagerPrivate::OnMarkerMsgArray(
     const msgs::Marker_V&_req, msgs::Boolean &_res)
 {
   std::lock_guard<std::mutex> lock(this->mutex);
-  std::copy(_req.marker().begin(), _req.marker().end(),
-            std::back_inserter(this->markerMsgs));
+  for (const auto &marker : _req.marker())
+    this->markerMsgs.emplace_back(marker, true);
   _res.set_data(true);
   return true;
 }
 
+/////////////////////////////////////////////////
+void MarkerManagerPrivate::OnMarkerVMsg(const msgs::Marker_V &_req)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  for (const auto &marker : _req.marker())
+    this->markerMsgs.emplace_back(marker, false);
+}
+
+/////////////////////////////////////////////////
+void MarkerManagerPrivate::ReleaseVisual(const rendering::VisualPtr &_visual)
+{
+  if (_visual->HasParent())
+    _visual->Parent()->RemoveChild(_visual);
+  this->visualPool.push_back(_visual);
+}
+
 /////////////////////////////////////////////////
 void MarkerManager::Clear()
 {
   this->dataPtr->visuals.clear();
   this->dataPtr->markerMsgs.clear();
+  this->dataPtr->visualPool.clear();
   this->dataPtr->scene.reset();
 }
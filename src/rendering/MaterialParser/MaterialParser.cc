@@ -42,6 +42,10 @@ void MaterialParser::Load()
 std::optional<MaterialParser::MaterialValues> MaterialParser::GetMaterialValues(
   const std::string& _material)
 {
+  auto cached = this->cache.find(_material);
+  if (cached != this->cache.end())
+    return cached->second;
+
   std::optional<MaterialValues> values = std::nullopt;
   std::map<std::string, ConfigNode *> scripts =
     this->configLoader.GetAllConfigScripts();
@@ -95,5 +99,6 @@ std::optional<MaterialParser::MaterialValues> MaterialParser::GetMaterialValues(
       // \todo Handle dependent materials
     }
   }
+  this->cache[_material] = values;
   return values;
 }
@@ -20,6 +20,7 @@
 
 #include <optional>
 #include <string>
+#include <unordered_map>
 
 #include <gz/math/Color.hh>
 
@@ -47,6 +48,11 @@ class MaterialParser
 
   private:
   ConfigLoader configLoader;
+
+  /// Resolved values per material name. Resolving walks every loaded
+  /// script, so worlds where thousands of visuals reference a handful of
+  /// materials only pay that walk once per distinct name.
+  std::unordered_map<std::string, std::optional<MaterialValues>> cache;
 };
 }  // namespace sim
 }  // namespace gz
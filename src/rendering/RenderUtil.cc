@@ -27,9 +27,11 @@
 #include <sdf/Camera.hh>
 #include <sdf/Collision.hh>
 #include <sdf/Element.hh>
+#include <sdf/Geometry.hh>
 #include <sdf/Joint.hh>
 #include <sdf/Light.hh>
 #include <sdf/Link.hh>
+#include <sdf/Mesh.hh>
 #include <sdf/Model.hh>
 #include <sdf/parser.hh>
 #include <sdf/Scene.hh>
@@ -39,14 +41,22 @@
 #include <gz/common/Profiler.hh>
 #include <gz/common/Skeleton.hh>
 #include <gz/common/SkeletonAnimation.hh>
+#include <gz/common/WorkerPool.hh>
 
 #include <gz/math/Color.hh>
+#include <gz/math/Frustum.hh>
 #include <gz/math/Helpers.hh>
 #include <gz/math/Matrix4.hh>
 #include <gz/math/Pose3.hh>
 
+#include <gz/msgs/any.pb.h>
+#include <gz/msgs/param_v.pb.h>
+
 #include <gz/msgs/Utility.hh>
 
+#include <gz/transport/Node.hh>
+
+#include <gz/rendering/Camera.hh>
 #include <gz/rendering/Grid.hh>
 #include <gz/rendering/RenderEngine.hh>
 #include <gz/rendering/RenderingIface.hh>
@@ -93,6 +103,7 @@
 #include "gz/sim/components/Visibility.hh"
 #include "gz/sim/components/Visual.hh"
 #include "gz/sim/components/VisualCmd.hh"
+#include "gz/sim/components/VisualLod.hh"
 #include "gz/sim/components/WideAngleCamera.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/EntityComponentManager.hh"
@@ -140,9 +151,32 @@ class gz::sim::RenderUtilPrivate
   public: void RemoveRenderingEntities(const EntityComponentManager &_ecm,
       const UpdateInfo &_info);
 
+  /// \brief Per-frame pose and animation updates scanned from the ECM.
+  /// The sim thread fills a back buffer of these without holding
+  /// updateMutex and hands it over by swap, so the critical section
+  /// stays a few pointer swaps even in visual-heavy worlds.
+  public: struct EntityUpdates
+  {
+    /// \brief Entity pose updates, see RenderUtilPrivate::entityPoses
+    std::unordered_map<Entity, math::Pose3d> entityPoses;
+
+    /// \brief Actor transforms, see RenderUtilPrivate::actorTransforms
+    std::map<Entity, std::map<std::string, math::Matrix4d>> actorTransforms;
+
+    /// \brief Trajectory poses, see RenderUtilPrivate::trajectoryPoses
+    std::unordered_map<Entity, math::Pose3d> trajectoryPoses;
+
+    /// \brief Actor animation data, see
+    /// RenderUtilPrivate::actorAnimationData
+    std::unordered_map<Entity, AnimationUpdateData> actorAnimationData;
+  };
+
   /// \brief Update rendering entities
   /// \param[in] _ecm The entity-component manager
-  public: void UpdateRenderingEntities(const EntityComponentManager &_ecm);
+  /// \param[in] _info Update information
+  /// \param[out] _updates Buffer receiving the pose and animation updates
+  public: void UpdateRenderingEntities(const EntityComponentManager &_ecm,
+      const UpdateInfo &_info, EntityUpdates &_updates);
 
   /// \breif Helper function to add new sensors
   /// \param[in] _ecm The entity-component manager
@@ -237,6 +271,19 @@ class gz::sim::RenderUtilPrivate
   /// \brief Marker manager
   public: MarkerManager markerManager;
 
+  /// \brief Transport node for the culling statistics publisher
+  public: transport::Node node;
+
+  /// \brief Publisher of per camera frustum culling statistics. The
+  /// statistics are only computed while the topic has subscribers.
+  public: transport::Node::Publisher cullingStatsPub;
+
+  /// \brief Test every visual's world bounding box against the frustum
+  /// of every camera in the scene and publish visible / culled counts
+  /// per camera. Engine side culling already uses an internal octree;
+  /// these counters make its effect observable.
+  public: void PublishCullingStats();
+
   /// \brief Pointer to rendering engine.
   public: rendering::RenderEngine *engine{nullptr};
 
@@ -269,6 +316,12 @@ class gz::sim::RenderUtilPrivate
   /// [0] entity id, [1] SDF DOM, [2] parent entity id
   public: std::vector<std::tuple<Entity, sdf::Visual, Entity>> newVisuals;
 
+  /// \brief Level of detail bands of new visuals, to be registered with
+  /// the scene manager. The elements in the pair are:
+  /// [0] entity id, [1] bands pairing switch distance with geometry
+  public: std::vector<std::pair<Entity,
+      std::vector<std::pair<double, sdf::Geometry>>>> newVisualLods;
+
   /// \brief New actors to be created. The elements in the tuple are:
   /// [0] entity id, [1] SDF DOM, [2] actor name, [3] parent entity id
   public: std::vector<std::tuple<Entity, sdf::Actor, std::string, Entity>>
@@ -316,6 +369,20 @@ class gz::sim::RenderUtilPrivate
   /// \brief A map of entity ids and pose updates.
   public: std::unordered_map<Entity, math::Pose3d> entityPoses;
 
+  /// \brief See RenderUtil::SetOffscreenPoseUpdatePeriod. Zero, the
+  /// default, applies every pose update immediately.
+  public: unsigned int offscreenPoseUpdatePeriod{0u};
+
+  /// \brief Counter of render updates, used to stagger off-screen pose
+  /// applications across frames when throttling is enabled.
+  public: uint64_t renderUpdateCounter{0u};
+
+  /// \brief Pose updates held back because the entity was outside every
+  /// camera frustum. They are re-applied when the entity's stagger slot
+  /// comes up, or replaced when a newer update arrives, so no pose update
+  /// is ever lost.
+  public: std::unordered_map<Entity, math::Pose3d> deferredPoses;
+
   /// \brief A map of entity ids and light updates.
   public: std::unordered_map<Entity, msgs::Light> entityLights;
 
@@ -385,6 +452,18 @@ class gz::sim::RenderUtilPrivate
   /// \brief Mutex to protect updates
   public: std::mutex updateMutex;
 
+  /// \brief Back buffer UpdateFromECM scans into before taking
+  /// updateMutex. Kept as a member so map capacity stays warm between
+  /// frames.
+  public: EntityUpdates updateBuffer;
+
+  /// \brief Worker threads that decode mesh files for newly staged
+  /// visuals ahead of the render thread. common::MeshManager caches the
+  /// decoded mesh process-wide, so by the time the render thread creates
+  /// the visual the expensive parse is usually done. The GPU upload
+  /// itself stays on the render thread; it needs the graphics context.
+  public: common::WorkerPool meshPreloadPool{2u};
+
   //// \brief Flag to indicate whether to create sensors
   public: bool enableSensors = false;
 
@@ -818,11 +897,40 @@ void RenderUtil::UpdateFromECM(const UpdateInfo &_info,
                                const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("RenderUtil::UpdateFromECM");
+
+  // Scan the per-frame pose and animation updates into the back buffer
+  // without holding the update mutex. In visual-heavy worlds this scan is
+  // the bulk of the work, and doing it unlocked keeps the render thread
+  // from stalling behind it.
+  RenderUtilPrivate::EntityUpdates &updates = this->dataPtr->updateBuffer;
+  this->dataPtr->UpdateRenderingEntities(_ecm, _info, updates);
+
   std::lock_guard<std::mutex> lock(this->dataPtr->updateMutex);
   this->dataPtr->simTime = _info.simTime;
 
   this->dataPtr->CreateRenderingEntities(_ecm, _info);
-  this->dataPtr->UpdateRenderingEntities(_ecm);
+
+  // Hand the scanned updates over. The render thread consumes the staging
+  // maps every frame, so in the common case they are empty here and the
+  // handoff is a buffer swap; otherwise newer entries overwrite older.
+  auto merge = [](auto &_staged, auto &_scanned)
+  {
+    if (_staged.empty())
+    {
+      std::swap(_staged, _scanned);
+    }
+    else
+    {
+      for (auto &entry : _scanned)
+        _staged[entry.first] = std::move(entry.second);
+    }
+    _scanned.clear();
+  };
+  merge(this->dataPtr->entityPoses, updates.entityPoses);
+  merge(this->dataPtr->actorTransforms, updates.actorTransforms);
+  merge(this->dataPtr->trajectoryPoses, updates.trajectoryPoses);
+  merge(this->dataPtr->actorAnimationData, updates.actorAnimationData);
+
   this->dataPtr->RemoveRenderingEntities(_ecm, _info);
   this->dataPtr->markerManager.SetSimTime(_info.simTime);
   this->dataPtr->PopulateViewModeVisualLinks(_ecm);
@@ -1102,6 +1210,7 @@ void RenderUtil::Update()
   auto newModels = std::move(this->dataPtr->newModels);
   auto newLinks = std::move(this->dataPtr->newLinks);
   auto newVisuals = std::move(this->dataPtr->newVisuals);
+  auto newVisualLods = std::move(this->dataPtr->newVisualLods);
   auto newActors = std::move(this->dataPtr->newActors);
   auto newLights = std::move(this->dataPtr->newLights);
   auto newParticleEmitters = std::move(this->dataPtr->newParticleEmitters);
@@ -1133,6 +1242,7 @@ void RenderUtil::Update()
   this->dataPtr->newModels.clear();
   this->dataPtr->newLinks.clear();
   this->dataPtr->newVisuals.clear();
+  this->dataPtr->newVisualLods.clear();
   this->dataPtr->newActors.clear();
   this->dataPtr->newLights.clear();
   this->dataPtr->newParticleEmitters.clear();
@@ -1251,6 +1361,12 @@ void RenderUtil::Update()
           std::get<0>(visual), std::get<1>(visual), std::get<2>(visual));
     }
 
+    for (const auto &visualLod : newVisualLods)
+    {
+      this->dataPtr->sceneManager.SetVisualLod(
+          visualLod.first, visualLod.second);
+    }
+
     for (const auto &light : newLights)
     {
       auto newLightRendering = this->dataPtr->sceneManager.CreateLight(
@@ -1345,6 +1461,31 @@ void RenderUtil::Update()
   // update entities' pose
   {
     GZ_PROFILE("RenderUtil::Update Poses");
+
+    // When off-screen throttling is enabled, build the frustums of all
+    // cameras once; entities outside every frustum only have their pose
+    // applied when their stagger slot comes up.
+    std::vector<math::Frustum> frustums;
+    if (this->dataPtr->offscreenPoseUpdatePeriod > 0u)
+    {
+      for (unsigned int i = 0; i < this->dataPtr->scene->SensorCount(); ++i)
+      {
+        auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+            this->dataPtr->scene->SensorByIndex(i));
+        if (!camera)
+          continue;
+        frustums.emplace_back(camera->NearClipPlane(), camera->FarClipPlane(),
+            camera->HFOV(), camera->AspectRatio(), camera->WorldPose());
+      }
+
+      // Deferred poses stay due; a fresh update for the same entity takes
+      // precedence since entityPoses already holds the newest value.
+      entityPoses.insert(this->dataPtr->deferredPoses.begin(),
+          this->dataPtr->deferredPoses.end());
+      this->dataPtr->deferredPoses.clear();
+      ++this->dataPtr->renderUpdateCounter;
+    }
+
     for (const auto &pose : entityPoses)
     {
       auto node = this->dataPtr->sceneManager.NodeById(pose.first);
@@ -1373,6 +1514,31 @@ void RenderUtil::Update()
         continue;
       }
 
+      // Defer the pose if the visual is outside every camera frustum and
+      // it is not this entity's turn in the stagger cycle. The bounding box
+      // is the node's current one, so an entity moving into view may lag by
+      // up to one period before its first on-screen update lands.
+      if (!frustums.empty() && vis)
+      {
+        const auto box = vis->BoundingBox();
+        bool onScreen = false;
+        for (const auto &frustum : frustums)
+        {
+          if (frustum.Contains(box))
+          {
+            onScreen = true;
+            break;
+          }
+        }
+        if (!onScreen &&
+            (pose.first + this->dataPtr->renderUpdateCounter) %
+            this->dataPtr->offscreenPoseUpdatePeriod != 0u)
+        {
+          this->dataPtr->deferredPoses[pose.first] = pose.second;
+          continue;
+        }
+      }
+
       node->SetLocalPose(pose.second);
     }
 
@@ -1451,7 +1617,10 @@ void RenderUtil::Update()
     }
   }
 
-  this->dataPtr->UpdateVisualLabels(entityLabel);
+  // Labels are only queued when a labeled visual or actor is created, so
+  // this is a no-op on steady-state frames.
+  if (!entityLabel.empty())
+    this->dataPtr->UpdateVisualLabels(entityLabel);
 
   // update joint parent visual poses
   {
@@ -1683,10 +1852,67 @@ void RenderUtil::Update()
     }
   }
 
+  // select level of detail bands from the updated camera and visual poses
+  this->dataPtr->sceneManager.UpdateLods();
+
+  this->dataPtr->PublishCullingStats();
+
   if (this->dataPtr->eventManager)
     this->dataPtr->eventManager->Emit<events::SceneUpdate>();
 }
 
+/////////////////////////////////////////////////
+void RenderUtilPrivate::PublishCullingStats()
+{
+  if (!this->cullingStatsPub || !this->cullingStatsPub.HasConnections())
+    return;
+
+  msgs::Param_V statsMsg;
+  for (unsigned int i = 0; i < this->scene->SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+        this->scene->SensorByIndex(i));
+    if (!camera)
+      continue;
+
+    const math::Frustum frustum(camera->NearClipPlane(),
+        camera->FarClipPlane(), camera->HFOV(), camera->AspectRatio(),
+        camera->WorldPose());
+
+    unsigned int visible = 0u;
+    unsigned int culled = 0u;
+    for (unsigned int v = 0; v < this->scene->VisualCount(); ++v)
+    {
+      auto visual = this->scene->VisualByIndex(v);
+      if (!visual || visual == this->scene->RootVisual() ||
+          visual->GeometryCount() == 0u)
+        continue;
+
+      if (frustum.Contains(visual->BoundingBox()))
+        ++visible;
+      else
+        ++culled;
+    }
+
+    auto *param = statsMsg.add_param();
+    auto *params = param->mutable_params();
+    msgs::Any nameValue;
+    nameValue.set_type(msgs::Any::STRING);
+    nameValue.set_string_value(camera->Name());
+    (*params)["camera"] = nameValue;
+    msgs::Any visibleValue;
+    visibleValue.set_type(msgs::Any::INT32);
+    visibleValue.set_int_value(static_cast<int>(visible));
+    (*params)["visible"] = visibleValue;
+    msgs::Any culledValue;
+    culledValue.set_type(msgs::Any::INT32);
+    culledValue.set_int_value(static_cast<int>(culled));
+    (*params)["culled"] = culledValue;
+  }
+
+  this->cullingStatsPub.Publish(statsMsg);
+}
+
 //////////////////////////////////////////////////
 void RenderUtilPrivate::CreateRenderingEntities(
     const EntityComponentManager &_ecm, const UpdateInfo &_info)
@@ -2306,7 +2532,8 @@ void RenderUtilPrivate::CreateEntitiesRuntime(
 
 //////////////////////////////////////////////////
 void RenderUtilPrivate::UpdateRenderingEntities(
-    const EntityComponentManager &_ecm)
+    const EntityComponentManager &_ecm, const UpdateInfo &_info,
+    EntityUpdates &_updates)
 {
   GZ_PROFILE("RenderUtilPrivate::UpdateRenderingEntities");
   _ecm.Each<components::Model, components::Pose>(
@@ -2314,7 +2541,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Model *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        _updates.entityPoses[_entity] = _pose->Data();
         return true;
       });
 
@@ -2323,7 +2550,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Link *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        _updates.entityPoses[_entity] = _pose->Data();
         return true;
       });
 
@@ -2333,7 +2560,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Visual *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        _updates.entityPoses[_entity] = _pose->Data();
         return true;
       });
 
@@ -2344,7 +2571,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Pose *_pose)->bool
       {
         // Trajectory origin
-        this->entityPoses[_entity] = _pose->Data();
+        _updates.entityPoses[_entity] = _pose->Data();
 
         auto animTimeComp = _ecm.Component<components::AnimationTime>(_entity);
         auto animNameComp = _ecm.Component<components::AnimationName>(_entity);
@@ -2363,32 +2590,32 @@ void RenderUtilPrivate::UpdateRenderingEntities(
             animData.time = animTimeComp->Data();
             animData.rootTransform = skel->RootNode()->Transform();
             animData.valid = true;
-            this->actorAnimationData[_entity] = animData;
+            _updates.actorAnimationData[_entity] = animData;
           }
         }
         // Bone poses calculated by gz-common
         else if (this->actorManualSkeletonUpdate)
         {
-          this->actorTransforms[_entity] =
+          _updates.actorTransforms[_entity] =
               this->sceneManager.ActorSkeletonTransformsAt(
-              _entity, this->simTime);
+              _entity, _info.simTime);
         }
         // Trajectory info from SDF so gz-rendering can calculate bone poses
         else
         {
           auto animData =
-            this->sceneManager.ActorAnimationAt(_entity, this->simTime);
+            this->sceneManager.ActorAnimationAt(_entity, _info.simTime);
 
           if (animData.valid)
           {
-            this->actorAnimationData[_entity] = animData;
+            _updates.actorAnimationData[_entity] = animData;
           }
         }
 
         // Trajectory pose set by other systems
         auto trajPoseComp = _ecm.Component<components::TrajectoryPose>(_entity);
         if (trajPoseComp)
-          this->trajectoryPoses[_entity] = trajPoseComp->Data();
+          _updates.trajectoryPoses[_entity] = trajPoseComp->Data();
         return true;
       });
 
@@ -2398,7 +2625,7 @@ void RenderUtilPrivate::UpdateRenderingEntities(
         const components::Light *,
         const components::Pose *_pose)->bool
       {
-        this->entityPoses[_entity] = _pose->Data();
+        _updates.entityPoses[_entity] = _pose->Data();
         return true;
       });
 }
@@ -2664,6 +2891,11 @@ void RenderUtil::Init()
   if (this->dataPtr->enableSensors)
     this->dataPtr->markerManager.SetTopic("/sensors/marker");
   this->dataPtr->markerManager.Init(this->dataPtr->scene);
+
+  std::string cullingStatsTopic = this->dataPtr->enableSensors ?
+      "/sensors/culling_stats" : "/gui/culling_stats";
+  this->dataPtr->cullingStatsPub =
+      this->dataPtr->node.Advertise<msgs::Param_V>(cullingStatsTopic);
 }
 
 /////////////////////////////////////////////////
@@ -2777,6 +3009,12 @@ void RenderUtil::SetSkyEnabled(bool _enabled)
   this->dataPtr->skyEnabled = _enabled;
 }
 
+/////////////////////////////////////////////////
+void RenderUtil::SetOffscreenPoseUpdatePeriod(unsigned int _frames)
+{
+  this->dataPtr->offscreenPoseUpdatePeriod = _frames;
+}
+
 /////////////////////////////////////////////////
 void RenderUtil::SetUseCurrentGLContext(bool _enable)
 {
@@ -3843,6 +4081,49 @@ void RenderUtilPrivate::CreateVisual(
     }
   }
 
+  // Start decoding mesh geometry in the background so the render thread
+  // finds it already cached in common::MeshManager when it creates the
+  // visual, instead of freezing the GUI while a big model parses.
+  if (visual.Geom() &&
+      visual.Geom()->Type() == sdf::GeometryType::MESH &&
+      nullptr != visual.Geom()->MeshShape())
+  {
+    this->meshPreloadPool.AddWork(
+        [meshSdf = *visual.Geom()->MeshShape()]()
+        {
+          loadMesh(meshSdf);
+        });
+  }
+
+  // Level of detail bands: band 0 is the visual's own geometry; the
+  // reduced detail meshes take over at their switch distances.
+  auto lodComp = _ecm.Component<components::VisualLod>(_entity);
+  if (lodComp && !lodComp->Data().empty() && visual.Geom())
+  {
+    std::vector<std::pair<double, sdf::Geometry>> bands;
+    bands.emplace_back(0.0, *visual.Geom());
+    for (const auto &band : lodComp->Data())
+    {
+      sdf::Mesh meshSdf;
+      meshSdf.SetUri(band.meshUri);
+      meshSdf.SetSubmesh(band.submesh);
+      meshSdf.SetScale(band.scale);
+
+      sdf::Geometry geomSdf;
+      geomSdf.SetType(sdf::GeometryType::MESH);
+      geomSdf.SetMeshShape(meshSdf);
+      bands.emplace_back(band.minDistance, geomSdf);
+
+      // decode band meshes in the background too
+      this->meshPreloadPool.AddWork(
+          [meshSdf]()
+          {
+            loadMesh(meshSdf);
+          });
+    }
+    this->newVisualLods.emplace_back(_entity, std::move(bands));
+  }
+
   this->newVisuals.push_back(
       std::make_tuple(_entity, visual, _parent->Data()));
 
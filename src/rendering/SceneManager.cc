@@ -16,9 +16,12 @@
  */
 
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <queue>
+#include <sstream>
+#include <tuple>
 #include <unordered_map>
 
 #include <sdf/Box.hh>
@@ -58,6 +61,7 @@
 #include <gz/msgs/Utility.hh>
 
 #include "gz/rendering/Capsule.hh"
+#include <gz/rendering/Camera.hh>
 #include <gz/rendering/COMVisual.hh>
 #include <gz/rendering/Geometry.hh>
 #include <gz/rendering/Heightmap.hh>
@@ -148,6 +152,71 @@ class gz::sim::SceneManagerPrivate
 
   /// \brief Holds the spherical coordinates from the world.
   public: math::SphericalCoordinates sphericalCoordinates;
+
+  /// \brief Resolved mesh descriptors keyed by URI, file path, submesh and
+  /// optimization settings. Spawning many copies of the same model re-runs
+  /// URI resolution and mesh manager dispatch for every visual; the cache
+  /// makes repeat loads a single map lookup. The render engine already
+  /// shares the GPU buffers between meshes created from equal descriptors.
+  ///
+  /// Draw-call batching of such visuals is also an engine concern: ogre2
+  /// auto-instances renderables that share a mesh and material datablock,
+  /// which equal descriptors enable. There is no instancing control in the
+  /// gz-rendering API for gz-sim to drive beyond keeping the descriptors
+  /// identical.
+  public: std::unordered_map<std::string, rendering::MeshDescriptor>
+      meshDescriptors;
+
+  /// \brief Loaded heightmap samples keyed by resolved file path. Reading a
+  /// large image or DEM heightmap takes seconds and pins the full elevation
+  /// grid in memory, and the same file is reloaded for every scene that
+  /// displays it (GUI, sensors, collision visualization). The cache keeps one
+  /// copy per file and hands it out by shared pointer; tiling and
+  /// level-of-detail selection for the terrain itself happen inside the
+  /// render engine's heightmap implementation.
+  public: std::unordered_map<std::string,
+      std::shared_ptr<common::HeightmapData>> heightmapData;
+
+  /// \brief Level of detail state of a visual
+  public: struct VisualLodInfo
+  {
+    /// \brief Bands sorted by ascending switch distance. The first band
+    /// is the geometry the visual was created with, at distance 0.
+    std::vector<std::pair<double, sdf::Geometry>> bands;
+
+    /// \brief Index into bands of the geometry currently attached.
+    std::size_t activeBand{0u};
+  };
+
+  /// \brief Visuals with level of detail bands, selected in UpdateLods
+  public: std::unordered_map<Entity, VisualLodInfo> visualLods;
+
+  /// \brief Skin transforms sampled from one animation clip at one point in
+  /// time, shared across every actor that plays the same clip. Actors spawned
+  /// from the same skin file share a skeleton and its animations, so with
+  /// crowds of identical actors the per-bone keyframe interpolation and
+  /// alignment math runs once per clip instead of once per actor.
+  ///
+  /// The key is the animation clip, the sample value (time in seconds, or x
+  /// displacement when the trajectory interpolates x), whether x displacement
+  /// sampling was used, and the loop flag.
+  public: std::map<
+      std::tuple<common::SkeletonAnimation *, double, bool, bool>,
+      std::map<std::string, math::Matrix4d>> skelAnimCache;
+
+  /// \brief Render time the entries in skelAnimCache were sampled at. The
+  /// cache only spans a single render update; it is cleared whenever the
+  /// update time changes.
+  public: std::chrono::steady_clock::duration skelAnimCacheTime{-1};
+
+  /// \brief Loaded visual materials shared across visuals, keyed by their
+  /// source sdf::Material properties plus the visual transparency and cast
+  /// shadows flags. Assigning a material to a geometry clones it, so each
+  /// visual still mutates its own copy; the cache only deduplicates the
+  /// template, letting worlds with many visuals and few distinct materials
+  /// build each material (including texture path resolution) once.
+  public: std::unordered_map<std::string, rendering::MaterialPtr>
+      visualMaterialCache;
 };
 
 
@@ -283,6 +352,50 @@ rendering::VisualPtr SceneManager::CreateLink(Entity _id,
   return linkVis;
 }
 
+/////////////////////////////////////////////////
+/// \brief Build the visualMaterialCache key for a visual's material,
+/// covering every sdf::Material property that LoadMaterial consumes plus
+/// the per-visual settings applied on top of it.
+/// \param[in] _material Material to key.
+/// \param[in] _transparency Visual transparency applied to the material.
+/// \param[in] _castShadows Visual cast shadows flag applied to the material.
+/// \return Cache key.
+static std::string VisualMaterialKey(const sdf::Material &_material,
+    double _transparency, bool _castShadows)
+{
+  std::ostringstream key;
+  key << _material.Ambient() << "|" << _material.Diffuse() << "|"
+      << _material.Specular() << "|" << _material.Emissive() << "|"
+      << _material.Shininess() << "|" << _material.RenderOrder() << "|"
+      << _material.DoubleSided() << "|" << _material.FilePath() << "|"
+      << _transparency << "|" << _castShadows;
+
+  const sdf::Pbr *pbr = _material.PbrMaterial();
+  if (pbr)
+  {
+    const sdf::PbrWorkflow *workflow =
+        pbr->Workflow(sdf::PbrWorkflowType::METAL);
+    if (workflow)
+    {
+      key << "|" << workflow->Roughness() << "|" << workflow->Metalness()
+          << "|" << workflow->RoughnessMap() << "|"
+          << workflow->MetalnessMap();
+    }
+    else
+    {
+      workflow = pbr->Workflow(sdf::PbrWorkflowType::SPECULAR);
+    }
+    if (workflow)
+    {
+      key << "|" << workflow->AlbedoMap() << "|" << workflow->NormalMap()
+          << "|" << workflow->EnvironmentMap() << "|"
+          << workflow->EmissiveMap() << "|" << workflow->LightMap() << "|"
+          << workflow->LightMapTexCoordSet();
+    }
+  }
+  return key.str();
+}
+
 /////////////////////////////////////////////////
 rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
     const sdf::Visual &_visual, Entity _parentId)
@@ -354,13 +467,35 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
 
     // set material
     rendering::MaterialPtr material{nullptr};
+    bool materialCached{false};
     if (_visual.Geom()->Type() == sdf::GeometryType::HEIGHTMAP)
     {
       // Heightmap's material is loaded together with it.
     }
     else if (_visual.Material())
     {
-      material = this->LoadMaterial(*_visual.Material());
+      // Visuals with identical materials share one cached template; the
+      // geometry clones it on assignment below, so the cached instance is
+      // never mutated after it is built.
+      const std::string matKey = VisualMaterialKey(*_visual.Material(),
+          _visual.Transparency(), _visual.CastShadows());
+      auto cacheIt = this->dataPtr->visualMaterialCache.find(matKey);
+      if (cacheIt != this->dataPtr->visualMaterialCache.end())
+      {
+        material = cacheIt->second;
+        materialCached = true;
+      }
+      else
+      {
+        material = this->LoadMaterial(*_visual.Material());
+        if (material)
+        {
+          material->SetTransparency(_visual.Transparency());
+          material->SetCastShadows(_visual.CastShadows());
+          this->dataPtr->visualMaterialCache[matKey] = material;
+          materialCached = true;
+        }
+      }
     }
     // Don't set a default material for meshes because they
     // may have their own
@@ -407,18 +542,23 @@ rendering::VisualPtr SceneManager::CreateVisual(Entity _id,
 
     if (material)
     {
-      // set transparency
-      material->SetTransparency(_visual.Transparency());
+      if (!materialCached)
+      {
+        // set transparency
+        material->SetTransparency(_visual.Transparency());
 
-      // cast shadows
-      material->SetCastShadows(_visual.CastShadows());
+        // cast shadows
+        material->SetCastShadows(_visual.CastShadows());
+      }
 
       geom->SetMaterial(material);
       // todo(anyone) SetMaterial function clones the input material.
       // but does not take ownership of it so we need to destroy it here.
       // This is not ideal. We should let gz-rendering handle the lifetime
-      // of this material
-      this->dataPtr->scene->DestroyMaterial(material);
+      // of this material. Cached templates are kept for reuse by later
+      // visuals and released in Clear().
+      if (!materialCached)
+        this->dataPtr->scene->DestroyMaterial(material);
     }
   }
   else
@@ -618,6 +758,94 @@ rendering::VisualPtr SceneManager::VisualById(Entity _id)
   return this->dataPtr->visuals[_id];
 }
 
+/////////////////////////////////////////////////
+void SceneManager::SetVisualLod(Entity _id,
+    const std::vector<std::pair<double, sdf::Geometry>> &_bands)
+{
+  if (_bands.empty())
+  {
+    this->dataPtr->visualLods.erase(_id);
+    return;
+  }
+
+  SceneManagerPrivate::VisualLodInfo lodInfo;
+  lodInfo.bands = _bands;
+  std::sort(lodInfo.bands.begin(), lodInfo.bands.end(),
+      [](const auto &_a, const auto &_b)
+      {
+        return _a.first < _b.first;
+      });
+  this->dataPtr->visualLods[_id] = std::move(lodInfo);
+}
+
+/////////////////////////////////////////////////
+void SceneManager::UpdateLods()
+{
+  if (this->dataPtr->visualLods.empty() || !this->dataPtr->scene)
+    return;
+
+  // A band has to satisfy the closest camera so no camera ever sees less
+  // detail than its distance calls for.
+  std::vector<math::Vector3d> cameraPositions;
+  for (unsigned int i = 0; i < this->dataPtr->scene->SensorCount(); ++i)
+  {
+    auto camera = std::dynamic_pointer_cast<rendering::Camera>(
+        this->dataPtr->scene->SensorByIndex(i));
+    if (camera)
+      cameraPositions.push_back(camera->WorldPosition());
+  }
+  if (cameraPositions.empty())
+    return;
+
+  for (auto &[entity, lodInfo] : this->dataPtr->visualLods)
+  {
+    auto it = this->dataPtr->visuals.find(entity);
+    if (it == this->dataPtr->visuals.end())
+      continue;
+    rendering::VisualPtr visual = it->second;
+
+    double distance = math::MAX_D;
+    for (const auto &pos : cameraPositions)
+    {
+      distance = std::min(distance,
+          (visual->WorldPosition() - pos).Length());
+    }
+
+    // index of the furthest band whose switch distance has been reached
+    std::size_t band = 0u;
+    for (std::size_t i = lodInfo.bands.size(); i-- > 1u;)
+    {
+      if (distance >= lodInfo.bands[i].first)
+      {
+        band = i;
+        break;
+      }
+    }
+
+    if (band == lodInfo.activeBand)
+      continue;
+
+    math::Vector3d scale = math::Vector3d::One;
+    math::Pose3d localPose;
+    rendering::GeometryPtr geom =
+        this->LoadGeometry(lodInfo.bands[band].second, scale, localPose);
+
+    // record the band even on failure so a broken mesh is logged once
+    // instead of once per frame
+    lodInfo.activeBand = band;
+    if (!geom)
+    {
+      gzerr << "Failed to load level of detail geometry for visual ["
+             << visual->Name() << "]" << std::endl;
+      continue;
+    }
+
+    visual->RemoveGeometries();
+    visual->AddGeometry(geom);
+    visual->SetLocalScale(scale);
+  }
+}
+
 /////////////////////////////////////////////////
 rendering::VisualPtr SceneManager::CreateCollision(Entity _id,
     const sdf::Collision &_collision, Entity _parentId)
@@ -710,23 +938,34 @@ rendering::GeometryPtr SceneManager::LoadGeometry(const sdf::Geometry &_geom,
   }
   else if (_geom.Type() == sdf::GeometryType::MESH)
   {
-    rendering::MeshDescriptor descriptor;
-    descriptor.mesh = loadMesh(*_geom.MeshShape());
-    if (!descriptor.mesh)
-      return geom;
-    std::string meshUri =
-        (common::URI(_geom.MeshShape()->Uri()).Scheme() == "name") ?
-         common::basename(_geom.MeshShape()->Uri()) :
-         asFullPath(_geom.MeshShape()->Uri(),
-                    _geom.MeshShape()->FilePath());
-    auto a =     asFullPath(_geom.MeshShape()->Uri(),
-                    _geom.MeshShape()->FilePath());
-
-    descriptor.meshName = meshUri;
-    descriptor.subMeshName = _geom.MeshShape()->Submesh();
-    descriptor.centerSubMesh = _geom.MeshShape()->CenterSubmesh();
-
-    geom = this->dataPtr->scene->CreateMesh(descriptor);
+    // Identical meshes resolve to identical descriptors; cache them so the
+    // 500th copy of a model skips URI resolution and mesh loading.
+    const std::string descriptorKey = _geom.MeshShape()->Uri() + "|" +
+        _geom.MeshShape()->FilePath() + "|" + _geom.MeshShape()->Submesh() +
+        "|" + (_geom.MeshShape()->CenterSubmesh() ? "1" : "0") + "|" +
+        _geom.MeshShape()->OptimizationStr();
+
+    auto descriptorIt = this->dataPtr->meshDescriptors.find(descriptorKey);
+    if (descriptorIt == this->dataPtr->meshDescriptors.end())
+    {
+      rendering::MeshDescriptor descriptor;
+      descriptor.mesh = loadMesh(*_geom.MeshShape());
+      if (!descriptor.mesh)
+        return geom;
+      std::string meshUri =
+          (common::URI(_geom.MeshShape()->Uri()).Scheme() == "name") ?
+           common::basename(_geom.MeshShape()->Uri()) :
+           asFullPath(_geom.MeshShape()->Uri(),
+                      _geom.MeshShape()->FilePath());
+
+      descriptor.meshName = meshUri;
+      descriptor.subMeshName = _geom.MeshShape()->Submesh();
+      descriptor.centerSubMesh = _geom.MeshShape()->CenterSubmesh();
+      descriptorIt = this->dataPtr->meshDescriptors.emplace(
+          descriptorKey, descriptor).first;
+    }
+
+    geom = this->dataPtr->scene->CreateMesh(descriptorIt->second);
     scale = _geom.MeshShape()->Scale();
   }
   else if (_geom.Type() == sdf::GeometryType::HEIGHTMAP)
@@ -741,33 +980,42 @@ rendering::GeometryPtr SceneManager::LoadGeometry(const sdf::Geometry &_geom,
 
 
     std::shared_ptr<common::HeightmapData> data;
-    std::string lowerFullPath = common::lowercase(fullPath);
-    // check if heightmap is an image
-    if (common::EndsWith(lowerFullPath, ".png")
-        || common::EndsWith(lowerFullPath, ".jpg")
-        || common::EndsWith(lowerFullPath, ".jpeg"))
-    {
-      auto img = std::make_shared<common::ImageHeightmap>();
-      if (img->Load(fullPath) < 0)
-      {
-        gzerr << "Failed to load heightmap image data from ["
-               << fullPath << "]" << std::endl;
-        return geom;
-      }
-      data = img;
+    auto heightmapIt = this->dataPtr->heightmapData.find(fullPath);
+    if (heightmapIt != this->dataPtr->heightmapData.end())
+    {
+      data = heightmapIt->second;
     }
-    // DEM
     else
     {
-      auto dem = std::make_shared<common::Dem>();
-      dem->SetSphericalCoordinates(this->dataPtr->sphericalCoordinates);
-      if (dem->Load(fullPath) < 0)
+      std::string lowerFullPath = common::lowercase(fullPath);
+      // check if heightmap is an image
+      if (common::EndsWith(lowerFullPath, ".png")
+          || common::EndsWith(lowerFullPath, ".jpg")
+          || common::EndsWith(lowerFullPath, ".jpeg"))
       {
-        gzerr << "Failed to load heightmap dem data from ["
-               << fullPath << "]" << std::endl;
-        return geom;
+        auto img = std::make_shared<common::ImageHeightmap>();
+        if (img->Load(fullPath) < 0)
+        {
+          gzerr << "Failed to load heightmap image data from ["
+                 << fullPath << "]" << std::endl;
+          return geom;
+        }
+        data = img;
+      }
+      // DEM
+      else
+      {
+        auto dem = std::make_shared<common::Dem>();
+        dem->SetSphericalCoordinates(this->dataPtr->sphericalCoordinates);
+        if (dem->Load(fullPath) < 0)
+        {
+          gzerr << "Failed to load heightmap dem data from ["
+                 << fullPath << "]" << std::endl;
+          return geom;
+        }
+        data = dem;
       }
-      data = dem;
+      this->dataPtr->heightmapData[fullPath] = data;
     }
 
     rendering::HeightmapDescriptor descriptor;
@@ -1960,10 +2208,11 @@ std::map<std::string, math::Matrix4d> SceneManager::ActorSkeletonTransformsAt(
   {
     auto skel = vIt->second;
     unsigned int animIndex = traj.AnimIndex();
-    std::map<std::string, math::Matrix4d> rawFrames;
 
     double timeSeconds = std::chrono::duration<double>(time).count();
 
+    bool interpolateX = false;
+    double sample = timeSeconds;
     if (followTraj)
     {
       double distance = traj.DistanceSoFar(time);
@@ -1973,30 +2222,52 @@ std::map<std::string, math::Matrix4d> SceneManager::ActorSkeletonTransformsAt(
       // e.g. a person standing that does not move in x direction
       if (traj.Waypoints()->InterpolateX() && !math::equal(distance, 0.0))
       {
-        rawFrames = skel->Animation(animIndex)->PoseAtX(distance,
-                                        skel->RootNode()->Name());
-      }
-      else
-      {
-        rawFrames = skel->Animation(animIndex)->PoseAt(timeSeconds, !noLoop);
+        interpolateX = true;
+        sample = distance;
       }
     }
-    else
+
+    // Actors playing the same clip at the same sample produce identical skin
+    // transforms, so each clip is evaluated once per render update and the
+    // result shared. Entries sampled at a different update time are stale.
+    if (_time != this->dataPtr->skelAnimCacheTime)
     {
-      rawFrames = skel->Animation(animIndex)->PoseAt(timeSeconds, !noLoop);
+      this->dataPtr->skelAnimCache.clear();
+      this->dataPtr->skelAnimCacheTime = _time;
     }
 
-    for (auto pair : rawFrames)
+    const auto cacheKey = std::make_tuple(skel->Animation(animIndex), sample,
+        interpolateX, !noLoop);
+    auto cacheIt = this->dataPtr->skelAnimCache.find(cacheKey);
+    if (cacheIt == this->dataPtr->skelAnimCache.end())
     {
-      std::string nodeName = pair.first;
-      auto nodeTf = pair.second;
+      std::map<std::string, math::Matrix4d> rawFrames;
+      if (interpolateX)
+      {
+        rawFrames = skel->Animation(animIndex)->PoseAtX(sample,
+                                        skel->RootNode()->Name());
+      }
+      else
+      {
+        rawFrames = skel->Animation(animIndex)->PoseAt(sample, !noLoop);
+      }
 
-      std::string skinName = skel->NodeNameAnimToSkin(animIndex, nodeName);
-      math::Matrix4d skinTf = skel->AlignTranslation(animIndex, nodeName)
-              * nodeTf * skel->AlignRotation(animIndex, nodeName);
+      std::map<std::string, math::Matrix4d> skinFrames;
+      for (auto pair : rawFrames)
+      {
+        std::string nodeName = pair.first;
+        auto nodeTf = pair.second;
 
-      allFrames[skinName] = skinTf;
+        std::string skinName = skel->NodeNameAnimToSkin(animIndex, nodeName);
+        math::Matrix4d skinTf = skel->AlignTranslation(animIndex, nodeName)
+                * nodeTf * skel->AlignRotation(animIndex, nodeName);
+
+        skinFrames[skinName] = skinTf;
+      }
+      cacheIt = this->dataPtr->skelAnimCache.emplace(
+          cacheKey, std::move(skinFrames)).first;
     }
+    allFrames = cacheIt->second;
   }
 
   // correct animation root pose
@@ -2045,6 +2316,8 @@ void SceneManager::RemoveEntity(Entity _id)
     }
   }
 
+  this->dataPtr->visualLods.erase(_id);
+
   {
     auto it = this->dataPtr->visuals.find(_id);
     if (it != this->dataPtr->visuals.end())
@@ -2563,6 +2836,12 @@ SceneManagerPrivate::LoadTrajectories(const sdf::Actor &_actor,
 /////////////////////////////////////////////////
 void SceneManager::Clear()
 {
+  for (auto &[key, material] : this->dataPtr->visualMaterialCache)
+  {
+    if (this->dataPtr->scene && material)
+      this->dataPtr->scene->DestroyMaterial(material);
+  }
+  this->dataPtr->visualMaterialCache.clear();
   this->dataPtr->visuals.clear();
   this->dataPtr->actors.clear();
   this->dataPtr->actorSkeletons.clear();
@@ -2574,4 +2853,7 @@ void SceneManager::Clear()
   this->dataPtr->scene.reset();
   this->dataPtr->originalTransparency.clear();
   this->dataPtr->originalDepthWrite.clear();
+  this->dataPtr->meshDescriptors.clear();
+  this->dataPtr->heightmapData.clear();
+  this->dataPtr->visualLods.clear();
 }
@@ -43,6 +43,7 @@
 #include "gz/sim/components/CanonicalLink.hh"
 #include "gz/sim/components/JointPosition.hh"
 #include "gz/sim/components/JointVelocityCmd.hh"
+#include "gz/sim/LazyPublisher.hh"
 #include "gz/sim/Link.hh"
 #include "gz/sim/Model.hh"
 #include "gz/sim/Util.hh"
@@ -173,11 +174,19 @@ class gz::sim::systems::AckermannSteeringPrivate
   /// \brief Last sim time odom was published.
   public: std::chrono::steady_clock::duration lastOdomPubTime{0};
 
-  /// \brief Ackermann steering odometry message publisher.
-  public: transport::Node::Publisher odomPub;
+  /// \brief Ackermann steering odometry message publisher. Lazy so the
+  /// odometry message is only built while someone is subscribed.
+  public: LazyPublisher odomPub;
 
-  /// \brief Ackermann tf message publisher.
-  public: transport::Node::Publisher tfPub;
+  /// \brief Ackermann tf message publisher. Lazy, see odomPub.
+  public: LazyPublisher tfPub;
+
+  /// \brief Odometry message reused across publications so the header frame
+  /// strings are only built once.
+  public: msgs::Odometry odomMsg;
+
+  /// \brief True once odomMsg's header frames have been filled.
+  public: bool odomMsgInitialized{false};
 
   /// \brief Odometry X value
   public: double odomX{0.0};
@@ -512,92 +521,132 @@ void AckermannSteering::PreUpdate(const UpdateInfo &_info,
            << "s]. System may not work properly." << std::endl;
   }
 
-  // If the joints haven't been identified yet, look for them
-  static std::set<std::string> warnedModels;
-  auto modelName = this->dataPtr->model.Name(_ecm);
-  if (!this->dataPtr->steeringOnly &&
+  // If the joints haven't been identified yet, look for them. Once they are
+  // resolved this whole block is skipped, so steady-state steps don't fetch
+  // the model name or probe the ECM for joints.
+  const bool needWheelJoints = !this->dataPtr->steeringOnly &&
       (this->dataPtr->leftJoints.empty() ||
-      this->dataPtr->rightJoints.empty()))
-  {
-    bool warned{false};
-    for (const std::string &name : this->dataPtr->leftJointNames)
+      this->dataPtr->rightJoints.empty());
+  const bool needSteeringJoints =
+      this->dataPtr->leftSteeringJoints.empty() ||
+      this->dataPtr->rightSteeringJoints.empty();
+  if (needWheelJoints || needSteeringJoints)
+  {
+    static std::set<std::string> warnedModels;
+    auto modelName = this->dataPtr->model.Name(_ecm);
+    if (needWheelJoints)
     {
-      Entity joint = this->dataPtr->model.JointByName(_ecm, name);
-      if (joint != kNullEntity)
-        this->dataPtr->leftJoints.push_back(joint);
-      else if (warnedModels.find(modelName) == warnedModels.end())
+      bool warned{false};
+      for (const std::string &name : this->dataPtr->leftJointNames)
       {
-        gzwarn << "Failed to find left joint [" << name << "] for model ["
-                << modelName << "]" << std::endl;
-        warned = true;
+        Entity joint = this->dataPtr->model.JointByName(_ecm, name);
+        if (joint != kNullEntity)
+          this->dataPtr->leftJoints.push_back(joint);
+        else if (warnedModels.find(modelName) == warnedModels.end())
+        {
+          gzwarn << "Failed to find left joint [" << name << "] for model ["
+                  << modelName << "]" << std::endl;
+          warned = true;
+        }
       }
-    }
 
-    for (const std::string &name : this->dataPtr->rightJointNames)
+      for (const std::string &name : this->dataPtr->rightJointNames)
+      {
+        Entity joint = this->dataPtr->model.JointByName(_ecm, name);
+        if (joint != kNullEntity)
+          this->dataPtr->rightJoints.push_back(joint);
+        else if (warnedModels.find(modelName) == warnedModels.end())
+        {
+          gzwarn << "Failed to find right joint [" << name << "] for model ["
+                  << modelName << "]" << std::endl;
+          warned = true;
+        }
+      }
+      if (warned)
+      {
+        warnedModels.insert(modelName);
+      }
+    }
+    if (needSteeringJoints)
     {
-      Entity joint = this->dataPtr->model.JointByName(_ecm, name);
-      if (joint != kNullEntity)
-        this->dataPtr->rightJoints.push_back(joint);
-      else if (warnedModels.find(modelName) == warnedModels.end())
+      bool warned{false};
+      for (const std::string &name : this->dataPtr->leftSteeringJointNames)
       {
-        gzwarn << "Failed to find right joint [" << name << "] for model ["
-                << modelName << "]" << std::endl;
-        warned = true;
+        Entity joint = this->dataPtr->model.JointByName(_ecm, name);
+        if (joint != kNullEntity)
+          this->dataPtr->leftSteeringJoints.push_back(joint);
+        else if (warnedModels.find(modelName) == warnedModels.end())
+        {
+          gzwarn << "Failed to find left steering joint ["
+                  << name << "] for model ["
+                  << modelName << "]" << std::endl;
+          warned = true;
+        }
+      }
+
+      for (const std::string &name : this->dataPtr->rightSteeringJointNames)
+      {
+        Entity joint = this->dataPtr->model.JointByName(_ecm, name);
+        if (joint != kNullEntity)
+          this->dataPtr->rightSteeringJoints.push_back(joint);
+        else if (warnedModels.find(modelName) == warnedModels.end())
+        {
+          gzwarn << "Failed to find right steering joint [" <<
+              name << "] for model [" << modelName << "]" << std::endl;
+          warned = true;
+        }
+      }
+      if (warned)
+      {
+        warnedModels.insert(modelName);
       }
     }
-    if (warned)
+    if (!this->dataPtr->steeringOnly &&
+      (this->dataPtr->leftJoints.empty() ||
+      this->dataPtr->rightJoints.empty()))
+      return;
+    else if (this->dataPtr->leftSteeringJoints.empty() ||
+        this->dataPtr->rightSteeringJoints.empty())
+      return;
+
+    if (warnedModels.find(modelName) != warnedModels.end())
     {
-      warnedModels.insert(modelName);
+      gzmsg << "Found joints for model [" << modelName
+             << "], plugin will start working." << std::endl;
+      warnedModels.erase(modelName);
     }
-  }
-  if (this->dataPtr->leftSteeringJoints.empty() ||
-      this->dataPtr->rightSteeringJoints.empty())
-  {
-    bool warned{false};
-    for (const std::string &name : this->dataPtr->leftSteeringJointNames)
+
+    // Create the joint position components the odometry and angle updates
+    // need, now that the joints are known.
+    if (!this->dataPtr->steeringOnly)
     {
-      Entity joint = this->dataPtr->model.JointByName(_ecm, name);
-      if (joint != kNullEntity)
-        this->dataPtr->leftSteeringJoints.push_back(joint);
-      else if (warnedModels.find(modelName) == warnedModels.end())
+      if (!_ecm.Component<components::JointPosition>(
+          this->dataPtr->leftJoints[0]))
       {
-        gzwarn << "Failed to find left steering joint ["
-                << name << "] for model ["
-                << modelName << "]" << std::endl;
-        warned = true;
+        _ecm.CreateComponent(this->dataPtr->leftJoints[0],
+            components::JointPosition());
       }
-    }
 
-    for (const std::string &name : this->dataPtr->rightSteeringJointNames)
-    {
-      Entity joint = this->dataPtr->model.JointByName(_ecm, name);
-      if (joint != kNullEntity)
-        this->dataPtr->rightSteeringJoints.push_back(joint);
-      else if (warnedModels.find(modelName) == warnedModels.end())
+      if (!_ecm.Component<components::JointPosition>(
+          this->dataPtr->rightJoints[0]))
       {
-        gzwarn << "Failed to find right steering joint [" <<
-            name << "] for model [" << modelName << "]" << std::endl;
-        warned = true;
+        _ecm.CreateComponent(this->dataPtr->rightJoints[0],
+            components::JointPosition());
       }
     }
-    if (warned)
+    if (!_ecm.Component<components::JointPosition>(
+        this->dataPtr->leftSteeringJoints[0]))
     {
-      warnedModels.insert(modelName);
+      _ecm.CreateComponent(this->dataPtr->leftSteeringJoints[0],
+          components::JointPosition());
     }
-  }
-  if (!this->dataPtr->steeringOnly &&
-    (this->dataPtr->leftJoints.empty() ||
-    this->dataPtr->rightJoints.empty()))
-    return;
-  else if (this->dataPtr->leftSteeringJoints.empty() ||
-      this->dataPtr->rightSteeringJoints.empty())
-    return;
 
-  if (warnedModels.find(modelName) != warnedModels.end())
-  {
-    gzmsg << "Found joints for model [" << modelName
-           << "], plugin will start working." << std::endl;
-    warnedModels.erase(modelName);
+    if (!_ecm.Component<components::JointPosition>(
+        this->dataPtr->rightSteeringJoints[0]))
+    {
+      _ecm.CreateComponent(this->dataPtr->rightSteeringJoints[0],
+          components::JointPosition());
+    }
   }
 
   // Nothing left to do if paused.
@@ -632,41 +681,6 @@ void AckermannSteering::PreUpdate(const UpdateInfo &_info,
     _ecm.SetComponentData<components::JointVelocityCmd>(
       joint, {this->dataPtr->rightSteeringJointSpeed});
   }
-  if (!this->dataPtr->steeringOnly)
-  {
-    // Create the left and right side joint position components if they
-    // don't exist.
-    auto leftPos = _ecm.Component<components::JointPosition>(
-        this->dataPtr->leftJoints[0]);
-    if (!leftPos)
-    {
-      _ecm.CreateComponent(this->dataPtr->leftJoints[0],
-          components::JointPosition());
-    }
-
-    auto rightPos = _ecm.Component<components::JointPosition>(
-        this->dataPtr->rightJoints[0]);
-    if (!rightPos)
-    {
-      _ecm.CreateComponent(this->dataPtr->rightJoints[0],
-          components::JointPosition());
-    }
-  }
-  auto leftSteeringPos = _ecm.Component<components::JointPosition>(
-      this->dataPtr->leftSteeringJoints[0]);
-  if (!leftSteeringPos)
-  {
-    _ecm.CreateComponent(this->dataPtr->leftSteeringJoints[0],
-        components::JointPosition());
-  }
-
-  auto rightSteeringPos = _ecm.Component<components::JointPosition>(
-      this->dataPtr->rightSteeringJoints[0]);
-  if (!rightSteeringPos)
-  {
-    _ecm.CreateComponent(this->dataPtr->rightSteeringJoints[0],
-        components::JointPosition());
-  }
 }
 
 //////////////////////////////////////////////////
@@ -752,8 +766,15 @@ void AckermannSteeringPrivate::UpdateOdometry(
   }
   this->lastOdomPubTime = _info.simTime;
 
-  // Construct the odometry message and publish it.
-  msgs::Odometry msg;
+  // The odometry state above is kept up to date regardless, but the
+  // messages are only worth building while someone is subscribed.
+  if (!this->odomPub.HasConnections() && !this->tfPub.HasConnections())
+  {
+    return;
+  }
+
+  // Update the reused odometry message and publish it.
+  msgs::Odometry &msg = this->odomMsg;
   msg.mutable_pose()->mutable_position()->set_x(this->odomX);
   msg.mutable_pose()->mutable_position()->set_y(this->odomY);
 
@@ -764,48 +785,59 @@ void AckermannSteeringPrivate::UpdateOdometry(
   msg.mutable_twist()->mutable_angular()->set_z(odomAngularVelocity);
 
   // Set the time stamp in the header
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
-  // Set the frame id.
-  auto frame = msg.mutable_header()->add_data();
-  frame->set_key("frame_id");
-  if (this->sdfFrameId.empty())
-  {
-    frame->add_value(this->model.Name(_ecm) + "/odom");
-  }
-  else
+  // The frame ids never change, so only build them the first time through.
+  if (!this->odomMsgInitialized)
   {
-    frame->add_value(this->sdfFrameId);
-  }
+    this->odomMsgInitialized = true;
 
-  std::optional<std::string> linkName = this->canonicalLink.Name(_ecm);
-  if (this->sdfChildFrameId.empty())
-  {
-    if (linkName)
+    auto frame = msg.mutable_header()->add_data();
+    frame->set_key("frame_id");
+    if (this->sdfFrameId.empty())
+    {
+      frame->add_value(this->model.Name(_ecm) + "/odom");
+    }
+    else
+    {
+      frame->add_value(this->sdfFrameId);
+    }
+
+    std::optional<std::string> linkName = this->canonicalLink.Name(_ecm);
+    if (this->sdfChildFrameId.empty())
+    {
+      if (linkName)
+      {
+        auto childFrame = msg.mutable_header()->add_data();
+        childFrame->set_key("child_frame_id");
+        childFrame->add_value(this->model.Name(_ecm) + "/" + *linkName);
+      }
+    }
+    else
     {
       auto childFrame = msg.mutable_header()->add_data();
       childFrame->set_key("child_frame_id");
-      childFrame->add_value(this->model.Name(_ecm) + "/" + *linkName);
+      childFrame->add_value(this->sdfChildFrameId);
     }
   }
-  else
-  {
-    auto childFrame = msg.mutable_header()->add_data();
-    childFrame->set_key("child_frame_id");
-    childFrame->add_value(this->sdfChildFrameId);
-  }
-
-  // Construct the Pose_V/tf message and publish it.
-  msgs::Pose_V tfMsg;
-  msgs::Pose *tfMsgPose = tfMsg.add_pose();
-  tfMsgPose->mutable_header()->CopyFrom(*msg.mutable_header());
-  tfMsgPose->mutable_position()->CopyFrom(msg.mutable_pose()->position());
-  tfMsgPose->mutable_orientation()->CopyFrom(msg.mutable_pose()->orientation());
 
-  // Publish the message
-  this->odomPub.Publish(msg);
-  this->tfPub.Publish(tfMsg);
+  // Publish the messages. The Pose_V/tf message is only constructed
+  // when its topic has subscribers.
+  this->odomPub.Publish([&]() -> const msgs::Odometry &
+      {
+        return msg;
+      });
+  this->tfPub.Publish([&]() -> msgs::Pose_V
+      {
+        msgs::Pose_V tfMsg;
+        msgs::Pose *tfMsgPose = tfMsg.add_pose();
+        tfMsgPose->mutable_header()->CopyFrom(*msg.mutable_header());
+        tfMsgPose->mutable_position()->CopyFrom(
+            msg.mutable_pose()->position());
+        tfMsgPose->mutable_orientation()->CopyFrom(
+            msg.mutable_pose()->orientation());
+        return tfMsg;
+      });
 }
 
 //////////////////////////////////////////////////
@@ -73,6 +73,11 @@ class AcousticComms::Implementation
   /// computer-science/underwater-acoustic-signal
   public: double sourcePower = 2000;
 
+  /// \brief Source level term of the sonar equation, in dB. Precomputed
+  /// from the source power at load time so the propagation model doesn't
+  /// evaluate it per packet.
+  public: double sourceLevel = 0;
+
   /// \brief Ratio of the noise intensity at the
   /// receiver to the same reference intensity used for source level.
   public: double noiseLevel = 1;
@@ -104,13 +109,10 @@ bool AcousticComms::Implementation::propagationModel(
   // TL : Transmission loss (dB)
   // NL : Noise level.
 
-  // The constant 170.8 comes from reference intensity measured
-  // 1m from the source.
-  double sl = 170.8 + 10 * std::log10(this->sourcePower);
   double tl = 20 * std::log10(_distToSource);
 
   // Calculate SNR.
-  auto snr = sl - tl - this->noiseLevel;
+  auto snr = this->sourceLevel - tl - this->noiseLevel;
 
   // References : https://www.montana.edu/aolson/ee447/EB%20and%20NO.pdf
   // https://en.wikipedia.org/wiki/Eb/N0
@@ -173,6 +175,11 @@ void AcousticComms::Load(
     this->dataPtr->seed = propElement->Get<int>("seed");
   }
 
+  // The constant 170.8 comes from reference intensity measured
+  // 1m from the source.
+  this->dataPtr->sourceLevel =
+    170.8 + 10 * std::log10(this->dataPtr->sourcePower);
+
   gzmsg << "AcousticComms configured with max range : " <<
     this->dataPtr->maxRange << " m and speed of sound : " <<
     this->dataPtr->speedOfSound << " m/s." << std::endl;
@@ -202,6 +209,20 @@ void AcousticComms::Step(
     }
   }
 
+  // World positions of the registered endpoints, gathered lazily once per
+  // step and shared by every message exchanged between the same vehicles.
+  std::unordered_map<Entity, math::Vector3d> endpointPositions;
+  auto positionOf = [&](Entity _entity) -> const math::Vector3d &
+  {
+    auto it = endpointPositions.find(_entity);
+    if (it == endpointPositions.end())
+    {
+      it = endpointPositions.emplace(
+        _entity, worldPose(_entity, _ecm).Pos()).first;
+    }
+    return it->second;
+  };
+
   for (auto & [address, content] : _currentRegistry)
   {
     // Reference to the outbound queue for this address.
@@ -231,7 +252,12 @@ void AcousticComms::Step(
           dstAddressBound && itDst->second.entity != kNullEntity;
 
         if (!dstAddressAttachedToModel)
+        {
+          // The message is dropped; stop keeping track of the position of
+          // its source, if any was recorded.
+          this->dataPtr->poseSrcAtMsgTimestamp.erase(msg);
           continue;
+        }
 
         // The plugin checks the distance travelled by the signal
         // so far. If it is more than the maxRange, it is dropped
@@ -241,20 +267,20 @@ void AcousticComms::Step(
         // If it has reached neither the destination nor the maxRange,
         // it is considered in transit.
 
-        if (this->dataPtr->poseSrcAtMsgTimestamp.count(msg) == 0)
+        auto itPoseSrc = this->dataPtr->poseSrcAtMsgTimestamp.find(msg);
+        if (itPoseSrc == this->dataPtr->poseSrcAtMsgTimestamp.end())
         {
           // This message is being processed for the first time.
           // Record the current position of the sender and use it
           // for distance calculations.
-          this->dataPtr->poseSrcAtMsgTimestamp[msg] =
-            worldPose(itSrc->second.entity, _ecm).Pos();
+          itPoseSrc = this->dataPtr->poseSrcAtMsgTimestamp.emplace(
+            msg, positionOf(itSrc->second.entity)).first;
         }
 
-        const auto& poseSrc =
-          this->dataPtr->poseSrcAtMsgTimestamp[msg];
+        const auto &poseSrc = itPoseSrc->second;
 
         // Calculate distance between the bodies.
-        const auto poseDst = worldPose(itDst->second.entity, _ecm).Pos();
+        const auto &poseDst = positionOf(itDst->second.entity);
         const auto distanceToTransmitter = (poseSrc - poseDst).Length();
 
         // Calculate distance covered by the message.
@@ -281,8 +307,9 @@ void AcousticComms::Step(
             bool receivedSuccessfully = false;
 
             // Check for time collision
-            if (this->dataPtr->lastMsgReceivedInfo.count(
-                  msg->dst_address()) == 0)
+            auto itLastMsg = this->dataPtr->lastMsgReceivedInfo.find(
+              msg->dst_address());
+            if (itLastMsg == this->dataPtr->lastMsgReceivedInfo.end())
             {
               // This is the first message received by this address.
               receivedSuccessfully = true;
@@ -292,14 +319,12 @@ void AcousticComms::Step(
               // A previous msg was already received at this address.
               // time gap = current time - time at which last msg was received.
               std::chrono::duration<double> timeGap = currTimestamp -
-                std::get<0>(this->dataPtr->lastMsgReceivedInfo[
-                            msg->dst_address()]);
+                std::get<0>(itLastMsg->second);
 
               // drop interval = collision time interval per byte *
               //                 length of last msg received.
               auto dropInterval = std::chrono::duration<double>(
-                  std::get<1>(this->dataPtr->lastMsgReceivedInfo[
-                              msg->dst_address()]));
+                  std::get<1>(itLastMsg->second));
 
               if (timeGap >= dropInterval)
                 receivedSuccessfully = true;
@@ -341,7 +366,7 @@ void AcousticComms::Step(
             }
 
             // Stop keeping track of the position of its source.
-            this->dataPtr->poseSrcAtMsgTimestamp.erase(msg);
+            this->dataPtr->poseSrcAtMsgTimestamp.erase(itPoseSrc);
           }
           else
           {
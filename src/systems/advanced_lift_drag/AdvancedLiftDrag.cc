@@ -243,6 +243,13 @@ class gz::sim::systems::AdvancedLiftDragPrivate
   public: double CD_fp_k1 = -0.224;
   public: double CD_fp_k2 = -0.115;
 
+  /// \brief Wing span, computed from the area and aspect ratio at load time.
+  public: double span = 0.0;
+
+  /// \brief Flat plate drag coefficient, computed from the aspect ratio at
+  /// load time.
+  public: double CD_fp = 0.0;
+
 
   /// \brief air density
   /// at 25 deg C it's about 1.1839 kg/m^3
@@ -274,6 +281,9 @@ class gz::sim::systems::AdvancedLiftDragPrivate
   /// \brief Link entity targeted this plugin.
   public: Entity linkEntity;
 
+  /// \brief Entity holding the world wind component, resolved once.
+  public: Entity windEntity{kNullEntity};
+
   /// \brief Joint entity that actuates a control surface for this lifting body
   public: Entity controlJointEntity;
 
@@ -460,6 +470,29 @@ void AdvancedLiftDragPrivate::Load(const EntityComponentManager &_ecm,
     return;
   }
 
+  // Quantities that depend only on the configuration are computed once
+  // here instead of on every step.
+  this->span = std::sqrt(this->area * this->AR);
+  if (std::fabs(this->mac) <= 1e-9)
+  {
+    // Computing the mean aerodynamic chord involves integrating the square of
+    // the chord along the span. If this parameter has not been input, this
+    // plugin will approximate MAC as mean chord. This works for rectangular
+    // and trapezoidal wings, but for more complex wing shapes, doing the
+    // integral is preferred.
+    this->mac = this->area / this->span;
+  }
+
+  // To estimate the flat plate coefficient of drag, I fit a sigmoid function
+  // to the data in Ostowari and Naik. The form I used was:
+  // CD_FP = 2/(1+exp(k1+k2*AR)).
+  // The coefficients k1 and k2 might need some tuning.
+  // I chose a sigmoid because the CD would initially increase quickly
+  // with aspect ratio, but that rate of increase would slow down as AR
+  // goes to infinity.
+  this->CD_fp = 2 / (1 + exp(this->CD_fp_k1 + this->CD_fp_k2 * (
+    std::max(this->AR, 1 / this->AR))));
+
   // If we reached here, we have a valid configuration
   this->validConfig = true;
 }
@@ -482,24 +515,15 @@ void AdvancedLiftDragPrivate::Update(EntityComponentManager &_ecm)
   const auto worldPose =
       _ecm.Component<components::WorldPose>(this->linkEntity);
 
-  // get wind as a component from the _ecm
+  // get wind as a component from the _ecm. The wind entity doesn't change,
+  // so it's only looked up once.
   components::WorldLinearVelocity *windLinearVel = nullptr;
-  if(_ecm.EntityByComponents(components::Wind()) != kNullEntity){
-    Entity windEntity = _ecm.EntityByComponents(components::Wind());
+  if (kNullEntity == this->windEntity)
+    this->windEntity = _ecm.EntityByComponents(components::Wind());
+  if (this->windEntity != kNullEntity)
+  {
     windLinearVel =
-        _ecm.Component<components::WorldLinearVelocity>(windEntity);
-  }
-
-  std::vector<components::JointPosition*> controlJointPosition_vec(
-    this->num_ctrl_surfaces);
-  // Generate a new vector that contains the current positions for all joints
-  for(int i = 0; i < this->num_ctrl_surfaces; i++){
-    components::JointPosition *controlJointPosition = nullptr;
-    if(this->controlJoints[i] != kNullEntity){
-      controlJointPosition = _ecm.Component<components::JointPosition>(
-        this->controlJoints[i]);
-      controlJointPosition_vec[i] = controlJointPosition;
-    }
+        _ecm.Component<components::WorldLinearVelocity>(this->windEntity);
   }
 
   if (!worldLinVel || !worldAngVel || !worldPose)
@@ -537,16 +561,8 @@ void AdvancedLiftDragPrivate::Update(EntityComponentManager &_ecm)
   gz::math::Vector3d stability_z_axis = stability_x_axis.Cross(
     stability_y_axis);
 
-  double span = std::sqrt(this->area*this->AR);
-  double epsilon = 1e-9;
-  if (fabs(this->mac - 0.0) <= epsilon){
-    // Computing the mean aerodynamic chord involves integrating the square of
-    // the chord along the span. If this parameter has not been input, this
-    // plugin will approximate MAC as mean chord. This works for rectangular
-    // and trapezoidal wings, but for more complex wing shapes, doing the
-    // integral is preferred.
-    this->mac = this->area/span;
-  }
+  // Span and mean aerodynamic chord are precomputed at load time.
+  const double span = this->span;
 
   // Get non-dimensional body rates. Gazebo uses ENU, so some have to be flipped
   // gz::math::Vector3d body_rates = this->link->GetRelativeAngularVel();
@@ -622,28 +638,23 @@ void AdvancedLiftDragPrivate::Update(EntityComponentManager &_ecm)
 
   for(int i = 0; i < this->num_ctrl_surfaces; i++){
     double controlAngle = 0.0;
-    if (controlJointPosition_vec[i] && !controlJointPosition_vec[
-      i]->Data().empty())
+    if (this->controlJoints[i] != kNullEntity)
     {
-      components::JointPosition *tmp_controlJointPosition =
-      controlJointPosition_vec[i];
-      controlAngle = tmp_controlJointPosition->Data()[0] * 180 / GZ_PI;
+      auto controlJointPosition = _ecm.Component<components::JointPosition>(
+        this->controlJoints[i]);
+      if (controlJointPosition && !controlJointPosition->Data().empty())
+        controlAngle = controlJointPosition->Data()[0] * 180 / GZ_PI;
     }
 
     // AVL's and Gazebo's direction of "positive" deflection may be different.
     // Future users, keep an eye on this.
-    CL_ctrl_tot += controlAngle*this->CL_ctrl[i]*
-    this->ctrl_surface_direction[i];
-    CD_ctrl_tot += controlAngle*this->CD_ctrl[i]*
-    this->ctrl_surface_direction[i];
-    CY_ctrl_tot += controlAngle*this->CY_ctrl[i]*
-    this->ctrl_surface_direction[i];
-    Cell_ctrl_tot += controlAngle*this->Cell_ctrl[i]*
-    this->ctrl_surface_direction[i];
-    Cem_ctrl_tot += controlAngle*this->Cem_ctrl[i]*
-    this->ctrl_surface_direction[i];
-    Cen_ctrl_tot += controlAngle*this->Cen_ctrl[i]*
-    this->ctrl_surface_direction[i];
+    const double deflection = controlAngle*this->ctrl_surface_direction[i];
+    CL_ctrl_tot += deflection*this->CL_ctrl[i];
+    CD_ctrl_tot += deflection*this->CD_ctrl[i];
+    CY_ctrl_tot += deflection*this->CY_ctrl[i];
+    Cell_ctrl_tot += deflection*this->Cell_ctrl[i];
+    Cem_ctrl_tot += deflection*this->Cem_ctrl[i];
+    Cen_ctrl_tot += deflection*this->Cen_ctrl[i];
   }
 
   // AVL outputs a "CZ_elev", but the Z axis is down. This plugin
@@ -673,19 +684,11 @@ void AdvancedLiftDragPrivate::Update(EntityComponentManager &_ecm)
   // flat plate drag model.
 
 
-  // To estimate the flat plate coefficient of drag, I fit a sigmoid function
-  // to the data in Ostowari and Naik. The form I used was:
-  // CD_FP = 2/(1+exp(k1+k2*AR)).
-  // The coefficients k1 and k2 might need some tuning.
-  // I chose a sigmoid because the CD would initially increase quickly
-  // with aspect ratio, but that rate of increase would slow down as AR
-  // goes to infinity.
-
-  double CD_fp = 2 / (1 + exp(this->CD_fp_k1 + this->CD_fp_k2 * (
-    std::max(this->AR, 1 / this->AR))));
+  // The flat plate coefficient of drag only depends on the aspect ratio,
+  // so it's precomputed at load time.
   CD = (1 - sigma) * (this->CD0 + (CL*CL) / (GZ_PI * this->AR *
     this->eff)) + sigma * abs(
-      CD_fp * (0.5 - 0.5 * cos(2 * this->alpha)));
+      this->CD_fp * (0.5 - 0.5 * cos(2 * this->alpha)));
 
   // Add in control surface terms
   CD = CD + CD_ctrl_tot;
@@ -24,6 +24,7 @@
 #include <atomic>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -178,6 +179,19 @@ class gz::sim::systems::LinearBatteryPluginPrivate
 
   /// \brief Initial power load set trough config
   public: double initialPowerLoad = 0.0;
+
+  /// \brief Last total power load pushed to the battery. The total only
+  /// moves when a BatteryPowerLoad component changes, so the load is
+  /// propagated to the battery on change instead of every step.
+  public: double lastTotalPowerLoad{std::numeric_limits<double>::lowest()};
+
+  /// \brief Joints of the model, cached on first use. They are scanned
+  /// every step while the battery is idle to detect motion commands that
+  /// start draining, so the children query is not repeated per step.
+  public: std::vector<Entity> jointEntities;
+
+  /// \brief True once jointEntities has been populated.
+  public: bool jointsCached{false};
 };
 
 /////////////////////////////////////////////////
@@ -435,6 +449,8 @@ void LinearBatteryPluginPrivate::Reset()
   this->ismooth = 0.0;
   this->q = this->q0;
   this->startDraining = false;
+  this->lastTotalPowerLoad = std::numeric_limits<double>::lowest();
+  this->jointsCached = false;
 }
 
 /////////////////////////////////////////////////
@@ -498,19 +514,28 @@ void LinearBatteryPlugin::PreUpdate(
       return true;
     });
 
-  bool success = this->dataPtr->battery->SetPowerLoad(
-      this->dataPtr->consumerId, total_power_load);
-  if (!success)
+  if (total_power_load != this->dataPtr->lastTotalPowerLoad)
+  {
+    bool success = this->dataPtr->battery->SetPowerLoad(
+        this->dataPtr->consumerId, total_power_load);
+    if (!success)
       gzerr << "Failed to set consumer power load." << std::endl;
+    else
+      this->dataPtr->lastTotalPowerLoad = total_power_load;
+  }
 
   // Start draining the battery if the robot has started moving
   if (!this->dataPtr->startDraining)
   {
-    const std::vector<Entity> joints = _ecm.ChildrenByComponents(
-      this->dataPtr->model.Entity(),
-      components::Joint());
+    if (!this->dataPtr->jointsCached)
+    {
+      this->dataPtr->jointEntities = _ecm.ChildrenByComponents(
+        this->dataPtr->model.Entity(),
+        components::Joint());
+      this->dataPtr->jointsCached = true;
+    }
 
-    for (Entity jointEntity : joints)
+    for (Entity jointEntity : this->dataPtr->jointEntities)
     {
       const auto *jointVelocityCmd =
         _ecm.Component<components::JointVelocityCmd>(jointEntity);
@@ -621,8 +646,7 @@ void LinearBatteryPlugin::PostUpdate(const UpdateInfo &_info,
 
   // Publish battery state
   msgs::BatteryState msg;
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
   msg.set_voltage(this->dataPtr->battery->Voltage());
   msg.set_current(this->dataPtr->ismooth);
   msg.set_charge(this->dataPtr->q);
@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "BoundingBoxes.hh"
+
+#include <gz/msgs/axis_aligned_box.pb.h>
+#include <gz/msgs/stringmsg.pb.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Profiler.hh>
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/plugin/Register.hh>
+#include <gz/transport/Node.hh>
+
+#include "gz/sim/components/AxisAlignedBox.hh"
+#include "gz/sim/components/Model.hh"
+#include "gz/sim/components/Name.hh"
+#include "gz/sim/Conversions.hh"
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Util.hh"
+
+using namespace gz;
+using namespace sim;
+using namespace systems;
+
+/// \brief Private data class
+class gz::sim::systems::BoundingBoxesPrivate
+{
+  /// \brief Service callback resolving a model name to its bounding box.
+  /// \param[in] _req Scoped model name.
+  /// \param[out] _rep The model's current world-frame bounding box.
+  /// \return True if the box is known.
+  public: bool BoundingBoxService(const msgs::StringMsg &_req,
+              msgs::AxisAlignedBox &_rep);
+
+  /// \brief State of one queried model.
+  public: struct Watch
+  {
+    /// \brief The model entity, resolved in PreUpdate.
+    Entity entity{kNullEntity};
+
+    /// \brief Latest box mirrored from the AxisAlignedBox component.
+    math::AxisAlignedBox box;
+
+    /// \brief True once the component holds a computed box.
+    bool ready{false};
+
+    /// \brief True when the name could not be resolved to a model, or
+    /// the model was removed.
+    bool failed{false};
+  };
+
+  /// \brief Transport node.
+  public: transport::Node node;
+
+  /// \brief Models being watched, keyed by requested scoped name.
+  /// Protected by mutex since the service runs on a transport thread.
+  public: std::unordered_map<std::string, Watch> watches;
+
+  /// \brief Names requested but not yet resolved to entities.
+  public: std::vector<std::string> pendingNames;
+
+  /// \brief Protects watches and pendingNames.
+  public: std::mutex mutex;
+
+  /// \brief Signalled whenever watches changes state.
+  public: std::condition_variable cv;
+
+  /// \brief True when pendingNames is non-empty; checked lock-free in
+  /// PreUpdate so steady-state steps don't touch the mutex.
+  public: std::atomic<bool> requestsPending{false};
+
+  /// \brief How long the service waits for a first box before failing,
+  /// e.g. while simulation is paused or the engine can't compute boxes.
+  public: std::chrono::seconds serviceTimeout{5};
+};
+
+//////////////////////////////////////////////////
+BoundingBoxes::BoundingBoxes()
+  : dataPtr(std::make_unique<BoundingBoxesPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+BoundingBoxes::~BoundingBoxes() = default;
+
+//////////////////////////////////////////////////
+void BoundingBoxes::Configure(const Entity &_entity,
+    const std::shared_ptr<const sdf::Element> &,
+    EntityComponentManager &_ecm,
+    EventManager &)
+{
+  auto nameComp = _ecm.Component<components::Name>(_entity);
+  if (nullptr == nameComp)
+  {
+    gzerr << "BoundingBoxes system should be attached to a world."
+          << " Failed to initialize." << std::endl;
+    return;
+  }
+
+  std::string service = transport::TopicUtils::AsValidTopic(
+      "/world/" + nameComp->Data() + "/entity/bounding_box");
+  if (service.empty())
+  {
+    gzerr << "Failed to create valid bounding box service for world ["
+          << nameComp->Data() << "]" << std::endl;
+    return;
+  }
+
+  this->dataPtr->node.Advertise(service,
+      &BoundingBoxesPrivate::BoundingBoxService, this->dataPtr.get());
+
+  gzmsg << "Serving bounding boxes on [" << service << "]" << std::endl;
+}
+
+//////////////////////////////////////////////////
+void BoundingBoxes::PreUpdate(const UpdateInfo &,
+    EntityComponentManager &_ecm)
+{
+  GZ_PROFILE("BoundingBoxes::PreUpdate");
+
+  if (!this->dataPtr->requestsPending)
+    return;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  for (const auto &name : this->dataPtr->pendingNames)
+  {
+    auto &watch = this->dataPtr->watches[name];
+
+    Entity model{kNullEntity};
+    for (const auto &entity : entitiesFromScopedName(name, _ecm))
+    {
+      if (nullptr != _ecm.Component<components::Model>(entity))
+      {
+        model = entity;
+        break;
+      }
+    }
+
+    if (kNullEntity == model)
+    {
+      gzwarn << "No model named [" << name << "] to compute a bounding "
+             << "box for" << std::endl;
+      watch.failed = true;
+      continue;
+    }
+
+    watch.entity = model;
+    // Creating the component makes Physics maintain the box from here
+    // on; it only marks it changed when the box actually moves.
+    if (nullptr == _ecm.Component<components::AxisAlignedBox>(model))
+    {
+      _ecm.CreateComponent(model, components::AxisAlignedBox());
+    }
+  }
+  this->dataPtr->pendingNames.clear();
+  this->dataPtr->requestsPending = false;
+  this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+void BoundingBoxes::PostUpdate(const UpdateInfo &,
+    const EntityComponentManager &_ecm)
+{
+  GZ_PROFILE("BoundingBoxes::PostUpdate");
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->watches.empty())
+    return;
+
+  bool changed{false};
+  for (auto &[name, watch] : this->dataPtr->watches)
+  {
+    if (kNullEntity == watch.entity || watch.failed)
+      continue;
+
+    auto comp = _ecm.Component<components::AxisAlignedBox>(watch.entity);
+    if (nullptr == comp)
+    {
+      // The model was removed.
+      watch.failed = true;
+      watch.ready = false;
+      changed = true;
+      continue;
+    }
+
+    // A default box means Physics hasn't filled the component yet, e.g.
+    // the engine lacks the bounding box feature.
+    if (comp->Data() == math::AxisAlignedBox())
+      continue;
+
+    if (!watch.ready || watch.box != comp->Data())
+    {
+      watch.box = comp->Data();
+      watch.ready = true;
+      changed = true;
+    }
+  }
+
+  if (changed)
+    this->dataPtr->cv.notify_all();
+}
+
+//////////////////////////////////////////////////
+bool BoundingBoxesPrivate::BoundingBoxService(const msgs::StringMsg &_req,
+    msgs::AxisAlignedBox &_rep)
+{
+  const std::string &name = _req.data();
+  if (name.empty())
+    return false;
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+  auto iter = this->watches.find(name);
+  if (iter == this->watches.end())
+  {
+    this->pendingNames.push_back(name);
+    this->requestsPending = true;
+  }
+
+  // Wait until the box has been computed. Later queries for the same
+  // model hit the cache and return immediately.
+  const bool done = this->cv.wait_for(lock, this->serviceTimeout,
+      [this, &name]
+      {
+        auto it = this->watches.find(name);
+        return it != this->watches.end() &&
+            (it->second.ready || it->second.failed);
+      });
+
+  if (!done)
+  {
+    gzwarn << "Timed out waiting for the bounding box of [" << name
+           << "]; is simulation running?" << std::endl;
+    return false;
+  }
+
+  const auto &watch = this->watches[name];
+  if (watch.failed)
+    return false;
+
+  _rep = convert<msgs::AxisAlignedBox>(watch.box);
+  return true;
+}
+
+GZ_ADD_PLUGIN(BoundingBoxes,
+              System,
+              BoundingBoxes::ISystemConfigure,
+              BoundingBoxes::ISystemPreUpdate,
+              BoundingBoxes::ISystemPostUpdate)
+
+GZ_ADD_PLUGIN_ALIAS(BoundingBoxes, "gz::sim::systems::BoundingBoxes")
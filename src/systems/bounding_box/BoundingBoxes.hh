@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_SYSTEMS_BOUNDINGBOXES_HH_
+#define GZ_SIM_SYSTEMS_BOUNDINGBOXES_HH_
+
+#include <memory>
+
+#include <gz/sim/config.hh>
+#include <gz/sim/System.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace systems
+{
+  // Forward declarations.
+  class BoundingBoxesPrivate;
+
+  /// \brief A world system serving model bounding boxes over a service,
+  /// maintained by the ECM instead of recomputed per query.
+  ///
+  /// The first request for a model creates its
+  /// `components::AxisAlignedBox`; from then on the Physics system keeps
+  /// the component up to date every step, only marking it changed when
+  /// the box actually moved, and this system mirrors the values into a
+  /// cache the service replies from. Repeat queries are a map lookup, so
+  /// callers no longer need to walk links and geometries themselves.
+  ///
+  /// ## Services
+  ///
+  /// `/world/<world_name>/entity/bounding_box`: Request is a StringMsg
+  /// holding the model's scoped name (`::` delimited); response is the
+  /// model's current world-frame AxisAlignedBox. The first request for a
+  /// model blocks until the box has been computed, which needs the
+  /// simulation to be stepping and a physics engine with the
+  /// GetModelBoundingBox feature; it fails after a timeout otherwise.
+  ///
+  /// ## Example Usage
+  ///
+  /// ```
+  /// <plugin filename="gz-sim-bounding-boxes-system"
+  ///         name="gz::sim::systems::BoundingBoxes">
+  /// </plugin>
+  /// ```
+  class BoundingBoxes final:
+    public System,
+    public ISystemConfigure,
+    public ISystemPreUpdate,
+    public ISystemPostUpdate
+  {
+    /// \brief Constructor
+    public: BoundingBoxes();
+
+    /// \brief Destructor
+    public: ~BoundingBoxes() final;
+
+    // Documentation inherited
+    public: void Configure(const Entity &_entity,
+                const std::shared_ptr<const sdf::Element> &_sdf,
+                EntityComponentManager &_ecm,
+                EventManager &_eventMgr) final;
+
+    // Documentation inherited
+    public: void PreUpdate(const UpdateInfo &_info,
+                EntityComponentManager &_ecm) final;
+
+    // Documentation inherited
+    public: void PostUpdate(const UpdateInfo &_info,
+                const EntityComponentManager &_ecm) final;
+
+    /// \brief Private data pointer.
+    private: std::unique_ptr<BoundingBoxesPrivate> dataPtr;
+  };
+}
+}
+}
+}
+#endif
@@ -167,6 +167,8 @@ void Breadcrumbs::Configure(const Entity &_entity,
   this->creator = std::make_unique<SdfEntityCreator>(_ecm, _eventMgr);
 
   this->worldEntity = _ecm.EntityByComponents(components::World());
+  if (auto worldNameComp = _ecm.Component<components::Name>(this->worldEntity))
+    this->worldName = worldNameComp->Data();
 
   this->initialized = true;
 }
@@ -207,18 +209,15 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
         std::string desiredName =
             modelToSpawn.Name() + "_" + std::to_string(this->numDeployments);
 
-        std::vector<std::string> modelNames;
-        _ecm.Each<components::Name, components::Model>(
-            [&modelNames](const Entity &, const components::Name *_name,
-                          const components::Model *)
+        // Check if there's a model with the same name. Probing for the
+        // candidate names directly avoids collecting every model name in the
+        // world for each deployment.
+        auto nameTaken = [&_ecm](const std::string &_name) -> bool
             {
-              modelNames.push_back(_name->Data());
-              return true;
-            });
-
-        // Check if there's a model with the same name.
-        auto it = std::find(modelNames.begin(), modelNames.end(), desiredName);
-        if (it != modelNames.end())
+              return kNullEntity != _ecm.EntityByComponents(
+                  components::Name(_name), components::Model());
+            };
+        if (nameTaken(desiredName))
         {
           if (!this->allowRenaming)
           {
@@ -231,8 +230,7 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
 
           std::string newName = desiredName;
           int counter = 0;
-          while (std::find(modelNames.begin(), modelNames.end(), newName) !=
-                 modelNames.end())
+          while (nameTaken(newName))
           {
             newName = desiredName + "_" + std::to_string(++counter);
           }
@@ -256,12 +254,10 @@ void Breadcrumbs::PreUpdate(const UpdateInfo &_info,
 
         if (this->isPerformer)
         {
-          auto worldName =
-              _ecm.Component<components::Name>(this->worldEntity)->Data();
           msgs::StringMsg req;
           req.set_data(modelToSpawn.Name());
           this->node.Request<msgs::StringMsg, msgs::Boolean>(
-              "/world/" + worldName + "/level/set_performer", req,
+              "/world/" + this->worldName + "/level/set_performer", req,
               [](const msgs::Boolean &, const bool)
               {
               });
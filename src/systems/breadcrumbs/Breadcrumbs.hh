@@ -125,6 +125,9 @@ namespace systems
     /// \brief World entity
     private: Entity worldEntity{kNullEntity};
 
+    /// \brief Name of the world entity, cached for performer requests
+    private: std::string worldName;
+
     /// \brief Creator interface
     public: std::unique_ptr<SdfEntityCreator> creator{nullptr};
 
@@ -16,8 +16,11 @@
  */
 #include <gz/msgs/wrench.pb.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <map>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -77,17 +80,90 @@ class gz::sim::systems::BuoyancyPrivate
   /// \return The fluid density at the givein pose.
   public: double UniformFluidDensity(const math::Pose3d &_pose) const;
 
+  /// \brief Precomputed submerged volume and centroid of one collision
+  /// shape, sampled against horizontal planes at uniform offsets across the
+  /// shape's vertical extent. Graded buoyancy only ever slices with
+  /// horizontal planes, so the plane offset fully determines the result and
+  /// the per-step slicing reduces to a table interpolation.
+  public: struct SubmergedVolumeTable
+  {
+    /// \brief Plane offset at or below which nothing is submerged.
+    double minOffset{0.0};
+
+    /// \brief Plane offset at or above which the shape is fully submerged.
+    double maxOffset{0.0};
+
+    /// \brief Offset distance between consecutive samples.
+    double step{0.0};
+
+    /// \brief Total volume of the shape.
+    double totalVolume{0.0};
+
+    /// \brief Sampled submerged volumes.
+    std::vector<double> volumes;
+
+    /// \brief Sampled submerged volume centroids, in the shape's frame.
+    std::vector<math::Vector3d> centroids;
+
+    /// \brief Interpolate the submerged volume at a plane offset.
+    /// \param[in] _offset Plane offset in the shape's frame.
+    /// \return The submerged volume.
+    public: double VolumeAt(double _offset) const
+    {
+      if (_offset <= this->minOffset)
+        return 0.0;
+      if (_offset >= this->maxOffset)
+        return this->totalVolume;
+      auto pos = (_offset - this->minOffset) / this->step;
+      auto idx = static_cast<std::size_t>(pos);
+      if (idx + 1 >= this->volumes.size())
+        return this->volumes.back();
+      auto frac = pos - static_cast<double>(idx);
+      return (1.0 - frac) * this->volumes[idx] +
+          frac * this->volumes[idx + 1];
+    }
+
+    /// \brief Interpolate the submerged volume centroid at a plane offset.
+    /// \param[in] _offset Plane offset in the shape's frame.
+    /// \return The centroid, in the shape's frame.
+    public: math::Vector3d CentroidAt(double _offset) const
+    {
+      if (_offset <= this->minOffset)
+        return math::Vector3d::Zero;
+      if (_offset >= this->maxOffset)
+        return this->centroids.back();
+      auto pos = (_offset - this->minOffset) / this->step;
+      auto idx = static_cast<std::size_t>(pos);
+      if (idx + 1 >= this->centroids.size())
+        return this->centroids.back();
+      auto frac = pos - static_cast<double>(idx);
+      return (1.0 - frac) * this->centroids[idx] +
+          frac * this->centroids[idx + 1];
+    }
+  };
+
+  /// \brief Build the submerged volume table of a shape.
+  /// \param[in] _shape Shape to slice. Must provide Volume, VolumeBelow and
+  /// CenterOfVolumeBelow; currently box or sphere.
+  /// \param[in] _minZ Lowest point of the shape along z, in its own frame.
+  /// \param[in] _maxZ Highest point of the shape along z, in its own frame.
+  /// \return The sampled table.
+  public: template<typename T>
+  static SubmergedVolumeTable BuildVolumeTable(const T &_shape,
+      double _minZ, double _maxZ);
+
+  /// \brief Tables of the graded-buoyancy collision shapes, keyed by
+  /// collision entity and built on first use.
+  public: std::unordered_map<Entity, SubmergedVolumeTable> volumeTables;
+
   /// \brief Get the resultant buoyant force on a shape.
   /// \param[in] _pose World pose of the shape's origin.
-  /// \param[in] _shape The collision mesh of a shape. Currently must
-  /// be box or sphere.
+  /// \param[in] _table The precomputed submerged volume table of the shape.
   /// \param[in] _gravity Gravity acceleration in the world frame.
   /// Updates this->buoyancyForces containing {force, center_of_volume} to be
   /// applied on the link.
-  public:
-  template<typename T>
-  void GradedFluidDensity(
-    const math::Pose3d &_pose, const T &_shape, const math::Vector3d &_gravity);
+  public: void GradedFluidDensity(const math::Pose3d &_pose,
+    const SubmergedVolumeTable &_table, const math::Vector3d &_gravity);
 
   /// \brief Check for new links to apply buoyancy forces to. Calculates the
   /// volume and center of volume for every new link and stages them to be
@@ -109,6 +185,10 @@ class gz::sim::systems::BuoyancyPrivate
   /// \brief Model interface
   public: Entity world{kNullEntity};
 
+  /// \brief World gravity vector, cached at configure time. Gravity is a
+  /// world constant, so it doesn't need to be looked up every step.
+  public: std::optional<math::Vector3d> gravity;
+
   /// \brief The density of the fluid in which the object is submerged in
   /// kg/m^3. Defaults to 1000, the fluid density of water.
   public: double fluidDensity{1000};
@@ -170,8 +250,34 @@ double BuoyancyPrivate::UniformFluidDensity(const math::Pose3d &/*_pose*/) const
 
 //////////////////////////////////////////////////
 template<typename T>
-void BuoyancyPrivate::GradedFluidDensity(
-  const math::Pose3d &_pose, const T &_shape, const math::Vector3d &_gravity)
+BuoyancyPrivate::SubmergedVolumeTable BuoyancyPrivate::BuildVolumeTable(
+  const T &_shape, double _minZ, double _maxZ)
+{
+  constexpr std::size_t kSamples{128};
+
+  SubmergedVolumeTable table;
+  table.minOffset = _minZ;
+  table.maxOffset = _maxZ;
+  table.step = (_maxZ - _minZ) / static_cast<double>(kSamples - 1);
+  table.totalVolume = _shape.Volume();
+  table.volumes.reserve(kSamples);
+  table.centroids.reserve(kSamples);
+
+  for (std::size_t i = 0; i < kSamples; ++i)
+  {
+    // TODO(arjo): Transform plane and slice the shape
+    math::Planed plane{math::Vector3d{0, 0, 1},
+        _minZ + static_cast<double>(i) * table.step};
+    table.volumes.push_back(std::max(_shape.VolumeBelow(plane), 0.0));
+    table.centroids.push_back(
+        _shape.CenterOfVolumeBelow(plane).value_or(math::Vector3d::Zero));
+  }
+  return table;
+}
+
+//////////////////////////////////////////////////
+void BuoyancyPrivate::GradedFluidDensity(const math::Pose3d &_pose,
+  const SubmergedVolumeTable &_table, const math::Vector3d &_gravity)
 {
   auto prevLayerFluidDensity = this->fluidDensity;
   auto prevLayerVol = 0.0;
@@ -179,9 +285,8 @@ void BuoyancyPrivate::GradedFluidDensity(
 
   for (const auto &[height, currFluidDensity] : this->layers)
   {
-    // TODO(arjo): Transform plane and slice the shape
-    math::Planed plane{math::Vector3d{0, 0, 1}, height - _pose.Pos().Z()};
-    auto vol = _shape.VolumeBelow(plane);
+    auto offset = height - _pose.Pos().Z();
+    auto vol = _table.VolumeAt(offset);
 
     // Short circuit.
     if (vol <= 0)
@@ -191,13 +296,7 @@ void BuoyancyPrivate::GradedFluidDensity(
     }
 
     // Calculate point from which force is applied
-    auto cov = _shape.CenterOfVolumeBelow(plane);
-
-    if (!cov.has_value())
-    {
-      prevLayerFluidDensity = currFluidDensity;
-      continue;
-    }
+    auto cov = _table.CentroidAt(offset);
 
     // Archimedes principle for this layer
     auto forceMag =  - (vol - prevLayerVol) * _gravity * prevLayerFluidDensity;
@@ -205,9 +304,9 @@ void BuoyancyPrivate::GradedFluidDensity(
     // Accumulate layers.
     prevLayerFluidDensity = currFluidDensity;
 
-    auto cob = (cov.value() * vol - centerOfBuoyancy * prevLayerVol)
+    auto cob = (cov * vol - centerOfBuoyancy * prevLayerVol)
       / (vol - prevLayerVol);
-    centerOfBuoyancy = cov.value();
+    centerOfBuoyancy = cov;
     auto buoyancyAction = BuoyancyActionPoint
     {
       forceMag,
@@ -219,7 +318,7 @@ void BuoyancyPrivate::GradedFluidDensity(
     prevLayerVol = vol;
   }
   // For the rest of the layers.
-  auto vol = _shape.Volume();
+  auto vol = _table.totalVolume;
 
   // No force contributed by this layer.
   if (std::abs(vol - prevLayerVol) < 1e-10)
@@ -452,6 +551,7 @@ void Buoyancy::Configure(const Entity &_entity,
       << "attached to a <world>, not a <model>." << std::endl;
     return;
   }
+  this->dataPtr->gravity = gravity->Data();
 
   if (_sdf->HasElement("uniform_fluid_density"))
   {
@@ -530,14 +630,13 @@ void Buoyancy::PreUpdate(const UpdateInfo &_info,
   if (_info.paused)
     return;
 
-  const components::Gravity *gravity = _ecm.Component<components::Gravity>(
-      this->dataPtr->world);
-  if (!gravity)
+  if (!this->dataPtr->gravity)
   {
     gzerr << "Unable to get the gravity vector. Has gravity been defined?"
            << std::endl;
     return;
   }
+  const math::Vector3d &gravity = *this->dataPtr->gravity;
 
   _ecm.Each<components::Link,
             components::Volume,
@@ -561,7 +660,7 @@ void Buoyancy::PreUpdate(const UpdateInfo &_info,
       {
         buoyancy =
         -this->dataPtr->UniformFluidDensity(linkWorldPose) *
-        _volume->Data() * gravity->Data();
+        _volume->Data() * gravity;
 
         // Convert the center of volume to the world frame
         math::Vector3d offsetWorld = linkWorldPose.Rot().RotateVector(
@@ -594,32 +693,48 @@ void Buoyancy::PreUpdate(const UpdateInfo &_info,
             continue;
           }
 
-          switch (coll->Data().Geom()->Type())
+          // Build the submerged volume table of this collision once; after
+          // that each step only interpolates it.
+          auto tableIter = this->dataPtr->volumeTables.find(e);
+          if (tableIter == this->dataPtr->volumeTables.end())
           {
-            case sdf::GeometryType::BOX:
-              this->dataPtr->GradedFluidDensity<math::Boxd>(
-                pose,
-                coll->Data().Geom()->BoxShape()->Shape(),
-                gravity->Data());
-              break;
-            case sdf::GeometryType::SPHERE:
-              this->dataPtr->GradedFluidDensity<math::Sphered>(
-                pose,
-                coll->Data().Geom()->SphereShape()->Shape(),
-                gravity->Data());
-              break;
-            default:
+            switch (coll->Data().Geom()->Type())
             {
-              static bool warned{false};
-              if (!warned)
+              case sdf::GeometryType::BOX:
+              {
+                const auto &shape = coll->Data().Geom()->BoxShape()->Shape();
+                tableIter = this->dataPtr->volumeTables.emplace(e,
+                    BuoyancyPrivate::BuildVolumeTable(shape,
+                      -shape.Size().Z() / 2, shape.Size().Z() / 2)).first;
+                break;
+              }
+              case sdf::GeometryType::SPHERE:
               {
-                gzwarn << "Only <box> and <sphere> collisions are supported "
-                  << "by the graded buoyancy option." << std::endl;
-                warned = true;
+                const auto &shape = coll->Data().Geom()->SphereShape()->Shape();
+                tableIter = this->dataPtr->volumeTables.emplace(e,
+                    BuoyancyPrivate::BuildVolumeTable(shape,
+                      -shape.Radius(), shape.Radius())).first;
+                break;
+              }
+              default:
+              {
+                static bool warned{false};
+                if (!warned)
+                {
+                  gzwarn << "Only <box> and <sphere> collisions are supported "
+                    << "by the graded buoyancy option." << std::endl;
+                  warned = true;
+                }
+                break;
               }
-              break;
             }
           }
+
+          if (tableIter != this->dataPtr->volumeTables.end())
+          {
+            this->dataPtr->GradedFluidDensity(
+              pose, tableIter->second, gravity);
+          }
         }
         auto [force, torque] = this->dataPtr->ResolveForces(linkWorldPose);
         // Apply the wrench to the link. This wrench is applied in the
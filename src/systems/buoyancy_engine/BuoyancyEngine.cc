@@ -18,9 +18,10 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
-#include <mutex>
+#include <optional>
 #include <string>
 
+#include <gz/sim/CommandMailbox.hh>
 #include <gz/sim/components/Gravity.hh>
 #include <gz/sim/components/World.hh>
 #include <gz/sim/Link.hh>
@@ -65,6 +66,10 @@ class gz::sim::systems::BuoyancyEnginePrivateData
   /// \brief The world entity
   public: Entity world{kNullEntity};
 
+  /// \brief World gravity vector, cached on first use. Gravity is a world
+  /// constant, so it doesn't need to be looked up every step.
+  public: std::optional<math::Vector3d> gravity;
+
   /// \brief The fluid density in kg*m^-3
   public: double fluidDensity = 1000;
 
@@ -80,8 +85,9 @@ class gz::sim::systems::BuoyancyEnginePrivateData
   /// \brief Publishes bladder status
   public: gz::transport::Node::Publisher statusPub;
 
-  /// \brief mutex for protecting bladder volume and set point.
-  public: std::mutex mtx;
+  /// \brief Mailbox carrying volume set points from the command callback to
+  /// the simulation thread without locking.
+  public: CommandMailbox<double> setpointMailbox;
 
   /// \brief  Get fluid density based on the link origin's current position.
   /// \param[in] _ecm - The ecm in question.
@@ -112,8 +118,7 @@ void BuoyancyEnginePrivateData::OnCmdBuoyancyEngine(
   auto volume = std::max(this->minVolume, _volumeSetpoint.data());
   volume = std::min(volume, this->maxVolume);
 
-  std::lock_guard lock(this->mtx);
-  this->volumeSetPoint = volume;
+  this->setpointMailbox.Push(volume);
 }
 
 //////////////////////////////////////////////////
@@ -226,51 +231,56 @@ void BuoyancyEnginePlugin::PreUpdate(
 
   gz::msgs::Double msg;
 
-  const components::Gravity *gravity = _ecm.Component<components::Gravity>(
-    this->dataPtr->world);
-  if (!gravity)
+  if (!this->dataPtr->gravity)
   {
-    gzerr << "World has no gravity component" << std::endl;
-    return;
+    const components::Gravity *gravity = _ecm.Component<components::Gravity>(
+      this->dataPtr->world);
+    if (!gravity)
+    {
+      gzerr << "World has no gravity component" << std::endl;
+      return;
+    }
+    this->dataPtr->gravity = gravity->Data();
   }
 
   gz::sim::Link link(this->dataPtr->linkEntity);
-  math::Vector3d zForce;
+
+  // Retrieve the latest commanded set point, if any arrived since the last
+  // step.
+  this->dataPtr->setpointMailbox.Pop(this->dataPtr->volumeSetPoint);
+
+  // Adjust the bladder volume using the pump. Assume ability to pump at
+  // max flow rate
+  if (this->dataPtr->bladderVolume < this->dataPtr->volumeSetPoint)
   {
-    std::lock_guard lock(this->dataPtr->mtx);
-    // Adjust the bladder volume using the pump. Assume ability to pump at
-    // max flow rate
-    if (this->dataPtr->bladderVolume < this->dataPtr->volumeSetPoint)
-    {
-      this->dataPtr->bladderVolume +=
-        std::min(
-          dt * this->dataPtr->maxInflationRate,
-          this->dataPtr->volumeSetPoint - this->dataPtr->bladderVolume
-        );
-    }
-    else if (this->dataPtr->bladderVolume > this->dataPtr->volumeSetPoint)
-    {
-      this->dataPtr->bladderVolume -=
-        std::min(
-          dt * this->dataPtr->maxInflationRate,
-          this->dataPtr->bladderVolume - this->dataPtr->volumeSetPoint
-        );
-    }
+    this->dataPtr->bladderVolume +=
+      std::min(
+        dt * this->dataPtr->maxInflationRate,
+        this->dataPtr->volumeSetPoint - this->dataPtr->bladderVolume
+      );
+  }
+  else if (this->dataPtr->bladderVolume > this->dataPtr->volumeSetPoint)
+  {
+    this->dataPtr->bladderVolume -=
+      std::min(
+        dt * this->dataPtr->maxInflationRate,
+        this->dataPtr->bladderVolume - this->dataPtr->volumeSetPoint
+      );
+  }
 
-    /// Populate status message
-    msg.set_data(this->dataPtr->bladderVolume);
-    this->dataPtr->statusPub.Publish(msg);
+  /// Populate status message
+  msg.set_data(this->dataPtr->bladderVolume);
+  this->dataPtr->statusPub.Publish(msg);
 
-    // Get the fluid density of the current layer
-    auto currentFluidDensity = this->dataPtr->CurrentFluidDensity(_ecm);
+  // Get the fluid density of the current layer
+  auto currentFluidDensity = this->dataPtr->CurrentFluidDensity(_ecm);
 
-    // Simply use Archimede's principle to apply a force at the desired link
-    // position. We take off the neutral buoyancy element in order to simulate
-    // the mass of the oil in the bladder.
-    zForce = - gravity->Data() *
-      ( currentFluidDensity * this->dataPtr->bladderVolume
-      - this->dataPtr->fluidDensity * this->dataPtr->neutralVolume);
-  }
+  // Simply use Archimede's principle to apply a force at the desired link
+  // position. We take off the neutral buoyancy element in order to simulate
+  // the mass of the oil in the bladder.
+  math::Vector3d zForce = - *this->dataPtr->gravity *
+    ( currentFluidDensity * this->dataPtr->bladderVolume
+    - this->dataPtr->fluidDensity * this->dataPtr->neutralVolume);
   link.AddWorldWrench(_ecm, zForce, {0, 0, 0});
 }
 
@@ -15,6 +15,8 @@
  *
  */
 
+#include <map>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -72,6 +74,11 @@ class gz::sim::systems::ColladaWorldExporterPrivate
     common::Mesh worldMesh;
     std::vector<math::Matrix4d> subMeshMatrix;
 
+    // Index of already-added materials, keyed by their visual properties.
+    // Repeated visuals (e.g. fleets of the same model) would otherwise add
+    // one identical material to the world mesh per visual.
+    std::map<std::string, int> materialIndices;
+
     _ecm.Each<components::World, components::Name>(
       [&](const Entity /*& _entity*/,
         const components::World *,
@@ -128,7 +135,20 @@ class gz::sim::systems::ColladaWorldExporterPrivate
         }
         else
         {
-          newMatIndex = worldMesh.AddMaterial(mat);
+          std::ostringstream key;
+          key << mat->Diffuse() << ";" << mat->Ambient() << ";"
+              << mat->Emissive() << ";" << mat->Specular() << ";"
+              << mat->Transparency();
+          auto matIt = materialIndices.find(key.str());
+          if (matIt != materialIndices.end())
+          {
+            newMatIndex = matIt->second;
+          }
+          else
+          {
+            newMatIndex = worldMesh.AddMaterial(mat);
+            materialIndices[key.str()] = newMatIndex;
+          }
         }
 
         subm.lock()->SetMaterialIndex(newMatIndex);
@@ -79,6 +79,11 @@ class ContactSensor
 
   /// \brief Entities for which this sensor publishes data
   public: std::vector<Entity> collisionEntities;
+
+  /// \brief True while the sensor's ContactSensorData components exist, so
+  /// physics gathers contacts for it. Cleared while the publisher has no
+  /// subscribers to spare the per-step message conversion.
+  public: bool enabled{true};
 };
 
 class gz::sim::systems::ContactPrivate
@@ -87,6 +92,13 @@ class gz::sim::systems::ContactPrivate
   /// \param[in] _ecm Mutable reference to ECM.
   public: void CreateSensors(EntityComponentManager &_ecm);
 
+  /// \brief Create or remove each sensor's ContactSensorData components to
+  /// match whether its publisher currently has subscribers. Physics only
+  /// gathers and converts contacts for entities that have the component,
+  /// so unsubscribed sensors cost nothing per step.
+  /// \param[in] _ecm Mutable reference to ECM.
+  public: void EnableSensors(EntityComponentManager &_ecm);
+
   /// \brief Update and publish sensor data
   /// \param[in] _ecm Immutable reference to ECM.
   public: void UpdateSensors(const UpdateInfo &_info,
@@ -211,6 +223,33 @@ void ContactPrivate::CreateSensors(EntityComponentManager &_ecm)
       });
 }
 
+//////////////////////////////////////////////////
+void ContactPrivate::EnableSensors(EntityComponentManager &_ecm)
+{
+  GZ_PROFILE("ContactPrivate::EnableSensors");
+  for (auto &item : this->entitySensorMap)
+  {
+    auto &sensor = item.second;
+    const bool wanted = sensor->pub.HasConnections();
+    if (wanted == sensor->enabled)
+      continue;
+
+    sensor->enabled = wanted;
+    for (const Entity &entity : sensor->collisionEntities)
+    {
+      if (wanted)
+      {
+        if (!_ecm.Component<components::ContactSensorData>(entity))
+          _ecm.CreateComponent(entity, components::ContactSensorData());
+      }
+      else
+      {
+        _ecm.RemoveComponent<components::ContactSensorData>(entity);
+      }
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 void ContactPrivate::UpdateSensors(const UpdateInfo &_info,
                                    const EntityComponentManager &_ecm)
@@ -218,12 +257,17 @@ void ContactPrivate::UpdateSensors(const UpdateInfo &_info,
   GZ_PROFILE("ContactPrivate::UpdateSensors");
   for (const auto &item : this->entitySensorMap)
   {
+    if (!item.second->enabled)
+      continue;
+
     for (const Entity &entity : item.second->collisionEntities)
     {
       auto contacts = _ecm.Component<components::ContactSensorData>(entity);
 
-      // We will assume that the ContactData component will have been created if
-      // this entity is in the collisionEntities list
+      // The component is removed while the sensor has no subscribers
+      if (nullptr == contacts)
+        continue;
+
       if (contacts->Data().contact_size() > 0)
       {
         item.second->AddContacts(_info.simTime, contacts->Data());
@@ -264,6 +308,7 @@ void Contact::PreUpdate(const UpdateInfo &, EntityComponentManager &_ecm)
 {
   GZ_PROFILE("Contact::PreUpdate");
   this->dataPtr->CreateSensors(_ecm);
+  this->dataPtr->EnableSensors(_ecm);
 }
 
 //////////////////////////////////////////////////
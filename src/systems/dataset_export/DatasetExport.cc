@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "DatasetExport.hh"
+
+#include <gz/msgs/image.pb.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gz/common/Filesystem.hh>
+#include <gz/common/Image.hh>
+#include <gz/common/Profiler.hh>
+#include <gz/math/Helpers.hh>
+#include <gz/plugin/Register.hh>
+#include <gz/transport/Node.hh>
+
+#include <gz/rendering/Camera.hh>
+#include <gz/rendering/PixelFormat.hh>
+#include <gz/rendering/RenderEngine.hh>
+#include <gz/rendering/RenderingIface.hh>
+#include <gz/rendering/Scene.hh>
+
+#include "gz/sim/rendering/Events.hh"
+
+#include "gz/sim/components/Camera.hh"
+#include "gz/sim/components/SegmentationCamera.hh"
+#include "gz/sim/components/ThermalCamera.hh"
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Events.hh"
+#include "gz/sim/Util.hh"
+
+using namespace gz;
+using namespace sim;
+using namespace systems;
+
+// Private data class.
+class gz::sim::systems::DatasetExportPrivate
+{
+  /// \brief A frame waiting to be encoded and written.
+  public: struct Frame
+  {
+    /// \brief Copy of the frame pixels.
+    std::shared_ptr<common::Image> image;
+
+    /// \brief Destination file name.
+    std::string fileName;
+  };
+
+  /// \brief Callback invoked in the rendering thread after a render update
+  public: void OnPostRender();
+
+  /// \brief Callback for new images. No work is done here; the
+  /// subscription makes the sensor active, like in CameraVideoRecorder.
+  /// \param[in] _msg Unused image message.
+  public: void OnImage(const msgs::Image &_msg);
+
+  /// \brief Encoder worker loop: pops frames off the queue and writes
+  /// them as PNG until the queue is drained after shutdown.
+  public: void WorkerLoop();
+
+  /// \brief Transport node
+  public: transport::Node node;
+
+  /// \brief Connection to the post-render event.
+  public: common::ConnectionPtr postRenderConn;
+
+  //// \brief Pointer to the rendering scene
+  public: rendering::ScenePtr scene;
+
+  /// \brief Pointer to the rendering camera
+  public: rendering::CameraPtr camera;
+
+  /// \brief Sensor entity.
+  public: Entity entity;
+
+  /// \brief Scoped name of the sensor, used to find it in the scene.
+  public: std::string cameraName;
+
+  /// \brief File name prefix derived from the sensor name.
+  public: std::string filePrefix;
+
+  /// \brief Image the camera renders into, reused between frames.
+  public: rendering::Image cameraImage;
+
+  /// \brief Directory the frames are written to.
+  public: std::string path;
+
+  /// \brief Number of encoder threads.
+  public: unsigned int workers = 2;
+
+  /// \brief Maximum number of frames waiting to be encoded. Frames
+  /// rendered while the queue is full are dropped, which bounds memory
+  /// when the disk cannot keep up with the sensor.
+  public: std::size_t maxQueueSize = 8;
+
+  /// \brief Current simulation time, copied in PostUpdate for use in the
+  /// rendering thread.
+  public: std::chrono::steady_clock::duration simTime{0};
+
+  /// \brief Mutex protecting simTime.
+  public: std::mutex updateMutex;
+
+  /// \brief Frames waiting to be encoded.
+  public: std::deque<Frame> frameQueue;
+
+  /// \brief Mutex protecting frameQueue and done.
+  public: std::mutex queueMutex;
+
+  /// \brief Signals the workers that the queue has frames or shutdown
+  /// started.
+  public: std::condition_variable queueCv;
+
+  /// \brief True once shutdown started. Workers drain the queue and exit.
+  public: bool done = false;
+
+  /// \brief Encoder threads.
+  public: std::vector<std::thread> workerThreads;
+
+  /// \brief Number of frames dropped because the queue was full, reported
+  /// once per occurrence batch.
+  public: uint64_t droppedFrames = 0u;
+
+  /// \brief True if the system configured successfully.
+  public: bool validConfig = false;
+};
+
+//////////////////////////////////////////////////
+void DatasetExportPrivate::OnImage(const msgs::Image &)
+{
+  // No work is done here. We need to subscribe to the sensor to make it
+  // active.
+}
+
+//////////////////////////////////////////////////
+void DatasetExportPrivate::WorkerLoop()
+{
+  while (true)
+  {
+    Frame frame;
+    {
+      std::unique_lock<std::mutex> lock(this->queueMutex);
+      this->queueCv.wait(lock, [this]
+          {
+            return !this->frameQueue.empty() || this->done;
+          });
+      if (this->frameQueue.empty())
+        return;
+      frame = std::move(this->frameQueue.front());
+      this->frameQueue.pop_front();
+    }
+    frame.image->SavePNG(frame.fileName);
+  }
+}
+
+//////////////////////////////////////////////////
+void DatasetExportPrivate::OnPostRender()
+{
+  GZ_PROFILE("DatasetExport::OnPostRender");
+
+  // get scene
+  if (!this->scene)
+    this->scene = rendering::sceneFromFirstRenderEngine();
+
+  // return if scene not ready or no sensors available.
+  if (!this->scene->IsInitialized() ||
+      this->scene->SensorCount() == 0)
+  {
+    return;
+  }
+
+  // get camera
+  if (!this->camera)
+  {
+    if (this->cameraName.empty())
+      return;
+    auto sensor = this->scene->SensorByName(this->cameraName);
+    if (!sensor)
+      return;
+    this->camera = std::dynamic_pointer_cast<rendering::Camera>(sensor);
+    if (!this->camera)
+    {
+      gzerr << "Sensor [" << this->cameraName << "] is not a camera"
+             << std::endl;
+      return;
+    }
+    return;
+  }
+
+  unsigned int width = this->camera->ImageWidth();
+  unsigned int height = this->camera->ImageHeight();
+  if (this->cameraImage.Width() != width ||
+      this->cameraImage.Height() != height)
+  {
+    this->cameraImage = this->camera->CreateImage();
+  }
+
+  // Drop the frame instead of queueing without bound when the workers
+  // can't keep up; the image copy below is skipped too.
+  {
+    std::lock_guard<std::mutex> lock(this->queueMutex);
+    if (this->frameQueue.size() >= this->maxQueueSize)
+    {
+      if (0u == this->droppedFrames++)
+      {
+        gzwarn << "Dataset export queue is full, dropping frames. "
+               << "Consider more <workers> or a larger <max_queue_size>."
+               << std::endl;
+      }
+      return;
+    }
+  }
+
+  this->camera->Copy(this->cameraImage);
+
+  auto formatStr = rendering::PixelUtil::Name(this->camera->ImageFormat());
+  auto format = common::Image::ConvertPixelFormat(formatStr);
+
+  std::chrono::steady_clock::duration t;
+  {
+    std::lock_guard<std::mutex> lock(this->updateMutex);
+    t = this->simTime;
+  }
+  auto [sec, nsec] = math::durationToSecNsec(t);
+
+  std::ostringstream fileName;
+  fileName << this->filePrefix << "_" << sec << "_"
+           << std::setw(9) << std::setfill('0') << nsec << ".png";
+
+  // SetFromData copies the buffer, so the render image can be reused for
+  // the next frame while this one is encoded and written in the
+  // background.
+  Frame frame;
+  frame.image = std::make_shared<common::Image>();
+  frame.image->SetFromData(this->cameraImage.Data<unsigned char>(),
+      width, height, format);
+  frame.fileName = common::joinPaths(this->path, fileName.str());
+
+  {
+    std::lock_guard<std::mutex> lock(this->queueMutex);
+    this->frameQueue.push_back(std::move(frame));
+  }
+  this->queueCv.notify_one();
+}
+
+//////////////////////////////////////////////////
+DatasetExport::DatasetExport()
+  : System(), dataPtr(std::make_unique<DatasetExportPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+DatasetExport::~DatasetExport()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->queueMutex);
+    this->dataPtr->done = true;
+  }
+  this->dataPtr->queueCv.notify_all();
+  for (auto &worker : this->dataPtr->workerThreads)
+    worker.join();
+
+  if (this->dataPtr->droppedFrames > 0u)
+  {
+    gzwarn << "Dataset export dropped [" << this->dataPtr->droppedFrames
+           << "] frames because the queue was full." << std::endl;
+  }
+}
+
+//////////////////////////////////////////////////
+void DatasetExport::Configure(
+    const Entity &_entity, const std::shared_ptr<const sdf::Element> &_sdf,
+    EntityComponentManager &_ecm, EventManager &_eventMgr)
+{
+  if (!_ecm.Component<components::Camera>(_entity) &&
+      !_ecm.Component<components::ThermalCamera>(_entity) &&
+      !_ecm.Component<components::SegmentationCamera>(_entity))
+  {
+    gzerr << "The dataset export system can only be attached to a camera, "
+           << "thermal camera or segmentation camera sensor." << std::endl;
+    return;
+  }
+
+  this->dataPtr->entity = _entity;
+
+  if (!_sdf->HasElement("path"))
+  {
+    gzerr << "No <path> specified. Dataset export disabled." << std::endl;
+    return;
+  }
+  this->dataPtr->path = _sdf->Get<std::string>("path");
+  if (!common::exists(this->dataPtr->path) &&
+      !common::createDirectories(this->dataPtr->path))
+  {
+    gzerr << "Unable to create directory [" << this->dataPtr->path
+           << "]. Dataset export disabled." << std::endl;
+    return;
+  }
+
+  this->dataPtr->workers = _sdf->Get<unsigned int>("workers",
+      this->dataPtr->workers).first;
+  if (this->dataPtr->workers < 1u)
+    this->dataPtr->workers = 1u;
+
+  this->dataPtr->maxQueueSize = static_cast<std::size_t>(
+      _sdf->Get<uint64_t>("max_queue_size",
+      this->dataPtr->maxQueueSize).first);
+  if (this->dataPtr->maxQueueSize < 1u)
+    this->dataPtr->maxQueueSize = 1u;
+
+  // Subscribe to the sensor topics in order to make the sensor active,
+  // otherwise the sensor thinks there are no subscribers and so does not
+  // actually render. The segmentation camera publishes on a suffixed
+  // topic, so subscribe to that one too; subscriptions without a matching
+  // publisher are harmless.
+  // todo(anyone) Make it possible to get a pointer to the sensor object so
+  // we can connect to its new image event
+  std::string topic;
+  auto cameraComp = _ecm.Component<components::Camera>(_entity);
+  auto thermalComp = _ecm.Component<components::ThermalCamera>(_entity);
+  auto segmentationComp =
+      _ecm.Component<components::SegmentationCamera>(_entity);
+  if (cameraComp)
+    topic = cameraComp->Data().Topic();
+  else if (thermalComp)
+    topic = thermalComp->Data().Topic();
+  else if (segmentationComp)
+    topic = segmentationComp->Data().Topic();
+  if (topic.empty())
+  {
+    auto scoped = scopedName(_entity, _ecm);
+    topic = transport::TopicUtils::AsValidTopic(scoped + "/image");
+  }
+  if (!topic.empty())
+  {
+    this->dataPtr->node.Subscribe(topic,
+        &DatasetExportPrivate::OnImage, this->dataPtr.get());
+    if (segmentationComp)
+    {
+      this->dataPtr->node.Subscribe(topic + "/colored_map",
+          &DatasetExportPrivate::OnImage, this->dataPtr.get());
+    }
+  }
+
+  // Encode and write on background threads so the rendering thread only
+  // pays for the frame copy.
+  for (unsigned int i = 0; i < this->dataPtr->workers; ++i)
+  {
+    this->dataPtr->workerThreads.emplace_back(
+        &DatasetExportPrivate::WorkerLoop, this->dataPtr.get());
+  }
+
+  // Set up the render connection so we can copy frames in the rendering
+  // thread.
+  this->dataPtr->postRenderConn =
+      _eventMgr.Connect<events::PostRender>(
+      std::bind(&DatasetExportPrivate::OnPostRender, this->dataPtr.get()));
+
+  this->dataPtr->validConfig = true;
+}
+
+//////////////////////////////////////////////////
+void DatasetExport::PostUpdate(const UpdateInfo &_info,
+    const EntityComponentManager &_ecm)
+{
+  if (!this->dataPtr->validConfig)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->updateMutex);
+    this->dataPtr->simTime = _info.simTime;
+  }
+
+  if (!this->dataPtr->cameraName.empty())
+    return;
+
+  this->dataPtr->cameraName =
+      removeParentScope(scopedName(this->dataPtr->entity, _ecm, "::", false),
+      "::");
+  this->dataPtr->filePrefix = std::regex_replace(this->dataPtr->cameraName,
+      std::regex("::"), "_");
+}
+
+GZ_ADD_PLUGIN(DatasetExport,
+                    System,
+                    DatasetExport::ISystemConfigure,
+                    DatasetExport::ISystemPostUpdate)
+
+GZ_ADD_PLUGIN_ALIAS(DatasetExport,
+                          "gz::sim::systems::DatasetExport")
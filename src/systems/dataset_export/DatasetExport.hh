@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GZ_SIM_DATASETEXPORT_SYSTEM_HH_
+#define GZ_SIM_DATASETEXPORT_SYSTEM_HH_
+
+#include <memory>
+#include <gz/sim/config.hh>
+#include <gz/sim/System.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace systems
+{
+  class DatasetExportPrivate;
+
+  /** \class DatasetExport DatasetExport.hh \
+   * gz/sim/systems/DatasetExport.hh
+  **/
+  ///
+  /// \brief Export frames from a camera-type sensor (camera, thermal
+  /// camera, segmentation camera) to timestamped PNG files, directly from
+  /// the rendering scene. Frames are copied in the post-render callback
+  /// and encoded and written on background worker threads, so no
+  /// transport serialization or subscriber round-trip is involved and the
+  /// render thread never waits on disk.
+  ///
+  /// The system must be attached to a sensor entity inside a world that
+  /// loads the Sensors system.
+  ///
+  /// ## System Parameters
+  ///
+  /// - `<path>`: Directory the frames are written to. Created if it does
+  ///   not exist. Required.
+  ///
+  /// - `<workers>`: Number of encoder threads. The default value is 2.
+  ///
+  /// - `<max_queue_size>`: Maximum number of frames waiting to be
+  ///   encoded. When the queue is full new frames are dropped, which
+  ///   bounds memory when the disk cannot keep up with the sensor. The
+  ///   default value is 8.
+  class DatasetExport final:
+    public System,
+    public ISystemConfigure,
+    public ISystemPostUpdate
+  {
+    /// \brief Constructor
+    public: DatasetExport();
+
+    /// \brief Destructor
+    public: ~DatasetExport() final;
+
+    /// Documentation inherited
+    public: void Configure(const Entity &_entity,
+                           const std::shared_ptr<const sdf::Element> &_sdf,
+                           EntityComponentManager &_ecm,
+                           EventManager &_eventMgr) final;
+
+    /// Documentation inherited
+    public: void PostUpdate(const UpdateInfo &_info,
+                const EntityComponentManager &_ecm) final;
+
+    /// \brief Private data pointer
+    private: std::unique_ptr<DatasetExportPrivate> dataPtr;
+  };
+}
+}
+}
+}
+#endif
@@ -24,10 +24,12 @@
 #include <gz/msgs/time.pb.h>
 #include <gz/msgs/twist.pb.h>
 
+#include <functional>
 #include <limits>
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
@@ -40,6 +42,9 @@
 #include "gz/sim/components/CanonicalLink.hh"
 #include "gz/sim/components/JointPosition.hh"
 #include "gz/sim/components/JointVelocityCmd.hh"
+#include "gz/sim/components/Model.hh"
+#include "gz/sim/components/World.hh"
+#include "gz/sim/LazyPublisher.hh"
 #include "gz/sim/Link.hh"
 #include "gz/sim/Model.hh"
 #include "gz/sim/Util.hh"
@@ -60,15 +65,74 @@ struct Commands
   Commands() : lin(0.0), ang(0.0) {}
 };
 
-class gz::sim::systems::DiffDrivePrivate
+/// \brief Per-robot state. A model-attached plugin manages a single entry;
+/// in fleet mode one entry is appended for every managed model, so the
+/// update passes iterate one contiguous array instead of going through
+/// many system instances.
+struct Robot
 {
-  /// \brief Callback for velocity subscription
-  /// \param[in] _msg Velocity message
-  public: void OnCmdVel(const msgs::Twist &_msg);
+  /// \brief Model interface
+  Model model{kNullEntity};
+
+  /// \brief The model's canonical link.
+  Link canonicalLink{kNullEntity};
+
+  /// \brief Entity of the left joint
+  std::vector<Entity> leftJoints;
+
+  /// \brief Entity of the right joint
+  std::vector<Entity> rightJoints;
+
+  /// \brief Calculated speed of left joint
+  double leftJointSpeed{0};
+
+  /// \brief Calculated speed of right joint
+  double rightJointSpeed{0};
+
+  /// \brief Diff drive odometry.
+  math::DiffDriveOdometry odom;
+
+  /// \brief Last sim time odom was published.
+  std::chrono::steady_clock::duration lastOdomPubTime{0};
+
+  /// \brief Diff drive odometry message publisher. Lazy so the odometry
+  /// message is only built while someone is subscribed.
+  LazyPublisher odomPub;
+
+  /// \brief Diff drive tf message publisher. Lazy, see odomPub.
+  LazyPublisher tfPub;
+
+  /// \brief Previous control command.
+  Commands last0Cmd;
+
+  /// \brief Previous control command to last0Cmd.
+  Commands last1Cmd;
+
+  /// \brief Last target velocity requested.
+  msgs::Twist targetVel;
+
+  /// \brief Enable/disable state of the controller.
+  bool enabled{true};
+};
 
-  /// \brief Callback for enable/disable subscription
-  /// \param[in] _msg Boolean message
-  public: void OnEnable(const msgs::Boolean &_msg);
+class gz::sim::systems::DiffDrivePrivate
+{
+  /// \brief Register a model to be controlled by this system instance.
+  /// Sets up the per-model command subscriptions and publishers.
+  /// \param[in] _ecm The EntityComponentManager of the given simulation
+  /// instance.
+  /// \param[in] _modelEntity The model to control.
+  /// \param[in] _sdf SDF element with optional topic overrides, or nullptr
+  /// when registering fleet models, which always use the default topics.
+  public: void RegisterRobot(EntityComponentManager &_ecm,
+    Entity _modelEntity, const std::shared_ptr<const sdf::Element> &_sdf);
+
+  /// \brief In fleet mode, register every model that has all the configured
+  /// wheel joints. The first call scans all models; later calls only
+  /// consider newly created entities.
+  /// \param[in] _ecm The EntityComponentManager of the given simulation
+  /// instance.
+  public: void DiscoverFleetModels(EntityComponentManager &_ecm);
 
   /// \brief Update odometry and publish an odometry message.
   /// \param[in] _info System update information.
@@ -87,11 +151,18 @@ class gz::sim::systems::DiffDrivePrivate
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
-  /// \brief Entity of the left joint
-  public: std::vector<Entity> leftJoints;
+  /// \brief All robots managed by this system instance. A model-attached
+  /// plugin holds exactly one entry. Only the simulation thread grows this
+  /// vector, under \ref mutex so the transport callbacks never observe a
+  /// reallocation.
+  public: std::vector<Robot> robots;
 
-  /// \brief Entity of the right joint
-  public: std::vector<Entity> rightJoints;
+  /// \brief True when attached to the world: one instance manages every
+  /// model that has the configured wheel joints.
+  public: bool fleetMode{false};
+
+  /// \brief Whether the initial fleet scan over pre-existing models ran.
+  public: bool initialFleetScanDone{false};
 
   /// \brief Name of left joint
   public: std::vector<std::string> leftJointNames;
@@ -99,58 +170,23 @@ class gz::sim::systems::DiffDrivePrivate
   /// \brief Name of right joint
   public: std::vector<std::string> rightJointNames;
 
-  /// \brief Calculated speed of left joint
-  public: double leftJointSpeed{0};
-
-  /// \brief Calculated speed of right joint
-  public: double rightJointSpeed{0};
-
   /// \brief Distance between wheels
   public: double wheelSeparation{1.0};
 
   /// \brief Wheel radius
   public: double wheelRadius{0.2};
 
-  /// \brief Model interface
-  public: Model model{kNullEntity};
-
-  /// \brief The model's canonical link.
-  public: Link canonicalLink{kNullEntity};
-
   /// \brief Update period calculated from <odom__publish_frequency>.
   public: std::chrono::steady_clock::duration odomPubPeriod{0};
 
-  /// \brief Last sim time odom was published.
-  public: std::chrono::steady_clock::duration lastOdomPubTime{0};
-
-  /// \brief Diff drive odometry.
-  public: math::DiffDriveOdometry odom;
-
-  /// \brief Diff drive odometry message publisher.
-  public: transport::Node::Publisher odomPub;
-
-  /// \brief Diff drive tf message publisher.
-  public: transport::Node::Publisher tfPub;
-
-  /// \brief Linear velocity limiter.
+  /// \brief Linear velocity limiter. The limiter holds no state, so it is
+  /// shared by all robots; per-robot command history lives in Robot.
   public: std::unique_ptr<math::SpeedLimiter> limiterLin;
 
   /// \brief Angular velocity limiter.
   public: std::unique_ptr<math::SpeedLimiter> limiterAng;
 
-  /// \brief Previous control command.
-  public: Commands last0Cmd;
-
-  /// \brief Previous control command to last0Cmd.
-  public: Commands last1Cmd;
-
-  /// \brief Last target velocity requested.
-  public: msgs::Twist targetVel;
-
-  /// \brief Enable/disable state of the controller.
-  public: bool enabled;
-
-  /// \brief A mutex to protect the target velocity command.
+  /// \brief A mutex to protect the target velocity commands.
   public: std::mutex mutex;
 
   /// \brief frame_id from sdf.
@@ -172,19 +208,22 @@ void DiffDrive::Configure(const Entity &_entity,
     EntityComponentManager &_ecm,
     EventManager &/*_eventMgr*/)
 {
-  this->dataPtr->model = Model(_entity);
-
-  // Get the canonical link
-  std::vector<Entity> links = _ecm.ChildrenByComponents(
-      this->dataPtr->model.Entity(), components::CanonicalLink());
-  if (!links.empty())
-    this->dataPtr->canonicalLink = Link(links[0]);
+  Model model(_entity);
 
-  if (!this->dataPtr->model.Valid(_ecm))
+  if (!model.Valid(_ecm))
   {
-    gzerr << "DiffDrive plugin should be attached to a model entity. "
-           << "Failed to initialize." << std::endl;
-    return;
+    if (_ecm.Component<components::World>(_entity) != nullptr)
+    {
+      // Attached to the world: one instance manages every model that has
+      // the configured wheel joints.
+      this->dataPtr->fleetMode = true;
+    }
+    else
+    {
+      gzerr << "DiffDrive plugin should be attached to a model entity. "
+             << "Failed to initialize." << std::endl;
+      return;
+    }
   }
 
   // Get params from SDF
@@ -328,64 +367,156 @@ void DiffDrive::Configure(const Entity &_entity,
       std::chrono::duration_cast<std::chrono::steady_clock::duration>(odomPer);
   }
 
+  if (_sdf->HasElement("frame_id"))
+    this->dataPtr->sdfFrameId = _sdf->Get<std::string>("frame_id");
+
+  if (_sdf->HasElement("child_frame_id"))
+    this->dataPtr->sdfChildFrameId = _sdf->Get<std::string>("child_frame_id");
+
+  if (this->dataPtr->fleetMode)
+  {
+    // Models are registered from PreUpdate, where newly spawned models are
+    // also picked up.
+    gzmsg << "DiffDrive fleet mode enabled, managing all models with joints ["
+           << (this->dataPtr->leftJointNames.empty() ? "" :
+               this->dataPtr->leftJointNames.front()) << "]/["
+           << (this->dataPtr->rightJointNames.empty() ? "" :
+               this->dataPtr->rightJointNames.front()) << "]" << std::endl;
+  }
+  else
+  {
+    this->dataPtr->RegisterRobot(_ecm, _entity, _sdf);
+  }
+}
+
+//////////////////////////////////////////////////
+void DiffDrivePrivate::RegisterRobot(EntityComponentManager &_ecm,
+    Entity _modelEntity, const std::shared_ptr<const sdf::Element> &_sdf)
+{
+  Robot robot;
+  robot.model = Model(_modelEntity);
+
+  // Get the canonical link
+  std::vector<Entity> links = _ecm.ChildrenByComponents(
+      _modelEntity, components::CanonicalLink());
+  if (!links.empty())
+    robot.canonicalLink = Link(links[0]);
+
   // Setup odometry.
-  this->dataPtr->odom.SetWheelParams(this->dataPtr->wheelSeparation,
-      this->dataPtr->wheelRadius, this->dataPtr->wheelRadius);
+  robot.odom.SetWheelParams(this->wheelSeparation,
+      this->wheelRadius, this->wheelRadius);
+
+  auto modelName = robot.model.Name(_ecm);
+  const std::size_t index = this->robots.size();
 
   // Subscribe to commands
   std::vector<std::string> topics;
-  if (_sdf->HasElement("topic"))
+  if (_sdf && _sdf->HasElement("topic"))
   {
     topics.push_back(_sdf->Get<std::string>("topic"));
   }
-  topics.push_back("/model/" + this->dataPtr->model.Name(_ecm) + "/cmd_vel");
+  topics.push_back("/model/" + modelName + "/cmd_vel");
   auto topic = validTopic(topics);
 
-  this->dataPtr->node.Subscribe(topic, &DiffDrivePrivate::OnCmdVel,
-      this->dataPtr.get());
+  std::function<void(const msgs::Twist &)> cmdCb =
+      [this, index](const msgs::Twist &_msg)
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->robots[index].enabled)
+        {
+          this->robots[index].targetVel = _msg;
+        }
+      };
+  this->node.Subscribe(topic, cmdCb);
 
   // Subscribe to enable/disable
   std::vector<std::string> enableTopics;
-  enableTopics.push_back(
-    "/model/" + this->dataPtr->model.Name(_ecm) + "/enable");
+  enableTopics.push_back("/model/" + modelName + "/enable");
   auto enableTopic = validTopic(enableTopics);
 
   if (!enableTopic.empty())
   {
-    this->dataPtr->node.Subscribe(enableTopic, &DiffDrivePrivate::OnEnable,
-        this->dataPtr.get());
+    std::function<void(const msgs::Boolean &)> enableCb =
+        [this, index](const msgs::Boolean &_msg)
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          Robot &robot = this->robots[index];
+          robot.enabled = _msg.data();
+          if (!robot.enabled)
+          {
+            math::Vector3d zeroVector{0, 0, 0};
+            msgs::Set(robot.targetVel.mutable_linear(), zeroVector);
+            msgs::Set(robot.targetVel.mutable_angular(), zeroVector);
+          }
+        };
+    this->node.Subscribe(enableTopic, enableCb);
   }
-  this->dataPtr->enabled = true;
 
   std::vector<std::string> odomTopics;
-  if (_sdf->HasElement("odom_topic"))
+  if (_sdf && _sdf->HasElement("odom_topic"))
   {
     odomTopics.push_back(_sdf->Get<std::string>("odom_topic"));
   }
-  odomTopics.push_back("/model/" + this->dataPtr->model.Name(_ecm) +
-      "/odometry");
+  odomTopics.push_back("/model/" + modelName + "/odometry");
   auto odomTopic = validTopic(odomTopics);
 
-  this->dataPtr->odomPub = this->dataPtr->node.Advertise<msgs::Odometry>(
-      odomTopic);
+  robot.odomPub = this->node.Advertise<msgs::Odometry>(odomTopic);
 
-  std::string tfTopic{"/model/" + this->dataPtr->model.Name(_ecm) +
-    "/tf"};
-  if (_sdf->HasElement("tf_topic"))
+  std::string tfTopic{"/model/" + modelName + "/tf"};
+  if (_sdf && _sdf->HasElement("tf_topic"))
     tfTopic = _sdf->Get<std::string>("tf_topic");
-  this->dataPtr->tfPub = this->dataPtr->node.Advertise<msgs::Pose_V>(
-      tfTopic);
-
-  if (_sdf->HasElement("frame_id"))
-    this->dataPtr->sdfFrameId = _sdf->Get<std::string>("frame_id");
+  robot.tfPub = this->node.Advertise<msgs::Pose_V>(tfTopic);
 
-  if (_sdf->HasElement("child_frame_id"))
-    this->dataPtr->sdfChildFrameId = _sdf->Get<std::string>("child_frame_id");
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->robots.push_back(std::move(robot));
+  }
 
   gzmsg << "DiffDrive subscribing to twist messages on [" << topic << "]"
          << std::endl;
 }
 
+//////////////////////////////////////////////////
+void DiffDrivePrivate::DiscoverFleetModels(EntityComponentManager &_ecm)
+{
+  auto tryRegister = [&](const Entity &_entity) -> bool
+  {
+    Model model(_entity);
+
+    // Only manage models that have every configured wheel joint.
+    for (const std::string &name : this->leftJointNames)
+    {
+      if (model.JointByName(_ecm, name) == kNullEntity)
+        return true;
+    }
+    for (const std::string &name : this->rightJointNames)
+    {
+      if (model.JointByName(_ecm, name) == kNullEntity)
+        return true;
+    }
+
+    this->RegisterRobot(_ecm, _entity, nullptr);
+    return true;
+  };
+
+  if (!this->initialFleetScanDone)
+  {
+    _ecm.Each<components::Model>(
+        [&](const Entity &_entity, const components::Model *) -> bool
+        {
+          return tryRegister(_entity);
+        });
+    this->initialFleetScanDone = true;
+    return;
+  }
+
+  _ecm.EachNew<components::Model>(
+      [&](const Entity &_entity, const components::Model *) -> bool
+      {
+        return tryRegister(_entity);
+      });
+}
+
 //////////////////////////////////////////////////
 void DiffDrive::PreUpdate(const UpdateInfo &_info,
     EntityComponentManager &_ecm)
@@ -400,18 +531,23 @@ void DiffDrive::PreUpdate(const UpdateInfo &_info,
            << "s]. System may not work properly." << std::endl;
   }
 
+  if (this->dataPtr->fleetMode)
+    this->dataPtr->DiscoverFleetModels(_ecm);
+
   // If the joints haven't been identified yet, look for them
   static std::set<std::string> warnedModels;
-  auto modelName = this->dataPtr->model.Name(_ecm);
-  if (this->dataPtr->leftJoints.empty() ||
-      this->dataPtr->rightJoints.empty())
+  for (Robot &robot : this->dataPtr->robots)
   {
+    if (!robot.leftJoints.empty() && !robot.rightJoints.empty())
+      continue;
+
+    auto modelName = robot.model.Name(_ecm);
     bool warned{false};
     for (const std::string &name : this->dataPtr->leftJointNames)
     {
-      Entity joint = this->dataPtr->model.JointByName(_ecm, name);
+      Entity joint = robot.model.JointByName(_ecm, name);
       if (joint != kNullEntity)
-        this->dataPtr->leftJoints.push_back(joint);
+        robot.leftJoints.push_back(joint);
       else if (warnedModels.find(modelName) == warnedModels.end())
       {
         gzwarn << "Failed to find left joint [" << name << "] for model ["
@@ -422,9 +558,9 @@ void DiffDrive::PreUpdate(const UpdateInfo &_info,
 
     for (const std::string &name : this->dataPtr->rightJointNames)
     {
-      Entity joint = this->dataPtr->model.JointByName(_ecm, name);
+      Entity joint = robot.model.JointByName(_ecm, name);
       if (joint != kNullEntity)
-        this->dataPtr->rightJoints.push_back(joint);
+        robot.rightJoints.push_back(joint);
       else if (warnedModels.find(modelName) == warnedModels.end())
       {
         gzwarn << "Failed to find right joint [" << name << "] for model ["
@@ -436,60 +572,64 @@ void DiffDrive::PreUpdate(const UpdateInfo &_info,
     {
       warnedModels.insert(modelName);
     }
-  }
 
-  if (this->dataPtr->leftJoints.empty() || this->dataPtr->rightJoints.empty())
-    return;
-
-  if (warnedModels.find(modelName) != warnedModels.end())
-  {
-    gzmsg << "Found joints for model [" << modelName
-           << "], plugin will start working." << std::endl;
-    warnedModels.erase(modelName);
+    if (!robot.leftJoints.empty() && !robot.rightJoints.empty() &&
+        warnedModels.find(modelName) != warnedModels.end())
+    {
+      gzmsg << "Found joints for model [" << modelName
+             << "], plugin will start working." << std::endl;
+      warnedModels.erase(modelName);
+    }
   }
 
   // Nothing left to do if paused.
   if (_info.paused)
     return;
 
-  for (Entity joint : this->dataPtr->leftJoints)
+  for (Robot &robot : this->dataPtr->robots)
   {
-    // skip this entity if it has been removed
-    if (!_ecm.HasEntity(joint))
+    if (robot.leftJoints.empty() || robot.rightJoints.empty())
       continue;
 
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->leftJointSpeed});
-  }
+    for (Entity joint : robot.leftJoints)
+    {
+      // skip this entity if it has been removed
+      if (!_ecm.HasEntity(joint))
+        continue;
 
-  for (Entity joint : this->dataPtr->rightJoints)
-  {
-    // skip this entity if it has been removed
-    if (!_ecm.HasEntity(joint))
-      continue;
+      // Update wheel velocity
+      _ecm.SetComponentData<components::JointVelocityCmd>(joint,
+        {robot.leftJointSpeed});
+    }
 
-    // Update wheel velocity
-    _ecm.SetComponentData<components::JointVelocityCmd>(joint,
-      {this->dataPtr->rightJointSpeed});
-  }
+    for (Entity joint : robot.rightJoints)
+    {
+      // skip this entity if it has been removed
+      if (!_ecm.HasEntity(joint))
+        continue;
 
-  // Create the left and right side joint position components if they
-  // don't exist.
-  auto leftPos = _ecm.Component<components::JointPosition>(
-      this->dataPtr->leftJoints[0]);
-  if (!leftPos && _ecm.HasEntity(this->dataPtr->leftJoints[0]))
-  {
-    _ecm.CreateComponent(this->dataPtr->leftJoints[0],
-        components::JointPosition());
-  }
+      // Update wheel velocity
+      _ecm.SetComponentData<components::JointVelocityCmd>(joint,
+        {robot.rightJointSpeed});
+    }
 
-  auto rightPos = _ecm.Component<components::JointPosition>(
-      this->dataPtr->rightJoints[0]);
-  if (!rightPos && _ecm.HasEntity(this->dataPtr->rightJoints[0]))
-  {
-    _ecm.CreateComponent(this->dataPtr->rightJoints[0],
-        components::JointPosition());
+    // Create the left and right side joint position components if they
+    // don't exist.
+    auto leftPos = _ecm.Component<components::JointPosition>(
+        robot.leftJoints[0]);
+    if (!leftPos && _ecm.HasEntity(robot.leftJoints[0]))
+    {
+      _ecm.CreateComponent(robot.leftJoints[0],
+          components::JointPosition());
+    }
+
+    auto rightPos = _ecm.Component<components::JointPosition>(
+        robot.rightJoints[0]);
+    if (!rightPos && _ecm.HasEntity(robot.rightJoints[0]))
+    {
+      _ecm.CreateComponent(robot.rightJoints[0],
+          components::JointPosition());
+    }
   }
 }
 
@@ -511,94 +651,113 @@ void DiffDrivePrivate::UpdateOdometry(const UpdateInfo &_info,
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("DiffDrive::UpdateOdometry");
-  // Initialize, if not already initialized.
-  if (!this->odom.Initialized())
+
+  for (Robot &robot : this->robots)
   {
-    this->odom.Init(std::chrono::steady_clock::time_point(_info.simTime));
-    return;
-  }
+    // Initialize, if not already initialized.
+    if (!robot.odom.Initialized())
+    {
+      robot.odom.Init(std::chrono::steady_clock::time_point(_info.simTime));
+      continue;
+    }
 
-  if (this->leftJoints.empty() || this->rightJoints.empty())
-    return;
+    if (robot.leftJoints.empty() || robot.rightJoints.empty())
+      continue;
 
-  // Get the first joint positions for the left and right side.
-  auto leftPos = _ecm.Component<components::JointPosition>(this->leftJoints[0]);
-  auto rightPos = _ecm.Component<components::JointPosition>(
-      this->rightJoints[0]);
+    // Get the first joint positions for the left and right side.
+    auto leftPos = _ecm.Component<components::JointPosition>(
+        robot.leftJoints[0]);
+    auto rightPos = _ecm.Component<components::JointPosition>(
+        robot.rightJoints[0]);
 
-  // Abort if the joints were not found or just created.
-  if (!leftPos || !rightPos || leftPos->Data().empty() ||
-      rightPos->Data().empty())
-  {
-    return;
-  }
+    // Abort if the joints were not found or just created.
+    if (!leftPos || !rightPos || leftPos->Data().empty() ||
+        rightPos->Data().empty())
+    {
+      continue;
+    }
 
-  this->odom.Update(leftPos->Data()[0], rightPos->Data()[0],
-      std::chrono::steady_clock::time_point(_info.simTime));
+    robot.odom.Update(leftPos->Data()[0], rightPos->Data()[0],
+        std::chrono::steady_clock::time_point(_info.simTime));
 
-  // Throttle publishing
-  auto diff = _info.simTime - this->lastOdomPubTime;
-  if (diff > std::chrono::steady_clock::duration::zero() &&
-      diff < this->odomPubPeriod)
-  {
-    return;
-  }
-  this->lastOdomPubTime = _info.simTime;
+    // Throttle publishing
+    auto diff = _info.simTime - robot.lastOdomPubTime;
+    if (diff > std::chrono::steady_clock::duration::zero() &&
+        diff < this->odomPubPeriod)
+    {
+      continue;
+    }
+    robot.lastOdomPubTime = _info.simTime;
 
-  // Construct the odometry message and publish it.
-  msgs::Odometry msg;
-  msg.mutable_pose()->mutable_position()->set_x(this->odom.X());
-  msg.mutable_pose()->mutable_position()->set_y(this->odom.Y());
+    // The odometry state above is kept up to date regardless, but the
+    // messages are only worth building while someone is subscribed.
+    if (!robot.odomPub.HasConnections() && !robot.tfPub.HasConnections())
+    {
+      continue;
+    }
 
-  math::Quaterniond orientation(0, 0, *this->odom.Heading());
-  msgs::Set(msg.mutable_pose()->mutable_orientation(), orientation);
+    // Construct the odometry message and publish it.
+    msgs::Odometry msg;
+    msg.mutable_pose()->mutable_position()->set_x(robot.odom.X());
+    msg.mutable_pose()->mutable_position()->set_y(robot.odom.Y());
 
-  msg.mutable_twist()->mutable_linear()->set_x(this->odom.LinearVelocity());
-  msg.mutable_twist()->mutable_angular()->set_z(*this->odom.AngularVelocity());
+    math::Quaterniond orientation(0, 0, *robot.odom.Heading());
+    msgs::Set(msg.mutable_pose()->mutable_orientation(), orientation);
 
-  // Set the time stamp in the header
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+    msg.mutable_twist()->mutable_linear()->set_x(robot.odom.LinearVelocity());
+    msg.mutable_twist()->mutable_angular()->set_z(
+        *robot.odom.AngularVelocity());
 
-  // Set the frame id.
-  auto frame = msg.mutable_header()->add_data();
-  frame->set_key("frame_id");
-  if (this->sdfFrameId.empty())
-  {
-    frame->add_value(this->model.Name(_ecm) + "/odom");
-  }
-  else
-  {
-    frame->add_value(this->sdfFrameId);
-  }
+    // Set the time stamp in the header
+    set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
-  std::optional<std::string> linkName = this->canonicalLink.Name(_ecm);
-  if (this->sdfChildFrameId.empty())
-  {
-    if (linkName)
+    // Set the frame id.
+    auto frame = msg.mutable_header()->add_data();
+    frame->set_key("frame_id");
+    if (this->sdfFrameId.empty())
+    {
+      frame->add_value(robot.model.Name(_ecm) + "/odom");
+    }
+    else
+    {
+      frame->add_value(this->sdfFrameId);
+    }
+
+    std::optional<std::string> linkName = robot.canonicalLink.Name(_ecm);
+    if (this->sdfChildFrameId.empty())
+    {
+      if (linkName)
+      {
+        auto childFrame = msg.mutable_header()->add_data();
+        childFrame->set_key("child_frame_id");
+        childFrame->add_value(robot.model.Name(_ecm) + "/" + *linkName);
+      }
+    }
+    else
     {
       auto childFrame = msg.mutable_header()->add_data();
       childFrame->set_key("child_frame_id");
-      childFrame->add_value(this->model.Name(_ecm) + "/" + *linkName);
+      childFrame->add_value(this->sdfChildFrameId);
     }
-  }
-  else
-  {
-    auto childFrame = msg.mutable_header()->add_data();
-    childFrame->set_key("child_frame_id");
-    childFrame->add_value(this->sdfChildFrameId);
-  }
-
-  // Construct the Pose_V/tf message and publish it.
-  msgs::Pose_V tfMsg;
-  msgs::Pose *tfMsgPose = tfMsg.add_pose();
-  tfMsgPose->mutable_header()->CopyFrom(*msg.mutable_header());
-  tfMsgPose->mutable_position()->CopyFrom(msg.mutable_pose()->position());
-  tfMsgPose->mutable_orientation()->CopyFrom(msg.mutable_pose()->orientation());
 
-  // Publish the messages
-  this->odomPub.Publish(msg);
-  this->tfPub.Publish(tfMsg);
+    // Publish the messages. The Pose_V/tf message is only constructed
+    // when its topic has subscribers.
+    robot.odomPub.Publish([&]() -> const msgs::Odometry &
+        {
+          return msg;
+        });
+    robot.tfPub.Publish([&]() -> msgs::Pose_V
+        {
+          msgs::Pose_V tfMsg;
+          msgs::Pose *tfMsgPose = tfMsg.add_pose();
+          tfMsgPose->mutable_header()->CopyFrom(*msg.mutable_header());
+          tfMsgPose->mutable_position()->CopyFrom(
+              msg.mutable_pose()->position());
+          tfMsgPose->mutable_orientation()->CopyFrom(
+              msg.mutable_pose()->orientation());
+          return tfMsg;
+        });
+  }
 }
 
 //////////////////////////////////////////////////
@@ -607,52 +766,29 @@ void DiffDrivePrivate::UpdateVelocity(const UpdateInfo &_info,
 {
   GZ_PROFILE("DiffDrive::UpdateVelocity");
 
-  double linVel;
-  double angVel;
-  {
-    std::lock_guard<std::mutex> lock(this->mutex);
-    linVel = this->targetVel.linear().x();
-    angVel = this->targetVel.angular().z();
-  }
-
-  // Limit the target velocity if needed.
-  this->limiterLin->Limit(
-      linVel, this->last0Cmd.lin, this->last1Cmd.lin, _info.dt);
-  this->limiterAng->Limit(
-      angVel, this->last0Cmd.ang, this->last1Cmd.ang, _info.dt);
-
-  // Update history of commands.
-  this->last1Cmd = last0Cmd;
-  this->last0Cmd.lin = linVel;
-  this->last0Cmd.ang = angVel;
-
-  // Convert the target velocities to joint velocities.
-  this->rightJointSpeed =
-    (linVel + angVel * this->wheelSeparation / 2.0) / this->wheelRadius;
-  this->leftJointSpeed =
-    (linVel - angVel * this->wheelSeparation / 2.0) / this->wheelRadius;
-}
-
-//////////////////////////////////////////////////
-void DiffDrivePrivate::OnCmdVel(const msgs::Twist &_msg)
-{
-  std::lock_guard<std::mutex> lock(this->mutex);
-  if (this->enabled)
-  {
-    this->targetVel = _msg;
-  }
-}
-
-//////////////////////////////////////////////////
-void DiffDrivePrivate::OnEnable(const msgs::Boolean &_msg)
-{
+  // One pass over all robots, holding the command mutex once.
   std::lock_guard<std::mutex> lock(this->mutex);
-  this->enabled = _msg.data();
-  if (!this->enabled)
-  {
-    math::Vector3d zeroVector{0, 0, 0};
-    msgs::Set(this->targetVel.mutable_linear(), zeroVector);
-    msgs::Set(this->targetVel.mutable_angular(), zeroVector);
+  for (Robot &robot : this->robots)
+  {
+    double linVel = robot.targetVel.linear().x();
+    double angVel = robot.targetVel.angular().z();
+
+    // Limit the target velocity if needed.
+    this->limiterLin->Limit(
+        linVel, robot.last0Cmd.lin, robot.last1Cmd.lin, _info.dt);
+    this->limiterAng->Limit(
+        angVel, robot.last0Cmd.ang, robot.last1Cmd.ang, _info.dt);
+
+    // Update history of commands.
+    robot.last1Cmd = robot.last0Cmd;
+    robot.last0Cmd.lin = linVel;
+    robot.last0Cmd.ang = angVel;
+
+    // Convert the target velocities to joint velocities.
+    robot.rightJointSpeed =
+      (linVel + angVel * this->wheelSeparation / 2.0) / this->wheelRadius;
+    robot.leftJointSpeed =
+      (linVel - angVel * this->wheelSeparation / 2.0) / this->wheelRadius;
   }
 }
 
@@ -35,6 +35,17 @@ namespace systems
   /// \brief Differential drive controller which can be attached to a model
   /// with any number of left and right wheels.
   ///
+  /// The plugin may also be attached to the world, which enables fleet
+  /// mode: a single system instance manages every model in the world that
+  /// has all the configured wheel joints, including models spawned after
+  /// startup. Each managed model keeps its own default command and odometry
+  /// topics (`/model/{name_of_model}/...`), but the wheel parameters and
+  /// velocity limits are shared and the wheel speed and odometry updates
+  /// run as one pass over all models. This avoids the per-instance
+  /// overhead of loading one copy of the plugin into each member of a
+  /// large homogeneous fleet. The `<topic>`, `<odom_topic>` and
+  /// `<tf_topic>` overrides are ignored in fleet mode.
+  ///
   /// ## System Parameters
   ///
   /// - `<left_joint>`: Name of a joint that controls a left wheel. This
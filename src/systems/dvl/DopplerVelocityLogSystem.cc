@@ -356,8 +356,12 @@ void DopplerVelocityLogSystem::Implementation::DoPostUpdate(
 
   std::lock_guard<std::mutex> timeLock(this->timeMutex);
 
+  // Without the knownSensorEntities check, a stale nextUpdateTime would keep
+  // snapshotting the world kinematics every step after the last sensor is
+  // destroyed.
   if (!this->perStepRequests.empty() || (
-        !_info.paused && this->nextUpdateTime <= _info.simTime))
+        !_info.paused && !this->knownSensorEntities.empty() &&
+        this->nextUpdateTime <= _info.simTime))
   {
     this->simTime = _info.simTime;
     requests::SetWorldState request;
@@ -249,6 +249,24 @@ void Elevator::PostUpdate(const UpdateInfo &_info,
   this->dataPtr->lastUpdateTime = _info.simTime;
 
   std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  // While no transition is pending, the door timer and joint monitors are
+  // all inactive and the cabin cannot be moving, so the only remaining duty
+  // is the periodic state publication. Skip the ECM queries entirely until
+  // the next publication is due; commands re-activate the state machine from
+  // their own callback.
+  if (!this->dataPtr->doorTimer->IsActive() &&
+      !this->dataPtr->doorJointMonitor.IsActive() &&
+      !this->dataPtr->cabinJointMonitor.IsActive())
+  {
+    auto pubElapsed = _info.simTime - this->dataPtr->lastStatePubTime;
+    if (pubElapsed > std::chrono::steady_clock::duration::zero() &&
+        pubElapsed < this->dataPtr->statePubPeriod)
+      return;
+    this->dataPtr->UpdateState(_info, _ecm);
+    return;
+  }
+
   this->dataPtr->UpdateState(_info, _ecm);
   this->dataPtr->doorTimer->Update(
       _info, this->dataPtr->isDoorwayBlockedStates[this->dataPtr->state]);
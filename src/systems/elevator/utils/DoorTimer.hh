@@ -61,6 +61,10 @@ class DoorTimer
   public: void Configure(const std::chrono::steady_clock::duration &_startTime,
                          const std::function<void()> &_timeoutCallback);
 
+  /// \brief Checks whether the timer is counting down to a timeout
+  /// \return True while the timer is running
+  public: bool IsActive() const;
+
   /// \brief Checks whether the timer has timed out
   /// \param[in] _info Current simulation step info
   /// \param[in] _isDoorwayBlocked Flag that indicates whether the doorway is
@@ -61,6 +61,11 @@ class JointMonitor
       Entity _joint, double _target, double _posEps, double _velEps,
       const std::function<void()> &_jointTargetReachedCallback);
 
+  /// \brief Checks whether the monitor is waiting for a joint to reach its
+  /// target
+  /// \return True while a target is being monitored
+  public: bool IsActive() const;
+
   /// \brief Checks whether the position and velocity of the joint are within
   /// the configured tolerances
   /// \param[in] _ecm Entity component manager
@@ -17,9 +17,16 @@
 #include "EnvironmentPreload.hh"
 #include "VisualizationTool.hh"
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -43,6 +50,204 @@ using namespace sim;
 using namespace systems;
 
 using Units = msgs::DataLoadPathOptions_DataAngularUnits;
+
+namespace
+{
+/// \brief Magic bytes identifying the binary row cache format.
+constexpr char kCacheMagic[8] = {'G', 'Z', 'E', 'N', 'V', 'B', '0', '1'};
+
+/// \brief Check whether a binary row cache exists and is at least as new
+/// as the dataset it was generated from.
+/// \param[in] _cachePath Path to the cache file.
+/// \param[in] _dataPath Path to the source dataset.
+/// \return True if the cache can be used.
+bool RowCacheIsFresh(const std::string &_cachePath,
+    const std::string &_dataPath)
+{
+  std::error_code ec;
+  const auto cacheTime = std::filesystem::last_write_time(_cachePath, ec);
+  if (ec)
+    return false;
+  const auto dataTime = std::filesystem::last_write_time(_dataPath, ec);
+  if (ec)
+    return false;
+  return cacheTime >= dataTime;
+}
+
+/// \brief Write parsed dataset rows to a binary cache. The format is the
+/// magic bytes, the number of data columns, each column name
+/// (length-prefixed), the total number of doubles and the row data as
+/// (time, x, y, z, data columns...) tuples.
+/// \param[in] _path Path to the cache file.
+/// \param[in] _columns Data column names.
+/// \param[in] _rows Flattened row data.
+/// \return True if the cache was fully written.
+bool WriteRowCache(const std::string &_path,
+    const std::vector<std::string> &_columns,
+    const std::vector<double> &_rows)
+{
+  std::ofstream file(_path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open())
+    return false;
+
+  file.write(kCacheMagic, sizeof(kCacheMagic));
+  const uint64_t columnCount = _columns.size();
+  file.write(reinterpret_cast<const char *>(&columnCount),
+      sizeof(columnCount));
+  for (const auto &column : _columns)
+  {
+    const uint64_t length = column.size();
+    file.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    file.write(column.data(), static_cast<std::streamsize>(length));
+  }
+  const uint64_t valueCount = _rows.size();
+  file.write(reinterpret_cast<const char *>(&valueCount), sizeof(valueCount));
+  file.write(reinterpret_cast<const char *>(_rows.data()),
+      static_cast<std::streamsize>(valueCount * sizeof(double)));
+  return file.good();
+}
+
+/// \brief Read dataset rows back from a binary cache.
+/// \param[in] _path Path to the cache file.
+/// \param[out] _columns Data column names.
+/// \param[out] _rows Flattened row data.
+/// \return True if the cache was read and is consistent.
+bool ReadRowCache(const std::string &_path,
+    std::vector<std::string> &_columns, std::vector<double> &_rows)
+{
+  std::ifstream file(_path, std::ios::binary);
+  if (!file.is_open())
+    return false;
+
+  char magic[sizeof(kCacheMagic)];
+  file.read(magic, sizeof(magic));
+  if (!file.good() ||
+      !std::equal(std::begin(magic), std::end(magic), std::begin(kCacheMagic)))
+    return false;
+
+  uint64_t columnCount{0u};
+  file.read(reinterpret_cast<char *>(&columnCount), sizeof(columnCount));
+  if (!file.good() || columnCount == 0u || columnCount > 1024u)
+    return false;
+
+  _columns.resize(columnCount);
+  for (auto &column : _columns)
+  {
+    uint64_t length{0u};
+    file.read(reinterpret_cast<char *>(&length), sizeof(length));
+    if (!file.good() || length > 1024u)
+      return false;
+    column.resize(length);
+    file.read(column.data(), static_cast<std::streamsize>(length));
+    if (!file.good())
+      return false;
+  }
+
+  uint64_t valueCount{0u};
+  file.read(reinterpret_cast<char *>(&valueCount), sizeof(valueCount));
+  if (!file.good() || valueCount % (4u + columnCount) != 0u)
+    return false;
+  _rows.resize(valueCount);
+  file.read(reinterpret_cast<char *>(_rows.data()),
+      static_cast<std::streamsize>(valueCount * sizeof(double)));
+  return file.good();
+}
+
+/// \brief Parse a CSV dataset into flattened rows of
+/// (time, x, y, z, data columns...), using the same column mapping as
+/// common::IO<FrameT>::ReadFrom.
+/// \param[in] _file Stream over the dataset.
+/// \param[in] _timeColumn Name of the time column.
+/// \param[in] _spatialColumns Names of the x, y and z columns.
+/// \param[out] _columns Data column names, in header order.
+/// \param[out] _rows Flattened row data.
+/// \throws std::invalid_argument if the dataset is malformed.
+void ParseCsvRows(std::istream &_file, const std::string &_timeColumn,
+    const std::array<std::string, 3> &_spatialColumns,
+    std::vector<std::string> &_columns, std::vector<double> &_rows)
+{
+  auto it = common::CSVIStreamIterator(_file);
+  const auto end = common::CSVIStreamIterator();
+  if (it == end)
+    throw std::invalid_argument("Dataset is empty");
+
+  const std::vector<std::string> header = *it;
+  constexpr size_t kInvalidIndex = std::numeric_limits<size_t>::max();
+  size_t timeIndex = kInvalidIndex;
+  std::array<size_t, 3> spatialIndices =
+      {kInvalidIndex, kInvalidIndex, kInvalidIndex};
+  std::vector<size_t> dataIndices;
+  for (size_t i = 0; i < header.size(); ++i)
+  {
+    if (header[i] == _timeColumn)
+    {
+      timeIndex = i;
+    }
+    else if (header[i] == _spatialColumns[0])
+    {
+      spatialIndices[0] = i;
+    }
+    else if (header[i] == _spatialColumns[1])
+    {
+      spatialIndices[1] = i;
+    }
+    else if (header[i] == _spatialColumns[2])
+    {
+      spatialIndices[2] = i;
+    }
+    else
+    {
+      dataIndices.push_back(i);
+      _columns.push_back(header[i]);
+    }
+  }
+  if (timeIndex == kInvalidIndex || spatialIndices[0] == kInvalidIndex ||
+      spatialIndices[1] == kInvalidIndex || spatialIndices[2] == kInvalidIndex)
+  {
+    throw std::invalid_argument(
+        "Dataset is missing time or spatial dimension columns");
+  }
+
+  for (++it; it != end; ++it)
+  {
+    const std::vector<std::string> &row = *it;
+    if (row.size() != header.size())
+      throw std::invalid_argument("Dataset row has wrong number of columns");
+    _rows.push_back(std::stod(row[timeIndex]));
+    _rows.push_back(std::stod(row[spatialIndices[0]]));
+    _rows.push_back(std::stod(row[spatialIndices[1]]));
+    _rows.push_back(std::stod(row[spatialIndices[2]]));
+    for (const auto index : dataIndices)
+      _rows.push_back(std::stod(row[index]));
+  }
+}
+
+/// \brief Build an environmental data frame from flattened rows.
+/// \param[in] _columns Data column names.
+/// \param[in] _rows Flattened row data.
+/// \return The populated frame.
+components::EnvironmentalData::FrameT BuildFrame(
+    const std::vector<std::string> &_columns,
+    const std::vector<double> &_rows)
+{
+  using FactoryT =
+      math::InMemoryTimeVaryingVolumetricGridFactory<double, double>;
+  std::vector<FactoryT> factories(_columns.size());
+  const size_t stride = 4u + _columns.size();
+  for (size_t i = 0; i + stride <= _rows.size(); i += stride)
+  {
+    const math::Vector3d position(_rows[i + 1], _rows[i + 2], _rows[i + 3]);
+    for (size_t c = 0; c < _columns.size(); ++c)
+      factories[c].AddPoint(_rows[i], position, _rows[i + 4u + c]);
+  }
+
+  components::EnvironmentalData::FrameT frame;
+  for (size_t c = 0; c < _columns.size(); ++c)
+    frame[_columns[c]] = factories[c].Build();
+  return frame;
+}
+}
+
 //////////////////////////////////////////////////
 class gz::sim::systems::EnvironmentPreloadPrivate
 {
@@ -256,27 +461,52 @@ class gz::sim::systems::EnvironmentPreloadPrivate
         msgs::Convert(this->dataDescription.coordinate_type());
       auto units = this->ConvertUnits(this->dataDescription.units());
 
-      std::ifstream dataFile(this->dataDescription.path());
-      if (!dataFile.is_open())
+      // Large CSV datasets are slow to tokenize and convert, so rows are
+      // cached in a binary sidecar file next to the dataset after the first
+      // parse and read back directly on subsequent loads.
+      const std::string cachePath = this->dataDescription.path() + ".bin";
+      std::vector<std::string> columns;
+      std::vector<double> rows;
+      if (RowCacheIsFresh(cachePath, this->dataDescription.path()) &&
+          ReadRowCache(cachePath, columns, rows))
       {
-        if (this->logFileLoadError)
+        gzmsg << "Loading environment data from binary cache " << cachePath <<
+          std::endl;
+      }
+      else
+      {
+        std::ifstream dataFile(this->dataDescription.path());
+        if (!dataFile.is_open())
         {
-          gzerr << "No environmental data file was found at " <<
-            this->dataDescription.path() << std::endl;
-          logFileLoadError = false;
+          if (this->logFileLoadError)
+          {
+            gzerr << "No environmental data file was found at " <<
+              this->dataDescription.path() << std::endl;
+            logFileLoadError = false;
+          }
+          return;
         }
-        return;
-      }
 
-      gzmsg << "Loading Environment Data " << this->dataDescription.path() <<
-        std::endl;
+        gzmsg << "Loading Environment Data " << this->dataDescription.path() <<
+          std::endl;
+
+        columns.clear();
+        rows.clear();
+        ParseCsvRows(dataFile, this->dataDescription.time(),
+            spatialColumnNames, columns, rows);
+
+        // Best effort: a read-only dataset directory just means the next
+        // load parses the CSV again.
+        if (!WriteRowCache(cachePath, columns, rows))
+        {
+          gzwarn << "Unable to write environment data cache to " << cachePath
+                 << std::endl;
+        }
+      }
 
       using ComponentDataT = components::EnvironmentalData;
       auto data = ComponentDataT::MakeShared(
-          common::IO<ComponentDataT::FrameT>::ReadFrom(
-              common::CSVIStreamIterator(dataFile),
-              common::CSVIStreamIterator(),
-              this->dataDescription.time(), spatialColumnNames),
+          BuildFrame(columns, rows),
           spatialReference, units, this->dataDescription.static_time());
       this->envData = data;
       using ComponentT = components::Environment;
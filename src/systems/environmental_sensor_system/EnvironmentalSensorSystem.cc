@@ -38,6 +38,10 @@
 #include <gz/math/Pose3.hh>
 
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <unordered_set>
@@ -51,6 +55,115 @@ using namespace gz::sim;
 /// "environment_sensor/" in their gz:type field.
 constexpr char SENSOR_TYPE_PREFIX[] =  "environmental_sensor/";
 
+////////////////////////////////////////////////////////////////
+/// \brief Memoizes field lookups within one simulation step. All
+/// environmental sensors of a world share a single cache, so sensors
+/// sampling the same spot of the grid reuse the interpolated value instead
+/// of each re-interpolating it. The memo is cleared whenever simulation
+/// time advances, since the underlying fields may be time-varying.
+class EnvironmentalFieldCache
+{
+  /// \brief Cell size used to quantize sample positions, settable through
+  /// the system's <sample_resolution> tag. Zero keys lookups by exact
+  /// position, so only sensors sampling identical positions share values
+  /// and results are bit-for-bit unchanged.
+  public: double resolution{0.0};
+
+  /// \brief Clear the memo if simulation time has advanced.
+  /// \param[in] _now The current time.
+  public: void NewStep(const std::chrono::steady_clock::duration &_now)
+  {
+    if (_now != this->stamp)
+    {
+      this->values.clear();
+      this->stamp = _now;
+    }
+  }
+
+  /// \brief Look for a memoized value.
+  /// \param[in] _field Field name.
+  /// \param[in] _position Sample position in grid coordinates.
+  /// \return The memoized lookup result, or nullopt on a cache miss. Note
+  /// that a memoized result may itself be nullopt, e.g. for positions
+  /// outside of the field.
+  public: std::optional<std::optional<double>> Find(
+    const std::string &_field, const math::Vector3d &_position) const
+  {
+    auto iter = this->values.find(this->KeyFor(_field, _position));
+    if (iter == this->values.end())
+      return std::nullopt;
+    return iter->second;
+  }
+
+  /// \brief Memoize a lookup result.
+  /// \param[in] _field Field name.
+  /// \param[in] _position Sample position in grid coordinates.
+  /// \param[in] _value The lookup result.
+  public: void Store(const std::string &_field,
+    const math::Vector3d &_position, const std::optional<double> &_value)
+  {
+    // Bound the memory used within a step; once full, lookups simply stop
+    // being shared.
+    if (this->values.size() >= kMaxEntries)
+      return;
+    this->values[this->KeyFor(_field, _position)] = _value;
+  }
+
+  /// \brief Key identifying one sample: the field and the quantized
+  /// sample position.
+  private: struct Key
+  {
+    std::string field;
+    int64_t x, y, z;
+
+    bool operator==(const Key &_other) const
+    {
+      return this->x == _other.x && this->y == _other.y &&
+             this->z == _other.z && this->field == _other.field;
+    }
+  };
+
+  private: struct KeyHash
+  {
+    std::size_t operator()(const Key &_key) const
+    {
+      return std::hash<std::string>()(_key.field) ^
+             static_cast<std::size_t>(_key.x * 73856093) ^
+             static_cast<std::size_t>(_key.y * 19349663) ^
+             static_cast<std::size_t>(_key.z * 83492791);
+    }
+  };
+
+  /// \brief Quantize one coordinate. Without a resolution the exact bit
+  /// pattern is used, which makes the cache lossless.
+  private: int64_t Quantize(double _v) const
+  {
+    if (this->resolution > 0.0)
+      return static_cast<int64_t>(std::floor(_v / this->resolution));
+
+    int64_t bits;
+    std::memcpy(&bits, &_v, sizeof(bits));
+    return bits;
+  }
+
+  private: Key KeyFor(const std::string &_field,
+    const math::Vector3d &_position) const
+  {
+    return Key{_field, this->Quantize(_position.X()),
+        this->Quantize(_position.Y()), this->Quantize(_position.Z())};
+  }
+
+  /// \brief Maximum number of memoized samples per step.
+  private: static constexpr std::size_t kMaxEntries{65536};
+
+  /// \brief Memoized lookups of the current step.
+  private: std::unordered_map<Key, std::optional<double>, KeyHash> values;
+
+  /// \brief Time the memoized lookups were taken at.
+  private: std::chrono::steady_clock::duration stamp{
+    std::chrono::steady_clock::duration::min()};
+};
+
 ////////////////////////////////////////////////////////////////
 /// \brief Envirtonment Sensor used for looking up environment values in our
 /// CSV file.
@@ -216,8 +329,26 @@ class EnvironmentalSensor : public gz::sensors::Sensor
 
       if (!this->session[i].has_value()) return false;
 
-      dataPoints[i] = this->gridField->frame[this->fieldName[i]].LookUp(
-        this->session[i].value(), this->position);
+      // Share interpolated values with the other sensors through the
+      // system-wide cache.
+      std::optional<std::optional<double>> cached;
+      if (this->fieldCache)
+        cached = this->fieldCache->Find(this->fieldName[i], this->position);
+
+      if (cached.has_value())
+      {
+        dataPoints[i] = cached.value();
+      }
+      else
+      {
+        dataPoints[i] = this->gridField->frame[this->fieldName[i]].LookUp(
+          this->session[i].value(), this->position);
+        if (this->fieldCache)
+        {
+          this->fieldCache->Store(this->fieldName[i], this->position,
+            dataPoints[i]);
+        }
+      }
     }
 
     if (this->numberOfFields == 1) {
@@ -349,6 +480,15 @@ class EnvironmentalSensor : public gz::sensors::Sensor
     return fieldName[0];
   }
 
+  ////////////////////////////////////////////////////////////////
+  /// \brief Set the lookup cache shared by all sensors of the system.
+  /// \param[in] _cache The cache.
+  public: void SetFieldCache(
+    const std::shared_ptr<EnvironmentalFieldCache> &_cache)
+  {
+    this->fieldCache = _cache;
+  }
+
   private: bool ready {false};
   private: math::Vector3d position, velocity;
   private: math::Pose3d objectPose;
@@ -358,6 +498,7 @@ class EnvironmentalSensor : public gz::sensors::Sensor
   private: std::optional<gz::math::InMemorySession<double, double>> session[3];
   private: std::shared_ptr<gz::sim::components::EnvironmentalData>
     gridField;
+  private: std::shared_ptr<EnvironmentalFieldCache> fieldCache;
   private: TransformType transformType{TransformType::GLOBAL};
 };
 
@@ -386,6 +527,10 @@ class gz::sim::EnvironmentalSensorSystemPrivate {
   public: Entity worldEntity;
 
   public: bool useSphericalCoords{false};
+
+  /// \brief Lookup cache shared by all sensors of this system.
+  public: std::shared_ptr<EnvironmentalFieldCache> fieldCache =
+    std::make_shared<EnvironmentalFieldCache>();
 };
 
 
@@ -399,11 +544,25 @@ EnvironmentalSensorSystem::EnvironmentalSensorSystem () :
 ////////////////////////////////////////////////////////////////
 void EnvironmentalSensorSystem::Configure(
   const gz::sim::Entity &_entity,
-  const std::shared_ptr<const sdf::Element> &/*_sdf*/,
+  const std::shared_ptr<const sdf::Element> &_sdf,
   gz::sim::EntityComponentManager &/*_ecm*/,
   gz::sim::EventManager &/*_eventMgr*/)
 {
   dataPtr->worldEntity = _entity;
+
+  if (_sdf->HasElement("sample_resolution"))
+  {
+    auto resolution = _sdf->Get<double>("sample_resolution");
+    if (resolution < 0.0)
+    {
+      gzwarn << "Ignoring negative <sample_resolution> ["
+        << resolution << "]" << std::endl;
+    }
+    else
+    {
+      dataPtr->fieldCache->resolution = resolution;
+    }
+  }
 }
 
 ////////////////////////////////////////////////////////////////
@@ -462,6 +621,8 @@ void EnvironmentalSensorSystem::PreUpdate(const gz::sim::UpdateInfo &_info,
 
         enableComponent<components::WorldLinearVelocity>(_ecm, _entity);
 
+        sensor->SetFieldCache(this->dataPtr->fieldCache);
+
         // Keep track of this sensor
         this->dataPtr->entitySensorMap.insert(std::make_pair(_entity,
             std::move(sensor)));
@@ -485,6 +646,7 @@ void EnvironmentalSensorSystem::PostUpdate(const gz::sim::UpdateInfo &_info,
   // Only update and publish if not paused.
   if (!_info.paused)
   {
+    this->dataPtr->fieldCache->NewStep(_info.simTime);
 
     for (auto &[entity, sensor] : this->dataPtr->entitySensorMap)
     {
@@ -64,6 +64,14 @@ class EnvironmentalSensorSystemPrivate;
 ///      * ADD_VELOCITY_LOCAL - Transform to local frame and account for sensor
 ///          velocity. If you're working with wind or ocean currents, this is
 ///          probably the option you want.
+///
+/// The system itself accepts the following tag in the world file:
+///  <sample_resolution> - Sensors of one world share the interpolated field
+///    values they look up within a step. By default only sensors sampling
+///    the exact same position share a value. Setting a resolution (in grid
+///    coordinate units) quantizes the sample positions to cells of that
+///    size, so nearby sensors also share values at the cost of some spatial
+///    accuracy. [Optional, defaults to 0]
 class EnvironmentalSensorSystem:
   public gz::sim::System,
   public gz::sim::ISystemConfigure,
@@ -228,14 +228,16 @@ void FollowActor::PreUpdate(const UpdateInfo &_info,
   auto dir = targetPose.Pos() - actorPose.Pos();
   dir.Z(0);
 
+  double distance = dir.Length();
+
   // Stop if too close to target
-  if (dir.Length() <= this->dataPtr->minDistance)
+  if (distance <= this->dataPtr->minDistance)
   {
     return;
   }
 
   // Stop following if too far from target
-  if (dir.Length() > this->dataPtr->maxDistance)
+  if (distance > this->dataPtr->maxDistance)
   {
     if (this->dataPtr->following)
     {
@@ -254,7 +256,9 @@ void FollowActor::PreUpdate(const UpdateInfo &_info,
     this->dataPtr->following = true;
   }
 
-  dir.Normalize();
+  // Reuse the distance computed above rather than normalizing, which would
+  // recompute the length.
+  dir /= distance;
 
   // Towards target
   math::Angle yaw = atan2(dir.Y(), dir.X());
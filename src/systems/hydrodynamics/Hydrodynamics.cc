@@ -15,6 +15,7 @@
  *
  */
 #include <string>
+#include <vector>
 
 #include <Eigen/Eigen>
 
@@ -76,8 +77,8 @@ class gz::sim::systems::HydrodynamicsPrivateData
   /// See: https://en.wikipedia.org/wiki/Added_mass
   public: Eigen::MatrixXd Ma;
 
-  /// \brief Previous state.
-  public: Eigen::VectorXd prevState;
+  /// \brief Previous state, one column per link.
+  public: Eigen::MatrixXd prevStates;
 
   /// \brief Previous derivative of the state
   public: Eigen::VectorXd prevStateDot;
@@ -93,8 +94,8 @@ class gz::sim::systems::HydrodynamicsPrivateData
 
   public: std::optional<gz::math::InMemorySession<double, double>> session[3];
 
-  /// \brief Link entity
-  public: Entity linkEntity;
+  /// \brief Links the hydrodynamic forces act upon
+  public: std::vector<Entity> linkEntities;
 
   /// \brief Ocean current callback
   public: void UpdateCurrent(const msgs::Vector3d &_msg);
@@ -396,12 +397,19 @@ void Hydrodynamics::Configure(
       << " plugin to act upon";
     return;
   }
-  auto linkName = _sdf->Get<std::string>("link_name");
-  this->dataPtr->linkEntity = model.LinkByName(_ecm, linkName);
-  if (!_ecm.HasEntity(this->dataPtr->linkEntity))
+  // All hydrodynamic links of the model may be listed in a single plugin
+  // instance, so that their forces are computed together in one pass.
+  for (auto elem = _sdf->FindElement("link_name"); elem;
+      elem = elem->GetNextElement("link_name"))
   {
-    gzerr << "Link name" << linkName << "does not exist";
-    return;
+    auto linkName = elem->Get<std::string>();
+    auto linkEntity = model.LinkByName(_ecm, linkName);
+    if (!_ecm.HasEntity(linkEntity))
+    {
+      gzerr << "Link name" << linkName << "does not exist";
+      continue;
+    }
+    this->dataPtr->linkEntities.push_back(linkEntity);
   }
 
   if(_sdf->HasElement("default_current"))
@@ -409,7 +417,8 @@ void Hydrodynamics::Configure(
     this->dataPtr->currentVector = _sdf->Get<math::Vector3d>("default_current");
   }
 
-  this->dataPtr->prevState = Eigen::VectorXd::Zero(6);
+  this->dataPtr->prevStates = Eigen::MatrixXd::Zero(6,
+      this->dataPtr->linkEntities.size());
 
   if(_sdf->HasElement("lookup_current_x"))
   {
@@ -433,9 +442,12 @@ void Hydrodynamics::Configure(
   }
 
 
-  AddWorldPose(this->dataPtr->linkEntity, _ecm);
-  AddAngularVelocityComponent(this->dataPtr->linkEntity, _ecm);
-  AddWorldLinearVelocity(this->dataPtr->linkEntity, _ecm);
+  for (const auto &linkEntity : this->dataPtr->linkEntities)
+  {
+    AddWorldPose(linkEntity, _ecm);
+    AddAngularVelocityComponent(linkEntity, _ecm);
+    AddWorldLinearVelocity(linkEntity, _ecm);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -451,141 +463,153 @@ void Hydrodynamics::PreUpdate(
   if (_info.paused)
     return;
 
+  const auto numLinks = this->dataPtr->linkEntities.size();
+  if (numLinks == 0)
+    return;
+
   // These variables follow Fossen's scheme in "Guidance and Control
-  // of Ocean Vehicles." The `state` vector contains the ship's current velocity
-  // in the format [x_vel, y_vel, z_vel, roll_vel, pitch_vel, yaw_vel].
-  // `stateDot` consists of the first derivative in time of the state vector.
-  // `Cmat` corresponds to the Centripetal matrix
-  // `Dmat` is the drag matrix
-  // `Ma` is the added mass.
-  Eigen::VectorXd stateDot = Eigen::VectorXd(6);
-  Eigen::VectorXd state    = Eigen::VectorXd(6);
-  Eigen::MatrixXd Cmat     = Eigen::MatrixXd::Zero(6, 6);
-  Eigen::MatrixXd Dmat     = Eigen::MatrixXd::Zero(6, 6);
-
-  // Get vehicle state
-  gz::sim::Link baseLink(this->dataPtr->linkEntity);
-  auto linearVelocity =
-    _ecm.Component<components::WorldLinearVelocity>(this->dataPtr->linkEntity);
-  auto rotationalVelocity = baseLink.WorldAngularVelocity(_ecm);
-
-  if (!linearVelocity)
+  // of Ocean Vehicles." Each column of `states` contains one link's current
+  // velocity in the format [x_vel, y_vel, z_vel, roll_vel, pitch_vel,
+  // yaw_vel]. `statesDot` consists of the first derivative in time of the
+  // states. `Cmat` corresponds to the Centripetal matrix, `Dmat` is the
+  // drag matrix and `Ma` is the added mass.
+
+  // Gather phase: read every link's pose and velocities into
+  // column-per-link buffers so the force model below runs over contiguous
+  // data in one pass.
+  Eigen::MatrixXd states(6, numLinks);
+  std::vector<math::Pose3d> poses(numLinks);
+  for (std::size_t i = 0; i < numLinks; ++i)
   {
-    gzerr << "no linear vel" <<"\n";
-    return;
-  }
+    gz::sim::Link link(this->dataPtr->linkEntities[i]);
+    auto linearVelocity = _ecm.Component<components::WorldLinearVelocity>(
+        this->dataPtr->linkEntities[i]);
+    auto rotationalVelocity = link.WorldAngularVelocity(_ecm);
+    auto pose = link.WorldPose(_ecm);
 
-  // Get current vector
-  math::Vector3d currentVector(0, 0, 0);
+    if (!linearVelocity || !rotationalVelocity || !pose)
+    {
+      gzerr << "no linear vel" <<"\n";
+      return;
+    }
 
-  if (this->dataPtr->useCurrentTable)
-  {
-    auto position = baseLink.WorldInertialPose(_ecm);
-    if (position.has_value())
+    // Get current vector
+    math::Vector3d currentVector(0, 0, 0);
+    if (this->dataPtr->useCurrentTable)
     {
-      currentVector = this->dataPtr->GetWaterCurrentFromEnvironment(
-        _ecm, _info.simTime, position.value().Pos());
+      auto position = link.WorldInertialPose(_ecm);
+      if (position.has_value())
+      {
+        currentVector = this->dataPtr->GetWaterCurrentFromEnvironment(
+          _ecm, _info.simTime, position.value().Pos());
+      }
     }
+    else
+    {
+      std::lock_guard lock(this->dataPtr->mtx);
+      currentVector = this->dataPtr->currentVector;
+    }
+
+    // Transform state to local frame. Since we are transforming angular and
+    // linear velocity we only care about rotation. Also this is where we
+    // apply the effects of current to the link.
+    auto localLinearVelocity = pose->Rot().Inverse() *
+      (linearVelocity->Data() - currentVector);
+    auto localRotationalVelocity = pose->Rot().Inverse() *
+      (*rotationalVelocity);
+
+    poses[i] = pose.value();
+    states.col(i) << localLinearVelocity.X(), localLinearVelocity.Y(),
+        localLinearVelocity.Z(), localRotationalVelocity.X(),
+        localRotationalVelocity.Y(), localRotationalVelocity.Z();
   }
-  else
-  {
-    std::lock_guard lock(this->dataPtr->mtx);
-    currentVector = this->dataPtr->currentVector;
-  }
-  // Transform state to local frame
-  auto pose = baseLink.WorldPose(_ecm);
-  // Since we are transforming angular and linear velocity we only care about
-  // rotation. Also this is where we apply the effects of current to the link
-  auto localLinearVelocity = pose->Rot().Inverse() *
-    (linearVelocity->Data() - currentVector);
-  auto localRotationalVelocity = pose->Rot().Inverse() * *rotationalVelocity;
-
-  state(0) = localLinearVelocity.X();
-  state(1) = localLinearVelocity.Y();
-  state(2) = localLinearVelocity.Z();
-
-  state(3) = localRotationalVelocity.X();
-  state(4) = localRotationalVelocity.Y();
-  state(5) = localRotationalVelocity.Z();
 
   auto dt = static_cast<double>(_info.dt.count())/1e9;
-  stateDot = (state - this->dataPtr->prevState)/dt;
+  const Eigen::MatrixXd statesDot = (states - this->dataPtr->prevStates)/dt;
 
-  this->dataPtr->prevState = state;
+  this->dataPtr->prevStates = states;
 
-  // The added mass
+  // The added mass of all links in a single product
   // Negative sign signifies the behaviour change
-  const Eigen::VectorXd kAmassVec = - this->dataPtr->Ma * stateDot;
-
-  // Coriolis and Centripetal forces for under water vehicles (Fossen P. 37)
-  // Note: this is significantly different from VRX because we need to account
-  // for the under water vehicle's additional DOF. We are just considering
-  // diagonal terms here. Have yet to add the cross terms here. Also note, since
-  // $M_a(0,0) = \dot X_u $ , $M_a(1,1) = \dot Y_v $ and so forth, we simply
-  // load the stability derivatives from $M_a$.
-  Cmat(0, 4) = - this->dataPtr->Ma(2, 2) * state(2);
-  Cmat(0, 5) = - this->dataPtr->Ma(1, 1) * state(1);
-  Cmat(1, 3) =   this->dataPtr->Ma(2, 2) * state(2);
-  Cmat(1, 5) = - this->dataPtr->Ma(0, 0) * state(0);
-  Cmat(2, 3) = - this->dataPtr->Ma(1, 1) * state(1);
-  Cmat(2, 4) =   this->dataPtr->Ma(0, 0) * state(0);
-  Cmat(3, 1) = - this->dataPtr->Ma(2, 2) * state(2);
-  Cmat(3, 2) =   this->dataPtr->Ma(1, 1) * state(1);
-  Cmat(3, 4) = - this->dataPtr->Ma(5, 5) * state(5);
-  Cmat(3, 5) =   this->dataPtr->Ma(4, 4) * state(4);
-  Cmat(4, 0) =   this->dataPtr->Ma(2, 2) * state(2);
-  Cmat(4, 2) = - this->dataPtr->Ma(0, 0) * state(0);
-  Cmat(4, 3) =   this->dataPtr->Ma(5, 5) * state(5);
-  Cmat(4, 5) = - this->dataPtr->Ma(3, 3) * state(3);
-  Cmat(5, 0) =   this->dataPtr->Ma(2, 2) * state(2);
-  Cmat(5, 1) =   this->dataPtr->Ma(0, 0) * state(0);
-  Cmat(5, 3) = - this->dataPtr->Ma(4, 4) * state(4);
-  Cmat(5, 4) =   this->dataPtr->Ma(3, 3) * state(3);
-  const Eigen::VectorXd kCmatVec = - Cmat * state;
-
-  // Damping forces
-  for(int i = 0; i < 6; i++)
+  const Eigen::MatrixXd kAmass = - this->dataPtr->Ma * statesDot;
+
+  // Damping forces. The 6x6x6 stability derivative tensors are mapped as
+  // 36x6 matrices, so two products against the state columns produce the
+  // damping matrices of every link at once and Eigen can vectorize across
+  // links instead of looping over 216 scalar terms per link.
+  using DerivativeTensor = Eigen::Matrix<double, 36, 6, Eigen::RowMajor>;
+  Eigen::Map<const DerivativeTensor> quadraticDerivative(
+      this->dataPtr->stabilityQuadraticDerivative);
+  Eigen::Map<const DerivativeTensor> quadraticAbsDerivative(
+      this->dataPtr->stabilityQuadraticAbsDerivative);
+  Eigen::Map<const Eigen::Matrix<double, 36, 1>> linearTerms(
+      this->dataPtr->stabilityLinearTerms);
+
+  // Row i*6+j holds Dmat(i, j) of every link.
+  const Eigen::MatrixXd dampingCoeffs =
+      (-linearTerms).replicate(1, numLinks)
+      - quadraticDerivative * states
+      - quadraticAbsDerivative * states.cwiseAbs();
+
+  // Writeback phase: combine the per-link wrenches and apply them.
+  for (std::size_t i = 0; i < numLinks; ++i)
   {
-    for(int j = 0; j < 6; j++)
+    const Eigen::VectorXd state = states.col(i);
+
+    // Coriolis and Centripetal forces for under water vehicles (Fossen
+    // P. 37). Note: this is significantly different from VRX because we
+    // need to account for the under water vehicle's additional DOF. We are
+    // just considering diagonal terms here. Have yet to add the cross terms
+    // here. Also note, since $M_a(0,0) = \dot X_u $ ,
+    // $M_a(1,1) = \dot Y_v $ and so forth, we simply load the stability
+    // derivatives from $M_a$.
+    Eigen::Matrix<double, 6, 6> Cmat = Eigen::Matrix<double, 6, 6>::Zero();
+    Cmat(0, 4) = - this->dataPtr->Ma(2, 2) * state(2);
+    Cmat(0, 5) = - this->dataPtr->Ma(1, 1) * state(1);
+    Cmat(1, 3) =   this->dataPtr->Ma(2, 2) * state(2);
+    Cmat(1, 5) = - this->dataPtr->Ma(0, 0) * state(0);
+    Cmat(2, 3) = - this->dataPtr->Ma(1, 1) * state(1);
+    Cmat(2, 4) =   this->dataPtr->Ma(0, 0) * state(0);
+    Cmat(3, 1) = - this->dataPtr->Ma(2, 2) * state(2);
+    Cmat(3, 2) =   this->dataPtr->Ma(1, 1) * state(1);
+    Cmat(3, 4) = - this->dataPtr->Ma(5, 5) * state(5);
+    Cmat(3, 5) =   this->dataPtr->Ma(4, 4) * state(4);
+    Cmat(4, 0) =   this->dataPtr->Ma(2, 2) * state(2);
+    Cmat(4, 2) = - this->dataPtr->Ma(0, 0) * state(0);
+    Cmat(4, 3) =   this->dataPtr->Ma(5, 5) * state(5);
+    Cmat(4, 5) = - this->dataPtr->Ma(3, 3) * state(3);
+    Cmat(5, 0) =   this->dataPtr->Ma(2, 2) * state(2);
+    Cmat(5, 1) =   this->dataPtr->Ma(0, 0) * state(0);
+    Cmat(5, 3) = - this->dataPtr->Ma(4, 4) * state(4);
+    Cmat(5, 4) =   this->dataPtr->Ma(3, 3) * state(3);
+    const Eigen::VectorXd kCmatVec = - Cmat * state;
+
+    Eigen::Map<const Eigen::Matrix<double, 6, 6, Eigen::RowMajor>> Dmat(
+        dampingCoeffs.col(i).data());
+    const Eigen::VectorXd kDvec = Dmat * state;
+
+    Eigen::VectorXd kTotalWrench = kDvec;
+
+    if (!this->dataPtr->disableAddedMass)
     {
-      auto coeff = - this->dataPtr->stabilityLinearTerms[i * 6 + j];
-      for(int k = 0; k < 6; k++)
-      {
-        auto index = i * 36 + j * 6 + k;
-        auto absCoeff =
-          this->dataPtr->stabilityQuadraticAbsDerivative[index] * abs(state(k));
-        coeff -= absCoeff;
-        auto velCoeff =
-          this->dataPtr->stabilityQuadraticDerivative[index] * state(k);
-        coeff -= velCoeff;
-      }
-
-      Dmat(i, j) = coeff;
+      kTotalWrench += kAmass.col(i);
+    }
+    if (!this->dataPtr->disableCoriolis)
+    {
+      kTotalWrench += kCmatVec;
     }
-  }
-
-  const Eigen::VectorXd kDvec = Dmat * state;
 
-  Eigen::VectorXd kTotalWrench = kDvec;
+    math::Vector3d totalForce(
+      -kTotalWrench(0),  -kTotalWrench(1), -kTotalWrench(2));
+    math::Vector3d totalTorque(
+      -kTotalWrench(3),  -kTotalWrench(4), -kTotalWrench(5));
 
-  if (!this->dataPtr->disableAddedMass)
-  {
-    kTotalWrench += kAmassVec;
+    gz::sim::Link link(this->dataPtr->linkEntities[i]);
+    link.AddWorldWrench(
+      _ecm,
+      poses[i].Rot()*(totalForce),
+      poses[i].Rot()*totalTorque);
   }
-  if (!this->dataPtr->disableCoriolis)
-  {
-    kTotalWrench += kCmatVec;
-  }
-
-  math::Vector3d totalForce(
-    -kTotalWrench(0),  -kTotalWrench(1), -kTotalWrench(2));
-  math::Vector3d totalTorque(
-    -kTotalWrench(3),  -kTotalWrench(4), -kTotalWrench(5));
-
-  baseLink.AddWorldWrench(
-    _ecm,
-    pose->Rot()*(totalForce),
-    pose->Rot()*totalTorque);
 }
 
 /////////////////////////////////////////////////
@@ -91,7 +91,9 @@ namespace systems
   ///   * <water_density> - The density of the fluid its moving in.
   ///     Defaults to 998kgm^-3. [kgm^-3]
   ///   * <link_name> - The link of the model that is being subject to
-  ///     hydrodynamic forces. [Required]
+  ///     hydrodynamic forces. May be repeated to act on several links that
+  ///     share the same coefficients; their forces are then computed
+  ///     together in one batched pass. [Required]
   ///   * <namespace> - This allows the robot to have an individual namespace
   ///     for current. This is useful when you have multiple vehicles in
   ///     different locations and you wish to set the currents of each vehicle
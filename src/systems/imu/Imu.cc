@@ -63,6 +63,12 @@ class gz::sim::systems::ImuPrivate
   /// `PreUpdate`.
   public: std::unordered_set<Entity> newSensors;
 
+  /// \brief Sensors that are due for a measurement this step and have
+  /// subscribers. Gathered once per step so that state is only scattered
+  /// into the sensors that will actually publish. Kept as a member to
+  /// reuse its allocation.
+  public: std::unordered_set<Entity> dueSensors;
+
   /// \brief Keep track of world ID, which is equivalent to the scene's
   /// root visual.
   /// Defaults to zero, which is considered invalid by Gazebo.
@@ -145,28 +151,34 @@ void Imu::PostUpdate(const UpdateInfo &_info,
   // Only update and publish if not paused.
   if (!_info.paused)
   {
-    // check to see if update is necessary
-    // we only update if there is at least one sensor that needs data
-    // and that sensor has subscribers.
+    // Gather the sensors that need data this step: due for a measurement
+    // and with subscribers. State is only scattered into these sensors,
+    // so with many IMUs at different rates each step only pays for the
+    // sensors that will actually publish.
     // note: gz-sensors does its own throttling. Here the check is mainly
     // to avoid doing work in the ImuPrivate::Update function
-    bool needsUpdate = false;
+    this->dataPtr->dueSensors.clear();
     for (auto &it : this->dataPtr->entitySensorMap)
     {
       if (it.second->NextDataUpdateTime() <= _info.simTime &&
           it.second->HasConnections())
       {
-        needsUpdate = true;
-        break;
+        this->dataPtr->dueSensors.insert(it.first);
       }
     }
-    if (!needsUpdate)
+    if (this->dataPtr->dueSensors.empty())
       return;
 
     this->dataPtr->Update(_ecm);
 
     for (auto &it : this->dataPtr->entitySensorMap)
     {
+      if (this->dataPtr->dueSensors.find(it.first) ==
+          this->dataPtr->dueSensors.end())
+      {
+        continue;
+      }
+
       // Update measurement time
       it.second->Update(_info.simTime, false);
     }
@@ -313,6 +325,10 @@ void ImuPrivate::Update(const EntityComponentManager &_ecm)
         const components::AngularVelocity *_angularVel,
         const components::LinearAcceleration *_linearAccel)->bool
       {
+        // Skip sensors that aren't publishing this step.
+        if (this->dueSensors.find(_entity) == this->dueSensors.end())
+          return true;
+
         auto it = this->entitySensorMap.find(_entity);
         if (it != this->entitySensorMap.end())
         {
@@ -21,6 +21,7 @@
 #include <gz/msgs/actuators.pb.h>
 #include <gz/msgs/double.pb.h>
 
+#include <algorithm>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -52,6 +53,13 @@ class gz::sim::systems::JointPositionControllerPrivate
   /// \param[in] _msg Position message
   public: void OnActuatorPos(const msgs::Actuators &_msg);
 
+  /// \brief Run one multi-joint control step: compute all joint errors in
+  /// one pass over contiguous arrays and write one command per joint.
+  /// \param[in] _info Update info.
+  /// \param[in] _ecm Entity component manager.
+  public: void MultiJointUpdate(const UpdateInfo &_info,
+      EntityComponentManager &_ecm);
+
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
@@ -97,6 +105,22 @@ class gz::sim::systems::JointPositionControllerPrivate
 
   /// \brief Joint position mode
   public: OperationMode mode = OperationMode::PID;
+
+  /// \brief True when one instance controls several joints independently,
+  /// instead of applying the same command to every listed joint.
+  public: bool multiJoint{false};
+
+  /// \brief Per-joint position targets in joint order, taken from the
+  /// Actuators position array. Protected by jointCmdMutex.
+  public: std::vector<double> multiJointPosCmds;
+
+  /// \brief Per-joint PID state, one entry per controlled joint, all
+  /// initialized from the configured gains.
+  public: std::vector<math::PID> multiJointPids;
+
+  /// \brief Scratch array of per-joint position errors. Member so the
+  /// control step doesn't allocate.
+  public: std::vector<double> multiJointErrors;
 };
 
 //////////////////////////////////////////////////
@@ -121,6 +145,11 @@ void JointPositionController::Configure(const Entity &_entity,
   }
 
   // Get params from SDF
+  if (_sdf->HasElement("multi_joint"))
+  {
+    this->dataPtr->multiJoint = _sdf->Get<bool>("multi_joint");
+  }
+
   auto sdfElem = _sdf->FindElement("joint_name");
   while (sdfElem)
   {
@@ -134,7 +163,7 @@ void JointPositionController::Configure(const Entity &_entity,
     }
     sdfElem = sdfElem->GetNextElement("joint_name");
   }
-  if (this->dataPtr->jointNames.empty())
+  if (this->dataPtr->jointNames.empty() && !this->dataPtr->multiJoint)
   {
     gzerr << "Failed to get any <joint_name>." << std::endl;
     return;
@@ -222,7 +251,16 @@ void JointPositionController::Configure(const Entity &_entity,
     }
   }
 
+  if (this->dataPtr->multiJoint)
+  {
+    // Multi-joint control always takes an Actuators message whose
+    // position array follows the controlled joint order.
+    this->dataPtr->useActuatorMsg = true;
+  }
+
   // Subscribe to commands
+  const std::string firstJointName = this->dataPtr->jointNames.empty() ?
+      std::string("all") : this->dataPtr->jointNames[0];
   std::string topic;
   if ((!_sdf->HasElement("sub_topic")) && (!_sdf->HasElement("topic"))
     && (!this->dataPtr->useActuatorMsg))
@@ -242,11 +280,13 @@ void JointPositionController::Configure(const Entity &_entity,
   if ((!_sdf->HasElement("sub_topic")) && (!_sdf->HasElement("topic"))
     && (this->dataPtr->useActuatorMsg))
   {
-    topic = transport::TopicUtils::AsValidTopic("/actuators");
+    topic = transport::TopicUtils::AsValidTopic(this->dataPtr->multiJoint ?
+        "/model/" + this->dataPtr->model.Name(_ecm) + "/joint_positions" :
+        "/actuators");
     if (topic.empty())
     {
       gzerr << "Failed to create Actuator topic for joint ["
-            << this->dataPtr->jointNames[0]
+            << firstJointName
             << "]" << std::endl;
       return;
     }
@@ -262,7 +302,7 @@ void JointPositionController::Configure(const Entity &_entity,
       gzerr << "Failed to create topic from sub_topic [/model/"
              << this->dataPtr->model.Name(_ecm) << "/"
              << _sdf->Get<std::string>("sub_topic")
-             << "]" << " for joint [" << this->dataPtr->jointNames[0]
+             << "]" << " for joint [" << firstJointName
              << "]" << std::endl;
       return;
     }
@@ -275,7 +315,7 @@ void JointPositionController::Configure(const Entity &_entity,
     if (topic.empty())
     {
       gzerr << "Failed to create topic [" << _sdf->Get<std::string>("topic")
-             << "]" << " for joint [" << this->dataPtr->jointNames[0]
+             << "]" << " for joint [" << firstJointName
              << "]" << std::endl;
       return;
     }
@@ -346,6 +386,12 @@ void JointPositionController::PreUpdate(
   // If the joints haven't been identified yet, look for them
   if (this->dataPtr->jointEntities.empty())
   {
+    // Multi-joint mode without explicit names controls every model joint.
+    if (this->dataPtr->multiJoint && this->dataPtr->jointNames.empty())
+    {
+      this->dataPtr->jointEntities = this->dataPtr->model.Joints(_ecm);
+    }
+
     bool warned{false};
     for (const std::string &name : this->dataPtr->jointNames)
     {
@@ -396,6 +442,12 @@ void JointPositionController::PreUpdate(
   if (_info.paused)
     return;
 
+  if (this->dataPtr->multiJoint)
+  {
+    this->dataPtr->MultiJointUpdate(_info, _ecm);
+    return;
+  }
+
   // Create joint position component if one doesn't exist
   auto jointPosComp = _ecm.Component<components::JointPosition>(
       this->dataPtr->jointEntities[0]);
@@ -485,6 +537,101 @@ void JointPositionController::PreUpdate(
   }
 }
 
+//////////////////////////////////////////////////
+void JointPositionControllerPrivate::MultiJointUpdate(const UpdateInfo &_info,
+    EntityComponentManager &_ecm)
+{
+  const std::size_t nJoints = this->jointEntities.size();
+
+  // One PID per joint so each joint keeps its own integral and derivative
+  // state; all start from the configured gains.
+  if (this->multiJointPids.size() != nJoints)
+  {
+    this->multiJointPids.assign(nJoints, this->posPid);
+    std::lock_guard<std::mutex> lock(this->jointCmdMutex);
+    if (this->multiJointPosCmds.size() < nJoints)
+      this->multiJointPosCmds.resize(nJoints, this->jointPosCmd);
+  }
+
+  // Gather positions into the contiguous error array. Joints without
+  // position data yet (component just created, or zero-DOF joints) are
+  // skipped this step.
+  this->multiJointErrors.assign(nJoints, 0.0);
+  std::vector<bool> hasData(nJoints, false);
+  for (std::size_t i = 0; i < nJoints; ++i)
+  {
+    auto jointPosComp = _ecm.Component<components::JointPosition>(
+        this->jointEntities[i]);
+    if (jointPosComp == nullptr)
+    {
+      _ecm.CreateComponent(this->jointEntities[i],
+          components::JointPosition());
+      continue;
+    }
+    if (jointPosComp->Data().empty())
+      continue;
+
+    this->multiJointErrors[i] = jointPosComp->Data()[0];
+    hasData[i] = true;
+  }
+
+  // Error pass over contiguous arrays, kept free of ECM lookups and
+  // branches so the compiler can vectorize it.
+  {
+    std::lock_guard<std::mutex> lock(this->jointCmdMutex);
+    const std::size_t n = std::min(nJoints, this->multiJointPosCmds.size());
+    for (std::size_t i = 0; i < n; ++i)
+      this->multiJointErrors[i] -= this->multiJointPosCmds[i];
+  }
+
+  if (this->mode == OperationMode::ABS)
+  {
+    auto dt = std::chrono::duration<double>(_info.dt).count();
+    auto maxMovement = this->posPid.CmdMax() * dt;
+    for (std::size_t i = 0; i < nJoints; ++i)
+    {
+      if (!hasData[i])
+        continue;
+
+      double targetVel = 0;
+      const double error = this->multiJointErrors[i];
+      if (abs(error) > maxMovement && this->isMaxSet)
+      {
+        targetVel = (error < 0) ? this->posPid.CmdMax() :
+          -this->posPid.CmdMax();
+      }
+      else
+      {
+        targetVel = - error / dt;
+      }
+      _ecm.SetComponentData<components::JointVelocityCmd>(
+          this->jointEntities[i], {targetVel});
+    }
+    return;
+  }
+
+  for (std::size_t i = 0; i < nJoints; ++i)
+  {
+    if (!hasData[i])
+      continue;
+
+    double force =
+        this->multiJointPids[i].Update(this->multiJointErrors[i], _info.dt);
+
+    auto forceComp = _ecm.Component<components::JointForceCmd>(
+        this->jointEntities[i]);
+    if (forceComp == nullptr)
+    {
+      _ecm.CreateComponent(this->jointEntities[i],
+          components::JointForceCmd({force}));
+    }
+    else
+    {
+      *forceComp = components::JointForceCmd({force});
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 void JointPositionControllerPrivate::OnCmdPos(const msgs::Double &_msg)
 {
@@ -495,6 +642,15 @@ void JointPositionControllerPrivate::OnCmdPos(const msgs::Double &_msg)
 void JointPositionControllerPrivate::OnActuatorPos(const msgs::Actuators &_msg)
 {
   std::lock_guard<std::mutex> lock(this->jointCmdMutex);
+  if (this->multiJoint)
+  {
+    // The position array maps one to one onto the controlled joints.
+    this->multiJointPosCmds.resize(_msg.position_size());
+    for (int i = 0; i < _msg.position_size(); ++i)
+      this->multiJointPosCmds[i] = static_cast<double>(_msg.position(i));
+    return;
+  }
+
   if (this->actuatorNumber > _msg.position_size() - 1)
   {
     gzerr << "You tried to access index " << this->actuatorNumber
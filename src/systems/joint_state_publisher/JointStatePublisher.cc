@@ -19,6 +19,7 @@
 
 #include <gz/msgs/model.pb.h>
 
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -100,6 +101,14 @@ void JointStatePublisher::Configure(
     this->topic = _sdf->Get<std::string>("topic");
   }
 
+  this->changeThreshold = _sdf->Get<double>("change_threshold",
+      this->changeThreshold).first;
+  if (this->changeThreshold < 0.0)
+  {
+    gzwarn << "JointStatePublisher <change_threshold> can't be negative, "
+            << "publishing every step instead." << std::endl;
+    this->changeThreshold = 0.0;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -182,10 +191,65 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
   if (!this->modelPub)
     return;
 
+  // Skip all message construction when nobody is subscribed.
+  if (!this->modelPub->HasConnections())
+    return;
+
+  // With a change threshold configured, only publish when a joint position
+  // or velocity moved by at least the threshold since the last message.
+  if (this->changeThreshold > 0.0 && this->publishedOnce)
+  {
+    bool changed{false};
+    std::size_t posIdx = 0;
+    std::size_t velIdx = 0;
+    for (const Entity &joint : this->joints)
+    {
+      const auto *jointPositions =
+        _ecm.Component<components::JointPosition>(joint);
+      if (jointPositions)
+      {
+        for (double position : jointPositions->Data())
+        {
+          if (posIdx >= this->lastPositions.size() ||
+              std::abs(position - this->lastPositions[posIdx]) >=
+              this->changeThreshold)
+          {
+            changed = true;
+          }
+          ++posIdx;
+        }
+      }
+
+      const auto *jointVelocity =
+        _ecm.Component<components::JointVelocity>(joint);
+      if (jointVelocity)
+      {
+        for (double velocity : jointVelocity->Data())
+        {
+          if (velIdx >= this->lastVelocities.size() ||
+              std::abs(velocity - this->lastVelocities[velIdx]) >=
+              this->changeThreshold)
+          {
+            changed = true;
+          }
+          ++velIdx;
+        }
+      }
+
+      if (changed)
+        break;
+    }
+
+    if (!changed && posIdx == this->lastPositions.size() &&
+        velIdx == this->lastVelocities.size())
+    {
+      return;
+    }
+  }
+
   // Create the message
   msgs::Model msg;
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
   // Set the name and ID.
   msg.set_name(this->model.Name(_ecm));
@@ -307,6 +371,33 @@ void JointStatePublisher::PostUpdate(const UpdateInfo &_info,
     }
   }
 
+  // Record the published joint state for the change threshold comparison.
+  // The vectors are reused, so this is allocation-free in steady state.
+  if (this->changeThreshold > 0.0)
+  {
+    this->lastPositions.clear();
+    this->lastVelocities.clear();
+    for (const Entity &joint : this->joints)
+    {
+      const auto *jointPositions =
+        _ecm.Component<components::JointPosition>(joint);
+      if (jointPositions)
+      {
+        this->lastPositions.insert(this->lastPositions.end(),
+            jointPositions->Data().begin(), jointPositions->Data().end());
+      }
+
+      const auto *jointVelocity =
+        _ecm.Component<components::JointVelocity>(joint);
+      if (jointVelocity)
+      {
+        this->lastVelocities.insert(this->lastVelocities.end(),
+            jointVelocity->Data().begin(), jointVelocity->Data().end());
+      }
+    }
+  }
+  this->publishedOnce = true;
+
   // Publish the message.
   this->modelPub->Publish(msg);
 }
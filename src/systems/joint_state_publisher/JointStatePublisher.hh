@@ -21,6 +21,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 #include <gz/sim/Model.hh>
 #include <gz/transport/Node.hh>
 #include <gz/sim/System.hh>
@@ -50,6 +51,16 @@ namespace systems
   /// - `<joint_name>`: Name of a joint to publish. This parameter can be
   /// specified multiple times, and is optional. All joints in a model will
   /// be published if joint names are not specified.
+  ///
+  /// - `<change_threshold>`: Minimum change in any joint position (radians
+  /// or meters) or velocity since the last published message required to
+  /// publish a new one. This parameter is optional and defaults to 0,
+  /// which publishes every simulation step. Note that messages are only
+  /// constructed and published while the topic has subscribers.
+  ///
+  /// For multi-robot worlds, several models may share a single `<topic>`:
+  /// each message carries the model name and ID, so one aggregated topic
+  /// can serve a fleet-wide consumer.
   class JointStatePublisher
       : public System,
         public ISystemConfigure,
@@ -90,6 +101,19 @@ namespace systems
 
     /// \brief The topic
     private: std::string topic;
+
+    /// \brief Minimum joint position or velocity change required to
+    /// publish a new message. Zero publishes every step.
+    private: double changeThreshold{0.0};
+
+    /// \brief Joint positions included in the last published message.
+    private: std::vector<double> lastPositions;
+
+    /// \brief Joint velocities included in the last published message.
+    private: std::vector<double> lastVelocities;
+
+    /// \brief Whether at least one message has been published.
+    private: bool publishedOnce{false};
   };
   }
 }
@@ -36,7 +36,9 @@
 #include <gz/transport/TopicUtils.hh>
 
 #include <map>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "JointTrajectoryController.hh"
@@ -251,6 +253,11 @@ class Trajectory
   /// \brief Trajectory defined in terms of temporal points, whose members are
   /// ordered according to `jointNames`
   public: std::vector<gz::msgs::JointTrajectoryPoint> points;
+
+  /// \brief Time from start of each entry of `points`, converted once at
+  /// message receipt so the per-step point search compares plain durations
+  /// instead of re-converting protobuf timestamps
+  public: std::vector<std::chrono::steady_clock::duration> pointTimes;
 };
 
 /// \brief Private data of the JointTrajectoryController plugin
@@ -289,10 +296,18 @@ class gz::sim::systems::JointTrajectoryControllerPrivate
   /// of the joint
   public: std::map<std::string, ActuatedJoint> actuatedJoints;
 
-  /// \brief Mutex projecting trajectory
+  /// \brief Mutex protecting pendingTrajectory. The critical section on
+  /// both sides is a single pointer move; all parsing happens on the
+  /// transport thread before taking the lock, and all evaluation happens
+  /// on the simulation thread after releasing it.
   public: std::mutex trajectoryMutex;
 
-  /// \brief Information about trajectory that should be followed
+  /// \brief Trajectory built by the subscriber callback, waiting to be
+  /// adopted by the next PreUpdate. Protected by trajectoryMutex.
+  public: std::shared_ptr<Trajectory> pendingTrajectory;
+
+  /// \brief Information about trajectory that should be followed. Only
+  /// accessed from the simulation thread.
   public: Trajectory trajectory;
 
   /// \brief Flag that determines whether to use message header timestamp as
@@ -440,12 +455,30 @@ void JointTrajectoryController::PreUpdate(
     return;
   }
 
-  // Update joint targets based on the current trajectory
+  // Adopt a trajectory received since the last step, if any. The critical
+  // section is a single pointer move; the message was already parsed on
+  // the transport thread.
   {
-    auto isTargetUpdateRequired = false;
+    std::shared_ptr<Trajectory> newTrajectory;
+    {
+      std::lock_guard<std::mutex> lock(this->dataPtr->trajectoryMutex);
+      newTrajectory = std::move(this->dataPtr->pendingTrajectory);
+    }
+    if (newTrajectory)
+    {
+      if (this->dataPtr->trajectory.status != Trajectory::Reached)
+      {
+        gzwarn << "[JointTrajectoryController] A new JointTrajectory message"
+                   " was received while executing a previous trajectory.\n";
+      }
+      this->dataPtr->trajectory = std::move(*newTrajectory);
+    }
+  }
 
-    // Lock mutex before accessing trajectory
-    std::lock_guard<std::mutex> lock(this->dataPtr->trajectoryMutex);
+  // Update joint targets based on the current trajectory. The active
+  // trajectory is only touched on this thread, so no lock is needed.
+  {
+    auto isTargetUpdateRequired = false;
 
     if (this->dataPtr->trajectory.status == Trajectory::New)
     {
@@ -648,14 +681,10 @@ void JointTrajectoryControllerPrivate::JointTrajectoryCallback(
                " acceleration commands, which are currently ignored.\n";
   }
 
-  // Lock mutex guarding the trajectory
-  std::lock_guard<std::mutex> lock(this->trajectoryMutex);
-
-  if (this->trajectory.status != Trajectory::Reached)
-  {
-    gzwarn << "[JointTrajectoryController] A new JointTrajectory message was"
-               " received while executing a previous trajectory.\n";
-  }
+  // Build the whole trajectory here on the transport thread, so the
+  // simulation thread only has to swap a pointer.
+  auto newTrajectory = std::make_shared<Trajectory>();
+  newTrajectory->Reset();
 
   // Get start time of the trajectory from message header if desired
   // If not enabled or there is no header, set start time to 0 and determine
@@ -665,27 +694,33 @@ void JointTrajectoryControllerPrivate::JointTrajectoryCallback(
     if (_msg.header().has_stamp())
     {
       const auto stamp = _msg.header().stamp();
-      this->trajectory.startTime = std::chrono::seconds(stamp.sec()) +
-                                   std::chrono::nanoseconds(stamp.nsec());
+      newTrajectory->startTime = std::chrono::seconds(stamp.sec()) +
+                                 std::chrono::nanoseconds(stamp.nsec());
     }
   }
   else
   {
-    this->trajectory.startTime = std::chrono::nanoseconds(0);
+    newTrajectory->startTime = std::chrono::nanoseconds(0);
   }
 
-  // Reset for a new trajectory
-  this->trajectory.Reset();
-
-  // Extract joint names and points
+  // Extract joint names and points, converting each point's time from
+  // start once so the per-step search does not touch protobuf timestamps
   for (const auto &joint_name : _msg.joint_names())
   {
-    this->trajectory.jointNames.push_back(joint_name);
+    newTrajectory->jointNames.push_back(joint_name);
   }
   for (const auto &point : _msg.points())
   {
-    this->trajectory.points.push_back(point);
+    newTrajectory->points.push_back(point);
+    newTrajectory->pointTimes.push_back(
+        std::chrono::seconds(point.time_from_start().sec()) +
+        std::chrono::nanoseconds(point.time_from_start().nsec()));
   }
+
+  // Stage the trajectory for the next PreUpdate. Only the newest message
+  // survives if several arrive within one step.
+  std::lock_guard<std::mutex> lock(this->trajectoryMutex);
+  this->pendingTrajectory = std::move(newTrajectory);
 }
 
 //////////////////////////////////////////////////
@@ -1010,10 +1045,7 @@ bool Trajectory::UpdateCurrentPoint(
     }
 
     // Break if point needs to be followed
-    const auto pointTFS = this->points[this->pointIndex].time_from_start();
-    const auto pointTime = std::chrono::seconds(pointTFS.sec()) +
-                           std::chrono::nanoseconds(pointTFS.nsec());
-    if (pointTime >= trajectoryTime)
+    if (this->pointTimes[this->pointIndex] >= trajectoryTime)
     {
       break;
     }
@@ -1054,6 +1086,7 @@ void Trajectory::Reset()
   this->pointIndex = 0;
   this->jointNames.clear();
   this->points.clear();
+  this->pointTimes.clear();
 }
 
 // Register plugin
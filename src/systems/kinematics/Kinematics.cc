@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "Kinematics.hh"
+
+#include <chrono>
+
+#include <gz/common/Profiler.hh>
+#include <gz/math/Pose3.hh>
+#include <gz/math/Vector3.hh>
+#include <gz/plugin/Register.hh>
+
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/components/AngularVelocityCmd.hh"
+#include "gz/sim/components/Kinematic.hh"
+#include "gz/sim/components/LinearVelocityCmd.hh"
+#include "gz/sim/components/Model.hh"
+#include "gz/sim/components/Pose.hh"
+
+using namespace gz;
+using namespace sim;
+using namespace systems;
+
+class gz::sim::systems::KinematicsPrivate
+{
+  /// \brief Integrate the poses of all kinematic models.
+  /// \param[in] _info Current simulation step info.
+  /// \param[in] _ecm Mutable reference to ECM.
+  public: void UpdatePoses(const UpdateInfo &_info,
+                           EntityComponentManager &_ecm);
+};
+
+//////////////////////////////////////////////////
+void KinematicsPrivate::UpdatePoses(const UpdateInfo &_info,
+                                    EntityComponentManager &_ecm)
+{
+  GZ_PROFILE("KinematicsPrivate::UpdatePoses");
+
+  const double dt = std::chrono::duration<double>(_info.dt).count();
+
+  _ecm.Each<components::Model, components::Kinematic, components::Pose>(
+      [&](const Entity &_entity,
+          const components::Model *,
+          const components::Kinematic *_kinematic,
+          components::Pose *_pose) -> bool
+      {
+        if (!_kinematic->Data())
+          return true;
+
+        math::Vector3d linVel = math::Vector3d::Zero;
+        math::Vector3d angVel = math::Vector3d::Zero;
+
+        auto linVelCmd =
+            _ecm.Component<components::LinearVelocityCmd>(_entity);
+        if (linVelCmd)
+          linVel = linVelCmd->Data();
+
+        auto angVelCmd =
+            _ecm.Component<components::AngularVelocityCmd>(_entity);
+        if (angVelCmd)
+          angVel = angVelCmd->Data();
+
+        if (linVel == math::Vector3d::Zero &&
+            angVel == math::Vector3d::Zero)
+        {
+          return true;
+        }
+
+        // Commands are expressed in the body frame, matching the semantics
+        // the Physics system gives model velocity commands.
+        math::Pose3d pose = _pose->Data();
+        pose.Pos() += pose.Rot().RotateVector(linVel) * dt;
+        pose.Rot() = pose.Rot() * math::Quaterniond(angVel * dt);
+        pose.Rot().Normalize();
+
+        _pose->Data() = pose;
+        _ecm.SetChanged(_entity, components::Pose::typeId,
+            ComponentState::PeriodicChange);
+
+        return true;
+      });
+}
+
+//////////////////////////////////////////////////
+Kinematics::Kinematics()
+  : System(), dataPtr(std::make_unique<KinematicsPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+void Kinematics::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
+{
+  GZ_PROFILE("Kinematics::Update");
+
+  if (_info.paused)
+    return;
+
+  this->dataPtr->UpdatePoses(_info, _ecm);
+}
+
+GZ_ADD_PLUGIN(Kinematics, System,
+  Kinematics::ISystemUpdate
+)
+
+GZ_ADD_PLUGIN_ALIAS(Kinematics, "gz::sim::systems::Kinematics")
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef GZ_SIM_SYSTEMS_KINEMATICS_HH_
+#define GZ_SIM_SYSTEMS_KINEMATICS_HH_
+
+#include <memory>
+
+#include <gz/sim/System.hh>
+
+namespace gz
+{
+namespace sim
+{
+// Inline bracket to help doxygen filtering.
+inline namespace GZ_SIM_VERSION_NAMESPACE {
+namespace systems
+{
+  // Forward declaration
+  class KinematicsPrivate;
+
+  /// \brief Pose integration for kinematic models.
+  ///
+  /// Models flagged with a true components::Kinematic component bypass the
+  /// physics engine entirely. This system advances their Pose from the
+  /// body-frame components::LinearVelocityCmd and
+  /// components::AngularVelocityCmd, using the same command semantics as
+  /// the Physics system, at a fraction of the cost. This is useful for
+  /// scripted entities, such as crowds of actors, that don't need dynamics.
+  ///
+  /// Attach this system to the world, before the Physics system so the
+  /// velocity commands are read before physics clears them. Nested
+  /// kinematic models are integrated relative to their parent.
+  class Kinematics
+      : public System,
+        public ISystemUpdate
+  {
+    /// \brief Constructor
+    public: Kinematics();
+
+    /// \brief Destructor
+    public: ~Kinematics() override = default;
+
+    // Documentation inherited
+    public: void Update(const UpdateInfo &_info,
+                        EntityComponentManager &_ecm) override;
+
+    /// \brief Private data pointer
+    private: std::unique_ptr<KinematicsPrivate> dataPtr;
+  };
+  }
+}
+}
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <gz/msgs/double.pb.h>
 
 #include <string>
+#include <vector>
 
 #include <gz/sim/components/AngularVelocity.hh>
 #include <gz/sim/components/Link.hh>
@@ -56,15 +57,22 @@ using namespace systems;
 /// \brief Private data class
 class gz::sim::systems::KineticEnergyMonitorPrivate
 {
-  /// \brief Link of the model.
-  public: Entity linkEntity;
+  /// \brief Bookkeeping for one monitored link.
+  public: struct MonitoredLink
+  {
+    /// \brief Link entity.
+    Entity entity{kNullEntity};
+
+    /// \brief Kinetic energy during the previous step.
+    double prevKineticEnergy{0.0};
+  };
+
+  /// \brief Links being monitored, all swept in one pass per step.
+  public: std::vector<MonitoredLink> links;
 
   /// \brief Name of the model this plugin is attached to.
   public: std::string modelName;
 
-  /// \brief Kinetic energy during the previous step.
-  public: double prevKineticEnergy {0.0};
-
   /// \brief Kinetic energy threshold.
   public: double keThreshold {7.0};
 
@@ -102,27 +110,35 @@ void KineticEnergyMonitor::Configure(const Entity &_entity,
   this->dataPtr->modelName = this->dataPtr->model.Name(_ecm);
 
   auto sdfClone = _sdf->Clone();
-  std::string linkName;
-  if (sdfClone->HasElement("link_name"))
-  {
-    linkName = sdfClone->Get<std::string>("link_name");
-  }
-
-  if (linkName.empty())
+  if (!sdfClone->HasElement("link_name"))
   {
     gzerr << "found an empty <link_name> parameter. Failed to initialize."
       << std::endl;
     return;
   }
 
-  // Get the link entity
-  this->dataPtr->linkEntity = this->dataPtr->model.LinkByName(_ecm, linkName);
-
-  if (this->dataPtr->linkEntity == kNullEntity)
+  // Get the link entities. <link_name> can be repeated to monitor several
+  // links with one system instance.
+  for (auto elem = sdfClone->GetElement("link_name"); elem;
+      elem = elem->GetNextElement("link_name"))
   {
-    gzerr << "Link " << linkName
-      << " could not be found. Failed to initialize.\n";
-    return;
+    std::string linkName = elem->Get<std::string>();
+    if (linkName.empty())
+    {
+      gzerr << "found an empty <link_name> parameter. Failed to initialize."
+        << std::endl;
+      return;
+    }
+
+    Entity linkEntity = this->dataPtr->model.LinkByName(_ecm, linkName);
+    if (linkEntity == kNullEntity)
+    {
+      gzerr << "Link " << linkName
+        << " could not be found. Failed to initialize.\n";
+      return;
+    }
+
+    this->dataPtr->links.push_back({linkEntity, 0.0});
   }
 
   this->dataPtr->keThreshold = sdfClone->Get<double>(
@@ -138,11 +154,14 @@ void KineticEnergyMonitor::Configure(const Entity &_entity,
   transport::Node node;
   this->dataPtr->pub = node.Advertise<msgs::Double>(topic);
 
-  Link link(this->dataPtr->linkEntity);
-  link.EnableVelocityChecks(_ecm, true);
+  for (const auto &monitored : this->dataPtr->links)
+  {
+    Link link(monitored.entity);
+    link.EnableVelocityChecks(_ecm, true);
 
-  // Create a default inertia in case the link doesn't have it
-  enableComponent<components::Inertial>(_ecm, this->dataPtr->linkEntity, true);
+    // Create a default inertia in case the link doesn't have it
+    enableComponent<components::Inertial>(_ecm, monitored.entity, true);
+  }
 }
 
 //////////////////////////////////////////////////
@@ -154,16 +173,17 @@ void KineticEnergyMonitor::PostUpdate(const UpdateInfo &_info,
   if (_info.paused || !this->dataPtr->pub)
     return;
 
-  if (this->dataPtr->linkEntity != kNullEntity)
+  for (auto &monitored : this->dataPtr->links)
   {
-    Link link(this->dataPtr->linkEntity);
-    if (std::nullopt != link.WorldKineticEnergy(_ecm))
+    Link link(monitored.entity);
+    auto kineticEnergy = link.WorldKineticEnergy(_ecm);
+    if (std::nullopt != kineticEnergy)
     {
-      double currKineticEnergy = *link.WorldKineticEnergy(_ecm);
+      double currKineticEnergy = *kineticEnergy;
 
       // We only care about positive values of this (the links looses energy)
-      double deltaKE = this->dataPtr->prevKineticEnergy - currKineticEnergy;
-      this->dataPtr->prevKineticEnergy = currKineticEnergy;
+      double deltaKE = monitored.prevKineticEnergy - currKineticEnergy;
+      monitored.prevKineticEnergy = currKineticEnergy;
 
       if (deltaKE > this->dataPtr->keThreshold)
       {
@@ -42,7 +42,8 @@ namespace systems
   /// ## System Parameters
   ///
   /// - `<link_name>`: Name of the link to monitor. This name must match
-  /// a name of link within the model.
+  /// a name of link within the model. This element can be repeated to
+  /// monitor several links with a single system instance.
   ///
   /// - `<kinetic_energy_threshold>`: Threshold, in Joule (J), after which
   /// a message is generated on `<topic>` with the kinetic energy value that
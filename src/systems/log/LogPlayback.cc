@@ -19,9 +19,14 @@
 
 #include <gz/msgs/log_playback_stats.pb.h>
 
+#include <algorithm>
+#include <memory>
+#include <regex>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Filesystem.hh>
 #include <gz/common/Profiler.hh>
@@ -29,6 +34,7 @@
 #include <gz/math/Pose3.hh>
 #include <gz/msgs/Utility.hh>
 #include <gz/plugin/RegisterMore.hh>
+#include <gz/transport/log/QualifiedTime.hh>
 #include <gz/transport/log/QueryOptions.hh>
 #include <gz/transport/log/Log.hh>
 #include <gz/transport/log/Message.hh>
@@ -85,9 +91,67 @@ class gz::sim::systems::LogPlaybackPrivate
   public: void Parse(EntityComponentManager &_ecm,
       const msgs::SerializedStateMap &_msg);
 
+  /// \brief Apply a single recorded message to the ECM.
+  /// \param[in] _ecm Mutable ECM.
+  /// \param[in] _msg Recorded message to apply.
+  /// \param[in] _seekRewind True when seeking, to track entity removals.
+  /// \param[in, out] _entitiesToRemove Entities to remove after the seek.
+  public: void ProcessMessage(EntityComponentManager &_ecm,
+      const transport::log::Message &_msg, bool _seekRewind,
+      std::set<Entity> &_entitiesToRemove);
+
+  /// \brief Apply messages from the main log and every merge log in
+  /// timestamp order, up to and including _endTime. All stream iterators
+  /// must already be positioned.
+  /// \param[in] _ecm Mutable ECM.
+  /// \param[in] _endTime Latest timestamp to apply.
+  /// \param[in] _seekRewind True when seeking, see ProcessMessage.
+  /// \param[in, out] _entitiesToRemove Entities to remove after a seek.
+  public: void MergePlay(EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_endTime, bool _seekRewind,
+      std::set<Entity> &_entitiesToRemove);
+
+  /// \brief Latest end time across the main log and all merge logs.
+  /// \return The end time.
+  public: std::chrono::nanoseconds LogEndTime() const;
+
   /// \brief A batch of data from log file, of all pose messages
   public: transport::log::Batch batch;
 
+  /// \brief Iterator streaming this->batch forward between updates, so
+  /// sequential playback issues a single database query instead of one per
+  /// simulation step. Null when the stream needs to be (re)opened, e.g.
+  /// after a seek.
+  public: std::unique_ptr<transport::log::MsgIter> streamIter;
+
+  /// \brief Decode buffer reused across messages so playback does not pay
+  /// a fresh protobuf allocation per message.
+  public: msgs::SerializedState stateMsg;
+
+  /// \brief Decode buffer reused across messages, see stateMsg.
+  public: msgs::SerializedStateMap stateMapMsg;
+
+  /// \brief Directories of additional logs to merge into this playback,
+  /// from <merge_path> elements, e.g. per-robot logs recorded on
+  /// distributed secondaries.
+  public: std::vector<std::string> mergePaths;
+
+  /// \brief One additional log merged into playback.
+  public: struct MergeStream
+  {
+    /// \brief Opened log.
+    std::unique_ptr<transport::log::Log> log;
+
+    /// \brief Batch currently being streamed.
+    transport::log::Batch batch;
+
+    /// \brief Iterator into batch, see streamIter.
+    std::unique_ptr<transport::log::MsgIter> iter;
+  };
+
+  /// \brief Logs opened from mergePaths.
+  public: std::vector<MergeStream> mergeStreams;
+
   /// \brief Pointer to gz-transport Log
   public: std::unique_ptr<transport::log::Log> log;
 
@@ -115,6 +179,10 @@ class gz::sim::systems::LogPlaybackPrivate
 
   // \brief Saves which particle emitter emitting components have changed
   public: std::unordered_map<Entity, bool> prevParticleEmitterCmds;
+
+  /// \brief Timestamps of the full-state keyframe messages in the log,
+  /// sorted ascending. Empty for logs recorded without keyframes.
+  public: std::vector<std::chrono::steady_clock::duration> keyframeTimes;
 };
 
 bool LogPlaybackPrivate::started{false};
@@ -150,6 +218,133 @@ void LogPlaybackPrivate::Parse(EntityComponentManager &_ecm,
   _ecm.SetState(_msg);
 }
 
+//////////////////////////////////////////////////
+void LogPlaybackPrivate::ProcessMessage(EntityComponentManager &_ecm,
+    const transport::log::Message &_msg, bool _seekRewind,
+    std::set<Entity> &_entitiesToRemove)
+{
+  auto msgType = _msg.Type();
+
+  if (msgType == "gz.msgs.SerializedState")
+  {
+    // Decode into a reused buffer to avoid a fresh protobuf allocation
+    // per message.
+    auto &msg = this->stateMsg;
+    msg.ParseFromString(_msg.Data());
+
+    // For seeking back in time only:
+    // While stepping, update the list of entities to be removed
+    // so we do not remove any entities that are to be created
+    if (_seekRewind)
+    {
+      for (const auto &entIt : msg.entities())
+      {
+        Entity entity{entIt.id()};
+        if (entIt.remove())
+        {
+          _entitiesToRemove.insert(entity);
+        }
+        else
+        {
+          _entitiesToRemove.erase(entity);
+        }
+      }
+    }
+
+    this->Parse(_ecm, msg);
+  }
+  else if (msgType == "gz.msgs.SerializedStateMap")
+  {
+    auto &msg = this->stateMapMsg;
+    msg.ParseFromString(_msg.Data());
+
+    // For seeking back in time only:
+    // While stepping, update the list of entities to be removed
+    // so we do not remove any entities that are to be created
+    if (_seekRewind)
+    {
+      for (const auto &entIt : msg.entities())
+      {
+        const auto &entityMsg = entIt.second;
+        Entity entity{entityMsg.id()};
+        if (entityMsg.remove())
+        {
+          _entitiesToRemove.insert(entity);
+        }
+        else
+        {
+          _entitiesToRemove.erase(entity);
+        }
+      }
+    }
+
+    this->Parse(_ecm, msg);
+  }
+  else if (msgType == "gz.msgs.StringMsg")
+  {
+    // Do nothing, we assume this is the SDF string
+  }
+  else
+  {
+    gzwarn << "Trying to playback unsupported message type ["
+            << msgType << "]" << std::endl;
+  }
+  this->ReplaceResourceURIs(_ecm);
+}
+
+//////////////////////////////////////////////////
+void LogPlaybackPrivate::MergePlay(EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_endTime, bool _seekRewind,
+    std::set<Entity> &_entitiesToRemove)
+{
+  // Gather the open streams and repeatedly apply the earliest head
+  // message: a k-way merge that keeps fleet-wide replays in timestamp
+  // order. With no merge logs this degenerates to draining the main
+  // stream.
+  std::vector<std::pair<transport::log::Batch *, transport::log::MsgIter *>>
+      streams;
+  if (this->streamIter)
+    streams.emplace_back(&this->batch, this->streamIter.get());
+  for (auto &stream : this->mergeStreams)
+  {
+    if (stream.iter)
+      streams.emplace_back(&stream.batch, stream.iter.get());
+  }
+
+  while (true)
+  {
+    std::pair<transport::log::Batch *, transport::log::MsgIter *> *next =
+        nullptr;
+    for (auto &stream : streams)
+    {
+      if (*stream.second == stream.first->end())
+        continue;
+      if ((*stream.second)->TimeReceived() > _endTime)
+        continue;
+      if (!next ||
+          (*stream.second)->TimeReceived() < (*next->second)->TimeReceived())
+      {
+        next = &stream;
+      }
+    }
+    if (!next)
+      break;
+
+    this->ProcessMessage(_ecm, **next->second, _seekRewind,
+        _entitiesToRemove);
+    ++(*next->second);
+  }
+}
+
+//////////////////////////////////////////////////
+std::chrono::nanoseconds LogPlaybackPrivate::LogEndTime() const
+{
+  auto endTime = this->log->EndTime();
+  for (const auto &stream : this->mergeStreams)
+    endTime = std::max(endTime, stream.log->EndTime());
+  return endTime;
+}
+
 //////////////////////////////////////////////////
 void LogPlayback::Configure(const Entity &,
     const std::shared_ptr<const sdf::Element> &_sdf,
@@ -163,6 +358,18 @@ void LogPlayback::Configure(const Entity &,
   // Prepend working directory if path is relative
   this->dataPtr->logPath = common::absPath(this->dataPtr->logPath);
 
+  // Additional logs to merge into this playback
+  if (_sdf->HasElement("merge_path"))
+  {
+    auto mergeElem = _sdf->FindElement("merge_path");
+    while (mergeElem)
+    {
+      this->dataPtr->mergePaths.push_back(
+          common::absPath(mergeElem->Get<std::string>()));
+      mergeElem = mergeElem->GetNextElement("merge_path");
+    }
+  }
+
   // Set the entity offset.
   // \todo This number should be included in the log file.
   _ecm.SetEntityCreateOffset(math::MAX_I64 / 2);
@@ -230,6 +437,45 @@ bool LogPlaybackPrivate::Start(EntityComponentManager &_ecm)
     gzerr << "Failed to open log file [" << dbPath << "]" << std::endl;
   }
 
+  // Open any additional logs to merge into this playback. A failed merge
+  // log is skipped rather than aborting the whole playback.
+  for (const auto &mergePath : this->mergePaths)
+  {
+    std::string mergeDb = common::joinPaths(mergePath, "state.tlog");
+    if (!common::exists(mergeDb))
+    {
+      gzerr << "Merge log [" << mergeDb << "] does not exist. Skipping.\n";
+      continue;
+    }
+    MergeStream stream;
+    stream.log = std::make_unique<transport::log::Log>();
+    if (!stream.log->Open(mergeDb))
+    {
+      gzerr << "Failed to open merge log [" << mergeDb << "]" << std::endl;
+      continue;
+    }
+    gzmsg << "Merging log file [" << mergeDb << "]\n";
+    this->mergeStreams.push_back(std::move(stream));
+  }
+
+  // Index the full-state keyframes recorded on the keyframe topic, if any,
+  // so that seeks can start from the closest keyframe instead of replaying
+  // the whole log. Logs recorded without keyframes yield an empty index and
+  // play back as before.
+  auto kfBatch = this->log->QueryMessages(
+      transport::log::TopicPattern(std::regex(".*/log/keyframe")));
+  for (auto kfIter = kfBatch.begin(); kfIter != kfBatch.end(); ++kfIter)
+  {
+    this->keyframeTimes.push_back(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        kfIter->TimeReceived()));
+  }
+  if (!this->keyframeTimes.empty())
+  {
+    gzmsg << "Found [" << this->keyframeTimes.size()
+           << "] keyframes in log file.\n";
+  }
+
   // Access all messages in .tlog file
   this->batch = this->log->QueryMessages();
   auto iter = this->batch.begin();
@@ -260,9 +506,15 @@ bool LogPlaybackPrivate::Start(EntityComponentManager &_ecm)
     }
   }
 
+  // The statistics span the main log and every merge log, so seeking
+  // tools see the full fleet-wide time range.
+  auto logStartTime = this->log->StartTime();
+  for (const auto &stream : this->mergeStreams)
+    logStartTime = std::min(logStartTime, stream.log->StartTime());
+
   msgs::LogPlaybackStatistics logStats;
-  auto startTime = convert<msgs::Time>(this->log->StartTime());
-  auto endTime = convert<msgs::Time>(this->log->EndTime());
+  auto startTime = convert<msgs::Time>(logStartTime);
+  auto endTime = convert<msgs::Time>(this->LogEndTime());
   logStats.mutable_start_time()->set_sec(startTime.sec());
   logStats.mutable_start_time()->set_nsec(startTime.nsec());
   logStats.mutable_end_time()->set_sec(endTime.sec());
@@ -487,10 +739,7 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
     // To rewind / seek backward in time, we also need to play every single
     // step from the beginning so we don't miss insertions and deletions
     // This is because each serialized state is a changed state and not an
-    // absolute state.
-    // todo(anyone) Record absolute states during recording, i.e. key frames,
-    // so that playback can jump to these states without the need to
-    // incrementally build the states from the beginning
+    // absolute state, unless keyframes were recorded (handled below).
 
     // Create a list of entities to be removed. The list will be updated later
     // as the log steps forward below
@@ -502,78 +751,80 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
     startTime = std::chrono::steady_clock::duration::zero();
   }
 
-  this->dataPtr->batch = this->dataPtr->log->QueryMessages(
-      transport::log::AllTopics({startTime, endTime}));
-
-  auto iter = this->dataPtr->batch.begin();
-  while (iter != this->dataPtr->batch.end())
+  // If a full-state keyframe was recorded between the start and target time,
+  // replay only needs to start at the latest such keyframe: applying its
+  // absolute state reproduces everything older, so rewinds and long jumps
+  // no longer replay the log from the beginning.
+  if (!this->dataPtr->keyframeTimes.empty())
   {
-    auto msgType = iter->Type();
-
-    if (msgType == "gz.msgs.SerializedState")
+    auto kfIt = std::upper_bound(this->dataPtr->keyframeTimes.begin(),
+        this->dataPtr->keyframeTimes.end(), endTime);
+    if (kfIt != this->dataPtr->keyframeTimes.begin() &&
+        *(--kfIt) > startTime)
     {
-      msgs::SerializedState msg;
-      msg.ParseFromString(iter->Data());
-
-      // For seeking back in time only:
-      // While stepping, update the list of entities to be removed
-      // so we do not remove any entities that are to be created
-      if (seekRewind)
+      if (!seekRewind)
       {
-        for (const auto &entIt : msg.entities())
-        {
-          Entity entity{entIt.id()};
-          if (entIt.remove())
-          {
-            entitiesToRemove.insert(entity);
-          }
-          else
-          {
-            entitiesToRemove.erase(entity);
-          }
-        }
+        // The keyframe carries no removals, so track entities the same way
+        // a rewind does; applying the keyframe prunes the ones it keeps
+        // alive and leftovers are removed after the loop.
+        seekRewind = true;
+        const auto &entities = _ecm.Entities().Vertices();
+        for (const auto &entity : entities)
+          entitiesToRemove.insert(Entity(entity.first));
       }
-
-      this->dataPtr->Parse(_ecm, msg);
+      startTime = *kfIt;
     }
-    else if (msgType == "gz.msgs.SerializedStateMap")
+  }
+
+  if (seekRewind)
+  {
+    // Seeks need bounded queries, one per log.
+    this->dataPtr->batch = this->dataPtr->log->QueryMessages(
+        transport::log::AllTopics({startTime, endTime}));
+    this->dataPtr->streamIter = std::make_unique<transport::log::MsgIter>(
+        this->dataPtr->batch.begin());
+    for (auto &stream : this->dataPtr->mergeStreams)
     {
-      msgs::SerializedStateMap msg;
-      msg.ParseFromString(iter->Data());
+      stream.batch = stream.log->QueryMessages(
+          transport::log::AllTopics({startTime, endTime}));
+      stream.iter = std::make_unique<transport::log::MsgIter>(
+          stream.batch.begin());
+    }
 
-      // For seeking back in time only:
-      // While stepping, update the list of entities to be removed
-      // so we do not remove any entities that are to be created
-      if (seekRewind)
-      {
-        for (const auto &entIt : msg.entities())
-        {
-          const auto &entityMsg = entIt.second;
-          Entity entity{entityMsg.id()};
-          if (entityMsg.remove())
-          {
-            entitiesToRemove.insert(entity);
-          }
-          else
-          {
-            entitiesToRemove.erase(entity);
-          }
-        }
-      }
+    this->dataPtr->MergePlay(_ecm, endTime, seekRewind, entitiesToRemove);
 
-      this->dataPtr->Parse(_ecm, msg);
-    }
-    else if (msgType == "gz.msgs.StringMsg")
+    // The bounded batches are consumed. Drop the iterators so fresh
+    // forward streams are opened on the next sequential step.
+    this->dataPtr->streamIter.reset();
+    for (auto &stream : this->dataPtr->mergeStreams)
+      stream.iter.reset();
+  }
+  else
+  {
+    // Sequential playback streams a single long-lived query per log
+    // forward, instead of issuing one database query per simulation step.
+    // The exclusive start skips messages already applied at startTime.
+    auto openStream = [&startTime](transport::log::Log *_log,
+        transport::log::Batch &_batch)
     {
-      // Do nothing, we assume this is the SDF string
+      _batch = _log->QueryMessages(
+          transport::log::AllTopics(transport::log::QualifiedTimeRange::From(
+          transport::log::QualifiedTime(startTime,
+          transport::log::QualifiedTime::Qualifier::EXCLUSIVE))));
+      return std::make_unique<transport::log::MsgIter>(_batch.begin());
+    };
+    if (!this->dataPtr->streamIter)
+    {
+      this->dataPtr->streamIter = openStream(this->dataPtr->log.get(),
+          this->dataPtr->batch);
     }
-    else
+    for (auto &stream : this->dataPtr->mergeStreams)
     {
-      gzwarn << "Trying to playback unsupported message type ["
-              << msgType << "]" << std::endl;
+      if (!stream.iter)
+        stream.iter = openStream(stream.log.get(), stream.batch);
     }
-    this->dataPtr->ReplaceResourceURIs(_ecm);
-    ++iter;
+
+    this->dataPtr->MergePlay(_ecm, endTime, seekRewind, entitiesToRemove);
   }
 
     // particle emitters
@@ -609,11 +860,11 @@ void LogPlayback::Update(const UpdateInfo &_info, EntityComponentManager &_ecm)
   }
 
   // pause playback if end of log is reached
-  if (_info.simTime >= this->dataPtr->log->EndTime())
+  if (_info.simTime >= this->dataPtr->LogEndTime())
   {
     gzmsg << "End of log file reached. Time: " <<
       std::chrono::duration_cast<std::chrono::seconds>(
-      this->dataPtr->log->EndTime()).count() << " seconds" << std::endl;
+      this->dataPtr->LogEndTime()).count() << " seconds" << std::endl;
 
     this->dataPtr->eventManager->Emit<events::Pause>(true);
   }
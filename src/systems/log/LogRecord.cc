@@ -23,8 +23,15 @@
 #include <string>
 #include <fstream>
 #include <ctime>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <set>
 #include <list>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <gz/common/Console.hh>
 #include <gz/common/Filesystem.hh>
@@ -48,6 +55,7 @@
 #include <sdf/Visual.hh>
 #include <sdf/World.hh>
 
+#include "gz/sim/components/Factory.hh"
 #include "gz/sim/components/Geometry.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/Link.hh"
@@ -163,6 +171,79 @@ class gz::sim::systems::LogRecordPrivate
 
   /// \brief Last time states are recorded
   public: std::chrono::steady_clock::duration lastRecordSimTime{0};
+
+  /// \brief Publisher for full-state keyframes, recorded periodically so
+  /// playback can seek by loading the closest keyframe and replaying a
+  /// short run of deltas instead of the whole log. Zero disables
+  /// keyframes.
+  public: transport::Node::Publisher kfPub;
+
+  /// \brief Time period between full-state keyframes
+  public: std::chrono::steady_clock::duration keyframePeriod{
+      std::chrono::seconds(60)};
+
+  /// \brief Last time a keyframe was recorded
+  public: std::chrono::steady_clock::duration lastKeyframeSimTime{0};
+
+  /// \brief Resolve the entity filter names to entity ids. Re-resolves
+  /// whenever new entities may have appeared, so subtrees spawned after
+  /// recording started are picked up.
+  /// \param[in] _ecm Immutable reference to the ECM.
+  public: void UpdateRecordFilters(const EntityComponentManager &_ecm);
+
+  /// \brief Component types to record, from <record_component> elements.
+  /// Empty records every changed component.
+  public: std::unordered_set<ComponentTypeId> recordComponentTypes;
+
+  /// \brief Scoped names of entities whose subtrees should be recorded,
+  /// from <record_entity> elements. Empty records every entity.
+  public: std::vector<std::string> recordEntityNames;
+
+  /// \brief Entities resolved from recordEntityNames, including their
+  /// descendants.
+  public: std::unordered_set<Entity> recordEntities;
+
+  /// \brief Enqueue a state message for the publisher thread, so the sim
+  /// thread doesn't pay for serializing it to the recorder's raw
+  /// subscription. Blocks if the queue is full, which applies backpressure
+  /// instead of growing memory without bound.
+  /// \param[in] _msg State message to record.
+  /// \param[in] _keyframe True to publish on the keyframe topic instead of
+  /// the changed state topic.
+  public: void QueueState(msgs::SerializedStateMap &&_msg,
+      bool _keyframe = false);
+
+  /// \brief Publisher thread loop. Drains the state queue in order and
+  /// publishes each message to the state topic the recorder subscribes to.
+  public: void StatePubLoop();
+
+  /// \brief Stop the publisher thread after draining the queue.
+  public: void StopStateThread();
+
+  /// \brief Maximum number of state messages held in the queue before the
+  /// sim thread blocks on the publisher thread. The recorder stamps
+  /// messages with the sim clock on receipt, so this also bounds how far
+  /// recorded stamps can lag behind the step they were taken in.
+  public: static constexpr std::size_t kMaxQueuedStates{200u};
+
+  /// \brief Queue of state messages waiting to be published, consumed by
+  /// statePubThread. The flag marks keyframes. Protected by
+  /// stateQueueMutex.
+  public: std::deque<std::pair<msgs::SerializedStateMap, bool>> stateQueue;
+
+  /// \brief Mutex protecting stateQueue and stateThreadRunning.
+  public: std::mutex stateQueueMutex;
+
+  /// \brief Signals the publisher thread about new messages or shutdown,
+  /// and the sim thread about freed queue slots.
+  public: std::condition_variable stateQueueCv;
+
+  /// \brief Thread publishing queued state messages.
+  public: std::thread statePubThread;
+
+  /// \brief Whether the publisher thread should keep running. Protected by
+  /// stateQueueMutex.
+  public: bool stateThreadRunning{false};
 };
 
 bool LogRecordPrivate::started{false};
@@ -191,6 +272,10 @@ LogRecord::~LogRecord()
 {
   if (this->dataPtr->instStarted)
   {
+    // Drain pending states before stopping the recorder so the tail of the
+    // log isn't lost.
+    this->dataPtr->StopStateThread();
+
     // Use gz-transport directly
     this->dataPtr->recorder.Stop();
 
@@ -220,6 +305,58 @@ void LogRecord::Configure(const Entity &_entity,
     std::chrono::duration<double>(
     _sdf->Get<double>("record_period", 0.0).first));
 
+  this->dataPtr->keyframePeriod =
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::duration<double>(
+    _sdf->Get<double>("keyframe_period", 60.0).first));
+
+  // Optional filters limiting what the state recording contains. Filtering
+  // happens before serialization, so it cuts both the sim-thread cost of
+  // building the change set and the size of the log on disk.
+  if (_sdf->HasElement("record_component"))
+  {
+    auto compElem = _sdf->FindElement("record_component");
+    while (compElem)
+    {
+      std::string compName = compElem->Get<std::string>();
+      ComponentTypeId typeId = kComponentTypeIdInvalid;
+      auto *factory = components::Factory::Instance();
+      for (const auto &id : factory->TypeIds())
+      {
+        // Accept the registered name or its unqualified suffix, e.g.
+        // "gz_sim_components.Pose" or just "Pose".
+        std::string name = factory->Name(id);
+        if (name == compName ||
+            name.substr(name.rfind('.') + 1) == compName)
+        {
+          typeId = id;
+          break;
+        }
+      }
+      if (kComponentTypeIdInvalid != typeId)
+      {
+        this->dataPtr->recordComponentTypes.insert(typeId);
+      }
+      else
+      {
+        gzwarn << "Unknown component type [" << compName
+                << "] in <record_component>. Ignoring." << std::endl;
+      }
+      compElem = compElem->GetNextElement("record_component");
+    }
+  }
+
+  if (_sdf->HasElement("record_entity"))
+  {
+    auto entityElem = _sdf->FindElement("record_entity");
+    while (entityElem)
+    {
+      this->dataPtr->recordEntityNames.push_back(
+          entityElem->Get<std::string>());
+      entityElem = entityElem->GetNextElement("record_entity");
+    }
+  }
+
   this->dataPtr->compress = _sdf->Get<bool>("compress", false).first;
   this->dataPtr->cmpPath = _sdf->Get<std::string>("compress_path", "").first;
 
@@ -320,6 +457,19 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
            << stateTopic << "]." << std::endl;
   }
 
+  std::string kfTopic = "/world/" + this->worldName + "/log/keyframe";
+  auto validKfTopic = transport::TopicUtils::AsValidTopic(kfTopic);
+  if (!validKfTopic.empty())
+  {
+    this->kfPub = this->node.Advertise<msgs::SerializedStateMap>(
+        validKfTopic);
+  }
+  else
+  {
+    gzerr << "Failed to generate valid topic to publish keyframes. Tried ["
+           << kfTopic << "]." << std::endl;
+  }
+
   // Append file name
   std::string dbPath = common::joinPaths(this->logPath, "state.tlog");
   if (common::exists(dbPath))
@@ -332,8 +482,10 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
   // Add default topics if no topics were specified.
   gzdbg << "Recording default topic[" << sdfTopic << "].\n";
   gzdbg << "Recording default topic[" << stateTopic << "].\n";
+  gzdbg << "Recording default topic[" << kfTopic << "].\n";
   this->recorder.AddTopic(sdfTopic);
   this->recorder.AddTopic(stateTopic);
+  this->recorder.AddTopic(kfTopic);
 
   // Get the topics to record, if any.
   if (this->sdf->HasElement("record_topic"))
@@ -371,6 +523,11 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
   if (this->recorder.Start(dbPath) ==
       transport::log::RecorderError::SUCCESS)
   {
+    // Publish recorded states from a background thread so the sim thread
+    // only pays for building the change set and an enqueue.
+    this->stateThreadRunning = true;
+    this->statePubThread = std::thread(&LogRecordPrivate::StatePubLoop, this);
+
     this->instStarted = true;
     return true;
   }
@@ -378,6 +535,103 @@ bool LogRecordPrivate::Start(const std::string &_logPath,
     return false;
 }
 
+//////////////////////////////////////////////////
+void LogRecordPrivate::UpdateRecordFilters(const EntityComponentManager &_ecm)
+{
+  if (this->recordEntityNames.empty())
+    return;
+
+  if (!this->recordEntities.empty() && !_ecm.HasNewEntities())
+    return;
+
+  this->recordEntities.clear();
+  for (const auto &name : this->recordEntityNames)
+  {
+    auto entities = entitiesFromScopedName(name, _ecm);
+    if (entities.empty())
+    {
+      gzwarn << "No entity found matching <record_entity> [" << name
+              << "]." << std::endl;
+      continue;
+    }
+    for (const auto &entity : entities)
+    {
+      auto descendants = _ecm.Descendants(entity);
+      this->recordEntities.insert(descendants.begin(), descendants.end());
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::QueueState(msgs::SerializedStateMap &&_msg,
+    bool _keyframe)
+{
+  {
+    std::unique_lock<std::mutex> lock(this->stateQueueMutex);
+    if (this->stateQueue.size() >= kMaxQueuedStates)
+    {
+      static bool warned{false};
+      if (!warned)
+      {
+        warned = true;
+        gzwarn << "State recording can't keep up with the simulation, "
+               << "blocking until the recorder catches up." << std::endl;
+      }
+      this->stateQueueCv.wait(lock, [this]()
+          {
+            return this->stateQueue.size() < kMaxQueuedStates ||
+                !this->stateThreadRunning;
+          });
+    }
+    this->stateQueue.emplace_back(std::move(_msg), _keyframe);
+  }
+  this->stateQueueCv.notify_all();
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::StatePubLoop()
+{
+  std::unique_lock<std::mutex> lock(this->stateQueueMutex);
+  while (this->stateThreadRunning || !this->stateQueue.empty())
+  {
+    if (this->stateQueue.empty())
+    {
+      this->stateQueueCv.wait(lock, [this]()
+          {
+            return !this->stateQueue.empty() || !this->stateThreadRunning;
+          });
+      continue;
+    }
+
+    auto [msg, keyframe] = std::move(this->stateQueue.front());
+    this->stateQueue.pop_front();
+
+    // Publish without holding the lock; this is where the message gets
+    // serialized for the recorder's raw subscription.
+    lock.unlock();
+    if (keyframe)
+      this->kfPub.Publish(msg);
+    else
+      this->statePub.Publish(msg);
+    lock.lock();
+
+    // Wake a sim thread blocked on a full queue.
+    this->stateQueueCv.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+void LogRecordPrivate::StopStateThread()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->stateQueueMutex);
+    this->stateThreadRunning = false;
+  }
+  this->stateQueueCv.notify_all();
+  if (this->statePubThread.joinable())
+    this->statePubThread.join();
+}
+
 //////////////////////////////////////////////////
 bool LogRecordPrivate::RecordResources() const
 {
@@ -717,16 +971,42 @@ void LogRecord::PostUpdate(const UpdateInfo &_info,
 
   // TODO(louise) Use the SceneBroadcaster's topic once that publishes
   // the changed state
-  // \todo(anyone) A potential enhancement here is have a keyframe mechanism
-  // to store complete state periodically, and then store incremental from
-  // that. It would reduce some of the compute on replaying
-  // (especially in tools like plotting or seeking through logs).
   if (record)
   {
+    // The change set has to be built here while the per-step change flags
+    // are valid, but publishing is handed to the background thread.
     msgs::SerializedStateMap stateMsg;
-    _ecm.ChangedState(stateMsg);
+    if (!this->dataPtr->recordComponentTypes.empty() ||
+        !this->dataPtr->recordEntityNames.empty())
+    {
+      // Filtered recording: serialize only the changed components matching
+      // the requested component types and entity subtrees.
+      this->dataPtr->UpdateRecordFilters(_ecm);
+      _ecm.State(stateMsg, this->dataPtr->recordEntities,
+          this->dataPtr->recordComponentTypes, false);
+    }
+    else
+    {
+      _ecm.ChangedState(stateMsg);
+    }
     if (!stateMsg.entities().empty())
-      this->dataPtr->statePub.Publish(stateMsg);
+      this->dataPtr->QueueState(std::move(stateMsg));
+  }
+
+  // Periodically record a full-state keyframe, independent of the
+  // record_period gating above, so playback can seek by jumping to the
+  // closest keyframe instead of replaying the log from the beginning.
+  if (this->dataPtr->keyframePeriod >
+      std::chrono::steady_clock::duration::zero() &&
+      (_info.simTime - this->dataPtr->lastKeyframeSimTime) >=
+      this->dataPtr->keyframePeriod)
+  {
+    this->dataPtr->lastKeyframeSimTime = _info.simTime;
+    this->dataPtr->UpdateRecordFilters(_ecm);
+    msgs::SerializedStateMap kfMsg;
+    _ecm.State(kfMsg, this->dataPtr->recordEntities,
+        this->dataPtr->recordComponentTypes, true);
+    this->dataPtr->QueueState(std::move(kfMsg), true);
   }
 
   // If there are new models loaded, save meshes and textures
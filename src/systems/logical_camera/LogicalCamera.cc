@@ -19,11 +19,13 @@
 
 #include <gz/msgs/logical_camera_image.pb.h>
 
+#include <cmath>
 #include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
 #include <gz/plugin/Register.hh>
@@ -65,6 +67,16 @@ class gz::sim::systems::LogicalCameraPrivate
   /// `PreUpdate`.
   public: std::unordered_set<Entity> newSensors;
 
+  /// \brief Sensors that are due for a measurement this step and have
+  /// subscribers. Gathered once per step so that model poses are only
+  /// scattered into the sensors that will actually publish. Kept as a
+  /// member to reuse its allocation.
+  public: std::unordered_set<Entity> dueSensors;
+
+  /// \brief Model names and poses gathered once per step and shared by
+  /// all cameras. Kept as a member to reuse its allocation.
+  public: std::vector<std::pair<std::string, math::Pose3d>> modelPoseCache;
+
   /// True if the rendering component is initialized
   public: bool initialized = false;
 
@@ -143,29 +155,35 @@ void LogicalCamera::PostUpdate(const UpdateInfo &_info,
   // Only update and publish if not paused.
   if (!_info.paused)
   {
-    // check to see if update is necessary
-    // we only update if there is at least one sensor that needs data
-    // and that sensor has subscribers.
+    // Gather the sensors that need data this step: due for a measurement
+    // and with subscribers. Model poses are only scattered into these
+    // sensors, so with many cameras at different rates each step only
+    // pays for the sensors that will actually publish.
     // note: gz-sensors does its own throttling. Here the check is mainly
     // to avoid doing work in the LogicalCameraPrivate::UpdateLogicalCameras
     // function
-    bool needsUpdate = false;
+    this->dataPtr->dueSensors.clear();
     for (auto &it : this->dataPtr->entitySensorMap)
     {
       if (it.second->NextDataUpdateTime() <= _info.simTime &&
           it.second->HasConnections())
       {
-        needsUpdate = true;
-        break;
+        this->dataPtr->dueSensors.insert(it.first);
       }
     }
-    if (!needsUpdate)
+    if (this->dataPtr->dueSensors.empty())
       return;
 
     this->dataPtr->UpdateLogicalCameras(_ecm);
 
     for (auto &it : this->dataPtr->entitySensorMap)
     {
+      if (this->dataPtr->dueSensors.find(it.first) ==
+          this->dataPtr->dueSensors.end())
+      {
+        continue;
+      }
+
       // Update sensor
       it.second->Update(_info.simTime, false);
     }
@@ -253,8 +271,9 @@ void LogicalCameraPrivate::UpdateLogicalCameras(
     const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("LogicalCameraPrivate::UpdateLogicalCameras");
-  std::map<std::string, math::Pose3d> modelPoses;
 
+  // Gather model names and poses once, shared by all cameras below.
+  this->modelPoseCache.clear();
   _ecm.Each<components::Model, components::Name, components::Pose>(
       [&](const Entity &,
         const components::Model *,
@@ -263,24 +282,44 @@ void LogicalCameraPrivate::UpdateLogicalCameras(
       {
         /// todo(anyone) We currently assume there are only top level models
         /// Update to retrieve world pose when nested models are supported.
-        modelPoses[_name->Data()] = _pose->Data();
+        this->modelPoseCache.emplace_back(_name->Data(), _pose->Data());
         return true;
       });
 
-
   _ecm.Each<components::LogicalCamera, components::WorldPose>(
     [&](const Entity &_entity,
         const components::LogicalCamera * /*_logicalCamera*/,
         const components::WorldPose *_worldPose)->bool
       {
+        // Skip sensors that aren't publishing this step.
+        if (this->dueSensors.find(_entity) == this->dueSensors.end())
+          return true;
+
         auto it = this->entitySensorMap.find(_entity);
         if (it != this->entitySensorMap.end())
         {
           const math::Pose3d &worldPose = _worldPose->Data();
           it->second->SetPose(worldPose);
-          // Make a copy of modelPoses s.t. SetModelPoses can take ownership
-          auto modelPoses_ = modelPoses;
-          it->second->SetModelPoses(std::move(modelPoses_));
+
+          // Only hand the sensor models that can possibly be inside its
+          // frustum. No point in the frustum is farther from the camera
+          // than the far plane's corners, so a squared-distance check
+          // against that radius is a conservative cull that lets the
+          // sensor's exact frustum test run on candidates only.
+          const double far = it->second->Far();
+          const double halfW =
+              far * std::tan(it->second->HorizontalFOV().Radian() / 2.0);
+          const double aspect = it->second->AspectRatio();
+          const double halfH = aspect > 0.0 ? halfW / aspect : halfW;
+          const double reachSq = far * far + halfW * halfW + halfH * halfH;
+
+          std::map<std::string, math::Pose3d> candidates;
+          for (const auto &[name, pose] : this->modelPoseCache)
+          {
+            if ((pose.Pos() - worldPose.Pos()).SquaredLength() <= reachSq)
+              candidates[name] = pose;
+          }
+          it->second->SetModelPoses(std::move(candidates));
         }
         else
         {
@@ -131,9 +131,20 @@ class gz::sim::systems::MagnetometerPrivate
   /// `PreUpdate`.
   public: std::unordered_set<Entity> newSensors;
 
+  /// \brief Sensors that are due for a measurement this step and have
+  /// subscribers. Gathered once per step so the magnetic field lookup is
+  /// only done for sensors that will actually publish. Kept as a member
+  /// to reuse its allocation.
+  public: std::unordered_set<Entity> dueSensors;
+
   /// True if the rendering component is initialized
   public: bool initialized = false;
 
+  /// \brief Keep track of world ID, which is equivalent to the scene's
+  /// root visual.
+  /// Defaults to zero, which is considered invalid by Gazebo.
+  public: Entity worldEntity = kNullEntity;
+
   /// \brief True if the magnetic field is reported in gauss rather than tesla.
   public: bool useUnitsGauss = true;
 
@@ -312,28 +323,34 @@ void Magnetometer::PostUpdate(const UpdateInfo &_info,
   // Only update and publish if not paused.
   if (!_info.paused)
   {
-    // check to see if update is necessary
-    // we only update if there is at least one sensor that needs data
-    // and that sensor has subscribers.
+    // Gather the sensors that need data this step: due for a measurement
+    // and with subscribers. The magnetic field lookup is only done for
+    // these sensors, so each step only pays for the sensors that will
+    // actually publish.
     // note: gz-sensors does its own throttling. Here the check is mainly
     // to avoid doing work in the MagnetometerPrivate::Update function
-    bool needsUpdate = false;
+    this->dataPtr->dueSensors.clear();
     for (auto &it : this->dataPtr->entitySensorMap)
     {
       if (it.second->NextDataUpdateTime() <= _info.simTime &&
           it.second->HasConnections())
       {
-        needsUpdate = true;
-        break;
+        this->dataPtr->dueSensors.insert(it.first);
       }
     }
-    if (!needsUpdate)
+    if (this->dataPtr->dueSensors.empty())
       return;
 
     this->dataPtr->Update(_ecm);
 
     for (auto &it : this->dataPtr->entitySensorMap)
     {
+      if (this->dataPtr->dueSensors.find(it.first) ==
+          this->dataPtr->dueSensors.end())
+      {
+        continue;
+      }
+
       // Update measurement time
       it.second->Update(_info.simTime, false);
     }
@@ -393,15 +410,18 @@ void MagnetometerPrivate::AddMagnetometer(
 void MagnetometerPrivate::CreateSensors(const EntityComponentManager &_ecm)
 {
   GZ_PROFILE("MagnetometerPrivate::CreateMagnetometerEntities");
-  auto worldEntity = _ecm.EntityByComponents(components::World());
-  if (kNullEntity == worldEntity)
+  // Get World Entity
+  if (kNullEntity == this->worldEntity)
+    this->worldEntity = _ecm.EntityByComponents(components::World());
+  if (kNullEntity == this->worldEntity)
   {
     gzerr << "Missing world entity." << std::endl;
     return;
   }
 
   // Get the world magnetic field (defined in world frame)
-  auto worldField = _ecm.Component<components::MagneticField>(worldEntity);
+  auto worldField =
+      _ecm.Component<components::MagneticField>(this->worldEntity);
   if (nullptr == worldField)
   {
     gzerr << "World missing magnetic field." << std::endl;
@@ -448,6 +468,10 @@ void MagnetometerPrivate::Update(
         const components::Magnetometer * /*_magnetometer*/,
         const components::WorldPose *_worldPose)->bool
       {
+        // Skip sensors that aren't publishing this step.
+        if (this->dueSensors.find(_entity) == this->dueSensors.end())
+          return true;
+
         auto it = this->entitySensorMap.find(_entity);
         if (it != this->entitySensorMap.end())
         {
@@ -16,6 +16,8 @@
  */
 #include "ModelPhotoShoot.hh"
 
+#include <future>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -23,6 +25,7 @@
 #include <gz/common/Image.hh>
 #include <gz/plugin/Register.hh>
 #include <gz/rendering/Camera.hh>
+#include <gz/rendering/Image.hh>
 #include <gz/rendering/Scene.hh>
 #include <gz/rendering/RenderingIface.hh>
 #include <gz/rendering/Visual.hh>
@@ -48,10 +51,14 @@ class gz::sim::systems::ModelPhotoShootPrivate
   /// \brief Callback for pos rendering operations.
   public: void PerformPostRenderingOperations();
 
-  /// \brief Save a pitcture with the camera from the given pose.
+  /// \brief Save a pitcture with the camera from the given pose. The
+  /// capture reuses _cameraImage as the render buffer and the PNG
+  /// encoding/writing happens asynchronously so the next capture isn't
+  /// delayed behind it.
   public: void SavePicture (const gz::rendering::CameraPtr _camera,
                     const gz::math::Pose3d &_pose,
-                    const std::string &_fileName) const;
+                    const std::string &_fileName,
+                    gz::rendering::Image &_cameraImage);
 
   /// \brief Name of the loaded model.
   public: std::string modelName;
@@ -73,6 +80,10 @@ class gz::sim::systems::ModelPhotoShootPrivate
 
   /// \brief File to save translation and scaling info.
   public: std::ofstream savingFile;
+
+  /// \brief Pending asynchronous picture writes. The futures block on
+  /// destruction, so all files are on disk before the plugin goes away.
+  public: std::vector<std::future<void>> saveFutures;
 };
 
 //////////////////////////////////////////////////
@@ -242,41 +253,44 @@ void ModelPhotoShootPrivate::PerformPostRenderingOperations()
           this->savingFile << "Scaling: " << scaling << std::endl;
         }
 
+        // One render buffer shared by all the captures
+        gz::rendering::Image cameraImage = camera->CreateImage();
+
         gz::math::Pose3d pose;
         // Perspective view
         pose.Pos().Set(1.6 / scaling + translation.X(),
                        -1.6 / scaling + translation.Y(),
                        1.2 / scaling + translation.Z());
         pose.Rot().SetFromEuler(0, GZ_DTOR(30), GZ_DTOR(-225));
-        SavePicture(camera, pose, "1.png");
+        SavePicture(camera, pose, "1.png", cameraImage);
 
         // Top view
         pose.Pos().Set(0 + translation.X(),
                        0 + translation.Y(),
                        2.2 / scaling + translation.Z());
         pose.Rot().SetFromEuler(0, GZ_DTOR(90), 0);
-        SavePicture(camera, pose, "2.png");
+        SavePicture(camera, pose, "2.png", cameraImage);
 
         // Front view
         pose.Pos().Set(2.2 / scaling + translation.X(),
                        0 + translation.Y(),
                        0 + translation.Z());
         pose.Rot().SetFromEuler(0, 0, GZ_DTOR(-180));
-        SavePicture(camera, pose, "3.png");
+        SavePicture(camera, pose, "3.png", cameraImage);
 
         // Side view
         pose.Pos().Set(0 + translation.X(),
                        2.2 / scaling + translation.Y(),
                        0 + translation.Z());
         pose.Rot().SetFromEuler(0, 0, GZ_DTOR(-90));
-        SavePicture(camera, pose, "4.png");
+        SavePicture(camera, pose, "4.png", cameraImage);
 
         // Back view
         pose.Pos().Set(-2.2 / scaling + translation.X(),
                        0 + translation.Y(),
                        0 + translation.Z());
         pose.Rot().SetFromEuler(0, 0, 0);
-        SavePicture(camera, pose, "5.png");
+        SavePicture(camera, pose, "5.png", cameraImage);
 
         this->takePicture = false;
       }
@@ -288,22 +302,30 @@ void ModelPhotoShootPrivate::PerformPostRenderingOperations()
 void ModelPhotoShootPrivate::SavePicture(
                                   const gz::rendering::CameraPtr _camera,
                                   const gz::math::Pose3d &_pose,
-                                  const std::string &_fileName) const
+                                  const std::string &_fileName,
+                                  gz::rendering::Image &_cameraImage)
 {
   unsigned int width = _camera->ImageWidth();
   unsigned int height = _camera->ImageHeight();
-  gz::common::Image image;
 
   _camera->SetWorldPose(_pose);
-  auto cameraImage = _camera->CreateImage();
-  _camera->Capture(cameraImage);
+  _camera->Capture(_cameraImage);
   auto formatStr =
       gz::rendering::PixelUtil::Name(_camera->ImageFormat());
   auto format = gz::common::Image::ConvertPixelFormat(formatStr);
-  image.SetFromData(cameraImage.Data<unsigned char>(), width, height, format);
-  image.SavePNG(_fileName);
 
-  gzdbg << "Saved image to [" << _fileName << "]" << std::endl;
+  // SetFromData copies the buffer, so the render image can be reused for
+  // the next capture while the PNG is encoded and written in the
+  // background.
+  auto image = std::make_shared<gz::common::Image>();
+  image->SetFromData(_cameraImage.Data<unsigned char>(), width, height,
+      format);
+  this->saveFutures.push_back(std::async(std::launch::async,
+      [image, _fileName]()
+      {
+        image->SavePNG(_fileName);
+        gzdbg << "Saved image to [" << _fileName << "]" << std::endl;
+      }));
 }
 
 GZ_ADD_PLUGIN(ModelPhotoShoot, gz::sim::System,
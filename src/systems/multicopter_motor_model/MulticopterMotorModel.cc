@@ -26,6 +26,8 @@
 
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <gz/msgs/actuators.pb.h>
 
@@ -121,29 +123,56 @@ enum class MotorType {
 
 class gz::sim::systems::MulticopterMotorModelPrivate
 {
-  /// \brief Callback for actuator commands.
-  public: void OnActuatorMsg(const msgs::Actuators &_msg);
+  /// \brief Per-rotor state. All rotors of one plugin instance share the
+  /// aerodynamic coefficients, the motor type and the actuator command
+  /// subscription.
+  public: struct Rotor
+  {
+    /// \brief Joint Entity
+    Entity jointEntity{kNullEntity};
 
-  /// \brief Apply link forces and moments based on propeller state.
-  public: void UpdateForcesAndMoments(EntityComponentManager &_ecm);
+    /// \brief Joint name
+    std::string jointName;
+
+    /// \brief Link Entity
+    Entity linkEntity{kNullEntity};
+
+    /// \brief Link name
+    std::string linkName;
+
+    /// \brief Parent link Entity
+    Entity parentLinkEntity{kNullEntity};
+
+    /// \brief Parent link name
+    std::string parentLinkName;
+
+    /// \brief Index of motor in Actuators msg on multirotor_base.
+    int actuatorNumber = 0;
 
-  /// \brief Joint Entity
-  public: Entity jointEntity;
+    /// \brief Turning direction of the motor.
+    int turningDirection = turning_direction::kCw;
 
-  /// \brief Joint name
-  public: std::string jointName;
+    /// \brief Reference input to motor. For MotorType kVelocity, this
+    /// is the reference angular velocity in rad/s.
+    double refMotorInput = 0.0;
 
-  /// \brief Link Entity
-  public: Entity linkEntity;
+    /// \brief Filter on rotor velocity that has different time constants
+    /// for increasing and decreasing values.
+    std::unique_ptr<FirstOrderFilter<double>> rotorVelocityFilter;
 
-  /// \brief Link name
-  public: std::string linkName;
+    /// \brief True while all the entities and components this rotor needs
+    /// are available.
+    bool ready = false;
+  };
 
-  /// \brief Parent link Entity
-  public: Entity parentLinkEntity;
+  /// \brief Callback for actuator commands.
+  public: void OnActuatorMsg(const msgs::Actuators &_msg);
+
+  /// \brief Apply link forces and moments based on propeller state.
+  public: void UpdateForcesAndMoments(EntityComponentManager &_ecm);
 
-  /// \brief Parent link name
-  public: std::string parentLinkName;
+  /// \brief Rotors driven by this plugin instance.
+  public: std::vector<Rotor> rotors;
 
   /// \brief Model interface
   public: Model model{kNullEntity};
@@ -157,12 +186,6 @@ class gz::sim::systems::MulticopterMotorModelPrivate
   /// \brief Sampling time (from motor_model.hpp).
   public: double samplingTime = 0.01;
 
-  /// \brief Index of motor in Actuators msg on multirotor_base.
-  public: int actuatorNumber = 0;
-
-  /// \brief Turning direction of the motor.
-  public: int turningDirection = turning_direction::kCw;
-
   /// \brief Type of input command to motor.
   public: MotorType motorType = MotorType::kVelocity;
 
@@ -180,10 +203,6 @@ class gz::sim::systems::MulticopterMotorModelPrivate
   /// The default value is taken from gazebo_motor_model.h
   public: double motorConstant = 8.54858e-06;
 
-  /// \brief Reference input to motor. For MotorType kVelocity, this
-  /// is the reference angular velocity in rad/s.
-  public: double refMotorInput = 0.0;
-
   /// \brief Rolling moment coefficient with units of N*m / (m/s^2).
   /// The default value is taken from gazebo_motor_model.h
   public: double rollingMomentCoefficient = 1.0e-6;
@@ -207,10 +226,6 @@ class gz::sim::systems::MulticopterMotorModelPrivate
   /// The default value is taken from gazebo_motor_model.h
   public: double timeConstantUp = 1.0 / 80.0;
 
-  /// \brief Filter on rotor velocity that has different time constants
-  /// for increasing and decreasing values.
-  public: std::unique_ptr<FirstOrderFilter<double>> rotorVelocityFilter;
-
   /// \brief Received Actuators message. This is nullopt if no message has been
   /// received.
   public: std::optional<msgs::Actuators> recvdActuatorsMsg;
@@ -222,6 +237,75 @@ class gz::sim::systems::MulticopterMotorModelPrivate
   public: transport::Node node;
 };
 
+//////////////////////////////////////////////////
+/// \brief Parse the per-rotor parameters out of an SDF element, either a
+/// <rotor> block or the top level plugin element (single-rotor layout).
+/// \param[in] _sdf Element holding the parameters.
+/// \param[out] _rotor Rotor to fill in.
+/// \return True if the rotor is usable.
+static bool ParseRotorParams(const sdf::ElementPtr &_sdf,
+    MulticopterMotorModelPrivate::Rotor &_rotor)
+{
+  if (_sdf->HasElement("jointName"))
+  {
+    _rotor.jointName = _sdf->Get<std::string>("jointName");
+  }
+
+  if (_rotor.jointName.empty())
+  {
+    gzerr << "MulticopterMotorModel found an empty jointName parameter. "
+           << "Failed to initialize.";
+    return false;
+  }
+
+  if (_sdf->HasElement("linkName"))
+  {
+    _rotor.linkName = _sdf->Get<std::string>("linkName");
+  }
+
+  if (_rotor.linkName.empty())
+  {
+    gzerr << "MulticopterMotorModel found an empty linkName parameter. "
+           << "Failed to initialize.";
+    return false;
+  }
+
+  if (_sdf->HasElement("actuator_number"))
+  {
+    _rotor.actuatorNumber =
+      _sdf->GetElement("actuator_number")->Get<int>();
+  }
+  else if (_sdf->HasElement("motorNumber"))
+  {
+    _rotor.actuatorNumber =
+      _sdf->GetElement("motorNumber")->Get<int>();
+    gzwarn << "<motorNumber> is depricated, "
+           << "please use <actuator_number>.\n";
+  }
+  else
+  {
+    gzerr << "Please specify a actuator_number.\n";
+  }
+
+  if (_sdf->HasElement("turningDirection"))
+  {
+    auto turningDirection =
+        _sdf->GetElement("turningDirection")->Get<std::string>();
+    if (turningDirection == "cw")
+      _rotor.turningDirection = turning_direction::kCw;
+    else if (turningDirection == "ccw")
+      _rotor.turningDirection = turning_direction::kCcw;
+    else
+      gzerr << "Please only use 'cw' or 'ccw' as turningDirection.\n";
+  }
+  else
+  {
+    gzerr << "Please specify a turning direction ('cw' or 'ccw').\n";
+  }
+
+  return true;
+}
+
 //////////////////////////////////////////////////
 MulticopterMotorModel::MulticopterMotorModel()
   : dataPtr(std::make_unique<MulticopterMotorModelPrivate>())
@@ -258,63 +342,28 @@ void MulticopterMotorModel::Configure(const Entity &_entity,
     this->dataPtr->robotNamespace = this->dataPtr->model.Name(_ecm);
   }
 
-  // Get params from SDF
-  if (sdfClone->HasElement("jointName"))
-  {
-    this->dataPtr->jointName = sdfClone->Get<std::string>("jointName");
-  }
-
-  if (this->dataPtr->jointName.empty())
-  {
-    gzerr << "MulticopterMotorModel found an empty jointName parameter. "
-           << "Failed to initialize.";
-    return;
-  }
-
-  if (sdfClone->HasElement("linkName"))
-  {
-    this->dataPtr->linkName = sdfClone->Get<std::string>("linkName");
-  }
-
-  if (this->dataPtr->linkName.empty())
-  {
-    gzerr << "MulticopterMotorModel found an empty linkName parameter. "
-           << "Failed to initialize.";
-    return;
-  }
-
-  if (sdfClone->HasElement("actuator_number"))
-  {
-    this->dataPtr->actuatorNumber =
-      sdfClone->GetElement("actuator_number")->Get<int>();
-  }
-  else if (sdfClone->HasElement("motorNumber"))
+  // Get params from SDF. Several rotors may be driven by one plugin
+  // instance through repeated <rotor> blocks; the flat single-rotor layout
+  // is still accepted.
+  if (sdfClone->HasElement("rotor"))
   {
-    this->dataPtr->actuatorNumber =
-      sdfClone->GetElement("motorNumber")->Get<int>();
-    gzwarn << "<motorNumber> is depricated, "
-           << "please use <actuator_number>.\n";
+    for (auto elem = sdfClone->GetElement("rotor"); elem;
+         elem = elem->GetNextElement("rotor"))
+    {
+      MulticopterMotorModelPrivate::Rotor rotor;
+      if (ParseRotorParams(elem, rotor))
+        this->dataPtr->rotors.push_back(std::move(rotor));
+    }
   }
   else
   {
-    gzerr << "Please specify a actuator_number.\n";
+    MulticopterMotorModelPrivate::Rotor rotor;
+    if (ParseRotorParams(sdfClone, rotor))
+      this->dataPtr->rotors.push_back(std::move(rotor));
   }
 
-  if (sdfClone->HasElement("turningDirection"))
-  {
-    auto turningDirection =
-        sdfClone->GetElement("turningDirection")->Get<std::string>();
-    if (turningDirection == "cw")
-      this->dataPtr->turningDirection = turning_direction::kCw;
-    else if (turningDirection == "ccw")
-      this->dataPtr->turningDirection = turning_direction::kCcw;
-    else
-      gzerr << "Please only use 'cw' or 'ccw' as turningDirection.\n";
-  }
-  else
-  {
-    gzerr << "Please specify a turning direction ('cw' or 'ccw').\n";
-  }
+  if (this->dataPtr->rotors.empty())
+    return;
 
   if (sdfClone->HasElement("motorType"))
   {
@@ -366,11 +415,14 @@ void MulticopterMotorModel::Configure(const Entity &_entity,
   sdfClone->Get<double>("rotorVelocitySlowdownSim",
       this->dataPtr->rotorVelocitySlowdownSim, 10);
 
-  // Create the first order filter.
-  this->dataPtr->rotorVelocityFilter =
-      std::make_unique<FirstOrderFilter<double>>(
-          this->dataPtr->timeConstantUp, this->dataPtr->timeConstantDown,
-          this->dataPtr->refMotorInput);
+  // Create the first order filters.
+  for (auto &rotor : this->dataPtr->rotors)
+  {
+    rotor.rotorVelocityFilter =
+        std::make_unique<FirstOrderFilter<double>>(
+            this->dataPtr->timeConstantUp, this->dataPtr->timeConstantDown,
+            rotor.refMotorInput);
+  }
 
   // Subscribe to actuator command messages
   std::string topic = transport::TopicUtils::AsValidTopic(
@@ -403,68 +455,75 @@ void MulticopterMotorModel::PreUpdate(const UpdateInfo &_info,
            << "s]. System may not work properly." << std::endl;
   }
 
-  // If the joint or links haven't been identified yet, look for them
-  if (this->dataPtr->jointEntity == kNullEntity)
+  for (auto &rotor : this->dataPtr->rotors)
   {
-    this->dataPtr->jointEntity =
-        this->dataPtr->model.JointByName(_ecm, this->dataPtr->jointName);
+    // If the joint or links haven't been identified yet, look for them
+    if (rotor.jointEntity == kNullEntity)
+    {
+      rotor.jointEntity =
+          this->dataPtr->model.JointByName(_ecm, rotor.jointName);
 
-    const auto parentLinkName = _ecm.Component<components::ParentLinkName>(
-        this->dataPtr->jointEntity);
-    this->dataPtr->parentLinkName = parentLinkName->Data();
-  }
+      const auto parentLinkName = _ecm.Component<components::ParentLinkName>(
+          rotor.jointEntity);
+      rotor.parentLinkName = parentLinkName->Data();
+    }
 
-  if (this->dataPtr->linkEntity == kNullEntity)
-  {
-    this->dataPtr->linkEntity =
-        this->dataPtr->model.LinkByName(_ecm, this->dataPtr->linkName);
-  }
+    if (rotor.linkEntity == kNullEntity)
+    {
+      rotor.linkEntity =
+          this->dataPtr->model.LinkByName(_ecm, rotor.linkName);
+    }
 
-  if (this->dataPtr->parentLinkEntity == kNullEntity)
-  {
-    this->dataPtr->parentLinkEntity =
-        this->dataPtr->model.LinkByName(_ecm, this->dataPtr->parentLinkName);
-  }
+    if (rotor.parentLinkEntity == kNullEntity)
+    {
+      rotor.parentLinkEntity =
+          this->dataPtr->model.LinkByName(_ecm, rotor.parentLinkName);
+    }
 
-  if (this->dataPtr->jointEntity == kNullEntity ||
-      this->dataPtr->linkEntity == kNullEntity ||
-      this->dataPtr->parentLinkEntity == kNullEntity)
-    return;
+    if (rotor.jointEntity == kNullEntity ||
+        rotor.linkEntity == kNullEntity ||
+        rotor.parentLinkEntity == kNullEntity)
+    {
+      rotor.ready = false;
+      continue;
+    }
 
-  // skip UpdateForcesAndMoments if needed components are missing
-  bool doUpdateForcesAndMoments = true;
+    // skip UpdateForcesAndMoments for this rotor if needed components are
+    // missing
+    rotor.ready = true;
 
-  const auto jointVelocity = _ecm.Component<components::JointVelocity>(
-      this->dataPtr->jointEntity);
-  if (!jointVelocity)
-  {
-    _ecm.CreateComponent(this->dataPtr->jointEntity,
-        components::JointVelocity());
-    doUpdateForcesAndMoments = false;
-  }
-  else if (jointVelocity->Data().empty())
-  {
-    doUpdateForcesAndMoments = false;
-  }
+    const auto jointVelocity = _ecm.Component<components::JointVelocity>(
+        rotor.jointEntity);
+    if (!jointVelocity)
+    {
+      _ecm.CreateComponent(rotor.jointEntity,
+          components::JointVelocity());
+      rotor.ready = false;
+    }
+    else if (jointVelocity->Data().empty())
+    {
+      rotor.ready = false;
+    }
 
-  if (!_ecm.Component<components::WorldPose>(this->dataPtr->linkEntity))
-  {
-    _ecm.CreateComponent(this->dataPtr->linkEntity, components::WorldPose());
-    doUpdateForcesAndMoments = false;
-  }
-  if (!_ecm.Component<components::WorldLinearVelocity>(
-      this->dataPtr->linkEntity))
-  {
-    _ecm.CreateComponent(this->dataPtr->linkEntity,
-        components::WorldLinearVelocity());
-    doUpdateForcesAndMoments = false;
-  }
+    if (!_ecm.Component<components::WorldPose>(rotor.linkEntity))
+    {
+      _ecm.CreateComponent(rotor.linkEntity, components::WorldPose());
+      rotor.ready = false;
+    }
+    if (!_ecm.Component<components::WorldLinearVelocity>(
+        rotor.linkEntity))
+    {
+      _ecm.CreateComponent(rotor.linkEntity,
+          components::WorldLinearVelocity());
+      rotor.ready = false;
+    }
 
-  if (!_ecm.Component<components::WorldPose>(this->dataPtr->parentLinkEntity))
-  {
-    _ecm.CreateComponent(this->dataPtr->parentLinkEntity,
-        components::WorldPose());
-    doUpdateForcesAndMoments = false;
+    if (!_ecm.Component<components::WorldPose>(rotor.parentLinkEntity))
+    {
+      _ecm.CreateComponent(rotor.parentLinkEntity,
+          components::WorldPose());
+      rotor.ready = false;
+    }
   }
 
   // Nothing left to do if paused.
@@ -473,10 +532,7 @@ void MulticopterMotorModel::PreUpdate(const UpdateInfo &_info,
 
   this->dataPtr->samplingTime =
     std::chrono::duration<double>(_info.dt).count();
-  if (doUpdateForcesAndMoments)
-  {
-    this->dataPtr->UpdateForcesAndMoments(_ecm);
-  }
+  this->dataPtr->UpdateForcesAndMoments(_ecm);
 }
 
 //////////////////////////////////////////////////
@@ -513,171 +569,181 @@ void MulticopterMotorModelPrivate::UpdateForcesAndMoments(
     }
   }
 
-  if (msg.has_value())
+  // The wind entity and its velocity are shared by every rotor.
+  Entity windEntity = _ecm.EntityByComponents(components::Wind());
+  auto windLinearVel =
+      _ecm.Component<components::WorldLinearVelocity>(windEntity);
+  math::Vector3d windSpeedWorld = windLinearVel ?
+      windLinearVel->Data() : math::Vector3d::Zero;
+
+  for (auto &rotor : this->rotors)
   {
-    if (this->actuatorNumber > msg->velocity_size() - 1)
-    {
-      gzerr << "You tried to access index " << this->actuatorNumber
-        << " of the Actuator velocity array which is of size "
-        << msg->velocity_size() << std::endl;
-      return;
-    }
+    if (!rotor.ready)
+      continue;
 
-    if (this->motorType == MotorType::kVelocity)
-    {
-      this->refMotorInput = std::min(
-          static_cast<double>(msg->velocity(this->actuatorNumber)),
-          static_cast<double>(this->maxRotVelocity));
-    }
-    //  else if (this->motorType == MotorType::kPosition)
-    else  // if (this->motorType == MotorType::kForce) {
+    if (msg.has_value())
     {
-      this->refMotorInput = msg->velocity(this->actuatorNumber);
-    }
-  }
+      if (rotor.actuatorNumber > msg->velocity_size() - 1)
+      {
+        gzerr << "You tried to access index " << rotor.actuatorNumber
+          << " of the Actuator velocity array which is of size "
+          << msg->velocity_size() << std::endl;
+        continue;
+      }
 
-  switch (this->motorType)
-  {
-    case (MotorType::kPosition):
-    {
-      // double err = joint_->GetAngle(0).Radian() - this->refMotorInput;
-      // double force = pids_.Update(err, this->samplingTime);
-      // joint_->SetForce(0, force);
-      break;
-    }
-    case (MotorType::kForce):
-    {
-      // joint_->SetForce(0, this->refMotorInput);
-      break;
-    }
-    default:  // MotorType::kVelocity
-    {
-      const auto jointVelocity = _ecm.Component<components::JointVelocity>(
-          this->jointEntity);
-      double motorRotVel = jointVelocity->Data()[0];
-      if (motorRotVel / (2 * GZ_PI) > 1 / (2 * this->samplingTime))
+      if (this->motorType == MotorType::kVelocity)
       {
-        gzerr << "Aliasing on motor [" << this->actuatorNumber
-              << "] might occur. Consider making smaller simulation time "
-                 "steps or raising the rotorVelocitySlowdownSim param.\n";
+        rotor.refMotorInput = std::min(
+            static_cast<double>(msg->velocity(rotor.actuatorNumber)),
+            static_cast<double>(this->maxRotVelocity));
       }
-      double realMotorVelocity =
-          motorRotVel * this->rotorVelocitySlowdownSim;
-      // Get the direction of the rotor rotation.
-      int realMotorVelocitySign =
-          (realMotorVelocity > 0) - (realMotorVelocity < 0);
-      // Assuming symmetric propellers (or rotors) for the thrust calculation.
-      double thrust = this->turningDirection * realMotorVelocitySign *
-                      realMotorVelocity * realMotorVelocity *
-                      this->motorConstant;
-
-      using Pose = math::Pose3d;
-      using Vector3 = math::Vector3d;
-
-      Link link(this->linkEntity);
-      const auto worldPose = link.WorldPose(_ecm);
-
-      // Apply a force to the link.
-      link.AddWorldForce(_ecm,
-                         worldPose->Rot().RotateVector(Vector3(0, 0, thrust)));
-
-      const auto jointPose = _ecm.Component<components::Pose>(
-          this->jointEntity);
-      if (!jointPose)
+      //  else if (this->motorType == MotorType::kPosition)
+      else  // if (this->motorType == MotorType::kForce) {
       {
-        gzerr << "joint " << this->jointName << " has no Pose"
-               << "component" << std::endl;
-        return;
+        rotor.refMotorInput = msg->velocity(rotor.actuatorNumber);
       }
-      // computer joint world pose by multiplying child link WorldPose
-      // with joint Pose
-      Pose jointWorldPose = *worldPose * jointPose->Data();
+    }
 
-      const auto jointAxisComp = _ecm.Component<components::JointAxis>(
-          this->jointEntity);
-      if (!jointAxisComp)
+    switch (this->motorType)
+    {
+      case (MotorType::kPosition):
       {
-        gzerr << "joint " << this->jointName << " has no JointAxis"
-               << "component" << std::endl;
-        return;
+        // double err = joint_->GetAngle(0).Radian() - rotor.refMotorInput;
+        // double force = pids_.Update(err, this->samplingTime);
+        // joint_->SetForce(0, force);
+        break;
       }
-
-      const auto worldLinearVel = link.WorldLinearVelocity(_ecm);
-
-      Entity windEntity = _ecm.EntityByComponents(components::Wind());
-      auto windLinearVel =
-          _ecm.Component<components::WorldLinearVelocity>(windEntity);
-      Vector3 windSpeedWorld = windLinearVel->Data();
-
-      // Forces from Philppe Martin's and Erwan Salaun's
-      // 2010 IEEE Conference on Robotics and Automation paper
-      // The True Role of Accelerometer Feedback in Quadrotor Control
-      // - \omega * \lambda_1 * V_A^{\perp}
-      Vector3 jointAxis =
-          jointWorldPose.Rot().RotateVector(jointAxisComp->Data().Xyz());
-      Vector3 bodyVelocityWorld = *worldLinearVel;
-      Vector3 relativeWindVelocityWorld = bodyVelocityWorld - windSpeedWorld;
-      Vector3 bodyVelocityPerpendicular =
-          relativeWindVelocityWorld -
-          (relativeWindVelocityWorld.Dot(jointAxis) * jointAxis);
-      Vector3 airDrag = -std::abs(realMotorVelocity) *
-                               this->rotorDragCoefficient *
-                               bodyVelocityPerpendicular;
-
-      // Apply air drag to link.
-      link.AddWorldForce(_ecm, airDrag);
-      // Moments get the parent link, such that the resulting torques can be
-      // applied.
-      Vector3 parentWorldTorque;
-      auto parentWrenchComp =
-        _ecm.Component<components::ExternalWorldWrenchCmd>(
-          this->parentLinkEntity);
-      // gazebo_motor_model.cpp subtracts the GetWorldCoGPose() of the
-      // child link from the parent but only uses the rotation component.
-      // Since GetWorldCoGPose() uses the link frame orientation, it
-      // is equivalent to use WorldPose().Rot().
-      Link parentLink(this->parentLinkEntity);
-      const auto parentWorldPose = parentLink.WorldPose(_ecm);
-      // The transformation from the parent_link to the link_.
-      // Pose poseDifference =
-      //  parent_links.at(0)->GetWorldCoGPose().Inverse()
-      //  * link_->GetWorldCoGPose()
-      Pose poseDifference = (*parentWorldPose).Inverse() * (*worldPose);
-      Vector3 dragTorque(
-          0, 0, -this->turningDirection * thrust * this->momentConstant);
-      // Transforming the drag torque into the parent frame to handle
-      // arbitrary rotor orientations.
-      Vector3 dragTorqueParentFrame =
-          poseDifference.Rot().RotateVector(dragTorque);
-      parentWorldTorque =
-          parentWorldPose->Rot().RotateVector(dragTorqueParentFrame);
-
-      Vector3 rollingMoment;
-      // - \omega * \mu_1 * V_A^{\perp}
-      rollingMoment = -std::abs(realMotorVelocity) *
-                       this->rollingMomentCoefficient *
-                       bodyVelocityPerpendicular;
-      parentWorldTorque += rollingMoment;
-      if (!parentWrenchComp)
+      case (MotorType::kForce):
       {
-        components::ExternalWorldWrenchCmd wrench;
-        msgs::Set(wrench.Data().mutable_torque(), parentWorldTorque);
-        _ecm.CreateComponent(this->parentLinkEntity, wrench);
+        // joint_->SetForce(0, rotor.refMotorInput);
+        break;
       }
-      else
+      default:  // MotorType::kVelocity
       {
-        msgs::Set(parentWrenchComp->Data().mutable_torque(),
-          msgs::Convert(parentWrenchComp->Data().torque()) + parentWorldTorque);
+        const auto jointVelocity = _ecm.Component<components::JointVelocity>(
+            rotor.jointEntity);
+        double motorRotVel = jointVelocity->Data()[0];
+        if (motorRotVel / (2 * GZ_PI) > 1 / (2 * this->samplingTime))
+        {
+          gzerr << "Aliasing on motor [" << rotor.actuatorNumber
+                << "] might occur. Consider making smaller simulation time "
+                   "steps or raising the rotorVelocitySlowdownSim param.\n";
+        }
+        double realMotorVelocity =
+            motorRotVel * this->rotorVelocitySlowdownSim;
+        // Get the direction of the rotor rotation.
+        int realMotorVelocitySign =
+            (realMotorVelocity > 0) - (realMotorVelocity < 0);
+        // Assuming symmetric propellers (or rotors) for the thrust
+        // calculation.
+        double thrust = rotor.turningDirection * realMotorVelocitySign *
+                        realMotorVelocity * realMotorVelocity *
+                        this->motorConstant;
+
+        using Pose = math::Pose3d;
+        using Vector3 = math::Vector3d;
+
+        Link link(rotor.linkEntity);
+        const auto worldPose = link.WorldPose(_ecm);
+
+        // Apply a force to the link.
+        link.AddWorldForce(_ecm,
+            worldPose->Rot().RotateVector(Vector3(0, 0, thrust)));
+
+        const auto jointPose = _ecm.Component<components::Pose>(
+            rotor.jointEntity);
+        if (!jointPose)
+        {
+          gzerr << "joint " << rotor.jointName << " has no Pose"
+                 << "component" << std::endl;
+          break;
+        }
+        // computer joint world pose by multiplying child link WorldPose
+        // with joint Pose
+        Pose jointWorldPose = *worldPose * jointPose->Data();
+
+        const auto jointAxisComp = _ecm.Component<components::JointAxis>(
+            rotor.jointEntity);
+        if (!jointAxisComp)
+        {
+          gzerr << "joint " << rotor.jointName << " has no JointAxis"
+                 << "component" << std::endl;
+          break;
+        }
+
+        const auto worldLinearVel = link.WorldLinearVelocity(_ecm);
+
+        // Forces from Philppe Martin's and Erwan Salaun's
+        // 2010 IEEE Conference on Robotics and Automation paper
+        // The True Role of Accelerometer Feedback in Quadrotor Control
+        // - \omega * \lambda_1 * V_A^{\perp}
+        Vector3 jointAxis =
+            jointWorldPose.Rot().RotateVector(jointAxisComp->Data().Xyz());
+        Vector3 bodyVelocityWorld = *worldLinearVel;
+        Vector3 relativeWindVelocityWorld = bodyVelocityWorld - windSpeedWorld;
+        Vector3 bodyVelocityPerpendicular =
+            relativeWindVelocityWorld -
+            (relativeWindVelocityWorld.Dot(jointAxis) * jointAxis);
+        Vector3 airDrag = -std::abs(realMotorVelocity) *
+                                 this->rotorDragCoefficient *
+                                 bodyVelocityPerpendicular;
+
+        // Apply air drag to link.
+        link.AddWorldForce(_ecm, airDrag);
+        // Moments get the parent link, such that the resulting torques can be
+        // applied.
+        Vector3 parentWorldTorque;
+        auto parentWrenchComp =
+          _ecm.Component<components::ExternalWorldWrenchCmd>(
+            rotor.parentLinkEntity);
+        // gazebo_motor_model.cpp subtracts the GetWorldCoGPose() of the
+        // child link from the parent but only uses the rotation component.
+        // Since GetWorldCoGPose() uses the link frame orientation, it
+        // is equivalent to use WorldPose().Rot().
+        Link parentLink(rotor.parentLinkEntity);
+        const auto parentWorldPose = parentLink.WorldPose(_ecm);
+        // The transformation from the parent_link to the link_.
+        // Pose poseDifference =
+        //  parent_links.at(0)->GetWorldCoGPose().Inverse()
+        //  * link_->GetWorldCoGPose()
+        Pose poseDifference = (*parentWorldPose).Inverse() * (*worldPose);
+        Vector3 dragTorque(
+            0, 0, -rotor.turningDirection * thrust * this->momentConstant);
+        // Transforming the drag torque into the parent frame to handle
+        // arbitrary rotor orientations.
+        Vector3 dragTorqueParentFrame =
+            poseDifference.Rot().RotateVector(dragTorque);
+        parentWorldTorque =
+            parentWorldPose->Rot().RotateVector(dragTorqueParentFrame);
+
+        Vector3 rollingMoment;
+        // - \omega * \mu_1 * V_A^{\perp}
+        rollingMoment = -std::abs(realMotorVelocity) *
+                         this->rollingMomentCoefficient *
+                         bodyVelocityPerpendicular;
+        parentWorldTorque += rollingMoment;
+        if (!parentWrenchComp)
+        {
+          components::ExternalWorldWrenchCmd wrench;
+          msgs::Set(wrench.Data().mutable_torque(), parentWorldTorque);
+          _ecm.CreateComponent(rotor.parentLinkEntity, wrench);
+        }
+        else
+        {
+          msgs::Set(parentWrenchComp->Data().mutable_torque(),
+            msgs::Convert(parentWrenchComp->Data().torque()) +
+            parentWorldTorque);
+        }
+        // Apply the filter on the motor's velocity.
+        double refMotorRotVel;
+        refMotorRotVel = rotor.rotorVelocityFilter->UpdateFilter(
+            rotor.refMotorInput, this->samplingTime);
+
+        _ecm.SetComponentData<components::JointVelocityCmd>(
+          rotor.jointEntity,
+          {rotor.turningDirection * refMotorRotVel
+                                  / this->rotorVelocitySlowdownSim});
       }
-      // Apply the filter on the motor's velocity.
-      double refMotorRotVel;
-      refMotorRotVel = this->rotorVelocityFilter->UpdateFilter(
-          this->refMotorInput, this->samplingTime);
-
-      _ecm.SetComponentData<components::JointVelocityCmd>(
-        this->jointEntity,
-        {this->turningDirection * refMotorRotVel
-                                / this->rotorVelocitySlowdownSim});
     }
   }
 }
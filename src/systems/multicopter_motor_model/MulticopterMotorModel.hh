@@ -33,6 +33,12 @@ namespace systems
 
   /// \brief This system applies a thrust force to models with spinning
   /// propellers. See examples/worlds/quadcopter.sdf for a demonstration.
+  ///
+  /// One plugin instance may drive all the rotors of a vehicle by wrapping
+  /// the per-rotor parameters (jointName, linkName, actuator_number,
+  /// turningDirection) in repeated <rotor> elements; the aerodynamic
+  /// coefficients and the command topic are then shared, and all rotors are
+  /// updated in one pass. The flat single-rotor layout is still accepted.
   class MulticopterMotorModel
       : public System,
         public ISystemConfigure,
@@ -39,6 +39,7 @@
 
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/JointPosition.hh"
+#include "gz/sim/LazyPublisher.hh"
 #include "gz/sim/Model.hh"
 #include "gz/sim/Util.hh"
 
@@ -79,14 +80,16 @@ class gz::sim::systems::OdometryPublisherPrivate
   /// \brief Last sim time odom was published.
   public: std::chrono::steady_clock::duration lastOdomPubTime{0};
 
-  /// \brief Odometry message publisher.
-  public: transport::Node::Publisher odomPub;
+  /// \brief Odometry message publisher. Lazy so messages are only
+  /// published while someone is subscribed.
+  public: LazyPublisher odomPub;
 
-  /// \brief Odometry with covariance message publisher.
-  public: transport::Node::Publisher odomCovPub;
+  /// \brief Odometry with covariance message publisher. Lazy, so the
+  /// covariance message copy only happens while someone is subscribed.
+  public: LazyPublisher odomCovPub;
 
-  /// \brief Pose vector (TF) message publisher.
-  public: transport::Node::Publisher tfPub;
+  /// \brief Pose vector (TF) message publisher. Lazy, see odomCovPub.
+  public: LazyPublisher tfPub;
 
   /// \brief Rolling mean accumulators for the linear velocity
   public: std::tuple<math::RollingMean, math::RollingMean, math::RollingMean>
@@ -110,6 +113,20 @@ class gz::sim::systems::OdometryPublisherPrivate
 
   /// \brief Gaussian noise
   public: double gaussianNoise = 0.0;
+
+  /// \brief Reused odometry message. The frame ids in the header are set
+  /// once at configure time; only the stamp, pose and twist are updated
+  /// per publish cycle, avoiding repeated protobuf allocation.
+  public: msgs::Odometry odomMsg;
+
+  /// \brief Reused odometry with covariance message. The constant
+  /// covariance matrix and header frame ids are populated once at
+  /// configure time.
+  public: msgs::OdometryWithCovariance odomCovMsg;
+
+  /// \brief Reused pose vector (TF) message holding a single pre-added
+  /// pose that is updated in place.
+  public: msgs::Pose_V tfMsg;
 };
 
 //////////////////////////////////////////////////
@@ -276,6 +293,42 @@ void OdometryPublisher::Configure(const Entity &_entity,
     gzmsg << "OdometryPublisher publishing Pose_V (TF) on ["
            << tfTopicValid << "]" << std::endl;
   }
+
+  // Prepare the reusable messages: the frame ids and the constant
+  // covariance matrix never change, so they are only set once here.
+  auto frame = this->dataPtr->odomMsg.mutable_header()->add_data();
+  frame->set_key("frame_id");
+  frame->add_value(this->dataPtr->odomFrame);
+  auto childFrame = this->dataPtr->odomMsg.mutable_header()->add_data();
+  childFrame->set_key("child_frame_id");
+  childFrame->add_value(this->dataPtr->robotBaseFrame);
+
+  this->dataPtr->odomCovMsg.mutable_header()->CopyFrom(
+      this->dataPtr->odomMsg.header());
+
+  // Populate the covariance matrix.
+  // Should the matrix me populated for pose as well ?
+  auto gn2 = this->dataPtr->gaussianNoise * this->dataPtr->gaussianNoise;
+  for (int i = 0; i < 36; i++)
+  {
+    if (i % 7 == 0)
+    {
+      this->dataPtr->odomCovMsg.mutable_pose_with_covariance()->
+        mutable_covariance()->add_data(gn2);
+      this->dataPtr->odomCovMsg.mutable_twist_with_covariance()->
+        mutable_covariance()->add_data(gn2);
+    }
+    else
+    {
+      this->dataPtr->odomCovMsg.mutable_pose_with_covariance()->
+        mutable_covariance()->add_data(0);
+      this->dataPtr->odomCovMsg.mutable_twist_with_covariance()->
+        mutable_covariance()->add_data(0);
+    }
+  }
+
+  this->dataPtr->tfMsg.add_pose()->mutable_header()->CopyFrom(
+      this->dataPtr->odomMsg.header());
 }
 
 //////////////////////////////////////////////////
@@ -343,9 +396,9 @@ void OdometryPublisherPrivate::UpdateOdometry(
     return;
   }
 
-  // Construct the odometry message and publish it.
+  // Update the reusable odometry message in place and publish it.
   //! [declarePoseMsg]
-  msgs::Odometry msg;
+  msgs::Odometry &msg = this->odomMsg;
   //! [declarePoseMsg]
 
   const std::chrono::duration<double> dt =
@@ -452,19 +505,9 @@ void OdometryPublisherPrivate::UpdateOdometry(
     std::get<2>(this->angularMean).Mean() +
     gz::math::Rand::DblNormal(0, this->gaussianNoise));
 
-  // Set the time stamp in the header.
-  msgs::Header header;
-  header.mutable_stamp()->CopyFrom(convert<msgs::Time>(_info.simTime));
-
-  // Set the frame ids.
-  auto frame = header.add_data();
-  frame->set_key("frame_id");
-  frame->add_value(odomFrame);
-  auto childFrame = header.add_data();
-  childFrame->set_key("child_frame_id");
-  childFrame->add_value(robotBaseFrame);
-
-  msg.mutable_header()->CopyFrom(header);
+  // Set the time stamp in the header. The frame ids were set once at
+  // configure time.
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
   this->lastUpdatePose = pose;
   this->lastUpdateTime = std::chrono::steady_clock::time_point(_info.simTime);
@@ -477,80 +520,64 @@ void OdometryPublisherPrivate::UpdateOdometry(
     return;
   }
   this->lastOdomPubTime = _info.simTime;
-  if (this->odomPub.Valid())
-  {
-    //! [publishMsg]
-    this->odomPub.Publish(msg);
-    //! [publishMsg]
-  }
-
-  // Generate odometry with covariance message and publish it.
-  msgs::OdometryWithCovariance msgCovariance;
-
-  // Set the time stamp in the header.
-  msgCovariance.mutable_header()->CopyFrom(header);
-
-  // Copy position from odometry msg.
-  msgCovariance.mutable_pose_with_covariance()->
-    mutable_pose()->mutable_position()->set_x(msg.pose().position().x());
-  msgCovariance.mutable_pose_with_covariance()->
-    mutable_pose()->mutable_position()->set_y(msg.pose().position().y());
-  msgCovariance.mutable_pose_with_covariance()->
-    mutable_pose()->mutable_position()->set_z(msg.pose().position().z());
-
-  // Copy orientation from odometry msg.
-  msgs::Set(msgCovariance.mutable_pose_with_covariance()->mutable_pose()->
-    mutable_orientation(), pose.Rot());
-
-  // Copy twist from odometry msg.
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_angular()->set_x(msg.twist().angular().x());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_angular()->set_y(msg.twist().angular().y());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_angular()->set_z(msg.twist().angular().z());
-
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_linear()->set_x(msg.twist().linear().x());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_linear()->set_y(msg.twist().linear().y());
-  msgCovariance.mutable_twist_with_covariance()->
-    mutable_twist()->mutable_linear()->set_z(msg.twist().linear().z());
-
-  // Populate the covariance matrix.
-  // Should the matrix me populated for pose as well ?
-  auto gn2 = this->gaussianNoise * this->gaussianNoise;
-  for (int i = 0; i < 36; i++)
-  {
-    if (i % 7 == 0)
-    {
-      msgCovariance.mutable_pose_with_covariance()->
-        mutable_covariance()->add_data(gn2);
-      msgCovariance.mutable_twist_with_covariance()->
-        mutable_covariance()->add_data(gn2);
-    }
-    else
-    {
-      msgCovariance.mutable_pose_with_covariance()->
-        mutable_covariance()->add_data(0);
-      msgCovariance.mutable_twist_with_covariance()->
-        mutable_covariance()->add_data(0);
-    }
-  }
-  if (this->odomCovPub.Valid())
-  {
-    this->odomCovPub.Publish(msgCovariance);
-  }
-
-  if (this->tfPub.Valid())
-  {
-    msgs::Pose_V tfMsg;
-    auto tfMsgPose = tfMsg.add_pose();
-    tfMsgPose->CopyFrom(msg.pose());
-    tfMsgPose->mutable_header()->CopyFrom(header);
-
-    this->tfPub.Publish(tfMsg);
-  }
+  //! [publishMsg]
+  this->odomPub.Publish([&]() -> const msgs::Odometry &
+      {
+        return msg;
+      });
+  //! [publishMsg]
+
+  // Update the reusable odometry with covariance message and publish it.
+  // The copies from the odometry message only happen while somebody is
+  // subscribed; the constant covariance matrix was populated once at
+  // configure time.
+  this->odomCovPub.Publish([&]() -> const msgs::OdometryWithCovariance &
+      {
+        msgs::OdometryWithCovariance &msgCovariance = this->odomCovMsg;
+
+        // Set the time stamp in the header.
+        msgCovariance.mutable_header()->mutable_stamp()->CopyFrom(
+            msg.header().stamp());
+
+        // Copy position from odometry msg.
+        msgCovariance.mutable_pose_with_covariance()->
+          mutable_pose()->mutable_position()->set_x(msg.pose().position().x());
+        msgCovariance.mutable_pose_with_covariance()->
+          mutable_pose()->mutable_position()->set_y(msg.pose().position().y());
+        msgCovariance.mutable_pose_with_covariance()->
+          mutable_pose()->mutable_position()->set_z(msg.pose().position().z());
+
+        // Copy orientation from odometry msg.
+        msgs::Set(msgCovariance.mutable_pose_with_covariance()->
+          mutable_pose()->mutable_orientation(), pose.Rot());
+
+        // Copy twist from odometry msg.
+        msgCovariance.mutable_twist_with_covariance()->
+          mutable_twist()->mutable_angular()->set_x(msg.twist().angular().x());
+        msgCovariance.mutable_twist_with_covariance()->
+          mutable_twist()->mutable_angular()->set_y(msg.twist().angular().y());
+        msgCovariance.mutable_twist_with_covariance()->
+          mutable_twist()->mutable_angular()->set_z(msg.twist().angular().z());
+
+        msgCovariance.mutable_twist_with_covariance()->
+          mutable_twist()->mutable_linear()->set_x(msg.twist().linear().x());
+        msgCovariance.mutable_twist_with_covariance()->
+          mutable_twist()->mutable_linear()->set_y(msg.twist().linear().y());
+        msgCovariance.mutable_twist_with_covariance()->
+          mutable_twist()->mutable_linear()->set_z(msg.twist().linear().z());
+
+        return msgCovariance;
+      });
+
+  this->tfPub.Publish([&]() -> const msgs::Pose_V &
+      {
+        auto tfMsgPose = this->tfMsg.mutable_pose(0);
+        tfMsgPose->mutable_position()->CopyFrom(msg.pose().position());
+        tfMsgPose->mutable_orientation()->CopyFrom(msg.pose().orientation());
+        tfMsgPose->mutable_header()->CopyFrom(msg.header());
+
+        return this->tfMsg;
+      });
 }
 
 GZ_ADD_PLUGIN(OdometryPublisher,
@@ -60,6 +60,9 @@ namespace systems
   /// - `<tf_topic>`: Custom topic on which this system will publish the
   /// transform from `odom_frame` to `robot_base_frame`. This element is
   /// optional, and the default value is `/model/{name_of_model}/pose`.
+  /// Multiple robots may share a single `<tf_topic>`: each message carries
+  /// the robot's frame ids in its header, so one aggregated topic can serve
+  /// a fleet-wide consumer.
   ///
   /// - `<dimensions>`: Number of dimensions to represent odometry. Only 2 and 3
   /// dimensional spaces are supported. This element is optional, and the
@@ -17,8 +17,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gz/common/Profiler.hh>
@@ -50,6 +53,9 @@ using namespace optical_tactile_sensor;
 
 class gz::sim::systems::OpticalTactilePluginPrivate
 {
+  /// \brief Destructor. Stops and joins the worker thread.
+  public: ~OpticalTactilePluginPrivate();
+
   /// \brief Load the Contact sensor from an sdf element
   /// \param[in] _ecm Immutable reference to the EntityComponentManager
   public: void Load(const EntityComponentManager &_ecm);
@@ -70,18 +76,22 @@ class gz::sim::systems::OpticalTactilePluginPrivate
   /// of the image, pointing rightwards
   /// \param[in] _j Vertical camera coordinate defined in the top-left corner
   /// of the image, pointing downwards
+  /// \param[in] _msg Message from the depth camera
   /// \param[in] _msgBuffer Buffer with the point cloud data
   /// \returns The corresponding (X,Y,Z) point
   public: gz::math::Vector3f MapPointCloudData(const uint64_t &_i,
-    const uint64_t &_j, const char *_msgBuffer);
+    const uint64_t &_j, const gz::msgs::PointCloudPacked &_msg,
+    const char *_msgBuffer);
 
   /// \brief Check if a specific point from the depth camera is inside
   /// the contact surface.
   /// \param[in] _point Point from the depth camera
   public: bool PointInsideSensor(gz::math::Vector3f _point);
 
-  /// \brief Computes the normal forces of the Optical Tactile sensor
+  /// \brief Computes the normal forces of the Optical Tactile sensor.
+  /// Runs on the worker thread, off the simulation thread.
   /// \param[in] _msg Message from the depth camera
+  /// \param[in] _sensorWorldPose Pose of the sensor model matching _msg
   /// \param[in] _visualizeForces Whether to visualize the forces or not
   ///
   /// Implementation inspired by
@@ -90,8 +100,13 @@ class gz::sim::systems::OpticalTactilePluginPrivate
   /// using-neighboring-pixels-cross-produc
   public: void ComputeNormalForces(
     const gz::msgs::PointCloudPacked &_msg,
+    gz::math::Pose3f _sensorWorldPose,
     const bool _visualizeForces);
 
+  /// \brief Loop run by the worker thread. Waits for camera messages handed
+  /// off by PostUpdate and computes the normal forces for each one.
+  public: void WorkerLoop();
+
   /// \brief Resolution of the visualization in pixels to skip.
   public: int visualizationResolution{30};
 
@@ -144,10 +159,31 @@ class gz::sim::systems::OpticalTactilePluginPrivate
   /// \brief Message returned by the depth camera
   public: gz::msgs::PointCloudPacked cameraMsg;
 
-  /// \brief Mutex for variables mutated by the camera callback.
-  /// The variables are: newCameraMsg, cameraMsg.
+  /// \brief Mutex for variables mutated by the camera callback and the
+  /// worker thread. The variables are: newCameraMsg, cameraMsg, workerMsg,
+  /// workerSensorPose, workerMsgReady, workerStop.
   public: std::mutex serviceMutex;
 
+  /// \brief Worker thread that computes the normal forces so the
+  /// simulation thread is not blocked by the per-pixel processing
+  public: std::thread workerThread;
+
+  /// \brief Condition variable signalling new work for the worker thread
+  public: std::condition_variable workerCv;
+
+  /// \brief Second buffer of the camera message, handed off to the worker
+  /// thread while the callback keeps filling cameraMsg
+  public: gz::msgs::PointCloudPacked workerMsg;
+
+  /// \brief Sensor pose snapshot taken when workerMsg was handed off
+  public: gz::math::Pose3f workerSensorPose;
+
+  /// \brief Whether workerMsg holds data not yet processed by the worker
+  public: bool workerMsgReady{false};
+
+  /// \brief Signals the worker thread to exit
+  public: bool workerStop{false};
+
   /// \brief If true, the plugin will draw a marker in the place of the
   /// contact sensor so it's easy to know its position
   public: bool visualizeSensor{false};
@@ -175,6 +211,18 @@ class gz::sim::systems::OpticalTactilePluginPrivate
   public: std::string ns{"optical_tactile_sensor"};
 };
 
+//////////////////////////////////////////////////
+OpticalTactilePluginPrivate::~OpticalTactilePluginPrivate()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->serviceMutex);
+    this->workerStop = true;
+  }
+  this->workerCv.notify_one();
+  if (this->workerThread.joinable())
+    this->workerThread.join();
+}
+
 //////////////////////////////////////////////////
 OpticalTactilePlugin::OpticalTactilePlugin()
   : System(), dataPtr(std::make_unique<OpticalTactilePluginPrivate>())
@@ -434,15 +482,18 @@ void OpticalTactilePlugin::PostUpdate(
     }
   }
 
-  // Process camera message if it's new
+  // Hand the camera message off to the worker thread if it's new. The
+  // normal forces are computed and published off the simulation thread.
   {
     std::lock_guard<std::mutex> lock(this->dataPtr->serviceMutex);
     if (this->dataPtr->newCameraMsg)
     {
-      this->dataPtr->ComputeNormalForces(this->dataPtr->cameraMsg,
-        this->dataPtr->visualizeForces);
-
+      this->dataPtr->workerMsg.Swap(&this->dataPtr->cameraMsg);
+      this->dataPtr->workerSensorPose =
+        this->dataPtr->tactileSensorWorldPose;
+      this->dataPtr->workerMsgReady = true;
       this->dataPtr->newCameraMsg = false;
+      this->dataPtr->workerCv.notify_one();
     }
   }
 
@@ -618,9 +669,38 @@ void OpticalTactilePluginPrivate::Load(const EntityComponentManager &_ecm)
       this->cameraUpdateRate,
       this->depthCameraOffset);
 
+  // Start the worker thread that processes the camera messages
+  this->workerThread =
+    std::thread(&OpticalTactilePluginPrivate::WorkerLoop, this);
+
   this->initialized = true;
 }
 
+//////////////////////////////////////////////////
+void OpticalTactilePluginPrivate::WorkerLoop()
+{
+  while (true)
+  {
+    gz::msgs::PointCloudPacked msg;
+    gz::math::Pose3f sensorPose;
+    {
+      std::unique_lock<std::mutex> lock(this->serviceMutex);
+      this->workerCv.wait(lock, [this]
+          {
+            return this->workerMsgReady || this->workerStop;
+          });
+      if (this->workerStop)
+        return;
+
+      msg.Swap(&this->workerMsg);
+      sensorPose = this->workerSensorPose;
+      this->workerMsgReady = false;
+    }
+
+    this->ComputeNormalForces(msg, sensorPose, this->visualizeForces);
+  }
+}
+
 //////////////////////////////////////////////////
 void OpticalTactilePluginPrivate::Enable(const gz::msgs::Boolean &_req)
 {
@@ -671,7 +751,8 @@ void OpticalTactilePluginPrivate::DepthCameraCallback(
 
 //////////////////////////////////////////////////
 gz::math::Vector3f OpticalTactilePluginPrivate::MapPointCloudData(
-  const uint64_t &_i, const uint64_t &_j, const char *_msgBuffer)
+  const uint64_t &_i, const uint64_t &_j,
+  const gz::msgs::PointCloudPacked &_msg, const char *_msgBuffer)
 {
   GZ_PROFILE("OpticalTactilePlugin::MapPointCloudData");
 
@@ -688,20 +769,20 @@ gz::math::Vector3f OpticalTactilePluginPrivate::MapPointCloudData(
   // Number of bytes from the beginning of the pointer (image coordinates at
   // 0,0) to the desired (i,j) position
   uint32_t msgBufferIndex =
-    _j*this->cameraMsg.row_step() + _i*this->cameraMsg.point_step();
+    _j*_msg.row_step() + _i*_msg.point_step();
 
   temporaryMsgBuffer += msgBufferIndex;
   int fieldIndex = 0;
 
   // X coordinate
   measuredPoint.X() = *reinterpret_cast<const float *>(
-    temporaryMsgBuffer + this->cameraMsg.field(fieldIndex++).offset());
+    temporaryMsgBuffer + _msg.field(fieldIndex++).offset());
   // Y coordinate
   measuredPoint.Y() = *reinterpret_cast<const float *>(
-    temporaryMsgBuffer + this->cameraMsg.field(fieldIndex++).offset());
+    temporaryMsgBuffer + _msg.field(fieldIndex++).offset());
   // Z coordinate
   measuredPoint.Z() = *reinterpret_cast<const float *>(
-    temporaryMsgBuffer + this->cameraMsg.field(fieldIndex).offset());
+    temporaryMsgBuffer + _msg.field(fieldIndex).offset());
 
   // Check if point is inside the sensor
   bool pointInside = this->PointInsideSensor(measuredPoint);
@@ -747,6 +828,7 @@ bool OpticalTactilePluginPrivate::PointInsideSensor(
 //////////////////////////////////////////////////
 void OpticalTactilePluginPrivate::ComputeNormalForces(
   const gz::msgs::PointCloudPacked &_msg,
+  gz::math::Pose3f _sensorWorldPose,
   const bool _visualizeForces)
 {
   GZ_PROFILE("OpticalTactilePlugin::ComputeNormalForces");
@@ -784,10 +866,10 @@ void OpticalTactilePluginPrivate::ComputeNormalForces(
         i += this->visualizationResolution)
     {
       // Get points for computing normal forces
-      p1 = this->MapPointCloudData(i + 1, j, msgBuffer);
-      p2 = this->MapPointCloudData(i - 1, j, msgBuffer);
-      p3 = this->MapPointCloudData(i, j + 1, msgBuffer);
-      p4 = this->MapPointCloudData(i, j - 1, msgBuffer);
+      p1 = this->MapPointCloudData(i + 1, j, _msg, msgBuffer);
+      p2 = this->MapPointCloudData(i - 1, j, _msg, msgBuffer);
+      p3 = this->MapPointCloudData(i, j + 1, _msg, msgBuffer);
+      p4 = this->MapPointCloudData(i, j - 1, _msg, msgBuffer);
 
       float dxdi = (p1.X() - p2.X()) / std::abs(p1.Y() - p2.Y());
       float dxdj =  (p3.X() - p4.X()) / std::abs(p3.Z() - p4.Z());
@@ -812,10 +894,10 @@ void OpticalTactilePluginPrivate::ComputeNormalForces(
       if (!_visualizeForces)
         continue;
 
-      markerPosition = this->MapPointCloudData(i, j, msgBuffer);
+      markerPosition = this->MapPointCloudData(i, j, _msg, msgBuffer);
       this->visualizePtr->AddNormalForceToMarkerMsgs(positionMarkerMsg,
         forceMarkerMsg, markerPosition, normalForce,
-        this->tactileSensorWorldPose);
+        _sensorWorldPose);
     }
   }
 
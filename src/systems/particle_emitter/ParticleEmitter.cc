@@ -18,6 +18,7 @@
 #include <gz/msgs/particle_emitter.pb.h>
 #include <gz/msgs/particle_emitter_v.pb.h>
 
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <string>
@@ -60,6 +61,11 @@ class gz::sim::systems::ParticleEmitterPrivate
   /// \brief Map of Entity to particle emitter command requested externally.
   public: std::map<Entity, gz::msgs::ParticleEmitter> userCmd;
 
+  /// \brief True when a command has arrived since the last `PreUpdate`.
+  /// Checked before taking the mutex so that steady-state steps with no
+  /// pending commands, e.g. headless runs, do no per-step work.
+  public: std::atomic<bool> cmdAvailable{false};
+
   /// \brief A mutex to protect the user command.
   public: std::mutex mutex;
 
@@ -80,6 +86,7 @@ void ParticleEmitterPrivate::OnCmd(const msgs::ParticleEmitter &_msg,
   if (iter != this->emitterTopicMap.end())
   {
     this->userCmd[iter->second].CopyFrom(_msg);
+    this->cmdAvailable = true;
   }
   else
   {
@@ -140,81 +147,85 @@ void ParticleEmitter::PreUpdate(const gz::sim::UpdateInfo &_info,
 {
   GZ_PROFILE("ParticleEmitter::PreUpdate");
 
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
-
-  // Create particle emitters
-  {
-    std::lock_guard<std::mutex> serviceLock(this->dataPtr->serviceMutex);
-    _ecm.EachNew<components::ParticleEmitter, components::ParentEntity,
-      components::Pose>(
-      [&](const Entity &_entity,
-          const components::ParticleEmitter *_emitter,
-          const components::ParentEntity *_parent,
-          const components::Pose *_pose)->bool
+  // Create particle emitters. The mutexes are taken per new emitter so
+  // that steps with nothing new, the steady state, stay lock free.
+  _ecm.EachNew<components::ParticleEmitter, components::ParentEntity,
+    components::Pose>(
+    [&](const Entity &_entity,
+        const components::ParticleEmitter *_emitter,
+        const components::ParentEntity *_parent,
+        const components::Pose *_pose)->bool
+      {
+        std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+        std::lock_guard<std::mutex> serviceLock(this->dataPtr->serviceMutex);
+        std::string topic;
+
+        // Get the topic information from the header, which is currently a
+        // hack to avoid breaking the particle_emitter.proto message.
+        if (_emitter->Data().has_header())
         {
-          std::string topic;
-
-          // Get the topic information from the header, which is currently a
-          // hack to avoid breaking the particle_emitter.proto message.
-          if (_emitter->Data().has_header())
+          for (const auto & data : _emitter->Data().header().data())
           {
-            for (const auto & data : _emitter->Data().header().data())
+            if (data.key() == "topic" && !data.value().empty())
             {
-              if (data.key() == "topic" && !data.value().empty())
-              {
-                topic = data.value(0);
-              }
+              topic = data.value(0);
             }
           }
+        }
 
-          // If a topic has not been specified, then generate topic based
-          // on the scoped name.
-          topic = !topic.empty() ? topic :
-            topicFromScopedName(_entity, _ecm) + "/cmd";
-
-          // Subscribe to the topic that receives particle emitter commands.
-          if (!this->dataPtr->node.Subscribe(
-                topic, &ParticleEmitterPrivate::OnCmd, this->dataPtr.get()))
-          {
-            gzerr << "Error subscribing to topic [" << topic << "]. "
-              << "Particle emitter will not receive updates." << std::endl;
-            return false;
-          }
-          gzmsg << "Particle emitter["
-            << scopedName(_entity, _ecm, "::", false) << "] subscribed "
-            << "to command messages on topic[" << topic << "]\n";
-
-          // Store the topic name so that we can apply user commands
-          // correctly.
-          this->dataPtr->emitterTopicMap[topic] = _entity;
-
-          // Store the emitter information in the service message, which
-          // can then be used in the particle_emitters service.
-          msgs::ParticleEmitter *emitterMsg =
-            this->dataPtr->serviceMsg.add_particle_emitter();
-          emitterMsg->CopyFrom(_emitter->Data());
-          msgs::Set(emitterMsg->mutable_pose(), _pose->Data());
-
-          // Set the topic information if it was not set via SDF.
-          if (!emitterMsg->has_header())
-          {
-            auto headerData = emitterMsg->mutable_header()->add_data();
-            headerData->set_key("topic");
-            headerData->add_value(topic);
-          }
-
-          // Set the particle emitter frame
-          auto frameData = emitterMsg->mutable_header()->add_data();
-          frameData->set_key("frame");
-          frameData->add_value(
-              removeParentScope(
-                scopedName(_parent->Data(), _ecm, "::", false), "::"));
+        // If a topic has not been specified, then generate topic based
+        // on the scoped name.
+        topic = !topic.empty() ? topic :
+          topicFromScopedName(_entity, _ecm) + "/cmd";
 
-          return true;
-        });
-  }
+        // Subscribe to the topic that receives particle emitter commands.
+        if (!this->dataPtr->node.Subscribe(
+              topic, &ParticleEmitterPrivate::OnCmd, this->dataPtr.get()))
+        {
+          gzerr << "Error subscribing to topic [" << topic << "]. "
+            << "Particle emitter will not receive updates." << std::endl;
+          return false;
+        }
+        gzmsg << "Particle emitter["
+          << scopedName(_entity, _ecm, "::", false) << "] subscribed "
+          << "to command messages on topic[" << topic << "]\n";
+
+        // Store the topic name so that we can apply user commands
+        // correctly.
+        this->dataPtr->emitterTopicMap[topic] = _entity;
+
+        // Store the emitter information in the service message, which
+        // can then be used in the particle_emitters service.
+        msgs::ParticleEmitter *emitterMsg =
+          this->dataPtr->serviceMsg.add_particle_emitter();
+        emitterMsg->CopyFrom(_emitter->Data());
+        msgs::Set(emitterMsg->mutable_pose(), _pose->Data());
+
+        // Set the topic information if it was not set via SDF.
+        if (!emitterMsg->has_header())
+        {
+          auto headerData = emitterMsg->mutable_header()->add_data();
+          headerData->set_key("topic");
+          headerData->add_value(topic);
+        }
+
+        // Set the particle emitter frame
+        auto frameData = emitterMsg->mutable_header()->add_data();
+        frameData->set_key("frame");
+        frameData->add_value(
+            removeParentScope(
+              scopedName(_parent->Data(), _ecm, "::", false), "::"));
+
+        return true;
+      });
+
+  // Nothing else to do until a command arrives. The atomic check keeps
+  // steps without pending commands from taking the mutex at all.
+  if (!this->dataPtr->cmdAvailable || _info.paused)
+    return;
 
-  if (this->dataPtr->userCmd.empty() || _info.paused)
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->userCmd.empty())
     return;
 
   // Process each command
@@ -244,6 +255,7 @@ void ParticleEmitter::PreUpdate(const gz::sim::UpdateInfo &_info,
     }
   }
   this->dataPtr->userCmd.clear();
+  this->dataPtr->cmdAvailable = false;
 }
 
 GZ_ADD_PLUGIN(ParticleEmitter,
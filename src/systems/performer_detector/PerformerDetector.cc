@@ -17,6 +17,10 @@
 
 #include <gz/msgs/pose.pb.h>
 
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <gz/common/Profiler.hh>
 #include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/Vector3.hh>
@@ -41,6 +45,49 @@ using namespace gz;
 using namespace sim;
 using namespace systems;
 
+namespace
+{
+  /// \brief A performer volume gathered once per step and shared by every
+  /// PerformerDetector in the process.
+  struct PerformerVolume
+  {
+    /// \brief Performer entity.
+    Entity entity;
+
+    /// \brief Name of the performer's parent model.
+    std::string name;
+
+    /// \brief World pose of the performer's parent model.
+    math::Pose3d pose;
+
+    /// \brief Performer volume in world coordinates.
+    math::AxisAlignedBox volume;
+  };
+
+  /// \brief Performer volumes shared by all detectors in the process. Each
+  /// step the first detector to run gathers the performers once and the
+  /// rest reuse the result, so worlds with many detectors pay for a single
+  /// scan instead of one per detector. Systems may run `PostUpdate` in
+  /// parallel, so all access is guarded by the mutex.
+  struct PerformerVolumeCache
+  {
+    /// \brief Protects all other members.
+    std::mutex mutex;
+
+    /// \brief ECM the cache was gathered from, so simulation runners in
+    /// the same process never share stale data.
+    const EntityComponentManager *ecm{nullptr};
+
+    /// \brief Iteration count the cache was gathered at.
+    uint64_t iterations{0};
+
+    /// \brief Cached performer volumes.
+    std::vector<PerformerVolume> volumes;
+  };
+
+  PerformerVolumeCache gPerformerVolumes;
+}
+
 /////////////////////////////////////////////////
 void PerformerDetector::Configure(const Entity &_entity,
                const std::shared_ptr<const sdf::Element> &_sdf,
@@ -159,45 +206,63 @@ void PerformerDetector::PostUpdate(
   auto region = this->detectorGeometry -
     (-(modelPose.Pos() + modelPose.Rot() * this->poseOffset.Pos()));
 
-  _ecm.Each<components::Performer, components::Geometry,
-            components::ParentEntity>(
-      [&](const Entity &_entity, const components::Performer *,
-          const components::Geometry *_geometry,
-          const components::ParentEntity *_parent) -> bool
-      {
-        auto pose = _ecm.Component<components::Pose>(_parent->Data())->Data();
-        auto name = _ecm.Component<components::Name>(_parent->Data())->Data();
-        const math::Pose3d relPose = modelPose.Inverse() * pose;
+  std::lock_guard<std::mutex> lock(gPerformerVolumes.mutex);
 
-        // We assume the geometry contains a box.
-        auto perfBox = _geometry->Data().BoxShape();
-        if (nullptr == perfBox)
+  // Gather the performer volumes once per step; every other detector in
+  // the process reuses this scan.
+  if (gPerformerVolumes.ecm != &_ecm ||
+      gPerformerVolumes.iterations != _info.iterations)
+  {
+    gPerformerVolumes.ecm = &_ecm;
+    gPerformerVolumes.iterations = _info.iterations;
+    gPerformerVolumes.volumes.clear();
+
+    _ecm.Each<components::Performer, components::Geometry,
+              components::ParentEntity>(
+        [&](const Entity &_entity, const components::Performer *,
+            const components::Geometry *_geometry,
+            const components::ParentEntity *_parent) -> bool
         {
-          gzerr << "Internal error: geometry of performer [" << _entity
-                 << "] missing box." << std::endl;
-          return true;
-        }
-
-        math::AxisAlignedBox performerVolume{pose.Pos() - perfBox->Size() / 2,
-                                             pose.Pos() + perfBox->Size() / 2};
+          auto pose = _ecm.Component<components::Pose>(_parent->Data())->Data();
+          auto name = _ecm.Component<components::Name>(_parent->Data())->Data();
 
-        bool alreadyDetected = this->IsAlreadyDetected(_entity);
-        if (region.Intersects(performerVolume))
-        {
-          if (!alreadyDetected)
+          // We assume the geometry contains a box.
+          auto perfBox = _geometry->Data().BoxShape();
+          if (nullptr == perfBox)
           {
-            this->AddToDetected(_entity);
-            this->Publish(_entity, name, true, relPose, _info.simTime);
+            gzerr << "Internal error: geometry of performer [" << _entity
+                   << "] missing box." << std::endl;
+            return true;
           }
-        }
-        else if (alreadyDetected)
-        {
-          this->RemoveFromDetected(_entity);
-          this->Publish(_entity, name, false, relPose, _info.simTime);
-        }
 
-        return true;
-      });
+          gPerformerVolumes.volumes.push_back({_entity, name, pose,
+              math::AxisAlignedBox(pose.Pos() - perfBox->Size() / 2,
+                                   pose.Pos() + perfBox->Size() / 2)});
+          return true;
+        });
+  }
+
+  for (const auto &performer : gPerformerVolumes.volumes)
+  {
+    const math::Pose3d relPose = modelPose.Inverse() * performer.pose;
+
+    bool alreadyDetected = this->IsAlreadyDetected(performer.entity);
+    if (region.Intersects(performer.volume))
+    {
+      if (!alreadyDetected)
+      {
+        this->AddToDetected(performer.entity);
+        this->Publish(performer.entity, performer.name, true, relPose,
+            _info.simTime);
+      }
+    }
+    else if (alreadyDetected)
+    {
+      this->RemoveFromDetected(performer.entity);
+      this->Publish(performer.entity, performer.name, false, relPose,
+          _info.simTime);
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -63,6 +63,10 @@ namespace systems
   /// The system does not assume that levels are enabled, but it does require
   /// performers to be specified.
   ///
+  /// All PerformerDetector instances in a process share a single per-step
+  /// scan of the performers, so adding more detectors does not multiply the
+  /// cost of gathering performer volumes.
+  ///
   /// ## System Parameters
   ///
   /// - `<topic>`: Custom topic to be used for publishing when a performer is
@@ -18,9 +18,11 @@
 #ifndef GZ_SIM_SYSTEMS_PHYSICS_ENTITY_FEATURE_MAP_HH_
 #define GZ_SIM_SYSTEMS_PHYSICS_ENTITY_FEATURE_MAP_HH_
 
+#include <cstddef>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <gz/physics/Entity.hh>
 #include <gz/physics/FindFeatures.hh>
@@ -108,30 +110,31 @@ namespace systems::physics_system
       else
       {
         using ToEntityPtr = PhysicsEntityPtr<ToFeatureList>;
+        if (_entity >= this->denseCasts.size())
+        {
+          return nullptr;
+        }
+
         // Has already been cast
-        auto castIt = this->castCache.find(_entity);
-        if (castIt != this->castCache.end())
+        auto &castSlot = this->denseCasts[_entity];
+        auto castEntity = std::get<ToEntityPtr>(castSlot);
+        if (nullptr != castEntity)
         {
-          auto castEntity = std::get<ToEntityPtr>(castIt->second);
-          if (nullptr != castEntity)
-          {
-            return castEntity;
-          }
+          return castEntity;
         }
 
-        auto reqEntity = this->Get(_entity);
+        auto reqEntity = this->denseEntities[_entity];
         if (nullptr == reqEntity)
         {
           return nullptr;
         }
 
         // Cast
-        auto castEntity = physics::RequestFeatures<ToFeatureList>::From(
-            this->Get(_entity));
+        castEntity = physics::RequestFeatures<ToFeatureList>::From(reqEntity);
 
         if (castEntity)
         {
-          std::get<ToEntityPtr>(this->castCache[_entity]) = castEntity;
+          std::get<ToEntityPtr>(castSlot) = castEntity;
         }
 
         return castEntity;
@@ -165,10 +168,11 @@ namespace systems::physics_system
     /// nullptr
     public: RequiredEntityPtr Get(const Entity &_entity) const
     {
-      auto it = this->entityMap.find(_entity);
-      if (it != this->entityMap.end())
+      // The dense storage is kept in exact sync with entityMap, so it is
+      // authoritative and avoids a hash lookup on this hot path.
+      if (_entity < this->denseEntities.size())
       {
-        return it->second;
+        return this->denseEntities[_entity];
       }
       return nullptr;
     }
@@ -247,6 +251,15 @@ namespace systems::physics_system
       this->reverseMap[_physicsEntity] = _entity;
       this->physEntityById[_physicsEntity->EntityID()] = _physicsEntity;
       this->entityByPhysId[_physicsEntity->EntityID()] = _entity;
+
+      if (_entity >= this->denseEntities.size())
+      {
+        this->denseEntities.resize(_entity + 1);
+        this->denseCasts.resize(_entity + 1);
+      }
+      this->denseEntities[_entity] = _physicsEntity;
+      // Drop casts cached for a previous occupant of this slot.
+      this->denseCasts[_entity] = ValueType();
     }
 
     /// \brief Remove entity from all associated maps
@@ -260,7 +273,8 @@ namespace systems::physics_system
         this->reverseMap.erase(it->second);
         this->physEntityById.erase(it->second->EntityID());
         this->entityByPhysId.erase(it->second->EntityID());
-        this->castCache.erase(_entity);
+        this->denseEntities[_entity] = nullptr;
+        this->denseCasts[_entity] = ValueType();
         this->entityMap.erase(it);
         return true;
       }
@@ -278,7 +292,8 @@ namespace systems::physics_system
         this->entityMap.erase(it->second);
         this->physEntityById.erase(it->first->EntityID());
         this->entityByPhysId.erase(it->first->EntityID());
-        this->castCache.erase(it->second);
+        this->denseEntities[it->second] = nullptr;
+        this->denseCasts[it->second] = ValueType();
         this->reverseMap.erase(it);
         return true;
       }
@@ -298,8 +313,22 @@ namespace systems::physics_system
     /// \return Number of entries in all the maps.
     public: std::size_t TotalMapEntryCount() const
     {
+      // Count dense cast slots holding at least one cached cast, matching
+      // what the old per-entity cast cache map would have held.
+      std::size_t castCount = 0;
+      for (const auto &castSlot : this->denseCasts)
+      {
+        bool hasCast = false;
+        std::apply([&hasCast](const auto &..._ptrs)
+            {
+              hasCast = (... || (nullptr != _ptrs));
+            }, castSlot);
+        if (hasCast)
+          ++castCount;
+      }
+
       return this->entityMap.size() + this->reverseMap.size() +
-             this->castCache.size() + this->physEntityById.size() +
+             castCount + this->physEntityById.size() +
              this->entityByPhysId.size();
     }
 
@@ -316,9 +345,16 @@ namespace systems::physics_system
     /// \brief Map of physics entity IDs to Gazebo entity
     private: std::unordered_map<std::size_t, Entity> entityByPhysId;
 
-    /// \brief Cache map from Gazebo entity to physics entities with optional
-    /// features
-    private: mutable std::unordered_map<Entity, ValueType> castCache;
+    /// \brief Dense storage of physics entities with required features,
+    /// indexed by Gazebo entity id and kept in exact sync with entityMap.
+    /// Slots of removed or unknown entities hold nullptr. This lets
+    /// steady-state stepping resolve entities without hashing.
+    private: std::vector<RequiredEntityPtr> denseEntities;
+
+    /// \brief Cache of physics entities with optional features, indexed
+    /// like denseEntities. Slots are reset whenever their entity is removed
+    /// or re-added, so no separate generation counter is needed.
+    private: mutable std::vector<ValueType> denseCasts;
   };
 
   /// \brief Convenience template that presets EntityFeatureMap with
@@ -184,3 +184,38 @@ TEST_F(EntityFeatureMapFixture,
       testWorld2->EntityID()));
   EXPECT_EQ(0u, testMap.TotalMapEntryCount());
 }
+
+TEST_F(EntityFeatureMapFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(ReAddedEntityDropsCachedCasts))
+{
+  struct TestOptionalFeatures
+      : physics::FeatureList<physics::LinkFrameSemantics>
+  {
+  };
+
+  using WorldEntityMap =
+      EntityFeatureMap3d<physics::World, MinimumFeatureList,
+                         TestOptionalFeatures>;
+
+  using WorldPtrType = physics::EntityPtr<
+      physics::World<physics::FeaturePolicy3d, MinimumFeatureList>>;
+
+  // Reusing a Gazebo entity id for a new physics entity, as happens when an
+  // entity is recreated, must not serve casts cached for the old occupant.
+  sim::Entity gazeboWorldEntity = 42;
+  WorldPtrType testWorld1 = this->engine->ConstructEmptyWorld("world1");
+  WorldEntityMap testMap;
+  testMap.AddEntity(gazeboWorldEntity, testWorld1);
+
+  auto world1Cast = testMap.EntityCast<TestOptionalFeatures>(gazeboWorldEntity);
+  ASSERT_NE(nullptr, world1Cast);
+
+  testMap.Remove(gazeboWorldEntity);
+  WorldPtrType testWorld2 = this->engine->ConstructEmptyWorld("world2");
+  testMap.AddEntity(gazeboWorldEntity, testWorld2);
+
+  auto world2Cast = testMap.EntityCast<TestOptionalFeatures>(gazeboWorldEntity);
+  ASSERT_NE(nullptr, world2Cast);
+  EXPECT_NE(world1Cast, world2Cast);
+  EXPECT_EQ(testWorld2, testMap.Get(gazeboWorldEntity));
+}
@@ -24,10 +24,13 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <deque>
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -41,6 +44,7 @@
 #include <gz/common/StringUtils.hh>
 #include <gz/common/SystemPaths.hh>
 #include <gz/common/Uuid.hh>
+#include <gz/common/WorkerPool.hh>
 #include <gz/math/AxisAlignedBox.hh>
 #include <gz/math/eigen3/Conversions.hh>
 #include <gz/math/Vector3.hh>
@@ -123,6 +127,7 @@
 #include "gz/sim/components/JointVelocityCmd.hh"
 #include "gz/sim/components/JointVelocityLimitsCmd.hh"
 #include "gz/sim/components/JointVelocityReset.hh"
+#include "gz/sim/components/Kinematic.hh"
 #include "gz/sim/components/LinearAcceleration.hh"
 #include "gz/sim/components/LinearVelocity.hh"
 #include "gz/sim/components/LinearVelocityCmd.hh"
@@ -137,6 +142,7 @@
 #include "gz/sim/components/JointForceCmd.hh"
 #include "gz/sim/components/Physics.hh"
 #include "gz/sim/components/PhysicsEnginePlugin.hh"
+#include "gz/sim/components/PhysicsSleepState.hh"
 #include "gz/sim/components/Pose.hh"
 #include "gz/sim/components/PoseCmd.hh"
 #include "gz/sim/components/Recreate.hh"
@@ -279,6 +285,15 @@ class gz::sim::systems::PhysicsPrivate
               EntityComponentManager &_ecm,
               const gz::physics::ForwardStep::Output &_updatedLinks);
 
+  /// \brief Update a link's PhysicsSleepState component, if it has one.
+  /// For now the component is updated only if another system has created
+  /// it, like the other physics-maintained components.
+  /// \param[in] _entity Link entity.
+  /// \param[in, out] _ecm The entity component manager.
+  /// \param[in] _asleep True if the link is now asleep.
+  public: void SetSleepState(const Entity _entity,
+              EntityComponentManager &_ecm, bool _asleep);
+
   /// \brief Helper function to update the pose of a model.
   /// \param[in] _model The model to update.
   /// \param[in] _canonicalLink The canonical link of _model.
@@ -344,11 +359,40 @@ class gz::sim::systems::PhysicsPrivate
   /// \brief Keep track of what entities are static (models and links).
   public: std::unordered_set<Entity> staticEntities;
 
+  /// \brief Entities flagged with a true Kinematic component (models and
+  /// links). They are never constructed in the physics engine; their poses
+  /// are integrated by the Kinematics system instead.
+  public: std::unordered_set<Entity> kinematicEntities;
+
   /// \brief Keep track of poses for links attached to non-static models.
   /// This allows for skipping pose updates if a link's pose didn't change
   /// after a physics step.
   public: std::unordered_map<Entity, gz::math::Pose3d> linkWorldPoses;
 
+  /// \brief Minimum number of changed links before the link writeback in
+  /// UpdateSim is spread across the worker pool. Below this, the cost of
+  /// dispatching work outweighs the parallelism.
+  public: static constexpr std::size_t kParallelLinkWritebackThreshold{256};
+
+  /// \brief A pool of worker threads for the link writeback.
+  public: common::WorkerPool workerPool{
+      std::max(2u, std::thread::hardware_concurrency())};
+
+  /// \brief Number of consecutive steps each link's pose has been still.
+  /// Saturates at kSleepStillSteps, at which point the link is asleep.
+  public: std::unordered_map<Entity, int> linkStillSteps;
+
+  /// \brief Consecutive still steps after which a link counts as asleep.
+  public: static constexpr int kSleepStillSteps{20};
+
+  /// \brief A sleeping link's pose is re-checked only once every this many
+  /// steps, bounding how late a wake is noticed.
+  public: static constexpr std::size_t kSleepPoseCheckPeriod{4};
+
+  /// \brief Number of times ChangedLinks has iterated the links, used to
+  /// schedule the sleeping links' pose checks.
+  public: std::size_t changedLinksCalls{0};
+
   /// \brief Keep a mapping of canonical links to models that have this
   /// canonical link. Useful for updating model poses efficiently after a
   /// physics step
@@ -367,6 +411,12 @@ class gz::sim::systems::PhysicsPrivate
   /// deleted the following iteration.
   public: std::unordered_set<Entity> worldPoseCmdsToRemove;
 
+  /// \brief Slip compliance values last pushed into the engine, per
+  /// collision entity. Slip compliance is persistent engine state, so
+  /// commands matching these values don't need to be re-applied.
+  public: std::unordered_map<Entity, std::vector<double>>
+      lastAppliedSlipCompliance;
+
   /// \brief IDs of the ContactSurfaceHandler callbacks registered for worlds
   public: std::unordered_map<Entity, std::string> worldContactCallbackIDs;
 
@@ -708,6 +758,28 @@ class gz::sim::systems::PhysicsPrivate
   /// gz-physics
   public: EntityJointMap entityJointMap;
 
+  /// \brief Cached degrees of freedom per joint entity. Joint DOF never
+  /// change after construction, and the per-step virtual queries add up
+  /// in worlds with thousands of joints.
+  public: std::unordered_map<Entity, std::size_t> jointDofs;
+
+  /// \brief Get a joint's degrees of freedom, querying the engine only the
+  /// first time and answering from \ref jointDofs afterwards.
+  /// \param[in] _entity Joint entity.
+  /// \param[in] _jointPhys Physics joint the entity maps to.
+  /// \return The joint's degrees of freedom.
+  public: std::size_t JointDof(const Entity _entity,
+      const EntityJointMap::RequiredEntityPtr &_jointPhys)
+  {
+    auto it = this->jointDofs.find(_entity);
+    if (it == this->jointDofs.end())
+    {
+      it = this->jointDofs.emplace(_entity,
+          _jointPhys->GetDegreesOfFreedom()).first;
+    }
+    return it->second;
+  }
+
   /// \brief Collision EntityFeatureMap
   public: using EntityCollisionMap = EntityFeatureMap3d<
             physics::Shape,
@@ -757,6 +829,13 @@ class gz::sim::systems::PhysicsPrivate
   /// \brief Flag to store whether the names of colliding entities should
   /// be populated in the contact points.
   public: bool contactsEntityNames = true;
+
+  /// \brief Number of engine steps to run per simulation step, read from
+  /// the plugin's `<substeps>` element. With N substeps the engine
+  /// integrates at N times the world step rate while the rest of the
+  /// pipeline (component writeback, other systems, SceneBroadcaster) only
+  /// runs once per simulation step on the final state.
+  public: unsigned int substeps{1u};
 };
 
 //////////////////////////////////////////////////
@@ -818,6 +897,15 @@ void Physics::Configure(const Entity &_entity,
       "include_entity_names", true).first;
   }
 
+  // Number of engine sub-steps per simulation step. This lets stiff
+  // systems integrate at a higher rate without the whole pipeline
+  // running faster.
+  if (_sdf->HasElement("substeps"))
+  {
+    this->dataPtr->substeps = std::max(1u,
+        _sdf->Get<unsigned int>("substeps", 1u).first);
+  }
+
   // Find engine shared library
   // Look in:
   // * Paths from environment variable
@@ -1121,6 +1209,15 @@ void PhysicsPrivate::CreateModelEntities(const EntityComponentManager &_ecm,
         if (_ecm.EntityHasComponentType(_entity, components::Recreate::typeId))
           return true;
 
+        // Kinematic models bypass the physics engine entirely; the
+        // Kinematics system integrates their poses from velocity commands.
+        auto kinematicComp = _ecm.Component<components::Kinematic>(_entity);
+        if (kinematicComp && kinematicComp->Data())
+        {
+          this->kinematicEntities.insert(_entity);
+          return true;
+        }
+
         // Check if model already exists
         if (this->entityModelMap.HasEntity(_entity))
         {
@@ -1290,6 +1387,14 @@ void PhysicsPrivate::CreateLinkEntities(const EntityComponentManager &_ecm,
           return true;
         }
 
+        // Links of kinematic models are not in the physics engine either
+        if (this->kinematicEntities.find(_parent->Data()) !=
+            this->kinematicEntities.end())
+        {
+          this->kinematicEntities.insert(_entity);
+          return true;
+        }
+
         // Check if link already exists
         if (this->entityLinkMap.HasEntity(_entity))
         {
@@ -1412,6 +1517,13 @@ void PhysicsPrivate::CreateCollisionEntities(const EntityComponentManager &_ecm,
           return true;
         }
 
+        // Collisions of kinematic links have no engine representation
+        if (this->kinematicEntities.find(_parent->Data()) !=
+            this->kinematicEntities.end())
+        {
+          return true;
+        }
+
         if (this->entityCollisionMap.HasEntity(_entity))
         {
           if (_warnIfEntityExists)
@@ -1710,6 +1822,13 @@ void PhysicsPrivate::CreateJointEntities(const EntityComponentManager &_ecm,
           return true;
         }
 
+        // Joints of kinematic models have no engine representation
+        if (this->kinematicEntities.find(_parentModel->Data()) !=
+            this->kinematicEntities.end())
+        {
+          return true;
+        }
+
         // Check if joint already exists
         if (this->entityJointMap.HasEntity(_entity))
         {
@@ -2015,6 +2134,19 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
           /* _model */) -> bool
       {
         const auto world = worldEntity(_ecm);
+
+        // Kinematic models were never added to the engine; just drop the
+        // flags kept for them and their links.
+        if (this->kinematicEntities.erase(_entity))
+        {
+          for (const auto &childLink :
+               _ecm.ChildrenByComponents(_entity, components::Link()))
+          {
+            this->kinematicEntities.erase(childLink);
+          }
+          return true;
+        }
+
         // Remove model if found
         if (auto modelPtrPhys = this->entityModelMap.Get(_entity))
         {
@@ -2042,7 +2174,9 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
             this->entityFreeGroupMap.Remove(childLink);
             this->topLevelModelMap.erase(childLink);
             this->staticEntities.erase(childLink);
+            this->kinematicEntities.erase(childLink);
             this->linkWorldPoses.erase(childLink);
+            this->linkStillSteps.erase(childLink);
             this->canonicalLinkModelTracker.RemoveLink(childLink);
           }
 
@@ -2051,6 +2185,7 @@ void PhysicsPrivate::RemovePhysicsEntities(const EntityComponentManager &_ecm)
           {
             this->entityJointMap.Remove(childJoint);
             this->topLevelModelMap.erase(childJoint);
+            this->jointDofs.erase(childJoint);
           }
 
           this->entityFreeGroupMap.Remove(_entity);
@@ -2380,6 +2515,14 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
       [&](const Entity &_entity,
           const components::ExternalWorldWrenchCmd *_wrenchComp)
       {
+        // Wrench commands are zeroed, not removed, once consumed, so this
+        // loop revisits every link that was ever commanded. Skip the ones
+        // with nothing to apply this step.
+        math::Vector3 force = msgs::Convert(_wrenchComp->Data().force());
+        math::Vector3 torque = msgs::Convert(_wrenchComp->Data().torque());
+        if (force == math::Vector3d::Zero && torque == math::Vector3d::Zero)
+          return true;
+
         if (!this->entityLinkMap.HasEntity(_entity))
         {
           gzwarn << "Failed to find link [" << _entity
@@ -2405,8 +2548,6 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
           return false;
         }
 
-        math::Vector3 force = msgs::Convert(_wrenchComp->Data().force());
-        math::Vector3 torque = msgs::Convert(_wrenchComp->Data().torque());
         linkForceFeature->AddExternalForce(math::eigen3::convert(force));
         linkForceFeature->AddExternalTorque(math::eigen3::convert(torque));
 
@@ -2507,6 +2648,17 @@ void PhysicsPrivate::UpdatePhysics(EntityComponentManager &_ecm)
 
         if (_slipCmdComp->Data().size() == 2)
         {
+          // Skip the engine calls when the command matches what was last
+          // applied to this shape.
+          auto &lastApplied = this->lastAppliedSlipCompliance[_entity];
+          if (lastApplied.size() == 2 &&
+              math::equal(lastApplied[0], _slipCmdComp->Data()[0]) &&
+              math::equal(lastApplied[1], _slipCmdComp->Data()[1]))
+          {
+            return true;
+          }
+          lastApplied = _slipCmdComp->Data();
+
           slipComplianceShape->SetPrimarySlipCompliance(
               _slipCmdComp->Data()[0]);
           slipComplianceShape->SetSecondarySlipCompliance(
@@ -2888,6 +3040,7 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
   // Clear worldPoseCmdsToRemove because pose commands that were issued before
   // the reset will be ignored.
   this->linkWorldPoses.clear();
+  this->linkStillSteps.clear();
   this->canonicalLinkModelTracker = CanonicalLinkModelTracker();
   this->modelWorldPoses.clear();
   this->worldPoseCmdsToRemove.clear();
@@ -2913,22 +3066,23 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
 
         this->entityFreeGroupMap.AddEntity(_entity, freeGroup);
 
+        // Only the root link of a free group moves the whole group, so the
+        // world pose of the other links doesn't need to be computed.
         if (freeGroup->RootLink() == linkPtrPhys)
         {
           auto linkWorldPose = worldPose(_entity, _ecm);
           freeGroup->SetWorldPose(math::eigen3::convert(linkWorldPose));
         }
 
-        auto worldAngularVelFeature =
+        auto worldVelFeature =
             this->entityFreeGroupMap
                 .EntityCast<WorldVelocityCommandFeatureList>(_entity);
-
-        if (!worldAngularVelFeature)
+        if (!worldVelFeature)
         {
           static bool informed{false};
           if (!informed)
           {
-            gzdbg << "Attempting to reset link angular velocity, but the "
+            gzdbg << "Attempting to reset link velocity, but the "
                    << "physics engine doesn't support velocity commands. "
                    << "Velocity won't be reset."
                    << std::endl;
@@ -2936,33 +3090,9 @@ void PhysicsPrivate::ResetPhysics(EntityComponentManager &_ecm)
           }
           return true;
         }
-        else
-        {
-          worldAngularVelFeature->SetWorldAngularVelocity(
-              Eigen::Vector3d::Zero());
-        }
 
-        auto worldLinearVelFeature =
-            this->entityFreeGroupMap
-                .EntityCast<WorldVelocityCommandFeatureList>(_entity);
-        if (!worldLinearVelFeature)
-        {
-          static bool informed{false};
-          if (!informed)
-          {
-            gzdbg << "Attempting to set link linear velocity, but the "
-                   << "physics engine doesn't support velocity commands. "
-                   << "Velocity won't be set."
-                   << std::endl;
-            informed = true;
-          }
-          return true;
-        }
-        else
-        {
-          worldLinearVelFeature->SetWorldLinearVelocity(
-              Eigen::Vector3d::Zero());
-        }
+        worldVelFeature->SetWorldAngularVelocity(Eigen::Vector3d::Zero());
+        worldVelFeature->SetWorldLinearVelocity(Eigen::Vector3d::Zero());
 
         return true;
       });
@@ -3011,14 +3141,70 @@ gz::physics::ForwardStep::Output PhysicsPrivate::Step(
 {
   GZ_PROFILE("PhysicsPrivate::Step");
   physics::ForwardStep::Input input;
-  physics::ForwardStep::State state;
   physics::ForwardStep::Output output;
 
-  input.Get<std::chrono::steady_clock::duration>() = _dt;
+  // With sub-stepping the engine advances in smaller increments while the
+  // caller only sees the state after the last sub-step.
+  input.Get<std::chrono::steady_clock::duration>() = _dt / this->substeps;
+
+  // Run all sub-steps for one world, merging the changed poses reported by
+  // each sub-step so links that only moved early in the step are still
+  // reported. Duplicate entries are harmless: the frame data is queried
+  // from the final state in ChangedLinks.
+  auto stepWorld = [this, &input](const auto &_world,
+      physics::ForwardStep::Output &_output)
+  {
+    physics::ForwardStep::State state;
+    for (unsigned int i = 0; i < this->substeps; ++i)
+    {
+      physics::ForwardStep::Output substepOutput;
+      _world->Step(substepOutput, state, input);
+      auto changedPoses = substepOutput.Query<physics::ChangedWorldPoses>();
+      if (nullptr == changedPoses)
+        continue;
+      auto &mergedPoses = _output.Get<physics::ChangedWorldPoses>();
+      mergedPoses.entries.insert(mergedPoses.entries.end(),
+          std::make_move_iterator(changedPoses->entries.begin()),
+          std::make_move_iterator(changedPoses->entries.end()));
+    }
+  };
 
-  for (const auto &world : this->entityWorldMap.Map())
+  const auto &worlds = this->entityWorldMap.Map();
+  if (worlds.size() <= 1)
   {
-    world.second->Step(output, state, input);
+    for (const auto &world : worlds)
+    {
+      stepWorld(world.second, output);
+    }
+    return output;
+  }
+
+  // Engine worlds don't share contacts or joints, so they are independent
+  // simulation islands. Step them concurrently on the worker pool, each
+  // into its own output, and merge the changed poses afterwards.
+  std::vector<physics::ForwardStep::Output> outputs(worlds.size());
+  std::size_t worldIndex = 0;
+  for (const auto &world : worlds)
+  {
+    auto worldPhys = world.second;
+    this->workerPool.AddWork(
+        [worldPhys, &outputs, &stepWorld, worldIndex]()
+        {
+          stepWorld(worldPhys, outputs[worldIndex]);
+        });
+    ++worldIndex;
+  }
+  this->workerPool.WaitForResults();
+
+  for (auto &worldOutput : outputs)
+  {
+    auto changedPoses = worldOutput.Query<physics::ChangedWorldPoses>();
+    if (nullptr == changedPoses)
+      continue;
+    auto &mergedPoses = output.Get<physics::ChangedWorldPoses>();
+    mergedPoses.entries.insert(mergedPoses.entries.end(),
+        std::make_move_iterator(changedPoses->entries.begin()),
+        std::make_move_iterator(changedPoses->entries.end()));
   }
 
   return output;
@@ -3060,6 +3246,22 @@ math::Pose3d PhysicsPrivate::RelativePose(const Entity &_from,
   return transform;
 }
 
+//////////////////////////////////////////////////
+void PhysicsPrivate::SetSleepState(const Entity _entity,
+    EntityComponentManager &_ecm, bool _asleep)
+{
+  auto sleepComp = _ecm.Component<components::PhysicsSleepState>(_entity);
+  if (nullptr == sleepComp)
+    return;
+
+  if (sleepComp->SetData(_asleep,
+      [](bool _a, bool _b){ return _a == _b; }))
+  {
+    _ecm.SetChanged(_entity, components::PhysicsSleepState::typeId,
+        ComponentState::OneTimeChange);
+  }
+}
+
 //////////////////////////////////////////////////
 std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
     EntityComponentManager &_ecm,
@@ -3098,15 +3300,32 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
   }
   else
   {
+    ++this->changedLinksCalls;
     _ecm.Each<components::Link>(
       [&](const Entity &_entity, components::Link *) -> bool
       {
         if (this->staticEntities.find(_entity) != this->staticEntities.end() ||
+            this->kinematicEntities.find(_entity) !=
+            this->kinematicEntities.end() ||
             _ecm.EntityHasComponentType(_entity, components::Recreate::typeId))
         {
           return true;
         }
 
+        // A link whose pose has been still long enough counts as asleep,
+        // and its pose is only re-checked once every few calls. This bounds
+        // the per-step cost by the number of active bodies, at the price of
+        // a wake (e.g. from a new contact) being noticed up to
+        // kSleepPoseCheckPeriod steps late.
+        auto stillIt = this->linkStillSteps.find(_entity);
+        const bool sleeping = stillIt != this->linkStillSteps.end() &&
+            stillIt->second >= kSleepStillSteps;
+        if (sleeping &&
+            this->changedLinksCalls % kSleepPoseCheckPeriod != 0)
+        {
+          return true;
+        }
+
         // This `once` variable is here to aid in debugging, make sure to
         // remove it.
         auto linkPhys = this->entityLinkMap.Get(_entity);
@@ -3142,6 +3361,21 @@ std::map<Entity, physics::FrameData3d> PhysicsPrivate::ChangedLinks(
           this->linkWorldPoses[_entity] = worldPoseMath3d;
 
           linkFrameData[_entity] = frameData;
+
+          // The link moved, so it is awake again.
+          this->linkStillSteps[_entity] = 0;
+          if (sleeping)
+            this->SetSleepState(_entity, _ecm, false);
+        }
+        else
+        {
+          auto &stillSteps = this->linkStillSteps[_entity];
+          if (stillSteps < kSleepStillSteps)
+          {
+            // Crossing the threshold puts the link to sleep.
+            if (++stillSteps == kSleepStillSteps)
+              this->SetSleepState(_entity, _ecm, true);
+          }
         }
 
         return true;
@@ -3359,7 +3593,14 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
 
   // Link poses, velocities...
   GZ_PROFILE_BEGIN("Links");
-  for (const auto &[entity, frameData] : _linkFrameData)
+  using LinkChange = std::tuple<Entity, ComponentTypeId, ComponentState>;
+
+  // Update the components of a single link from its frame data. Change
+  // notifications are deferred into _changes instead of being applied to
+  // the ECM's shared change tracking, so this can run on a worker thread.
+  auto updateLink = [&](const Entity &entity,
+      const physics::FrameData3d &frameData,
+      std::vector<LinkChange> &_changes)
   {
     GZ_PROFILE_BEGIN("Local pose");
     auto canonicalLink =
@@ -3377,7 +3618,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
         gzerr << "Internal error: parent model [" << parentEntity
               << "] does not have a world pose available for child entity["
               << entity << "]" << std::endl;
-        continue;
+        return;
       }
       const math::Pose3d &parentWorldPose = parentModelPoseIt->second;
 
@@ -3386,7 +3627,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
       auto pose = _ecm.Component<components::Pose>(entity);
       *pose = components::Pose(parentWorldPose.Inverse() *
                                 math::eigen3::convert(worldPose));
-      _ecm.SetChanged(entity, components::Pose::typeId,
+      _changes.emplace_back(entity, components::Pose::typeId,
           ComponentState::PeriodicChange);
     }
     GZ_PROFILE_END();
@@ -3402,7 +3643,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->pose3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity, components::WorldPose::typeId, state);
+      _changes.emplace_back(entity, components::WorldPose::typeId, state);
     }
 
     // Velocity in world coordinates
@@ -3415,7 +3656,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
             this->vec3Eql) ?
             ComponentState::PeriodicChange :
             ComponentState::NoChange;
-      _ecm.SetChanged(entity,
+      _changes.emplace_back(entity,
           components::WorldLinearVelocity::typeId, state);
     }
 
@@ -3429,7 +3670,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity,
+      _changes.emplace_back(entity,
           components::WorldAngularVelocity::typeId, state);
     }
 
@@ -3443,7 +3684,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity,
+      _changes.emplace_back(entity,
           components::WorldLinearAcceleration::typeId, state);
     }
 
@@ -3458,7 +3699,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity,
+      _changes.emplace_back(entity,
           components::WorldAngularAcceleration::typeId, state);
     }
 
@@ -3475,7 +3716,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity, components::LinearVelocity::typeId, state);
+      _changes.emplace_back(entity, components::LinearVelocity::typeId, state);
     }
 
     // Angular velocity in body-fixed frame coordinates
@@ -3489,7 +3730,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity, components::AngularVelocity::typeId,
+      _changes.emplace_back(entity, components::AngularVelocity::typeId,
           state);
     }
 
@@ -3504,7 +3745,7 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql)?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity, components::LinearAcceleration::typeId,
+      _changes.emplace_back(entity, components::LinearAcceleration::typeId,
           state);
     }
 
@@ -3519,9 +3760,46 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
           this->vec3Eql) ?
           ComponentState::PeriodicChange :
           ComponentState::NoChange;
-      _ecm.SetChanged(entity, components::AngularAcceleration::typeId,
+      _changes.emplace_back(entity, components::AngularAcceleration::typeId,
           state);
     }
+  };
+
+  const std::size_t linkCount = _linkFrameData.size();
+  if (linkCount < kParallelLinkWritebackThreshold)
+  {
+    std::vector<LinkChange> changes;
+    for (const auto &[entity, frameData] : _linkFrameData)
+      updateLink(entity, frameData, changes);
+    _ecm.SetChanged(changes);
+  }
+  else
+  {
+    // Spread the writeback across the worker pool. The reads from the
+    // physics engine and the writes to each link's own components are
+    // independent, so workers only have to defer the shared change
+    // tracking, which is applied in bulk afterwards.
+    std::vector<std::pair<Entity, const physics::FrameData3d *>> links;
+    links.reserve(linkCount);
+    for (const auto &[entity, frameData] : _linkFrameData)
+      links.emplace_back(entity, &frameData);
+
+    const std::size_t workers = std::min<std::size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), linkCount);
+    std::vector<std::vector<LinkChange>> workerChanges(workers);
+    for (std::size_t i = 0; i < workers; ++i)
+    {
+      this->workerPool.AddWork(
+          [&, i]()
+          {
+            for (std::size_t j = i; j < linkCount; j += workers)
+              updateLink(links[j].first, *links[j].second, workerChanges[i]);
+          });
+    }
+    this->workerPool.WaitForResults();
+
+    for (const auto &changes : workerChanges)
+      _ecm.SetChanged(changes);
   }
   GZ_PROFILE_END();
 
@@ -3902,7 +4180,8 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
   }
   GZ_PROFILE_END();
 
-  // Update joint positions
+  // Update joint positions. Joints are only queried when a consumer, such
+  // as JointStatePublisher or a controller, created the state component.
   GZ_PROFILE_BEGIN("Joints");
   _ecm.Each<components::Joint, components::JointPosition>(
       [&](const Entity &_entity, components::Joint *,
@@ -3910,8 +4189,10 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
       {
         if (auto jointPhys = this->entityJointMap.Get(_entity))
         {
-          _jointPos->Data().resize(jointPhys->GetDegreesOfFreedom());
-          for (std::size_t i = 0; i < jointPhys->GetDegreesOfFreedom(); ++i)
+          const std::size_t dof = this->JointDof(_entity, jointPhys);
+          if (_jointPos->Data().size() != dof)
+            _jointPos->Data().resize(dof);
+          for (std::size_t i = 0; i < dof; ++i)
           {
             _jointPos->Data()[i] = jointPhys->GetPosition(i);
           }
@@ -3928,9 +4209,10 @@ void PhysicsPrivate::UpdateSim(EntityComponentManager &_ecm,
       {
         if (auto jointPhys = this->entityJointMap.Get(_entity))
         {
-          _jointVel->Data().resize(jointPhys->GetDegreesOfFreedom());
-          for (std::size_t i = 0; i < jointPhys->GetDegreesOfFreedom();
-               ++i)
+          const std::size_t dof = this->JointDof(_entity, jointPhys);
+          if (_jointVel->Data().size() != dof)
+            _jointVel->Data().resize(dof);
+          for (std::size_t i = 0; i < dof; ++i)
           {
             _jointVel->Data()[i] = jointPhys->GetVelocity(i);
           }
@@ -50,6 +50,7 @@
 #include "gz/sim/components/Sensor.hh"
 #include "gz/sim/components/Visual.hh"
 #include "gz/sim/Conversions.hh"
+#include "gz/sim/LazyPublisher.hh"
 #include "gz/sim/Model.hh"
 
 using namespace gz;
@@ -81,19 +82,26 @@ class gz::sim::systems::PosePublisherPrivate
   public: void PublishPoses(
       std::vector<std::pair<Entity, math::Pose3d>> &_poses,
       const msgs::Time &_stampMsg,
-      transport::Node::Publisher &_publisher);
+      LazyPublisher &_publisher);
+
+  /// \brief Migrate dynamic entities whose pose has not changed for
+  /// autoStaticCycles publish cycles to the static stream, and back to the
+  /// dynamic stream as soon as their pose changes again.
+  /// \param[in] _ecm Immutable reference to the entity component manager
+  public: void ReclassifyPoses(const EntityComponentManager &_ecm);
 
   /// \brief Gazebo communication node.
   public: transport::Node node;
 
-  /// \brief publisher for pose data
-  public: transport::Node::Publisher posePub;
+  /// \brief publisher for pose data. Lazy so poses are only gathered and
+  /// filled while someone is subscribed.
+  public: LazyPublisher posePub;
 
   /// \brief True to publish static transforms to a separate topic
   public: bool staticPosePublisher = false;
 
-  /// \brief publisher for pose data
-  public: transport::Node::Publisher poseStaticPub;
+  /// \brief publisher for pose data. Lazy, see posePub.
+  public: LazyPublisher poseStaticPub;
 
   /// \brief Model interface
   public: Model model{kNullEntity};
@@ -145,6 +153,22 @@ class gz::sim::systems::PosePublisherPrivate
   /// by joints
   public: std::unordered_set<Entity> dynamicEntities;
 
+  /// \brief True to automatically reclassify dynamic poses that stop
+  /// changing as static. Requires staticPosePublisher.
+  public: bool autoStatic = false;
+
+  /// \brief Number of consecutive unchanged publish cycles after which a
+  /// dynamic pose migrates to the static stream.
+  public: unsigned int autoStaticCycles = 100;
+
+  /// \brief Dynamic entities currently demoted to the static stream.
+  public: std::unordered_set<Entity> autoStaticEntities;
+
+  /// \brief Last observed pose and unchanged publish cycle count for each
+  /// dynamic entity, used for the auto static classification.
+  public: std::unordered_map<Entity, std::pair<math::Pose3d, unsigned int>>
+              poseActivity;
+
   /// \brief A vector that contains the entities and their poses. This could
   /// easily be a temporary, but having it as a member variable improves
   /// performance by avoiding memory allocation
@@ -246,6 +270,27 @@ void PosePublisher::Configure(const Entity &_entity,
           std::chrono::duration_cast<std::chrono::steady_clock::duration>(
           period);
     }
+
+    this->dataPtr->autoStatic = _sdf->Get<bool>("auto_static",
+        this->dataPtr->autoStatic).first;
+    int autoStaticCycles = _sdf->Get<int>("auto_static_cycles",
+        static_cast<int>(this->dataPtr->autoStaticCycles)).first;
+    if (autoStaticCycles > 0)
+    {
+      this->dataPtr->autoStaticCycles =
+          static_cast<unsigned int>(autoStaticCycles);
+    }
+    else
+    {
+      gzwarn << "PosePublisher <auto_static_cycles> must be positive, "
+              << "using default of " << this->dataPtr->autoStaticCycles
+              << std::endl;
+    }
+  }
+  else if (_sdf->Get<bool>("auto_static", false).first)
+  {
+    gzwarn << "PosePublisher <auto_static> requires <static_publisher>, "
+            << "ignoring." << std::endl;
   }
 
   // create publishers
@@ -324,6 +369,12 @@ void PosePublisher::PostUpdate(const UpdateInfo &_info,
     publishStatic = false;
   }
 
+  // Gathering and filling poses is only worth doing while the stream has
+  // subscribers.
+  publish = publish && this->dataPtr->posePub.HasConnections();
+  publishStatic =
+      publishStatic && this->dataPtr->poseStaticPub.HasConnections();
+
   if (!publish && !publishStatic)
     return;
 
@@ -333,6 +384,13 @@ void PosePublisher::PostUpdate(const UpdateInfo &_info,
     this->dataPtr->initialized = true;
   }
 
+  // Migrate poses that have stopped changing to the static stream, and
+  // back once they move again.
+  if (this->dataPtr->staticPosePublisher && this->dataPtr->autoStatic &&
+      publish)
+  {
+    this->dataPtr->ReclassifyPoses(_ecm);
+  }
 
   // if static transforms are published through a different topic
   if (this->dataPtr->staticPosePublisher)
@@ -502,6 +560,38 @@ void PosePublisherPrivate::InitializeEntitiesToPublish(
   }
 }
 
+//////////////////////////////////////////////////
+void PosePublisherPrivate::ReclassifyPoses(const EntityComponentManager &_ecm)
+{
+  GZ_PROFILE("PosePublisher::ReclassifyPoses");
+
+  for (const auto &entity : this->dynamicEntities)
+  {
+    auto pose = _ecm.Component<components::Pose>(entity);
+    if (!pose)
+      continue;
+
+    auto &activity = this->poseActivity[entity];
+    if (pose->Data() == activity.first)
+    {
+      if (activity.second < this->autoStaticCycles)
+      {
+        ++activity.second;
+        if (activity.second >= this->autoStaticCycles)
+          this->autoStaticEntities.insert(entity);
+      }
+    }
+    else
+    {
+      // The pose moved again: promote it back to the dynamic stream.
+      if (activity.second >= this->autoStaticCycles)
+        this->autoStaticEntities.erase(entity);
+      activity.first = pose->Data();
+      activity.second = 0;
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 void PosePublisherPrivate::FillPoses(const EntityComponentManager &_ecm,
     std::vector<std::pair<Entity, math::Pose3d>> &_poses, bool _static)
@@ -515,7 +605,9 @@ void PosePublisherPrivate::FillPoses(const EntityComponentManager &_ecm,
       continue;
 
     bool isStatic = this->dynamicEntities.find(entity.first) ==
-          this->dynamicEntities.end();
+          this->dynamicEntities.end() ||
+        this->autoStaticEntities.find(entity.first) !=
+          this->autoStaticEntities.end();
 
     if (_static == isStatic)
       _poses.emplace_back(entity.first, pose->Data());
@@ -526,7 +618,7 @@ void PosePublisherPrivate::FillPoses(const EntityComponentManager &_ecm,
 void PosePublisherPrivate::PublishPoses(
     std::vector<std::pair<Entity, math::Pose3d>> &_poses,
     const msgs::Time &_stampMsg,
-    transport::Node::Publisher &_publisher)
+    LazyPublisher &_publisher)
 {
   GZ_PROFILE("PosePublisher::PublishPoses");
 
@@ -573,14 +665,15 @@ void PosePublisherPrivate::PublishPoses(
     msg->set_name(childFrameId);
     msgs::Set(msg, transform);
 
-    // publish individual pose msgs
+    // publish individual pose msgs; connections were checked before the
+    // poses were gathered
     if (!this->usePoseV)
-      _publisher.Publish(this->poseMsg);
+      _publisher.Publisher().Publish(this->poseMsg);
   }
 
   // publish pose vector msg
   if (this->usePoseV)
-    _publisher.Publish(this->poseVMsg);
+    _publisher.Publisher().Publish(this->poseVMsg);
 }
 
 GZ_ADD_PLUGIN(PosePublisher,
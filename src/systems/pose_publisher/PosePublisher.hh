@@ -58,6 +58,13 @@ namespace systems
   /// - `<static_update_frequency>`: Frequency of static pose publications in
   ///   Hz. A negative frequency publishes as fast as possible (i.e, at the
   ///   rate of the simulation step).
+  /// - `<auto_static>`: Set to true to automatically migrate a dynamic pose
+  ///   that has not changed for `<auto_static_cycles>` publish cycles to the
+  ///   low-rate static topic, and back to the dynamic topic as soon as it
+  ///   changes again. Requires `<static_publisher>`.
+  /// - `<auto_static_cycles>`: Number of consecutive unchanged publish
+  ///   cycles after which a dynamic pose is treated as static. Defaults
+  ///   to 100.
   class PosePublisher
       : public System,
         public ISystemConfigure,
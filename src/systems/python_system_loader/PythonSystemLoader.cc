@@ -43,6 +43,7 @@ PythonSystemLoader::~PythonSystemLoader()
 {
   if (this->pythonSystem)
   {
+    py::gil_scoped_acquire gil;
     if (py::hasattr(this->pythonSystem, "shutdown"))
     {
       this->pythonSystem.attr("shutdown")();
@@ -54,6 +55,10 @@ void PythonSystemLoader::Configure(
     const Entity &_entity, const std::shared_ptr<const sdf::Element> &_sdf,
     EntityComponentManager &_ecm, EventManager &_eventMgr)
 {
+  // Configure may run while the simulation loop has the GIL released,
+  // e.g. for plugins loaded from entities spawned mid-simulation.
+  py::gil_scoped_acquire gil;
+
   auto [moduleName, hasModule] = _sdf->Get<std::string>("module_name", "");
   if (!hasModule)
   {
@@ -190,10 +195,20 @@ void PythonSystemLoader::CallPythonMethod(py::object _method, Args &&..._args)
   }
 }
 
+//////////////////////////////////////////////////
+// Each callback acquires the GIL itself: the simulation loop runs with the
+// GIL released so that C++ systems never hold it, and PostUpdate may be
+// invoked from a worker thread. Acquiring is a no-op when nothing needs to
+// run, since the cached method objects are only non-null for implemented
+// callbacks.
+
 //////////////////////////////////////////////////
 void PythonSystemLoader::PreUpdate(const UpdateInfo &_info,
                                    EntityComponentManager &_ecm)
 {
+  if (!this->preUpdateMethod)
+    return;
+  py::gil_scoped_acquire gil;
   CallPythonMethod(this->preUpdateMethod, _info, &_ecm);
 }
 
@@ -201,6 +216,9 @@ void PythonSystemLoader::PreUpdate(const UpdateInfo &_info,
 void PythonSystemLoader::Update(const UpdateInfo &_info,
                                 EntityComponentManager &_ecm)
 {
+  if (!this->updateMethod)
+    return;
+  py::gil_scoped_acquire gil;
   CallPythonMethod(this->updateMethod, _info, &_ecm);
 }
 
@@ -208,6 +226,8 @@ void PythonSystemLoader::Update(const UpdateInfo &_info,
 void PythonSystemLoader::PostUpdate(const UpdateInfo &_info,
                                     const EntityComponentManager &_ecm)
 {
+  if (!this->postUpdateMethod)
+    return;
   py::gil_scoped_acquire gil;
   CallPythonMethod(this->postUpdateMethod, _info, &_ecm);
 }
@@ -215,6 +235,9 @@ void PythonSystemLoader::PostUpdate(const UpdateInfo &_info,
 void PythonSystemLoader::Reset(const UpdateInfo &_info,
                                EntityComponentManager &_ecm)
 {
+  if (!this->resetMethod)
+    return;
+  py::gil_scoped_acquire gil;
   CallPythonMethod(this->resetMethod, _info, &_ecm);
 }
 
@@ -192,6 +192,31 @@ class gz::sim::systems::RFComms::Implementation
                                           const RadioState &_txState,
                                           const RadioState &_rxState) const;
 
+  /// \brief Cached channel state of an ordered transmitter/receiver pair.
+  public: struct ChannelState
+  {
+    /// \brief True once the pathloss below has been computed.
+    bool valid = false;
+
+    /// \brief Transmitter position used to compute the pathloss.
+    math::Vector3d txPos;
+
+    /// \brief Receiver position used to compute the pathloss.
+    math::Vector3d rxPos;
+
+    /// \brief Pathloss distribution computed from those positions.
+    RFPower rxPowerDist;
+  };
+
+  /// \brief Pathloss cache keyed by transmitter/receiver pair. Only used
+  /// when channelUpdateDistance is positive.
+  public: std::unordered_map<std::string, ChannelState> channelStates;
+
+  /// \brief Distance (meters) either endpoint of a pair may move before the
+  /// cached pathloss of that pair is recomputed. Zero recomputes the
+  /// pathloss for every packet.
+  public: double channelUpdateDistance = 0.0;
+
   /// \brief Range configuration.
   public: RangeConfiguration rangeConfig;
 
@@ -278,8 +303,32 @@ std::tuple<bool, double> RFComms::Implementation::AttemptSend(
   _txState.bytesSentThisEpoch += _numBytes;
 
   // Get the received power based on TX power and position of each node.
-  auto rxPowerDist =
-    this->LogNormalReceivedPower(this->radioConfig.txPower, _txState, _rxState);
+  // When a channel update distance is configured, the deterministic part of
+  // the pathloss is cached per pair and only recomputed once an endpoint
+  // has moved beyond that distance.
+  RFPower rxPowerDist;
+  if (this->channelUpdateDistance > 0.0)
+  {
+    auto &channel = this->channelStates[_txState.name + "/" + _rxState.name];
+    if (!channel.valid ||
+        channel.txPos.Distance(_txState.pose.Pos()) >
+          this->channelUpdateDistance ||
+        channel.rxPos.Distance(_rxState.pose.Pos()) >
+          this->channelUpdateDistance)
+    {
+      channel.txPos = _txState.pose.Pos();
+      channel.rxPos = _rxState.pose.Pos();
+      channel.rxPowerDist = this->LogNormalReceivedPower(
+        this->radioConfig.txPower, _txState, _rxState);
+      channel.valid = true;
+    }
+    rxPowerDist = channel.rxPowerDist;
+  }
+  else
+  {
+    rxPowerDist = this->LogNormalReceivedPower(
+      this->radioConfig.txPower, _txState, _rxState);
+  }
 
   double rxPower = rxPowerDist.mean;
   if (rxPowerDist.variance > 0.0)
@@ -391,6 +440,10 @@ void RFComms::Load(const Entity &/*_entity*/,
         this->dataPtr->radioConfig.noiseFloor).first;
   }
 
+  this->dataPtr->channelUpdateDistance =
+    _sdf->Get<double>("channel_update_distance",
+      this->dataPtr->channelUpdateDistance).first;
+
   gzdbg << "Range configuration:" << std::endl
          << this->dataPtr->rangeConfig << std::endl;
 
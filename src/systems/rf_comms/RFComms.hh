@@ -65,6 +65,12 @@ namespace systems
   ///   - `<noise_floor>`: Noise floor in dBm.  Default is -90dBm.
   ///   - `<modulation>`: Supported modulations: ["QPSK"]. Default is "QPSK".
   ///
+  /// - `<channel_update_distance>`: Distance (meters) either node of a pair
+  ///   may move before the deterministic pathloss of that pair is
+  ///   recomputed. Useful on dense meshes where many packets are exchanged
+  ///   between nodes that barely move within a step. Default is 0, which
+  ///   recomputes the pathloss for every packet.
+  ///
   /// ## Example
   ///
   /// Here's an example:
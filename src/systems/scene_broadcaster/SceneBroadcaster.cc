@@ -17,8 +17,10 @@
 
 #include "SceneBroadcaster.hh"
 
+#include <gz/msgs/axis_aligned_box.pb.h>
 #include <gz/msgs/camerasensor.pb.h>
 #include <gz/msgs/distortion.pb.h>
+#include <gz/msgs/float_v.pb.h>
 #include <gz/msgs/geometry.pb.h>
 #include <gz/msgs/imu_sensor.pb.h>
 #include <gz/msgs/lidar_sensor.pb.h>
@@ -35,17 +37,25 @@
 #include <gz/msgs/serialized_map.pb.h>
 #include <gz/msgs/stringmsg.pb.h>
 #include <gz/msgs/uint32_v.pb.h>
+#include <gz/msgs/uint64.pb.h>
+#include <gz/msgs/uint64_v.pb.h>
 #include <gz/msgs/visual.pb.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <gz/common/Profiler.hh>
+#include <gz/math/AxisAlignedBox.hh>
+#include <gz/msgs/Utility.hh>
 #include <gz/math/graph/Graph.hh>
 #include <gz/plugin/Register.hh>
 #include <gz/transport/Node.hh>
@@ -81,6 +91,7 @@
 #include "gz/sim/components/Visual.hh"
 #include "gz/sim/components/World.hh"
 #include "gz/sim/Conversions.hh"
+#include "gz/sim/Util.hh"
 #include "gz/sim/EntityComponentManager.hh"
 
 #include <sdf/Camera.hh>
@@ -117,6 +128,13 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \return True if successful.
   public: bool SceneGraphService(msgs::StringMsg &_res);
 
+  /// \brief Callback for scene graph version service. Clients use the
+  /// version to validate a cached copy of the scene structure without
+  /// requesting the full state.
+  /// \param[out] _res Response containing the current scene graph version.
+  /// \return True if successful.
+  public: bool SceneGraphVersionService(msgs::UInt64 &_res);
+
   /// \brief Callback for state service.
   /// \param[out] _res Response containing the latest full state.
   /// \return True if successful.
@@ -126,6 +144,17 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \param[out] _res Response containing the last available full state.
   public: void StateAsyncService(const msgs::StringMsg &_req);
 
+  /// \brief Callback for per-entity state service. Returns the full state
+  /// of only the requested entities, so a client inspecting a handful of
+  /// entities doesn't pay for serializing and deserializing the whole
+  /// world.
+  /// \param[in] _req Entity ids to include in the response.
+  /// \param[out] _res Response containing the latest state of the
+  /// requested entities.
+  /// \return True if successful.
+  public: bool EntityStateService(const msgs::UInt64_V &_req,
+      msgs::SerializedStepMap &_res);
+
   /// \brief Updates the scene graph when entities are added
   /// \param[in] _manager The entity component manager
   public: void SceneGraphAddEntities(const EntityComponentManager &_manager);
@@ -209,6 +238,19 @@ class gz::sim::systems::SceneBroadcasterPrivate
   public: void PoseUpdate(const UpdateInfo &_info,
     const EntityComponentManager &_manager);
 
+  /// \brief Service that creates an area of interest pose topic. The
+  /// request is the interest region; the reply is the name of a new
+  /// Pose_V topic carrying only models whose pose component lies inside
+  /// the region, plus their links. The filter tests the pose component
+  /// directly, so it is exact for top level models. Regions live for
+  /// the rest of the run; nothing is published while a region topic
+  /// has no subscribers.
+  /// \param[in] _req Axis aligned box bounding the region of interest.
+  /// \param[out] _rep Topic name to subscribe to.
+  /// \return True on success.
+  public: bool InterestRegionService(const msgs::AxisAlignedBox &_req,
+              msgs::StringMsg &_rep);
+
   /// \brief Transport node.
   public: std::unique_ptr<transport::Node> node{nullptr};
 
@@ -280,6 +322,20 @@ class gz::sim::systems::SceneBroadcasterPrivate
   /// \brief A list of async state requests
   public: std::unordered_set<std::string> stateRequests;
 
+  /// \brief Entity ids requested through the per-entity state service.
+  /// Filled by service threads and consumed in PostUpdate. Protected by
+  /// stateMutex.
+  public: std::unordered_set<Entity> entityStateRequests;
+
+  /// \brief Filled in PostUpdate for the per-entity state service.
+  /// Protected by stateMutex.
+  public: msgs::SerializedStepMap entityStepMsg;
+
+  /// \brief Incremented each time entityStepMsg is filled, so waiting
+  /// per-entity state service calls can detect completion. Protected by
+  /// stateMutex.
+  public: uint64_t entityStateGeneration{0};
+
   /// \brief Store SDF scene information so that it can be inserted into
   /// scene message.
   public: sdf::Scene sdfScene;
@@ -293,6 +349,116 @@ class gz::sim::systems::SceneBroadcasterPrivate
   ///  frequently enough)
   public: std::unordered_map<ComponentTypeId,
     std::unordered_set<Entity>> changedComponents;
+
+  /// \brief When greater than zero, the pose topics switch to delta
+  /// publication: between keyframes an entity's pose is only included
+  /// once it translated more than this many meters, or rotated more
+  /// than this many radians, since the pose last published for it.
+  public: double poseDeltaEpsilon{0.0};
+
+  /// \brief Period between pose keyframes. A keyframe republishes every
+  /// pose and resets the delta cache, so late subscribers converge.
+  public: std::chrono::steady_clock::duration poseKeyframePeriod{
+      std::chrono::seconds(1)};
+
+  /// \brief Sim time of the last pose keyframe.
+  public: std::chrono::steady_clock::duration lastPoseKeyframeTime{0};
+
+  /// \brief Poses as last published, used to filter deltas.
+  public: std::unordered_map<Entity, math::Pose3d> lastPublishedPoses;
+
+  /// \brief True to also advertise the compact dynamic pose topic.
+  public: bool compactPose{false};
+
+  /// \brief An area of interest subscription.
+  public: struct InterestRegion
+  {
+    /// \brief Region of interest in world coordinates.
+    math::AxisAlignedBox box;
+
+    /// \brief Publisher of the region's pose topic.
+    transport::Node::Publisher pub;
+  };
+
+  /// \brief Regions created by the pose/interest service. Protected by
+  /// interestMutex since the service runs on a transport thread.
+  public: std::vector<InterestRegion> interestRegions;
+
+  /// \brief Protects interestRegions.
+  public: std::mutex interestMutex;
+
+  /// \brief Counter used to name interest region topics.
+  public: unsigned int interestRegionCount{0u};
+
+  /// \brief A state stream configured through a <state_stream> element,
+  /// publishing the poses of a fixed set of entities at its own rate.
+  public: struct NamedStateStream
+  {
+    /// \brief Stream name, used as the topic suffix.
+    public: std::string name;
+
+    /// \brief Publication period derived from the configured hertz.
+    public: std::chrono::steady_clock::duration period{0};
+
+    /// \brief Simulation time of the last publication.
+    public: std::chrono::steady_clock::duration lastPubTime{0};
+
+    /// \brief Scoped entity names the stream covers.
+    public: std::vector<std::string> entityNames;
+
+    /// \brief Entities resolved from entityNames.
+    public: std::unordered_set<Entity> entities;
+
+    /// \brief Whether entityNames has been resolved at least once.
+    public: bool resolved{false};
+
+    /// \brief Publisher of the stream's pose topic.
+    public: transport::Node::Publisher pub;
+  };
+
+  /// \brief Named state streams. Lets a high-rate consumer follow a few
+  /// entities on its own topic instead of pushing the whole world state
+  /// stream above the rate the GUI needs. Only touched on the simulation
+  /// thread.
+  public: std::vector<NamedStateStream> namedStreams;
+
+  /// \brief Publish the named state streams that are due this step.
+  /// \param[in] _info Update info.
+  /// \param[in] _manager Entity component manager.
+  public: void NamedStreamUpdate(const UpdateInfo &_info,
+      const EntityComponentManager &_manager);
+
+  /// \brief Rebuild the scene snapshots from the graph if the graph
+  /// changed since they were last built. Callers must hold
+  /// sceneSnapshotMutex and must not hold graphMutex.
+  public: void RefreshSceneSnapshot();
+
+  /// \brief Protects the scene snapshots.
+  public: std::mutex sceneSnapshotMutex;
+
+  /// \brief Ready to serve scene message. Late joining clients get a
+  /// copy of this instead of triggering a full scene build per request;
+  /// the expensive graph traversal only reruns after entities were
+  /// added or removed.
+  public: msgs::Scene sceneSnapshot;
+
+  /// \brief Serialized scene graph, rebuilt together with the snapshot.
+  public: std::string sceneGraphSnapshot;
+
+  /// \brief True when the graph changed since the snapshots were built.
+  public: std::atomic<bool> sceneSnapshotDirty{true};
+
+  /// \brief Monotonic version of the scene graph, bumped whenever entities
+  /// are added to or removed from the graph. Stamped into full state
+  /// responses and served on its own so clients can cheaply check whether
+  /// the scene structure changed since their last full state.
+  public: std::atomic<uint64_t> sceneGraphVersion{1};
+
+  /// \brief Publisher of dynamic poses quantized to float32, 8 values
+  /// per entity: [id, x, y, z, qw, qx, qy, qz]. Roughly half the bytes
+  /// of the Pose_V stream since names are dropped and doubles halved.
+  /// Entity ids are exact up to 2^24 in float32.
+  public: transport::Node::Publisher compactPosePub;
 };
 
 
@@ -322,6 +488,63 @@ void SceneBroadcaster::Configure(
   auto readHertz = _sdf->Get<int>("dynamic_pose_hertz", 60);
   this->dataPtr->dyPoseHertz = readHertz.first;
 
+  this->dataPtr->poseDeltaEpsilon =
+      _sdf->Get<double>("pose_delta_epsilon", 0.0).first;
+  auto keyframeSecs = _sdf->Get<double>("pose_keyframe_period", 1.0).first;
+  if (keyframeSecs > 0.0)
+  {
+    this->dataPtr->poseKeyframePeriod =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(keyframeSecs));
+  }
+  else
+  {
+    gzerr << "SceneBroadcaster pose_keyframe_period must be positive, "
+           << "using default (1s)\n";
+  }
+
+  this->dataPtr->compactPose = _sdf->Get<bool>("compact_pose", false).first;
+
+  // Named state streams with independent rates and entity filters
+  for (auto streamElem = _sdf->FindElement("state_stream");
+       streamElem != nullptr;
+       streamElem = streamElem->GetNextElement("state_stream"))
+  {
+    SceneBroadcasterPrivate::NamedStateStream stream;
+    stream.name = streamElem->Get<std::string>("name", "").first;
+    if (stream.name.empty())
+    {
+      gzerr << "Skipping <state_stream> element without a <name>\n";
+      continue;
+    }
+
+    auto streamHertz = streamElem->Get<double>("hertz", 60.0).first;
+    if (streamHertz <= 0.0)
+    {
+      gzerr << "State stream [" << stream.name
+             << "] hertz must be positive, skipping\n";
+      continue;
+    }
+    stream.period =
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / streamHertz));
+
+    for (auto entityElem = streamElem->FindElement("entity");
+         entityElem != nullptr;
+         entityElem = entityElem->GetNextElement("entity"))
+    {
+      stream.entityNames.push_back(entityElem->Get<std::string>());
+    }
+    if (stream.entityNames.empty())
+    {
+      gzerr << "State stream [" << stream.name
+             << "] has no <entity> elements, skipping\n";
+      continue;
+    }
+
+    this->dataPtr->namedStreams.push_back(std::move(stream));
+  }
+
   auto stateHertz = _sdf->Get<double>("state_hertz", 60);
   if (stateHertz.first > 0.0)
   {
@@ -374,6 +597,8 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
     this->dataPtr->PoseUpdate(_info, _manager);
   }
 
+  this->dataPtr->NamedStreamUpdate(_info, _manager);
+
   // call SceneGraphRemoveEntities at the end of this update cycle so that
   // removed entities are removed from the scene graph for the next update cycle
   this->dataPtr->SceneGraphRemoveEntities(_manager);
@@ -413,6 +638,15 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
     if (this->dataPtr->stateServiceRequest)
     {
       _manager.State(*this->dataPtr->stepMsg.mutable_state(), {}, {}, true);
+
+      // Stamp the scene graph version so clients can later validate their
+      // copy of the scene structure against the scene/version service
+      // without another full state round trip.
+      auto headerData =
+          this->dataPtr->stepMsg.mutable_stats()->mutable_header()->add_data();
+      headerData->set_key("scene_graph_version");
+      headerData->add_value(
+          std::to_string(this->dataPtr->sceneGraphVersion));
     }
     // Publish the changed state if a change occurred to the ECS
     else if (changeEvent)
@@ -483,6 +717,22 @@ void SceneBroadcaster::PostUpdate(const UpdateInfo &_info,
       this->dataPtr->lastStatePubTime = now;
     }
   }
+
+  // Serve pending per-entity state requests. The response only serializes
+  // the requested entities, independently of the full state above.
+  {
+    std::unique_lock<std::mutex> lock(this->dataPtr->stateMutex);
+    if (!this->dataPtr->entityStateRequests.empty())
+    {
+      this->dataPtr->entityStepMsg.Clear();
+      set(this->dataPtr->entityStepMsg.mutable_stats(), _info);
+      _manager.State(*this->dataPtr->entityStepMsg.mutable_state(),
+          this->dataPtr->entityStateRequests, {}, true);
+      this->dataPtr->entityStateRequests.clear();
+      ++this->dataPtr->entityStateGeneration;
+      this->dataPtr->stateCv.notify_all();
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -501,8 +751,61 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
   GZ_PROFILE("SceneBroadcast::PoseUpdate");
 
   msgs::Pose_V poseMsg, dyPoseMsg;
+  msgs::Float_V compactPoseMsg;
   bool dyPoseConnections = this->dyPosePub.HasConnections();
   bool poseConnections = this->posePub.HasConnections();
+  bool compactPoseConnections =
+      this->compactPosePub && this->compactPosePub.HasConnections();
+
+  // Quantize a dynamic pose into the compact message: 8 float32 values
+  // per entity, [id, x, y, z, qw, qx, qy, qz].
+  auto addCompactPose = [&compactPoseMsg](const Entity _entity,
+      const math::Pose3d &_pose)
+  {
+    compactPoseMsg.add_data(static_cast<float>(_entity));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Pos().X()));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Pos().Y()));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Pos().Z()));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Rot().W()));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Rot().X()));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Rot().Y()));
+    compactPoseMsg.add_data(static_cast<float>(_pose.Rot().Z()));
+  };
+
+  // Delta publication: between keyframes, only include poses that moved
+  // beyond the configured epsilon since they were last published.
+  const bool deltaEnabled = this->poseDeltaEpsilon > 0.0 &&
+      (poseConnections || dyPoseConnections || compactPoseConnections);
+  if (deltaEnabled &&
+      (_info.simTime - this->lastPoseKeyframeTime >=
+       this->poseKeyframePeriod ||
+       _info.simTime < this->lastPoseKeyframeTime))
+  {
+    // Keyframe: republish everything and restart the delta cache.
+    this->lastPoseKeyframeTime = _info.simTime;
+    this->lastPublishedPoses.clear();
+  }
+
+  auto beyondEpsilon = [this](const Entity _entity,
+      const math::Pose3d &_pose) -> bool
+  {
+    auto it = this->lastPublishedPoses.find(_entity);
+    if (it == this->lastPublishedPoses.end())
+    {
+      this->lastPublishedPoses[_entity] = _pose;
+      return true;
+    }
+
+    const double dot =
+        std::min(1.0, std::abs(it->second.Rot().Dot(_pose.Rot())));
+    if ((it->second.Pos() - _pose.Pos()).Length() > this->poseDeltaEpsilon ||
+        2.0 * std::acos(dot) > this->poseDeltaEpsilon)
+    {
+      it->second = _pose;
+      return true;
+    }
+    return false;
+  };
 
   // Models
   _manager.Each<components::Model, components::Name, components::Pose,
@@ -512,6 +815,9 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
           const components::Pose *_poseComp,
           const components::Static *_staticComp) -> bool
       {
+        if (deltaEnabled && !beyondEpsilon(_entity, _poseComp->Data()))
+          return true;
+
         if (poseConnections)
         {
           // Add to pose msg
@@ -529,6 +835,10 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
           dyPose->set_name(_nameComp->Data());
           dyPose->set_id(_entity);
         }
+
+        if (compactPoseConnections && !_staticComp->Data())
+          addCompactPose(_entity, _poseComp->Data());
+
         return true;
       });
 
@@ -540,6 +850,9 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
           const components::Pose *_poseComp,
           const components::ParentEntity *_parentComp) -> bool
       {
+        if (deltaEnabled && !beyondEpsilon(_entity, _poseComp->Data()))
+          return true;
+
         // Add to pose msg
         if (poseConnections)
         {
@@ -561,29 +874,36 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
           dyPose->set_id(_entity);
         }
 
+        if (compactPoseConnections && !staticComp->Data())
+          addCompactPose(_entity, _poseComp->Data());
+
         return true;
       });
 
   if (dyPoseConnections)
   {
     // Set the time stamp in the header
-    dyPoseMsg.mutable_header()->mutable_stamp()->CopyFrom(
-        convert<msgs::Time>(_info.simTime));
+    set(dyPoseMsg.mutable_header()->mutable_stamp(), _info.simTime);
 
     this->dyPosePub.Publish(dyPoseMsg);
   }
 
+  if (compactPoseConnections)
+    this->compactPosePub.Publish(compactPoseMsg);
+
   // Visuals
   if (poseConnections)
   {
-    poseMsg.mutable_header()->mutable_stamp()->CopyFrom(
-        convert<msgs::Time>(_info.simTime));
+    set(poseMsg.mutable_header()->mutable_stamp(), _info.simTime);
 
     _manager.Each<components::Visual, components::Name, components::Pose>(
       [&](const Entity &_entity, const components::Visual *,
           const components::Name *_nameComp,
           const components::Pose *_poseComp) -> bool
       {
+        if (deltaEnabled && !beyondEpsilon(_entity, _poseComp->Data()))
+          return true;
+
         // Add to pose msg
         auto pose = poseMsg.add_pose();
         msgs::Set(pose, _poseComp->Data());
@@ -598,6 +918,9 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
             const components::Name *_nameComp,
             const components::Pose *_poseComp) -> bool
         {
+          if (deltaEnabled && !beyondEpsilon(_entity, _poseComp->Data()))
+            return true;
+
           // Add to pose msg
           auto pose = poseMsg.add_pose();
           msgs::Set(pose, _poseComp->Data());
@@ -608,6 +931,110 @@ void SceneBroadcasterPrivate::PoseUpdate(const UpdateInfo &_info,
 
     this->posePub.Publish(poseMsg);
   }
+
+  // Area of interest subscriptions: publish the models inside each
+  // region, and their links, on the region's own topic.
+  std::lock_guard<std::mutex> interestLock(this->interestMutex);
+  for (auto &region : this->interestRegions)
+  {
+    if (!region.pub.HasConnections())
+      continue;
+
+    msgs::Pose_V regionMsg;
+    set(regionMsg.mutable_header()->mutable_stamp(), _info.simTime);
+
+    std::unordered_set<Entity> regionModels;
+    _manager.Each<components::Model, components::Name, components::Pose>(
+        [&](const Entity &_entity, const components::Model *,
+            const components::Name *_nameComp,
+            const components::Pose *_poseComp) -> bool
+        {
+          if (!region.box.Contains(_poseComp->Data().Pos()))
+            return true;
+
+          regionModels.insert(_entity);
+          auto pose = regionMsg.add_pose();
+          msgs::Set(pose, _poseComp->Data());
+          pose->set_name(_nameComp->Data());
+          pose->set_id(_entity);
+          return true;
+        });
+
+    _manager.Each<components::Link, components::Name, components::Pose,
+                  components::ParentEntity>(
+        [&](const Entity &_entity, const components::Link *,
+            const components::Name *_nameComp,
+            const components::Pose *_poseComp,
+            const components::ParentEntity *_parentComp) -> bool
+        {
+          if (regionModels.find(_parentComp->Data()) == regionModels.end())
+            return true;
+
+          auto pose = regionMsg.add_pose();
+          msgs::Set(pose, _poseComp->Data());
+          pose->set_name(_nameComp->Data());
+          pose->set_id(_entity);
+          return true;
+        });
+
+    region.pub.Publish(regionMsg);
+  }
+}
+
+//////////////////////////////////////////////////
+void SceneBroadcasterPrivate::NamedStreamUpdate(const UpdateInfo &_info,
+    const EntityComponentManager &_manager)
+{
+  if (this->namedStreams.empty())
+    return;
+
+  GZ_PROFILE("SceneBroadcast::NamedStreamUpdate");
+
+  // Re-resolve the configured names when entities come or go, so streams
+  // follow entities that are respawned under the same name.
+  const bool entitiesChanged = _manager.HasNewEntities() ||
+      _manager.HasEntitiesMarkedForRemoval();
+
+  for (auto &stream : this->namedStreams)
+  {
+    if (!stream.resolved || entitiesChanged)
+    {
+      stream.entities.clear();
+      for (const auto &entityName : stream.entityNames)
+      {
+        auto found = entitiesFromScopedName(entityName, _manager);
+        stream.entities.insert(found.begin(), found.end());
+      }
+      stream.resolved = true;
+    }
+
+    if (!stream.pub || !stream.pub.HasConnections())
+      continue;
+
+    // Latest-value sampling at the stream's own rate, throttled on sim
+    // time since consumers pace themselves against the simulation. A jump
+    // back in time publishes immediately.
+    if (_info.simTime >= stream.lastPubTime &&
+        _info.simTime - stream.lastPubTime < stream.period)
+      continue;
+    stream.lastPubTime = _info.simTime;
+
+    msgs::Pose_V streamMsg;
+    set(streamMsg.mutable_header()->mutable_stamp(), _info.simTime);
+    for (const Entity entity : stream.entities)
+    {
+      auto poseComp = _manager.Component<components::Pose>(entity);
+      auto nameComp = _manager.Component<components::Name>(entity);
+      if (nullptr == poseComp || nullptr == nameComp)
+        continue;
+
+      auto pose = streamMsg.add_pose();
+      msgs::Set(pose, poseComp->Data());
+      pose->set_name(nameComp->Data());
+      pose->set_id(entity);
+    }
+    stream.pub.Publish(streamMsg);
+  }
 }
 
 //////////////////////////////////////////////////
@@ -643,6 +1070,15 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Serving graph information on [" << opts.NameSpace() << "/"
          << graphService << "]" << std::endl;
 
+  // Scene graph version service
+  std::string graphVersionService{"scene/version"};
+
+  this->node->Advertise(graphVersionService,
+      &SceneBroadcasterPrivate::SceneGraphVersionService, this);
+
+  gzmsg << "Serving scene graph version on [" << opts.NameSpace() << "/"
+         << graphVersionService << "]" << std::endl;
+
   // State service
   // Note: GuiRunner used to call this service but it is now using the async
   // version (state_async)
@@ -663,6 +1099,15 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Serving full state (async) on [" << opts.NameSpace() << "/"
          << stateAsyncService << "]" << std::endl;
 
+  // Per-entity state service
+  std::string entityStateService{"state/entity"};
+
+  this->node->Advertise(entityStateService,
+      &SceneBroadcasterPrivate::EntityStateService, this);
+
+  gzmsg << "Serving per-entity state on [" << opts.NameSpace() << "/"
+         << entityStateService << "]" << std::endl;
+
   // Scene info topic
   std::string sceneTopic{ns + "/scene/info"};
 
@@ -689,6 +1134,15 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
   gzmsg << "Publishing state changes on [" << stateTopic << "]"
       << std::endl;
 
+  // Area of interest service
+  std::string interestService{"pose/interest"};
+
+  this->node->Advertise(interestService,
+      &SceneBroadcasterPrivate::InterestRegionService, this);
+
+  gzmsg << "Serving area of interest pose topics on [" << opts.NameSpace()
+         << "/" << interestService << "]" << std::endl;
+
   // Pose info publisher
   std::string poseTopic{"pose/info"};
 
@@ -710,23 +1164,101 @@ void SceneBroadcasterPrivate::SetupTransport(const std::string &_worldName)
 
   gzmsg << "Publishing dynamic pose messages on [" << opts.NameSpace() << "/"
          << dyPoseTopic << "]" << std::endl;
+
+  // Compact dynamic pose publisher, opt-in for constrained links.
+  // Subscribers pick this topic instead of dynamic_pose/info; there is
+  // no per subscriber negotiation in transport.
+  if (this->compactPose)
+  {
+    std::string compactPoseTopic{"dynamic_pose/compact"};
+
+    transport::AdvertiseMessageOptions compactPoseAdvertOpts;
+    compactPoseAdvertOpts.SetMsgsPerSec(this->dyPoseHertz);
+    this->compactPosePub = this->node->Advertise<msgs::Float_V>(
+        compactPoseTopic, compactPoseAdvertOpts);
+
+    gzmsg << "Publishing compact dynamic pose messages on ["
+           << opts.NameSpace() << "/" << compactPoseTopic << "]" << std::endl;
+  }
+
+  // Named state stream publishers
+  for (auto &stream : this->namedStreams)
+  {
+    auto streamTopic =
+        transport::TopicUtils::AsValidTopic("state_stream/" + stream.name);
+    if (streamTopic.empty())
+    {
+      gzerr << "Failed to create valid topic for state stream ["
+             << stream.name << "]" << std::endl;
+      continue;
+    }
+
+    stream.pub = this->node->Advertise<msgs::Pose_V>(streamTopic);
+
+    gzmsg << "Publishing state stream [" << stream.name << "] on ["
+           << opts.NameSpace() << "/" << streamTopic << "]" << std::endl;
+  }
 }
 
 //////////////////////////////////////////////////
-bool SceneBroadcasterPrivate::SceneInfoService(msgs::Scene &_res)
+bool SceneBroadcasterPrivate::InterestRegionService(
+    const msgs::AxisAlignedBox &_req, msgs::StringMsg &_rep)
+{
+  math::AxisAlignedBox box(msgs::Convert(_req.min_corner()),
+                           msgs::Convert(_req.max_corner()));
+  if (box.Size() == math::Vector3d::Zero)
+  {
+    gzwarn << "Refusing to create an empty interest region" << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(this->interestMutex);
+  std::string topic =
+      "pose/interest/" + std::to_string(this->interestRegionCount++);
+
+  InterestRegion region;
+  region.box = box;
+  region.pub = this->node->Advertise<msgs::Pose_V>(topic);
+  if (!region.pub)
+  {
+    gzerr << "Failed to advertise interest region topic [" << topic << "]"
+           << std::endl;
+    return false;
+  }
+  this->interestRegions.push_back(std::move(region));
+
+  _rep.set_data(std::string(this->node->Options().NameSpace()) + "/" + topic);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void SceneBroadcasterPrivate::RefreshSceneSnapshot()
 {
+  if (!this->sceneSnapshotDirty)
+    return;
+
   std::lock_guard<std::mutex> lock(this->graphMutex);
 
-  _res.Clear();
+  this->sceneSnapshot.Clear();
+  this->sceneSnapshot.CopyFrom(convert<msgs::Scene>(this->sdfScene));
+  AddModels(&this->sceneSnapshot, this->worldEntity, this->sceneGraph);
+  AddLights(&this->sceneSnapshot, this->worldEntity, this->sceneGraph);
 
-  // Populate scene message
-  _res.CopyFrom(convert<msgs::Scene>(this->sdfScene));
+  std::stringstream graphStr;
+  graphStr << this->sceneGraph;
+  this->sceneGraphSnapshot = graphStr.str();
 
-  // Add models
-  AddModels(&_res, this->worldEntity, this->sceneGraph);
+  this->sceneSnapshotDirty = false;
+}
+
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::SceneInfoService(msgs::Scene &_res)
+{
+  std::lock_guard<std::mutex> lock(this->sceneSnapshotMutex);
+  this->RefreshSceneSnapshot();
 
-  // Add lights
-  AddLights(&_res, this->worldEntity, this->sceneGraph);
+  _res.Clear();
+  _res.CopyFrom(this->sceneSnapshot);
 
   return true;
 }
@@ -763,17 +1295,59 @@ bool SceneBroadcasterPrivate::StateService(
   return success;
 }
 
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::EntityStateService(
+    const msgs::UInt64_V &_req, msgs::SerializedStepMap &_res)
+{
+  _res.Clear();
+
+  if (_req.data().empty())
+  {
+    gzwarn << "Ignoring per-entity state request with no entities"
+            << std::endl;
+    return false;
+  }
+
+  // Lock and wait for an iteration to be run and fill the state
+  std::unique_lock<std::mutex> lock(this->stateMutex);
+
+  for (auto id : _req.data())
+    this->entityStateRequests.insert(id);
+
+  // Concurrent requests are served by one fill covering the union of the
+  // requested entities, so a response may contain more entities than asked
+  // for.
+  const auto generation = this->entityStateGeneration;
+  auto success = this->stateCv.wait_for(lock, 5s, [&]
+  {
+    return this->entityStateGeneration != generation;
+  });
+
+  if (success)
+    _res.CopyFrom(this->entityStepMsg);
+  else
+    gzerr << "Timed out waiting for entity state" << std::endl;
+
+  return success;
+}
+
 //////////////////////////////////////////////////
 bool SceneBroadcasterPrivate::SceneGraphService(msgs::StringMsg &_res)
 {
-  std::lock_guard<std::mutex> lock(this->graphMutex);
+  std::lock_guard<std::mutex> lock(this->sceneSnapshotMutex);
+  this->RefreshSceneSnapshot();
 
   _res.Clear();
+  _res.set_data(this->sceneGraphSnapshot);
 
-  std::stringstream graphStr;
-  graphStr << this->sceneGraph;
+  return true;
+}
 
-  _res.set_data(graphStr.str());
+//////////////////////////////////////////////////
+bool SceneBroadcasterPrivate::SceneGraphVersionService(msgs::UInt64 &_res)
+{
+  _res.Clear();
+  _res.set_data(this->sceneGraphVersion);
 
   return true;
 }
@@ -1161,6 +1735,9 @@ void SceneBroadcasterPrivate::SceneGraphAddEntities(
 
   if (newEntity)
   {
+    this->sceneSnapshotDirty = true;
+    ++this->sceneGraphVersion;
+
     // Only offer scene services once the message has been populated at least
     // once
     if (!this->node)
@@ -1212,6 +1789,9 @@ void SceneBroadcasterPrivate::SceneGraphRemoveEntities(
 
   if (!removedEntities.empty())
   {
+    this->sceneSnapshotDirty = true;
+    ++this->sceneGraphVersion;
+
     // Send the list of deleted entities
     msgs::UInt32_V deletionMsg;
 
@@ -173,6 +173,16 @@ class gz::sim::systems::SensorsPrivate
   /// \brief Pointer to the event manager
   public: EventManager *eventManager{nullptr};
 
+  /// \brief Render events fetched once at configure time so the render
+  /// loop can signal and query them without a per-emit type lookup.
+  public: events::PreRender *preRenderEvent{nullptr};
+
+  /// \brief See preRenderEvent.
+  public: events::Render *renderEvent{nullptr};
+
+  /// \brief See preRenderEvent.
+  public: events::PostRender *postRenderEvent{nullptr};
+
   /// \brief Wait for initialization to happen
   private: void WaitForInit();
 
@@ -228,8 +238,22 @@ class gz::sim::systems::SensorsPrivate
   /// \brief Check if any of the sensors have connections
   public: bool SensorsHaveConnections();
 
-  /// \brief Returns all sensors that have a pending trigger
-  public: std::unordered_set<sensors::SensorId> SensorsWithPendingTrigger();
+  /// \brief Returns all sensors that have a pending trigger. The returned
+  /// reference points at pendingTriggerSensors, which is reused between
+  /// calls.
+  public: const std::unordered_set<sensors::SensorId> &
+      SensorsWithPendingTrigger();
+
+  /// \brief Sensors with a pending trigger, filled by
+  /// SensorsWithPendingTrigger. Kept as a member so the steady-state
+  /// publish path doesn't allocate a fresh set every step.
+  public: std::unordered_set<sensors::SensorId> pendingTriggerSensors;
+
+  /// \brief Sensors deactivated for the current frame because they have
+  /// no subscribers or were shed under RTF pressure. Kept as a member so
+  /// the render loop doesn't allocate a fresh set every frame.
+  public: std::unordered_set<sensors::RenderingSensor *>
+      frameDisabledSensors;
 
   /// \brief Use to optionally set the background color.
   public: std::optional<math::Color> backgroundColor;
@@ -253,6 +277,37 @@ class gz::sim::systems::SensorsPrivate
   /// Affects sensors that are in nested models
   public: bool disableOnDrainedBattery = false;
 
+  /// \brief Measured real time factor threshold below which low priority
+  /// sensors start skipping frames. Zero disables load shedding.
+  public: double loadSheddingRtf = 0.0;
+
+  /// \brief Names of sensors that may shed load under RTF pressure.
+  /// Sensors not listed here always keep their configured rate.
+  public: std::unordered_set<std::string> lowPrioritySensors;
+
+  /// \brief Exponential moving average of the measured real time factor.
+  public: double measuredRtf = 1.0;
+
+  /// \brief Real time at the previous PostUpdate, for the RTF estimate.
+  public: std::chrono::steady_clock::duration prevRealTime{0};
+
+  /// \brief Per-sensor toggle that makes shed sensors skip every other
+  /// due update, so the decimation is deterministic rather than
+  /// dependent on render thread timing.
+  public: std::unordered_map<sensors::SensorId, bool> shedToggle;
+
+  /// \brief Sensors shed from the upcoming render pass. They are
+  /// deactivated for that pass only, the same mechanism used for
+  /// sensors without connections. Protected by sensorsMutex.
+  public: std::unordered_set<sensors::SensorId> shedSensors;
+
+  /// \brief True to update rendering sensors one at a time and log how
+  /// long each sensor's update took. The shared scene pass - one
+  /// PreRender / PostRender and one scene graph update per frame - is
+  /// unchanged; this only splits the update loop so the cost of
+  /// individual cameras becomes visible.
+  public: bool perSensorTiming = false;
+
   /// \brief Mutex to protect access to sensorStateChanged
   public: std::mutex sensorStateMutex;
 };
@@ -353,7 +408,7 @@ void SensorsPrivate::RunOnce()
 
     {
       GZ_PROFILE("PreRender");
-      this->eventManager->Emit<events::PreRender>();
+      this->preRenderEvent->Signal();
       this->scene->SetTime(this->updateTimeApplied);
       // Update the scene graph manually to improve performance
       // We only need to do this once per frame It is important to call
@@ -364,7 +419,7 @@ void SensorsPrivate::RunOnce()
 
     // disable sensors that have no subscribers to prevent doing unnecessary
     // work
-    std::unordered_set<sensors::RenderingSensor *> tmpDisabledSensors;
+    this->frameDisabledSensors.clear();
     this->sensorsMutex.lock();
     for (auto id : this->sensorIds)
     {
@@ -373,9 +428,22 @@ void SensorsPrivate::RunOnce()
       if (rs->IsActive() && !rs->HasConnections())
       {
         rs->SetActive(false);
-        tmpDisabledSensors.insert(rs);
+        this->frameDisabledSensors.insert(rs);
       }
     }
+
+    // also deactivate sensors shed from this pass under RTF pressure
+    for (auto id : this->shedSensors)
+    {
+      sensors::Sensor *s = this->sensorManager.Sensor(id);
+      auto rs = dynamic_cast<sensors::RenderingSensor *>(s);
+      if (rs && rs->IsActive())
+      {
+        rs->SetActive(false);
+        this->frameDisabledSensors.insert(rs);
+      }
+    }
+    this->shedSensors.clear();
     this->sensorsMutex.unlock();
 
     // safety check to see if reset occurred while we're rendering
@@ -385,12 +453,34 @@ void SensorsPrivate::RunOnce()
     {
       // publish data
       GZ_PROFILE("RunOnce");
-      this->sensorManager.RunOnce(this->updateTimeApplied);
-      this->eventManager->Emit<events::Render>();
+      if (!this->perSensorTiming)
+      {
+        this->sensorManager.RunOnce(this->updateTimeApplied);
+      }
+      else
+      {
+        // Update the sensors one at a time so each one's cost can be
+        // reported. They still share this frame's single scene graph
+        // update via the manual PreRender / PostRender above.
+        std::unique_lock<std::mutex> lk(this->sensorsMutex);
+        for (auto id : this->sensorIds)
+        {
+          sensors::Sensor *s = this->sensorManager.Sensor(id);
+          if (nullptr == s)
+            continue;
+          auto tStart = std::chrono::steady_clock::now();
+          s->Update(this->updateTimeApplied, false);
+          const std::chrono::duration<double, std::milli> elapsed =
+              std::chrono::steady_clock::now() - tStart;
+          gzdbg << "Sensor [" << s->Name() << "] update: "
+                << elapsed.count() << " ms" << std::endl;
+        }
+      }
+      this->renderEvent->Signal();
     }
 
     // re-enble sensors
-    for (auto &rs : tmpDisabledSensors)
+    for (auto &rs : this->frameDisabledSensors)
     {
       rs->SetActive(true);
     }
@@ -402,7 +492,7 @@ void SensorsPrivate::RunOnce()
       // sensors::RenderingSensor::SetManualSceneUpdate and set it to true
       // so we don't waste cycles doing one scene graph update per sensor
       this->scene->PostRender();
-      this->eventManager->Emit<events::PostRender>();
+      this->postRenderEvent->Signal();
     }
 
     std::unique_lock<std::mutex> lk(this->sensorsMutex);
@@ -541,6 +631,26 @@ void Sensors::Configure(const Entity &/*_id*/,
       _sdf->Get<bool>("disable_on_drained_battery",
      this->dataPtr-> disableOnDrainedBattery).first;
 
+  // get whether to log per-sensor update timing
+  this->dataPtr->perSensorTiming =
+      _sdf->Get<bool>("per_sensor_timing",
+      this->dataPtr->perSensorTiming).first;
+
+  // get the load shedding threshold and the sensors allowed to shed.
+  // Below the threshold, listed sensors skip every other due update.
+  this->dataPtr->loadSheddingRtf =
+      _sdf->Get<double>("load_shedding_rtf",
+      this->dataPtr->loadSheddingRtf).first;
+  if (_sdf->HasElement("low_priority"))
+  {
+    auto sdfClone = _sdf->Clone();
+    for (auto elem = sdfClone->GetElement("low_priority"); elem;
+         elem = elem->GetNextElement("low_priority"))
+    {
+      this->dataPtr->lowPrioritySensors.insert(elem->Get<std::string>());
+    }
+  }
+
   // Get the background color, if specified.
   if (_sdf->HasElement("background_color"))
     this->dataPtr->backgroundColor = _sdf->Get<math::Color>("background_color");
@@ -606,6 +716,10 @@ void Sensors::Configure(const Entity &/*_id*/,
 
   this->dataPtr->eventManager = &_eventMgr;
 
+  this->dataPtr->preRenderEvent = _eventMgr.Event<events::PreRender>();
+  this->dataPtr->renderEvent = _eventMgr.Event<events::Render>();
+  this->dataPtr->postRenderEvent = _eventMgr.Event<events::PostRender>();
+
   this->dataPtr->stopConn = this->dataPtr->eventManager->Connect<events::Stop>(
       std::bind(&SensorsPrivate::Stop, this->dataPtr.get()));
 
@@ -708,6 +822,21 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
 
   if (this->dataPtr->running && this->dataPtr->initialized)
   {
+    // Track the measured real time factor for load shedding
+    if (this->dataPtr->loadSheddingRtf > 0)
+    {
+      const auto realDt = _info.realTime - this->dataPtr->prevRealTime;
+      this->dataPtr->prevRealTime = _info.realTime;
+      if (!_info.paused &&
+          realDt > std::chrono::steady_clock::duration::zero())
+      {
+        const double rtf = std::chrono::duration<double>(_info.dt).count() /
+            std::chrono::duration<double>(realDt).count();
+        this->dataPtr->measuredRtf =
+            this->dataPtr->measuredRtf * 0.9 + rtf * 0.1;
+      }
+    }
+
     {
       GZ_PROFILE("UpdateFromECM");
       // Make sure we do not override the state in renderUtil if there are
@@ -732,9 +861,9 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
     // rate which can be too frequent and causes a performance hit.
     // We should look into throttling render updates
     bool hasRenderConnections =
-      (this->dataPtr->eventManager->ConnectionCount<events::PreRender>() > 0u ||
-      this->dataPtr->eventManager->ConnectionCount<events::Render>() > 0u ||
-      this->dataPtr->eventManager->ConnectionCount<events::PostRender>() > 0u);
+      (this->dataPtr->preRenderEvent->ConnectionCount() > 0u ||
+      this->dataPtr->renderEvent->ConnectionCount() > 0u ||
+      this->dataPtr->postRenderEvent->ConnectionCount() > 0u);
 
     // if nextUpdateTime is max, it probably means there are previously
     // no active sensors or sensors with connections.
@@ -748,7 +877,7 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
           this->dataPtr->sensorsToUpdate, _info.simTime);
     }
 
-    std::unordered_set<sensors::SensorId> sensorsWithPendingTriggers =
+    const std::unordered_set<sensors::SensorId> &sensorsWithPendingTriggers =
         this->dataPtr->SensorsWithPendingTrigger();
 
     // notify the render thread if updates are available
@@ -776,6 +905,34 @@ void Sensors::PostUpdate(const UpdateInfo &_info,
         std::unique_lock<std::mutex> lockSensors(this->dataPtr->sensorsMutex);
         this->dataPtr->activeSensors =
             std::move(this->dataPtr->sensorsToUpdate);
+
+        // Shed load: while the measured RTF is below the threshold, low
+        // priority sensors skip every other due update. Skipped sensors
+        // stay due, so they run at half rate instead of falling behind
+        // open-endedly. Triggered sensors are added below and never shed.
+        if (this->dataPtr->loadSheddingRtf > 0 &&
+            this->dataPtr->measuredRtf < this->dataPtr->loadSheddingRtf)
+        {
+          for (auto it = this->dataPtr->activeSensors.begin();
+               it != this->dataPtr->activeSensors.end();)
+          {
+            sensors::Sensor *s = this->dataPtr->sensorManager.Sensor(*it);
+            if (s && this->dataPtr->lowPrioritySensors.find(s->Name()) !=
+                this->dataPtr->lowPrioritySensors.end())
+            {
+              bool &skip = this->dataPtr->shedToggle[*it];
+              skip = !skip;
+              if (skip)
+              {
+                this->dataPtr->shedSensors.insert(*it);
+                it = this->dataPtr->activeSensors.erase(it);
+                continue;
+              }
+            }
+            ++it;
+          }
+        }
+
         // Add all sensors that have pending triggers.
         this->dataPtr->activeSensors.insert(sensorsWithPendingTriggers.begin(),
                                             sensorsWithPendingTriggers.end());
@@ -1091,10 +1248,10 @@ bool SensorsPrivate::SensorsHaveConnections()
 }
 
 //////////////////////////////////////////////////
-std::unordered_set<sensors::SensorId>
+const std::unordered_set<sensors::SensorId> &
 SensorsPrivate::SensorsWithPendingTrigger()
 {
-  std::unordered_set<sensors::SensorId> sensorsWithPendingTrigger;
+  this->pendingTriggerSensors.clear();
   for (auto id : this->sensorIds)
   {
     sensors::Sensor *s = this->sensorManager.Sensor(id);
@@ -1105,10 +1262,10 @@ SensorsPrivate::SensorsWithPendingTrigger()
 
     if (s->HasPendingTrigger())
     {
-      sensorsWithPendingTrigger.insert(id);
+      this->pendingTriggerSensors.insert(id);
     }
   }
-  return sensorsWithPendingTrigger;
+  return this->pendingTriggerSensors;
 }
 
 GZ_ADD_PLUGIN(Sensors, System,
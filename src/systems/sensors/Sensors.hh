@@ -51,6 +51,13 @@ namespace systems
   /// battery plugin charge reaches zero. Sensors that are in nested
   /// models are also affected.
   ///
+  /// \note This system drives all rendering sensors through a single
+  /// render engine instance and scene, so camera updates serialize on
+  /// one GPU context. To scale many cameras across GPUs, partition the
+  /// cameras across multiple server processes (each with its own render
+  /// engine, pinned to a GPU through the driver's device selection
+  /// environment variables) rather than loading them all into one world.
+  ///
   /// \TODO(louise) Have one system for all sensors, or one per
   /// sensor / sensor type?
   class Sensors:
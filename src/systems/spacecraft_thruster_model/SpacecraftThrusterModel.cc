@@ -25,7 +25,6 @@
 
 #include "SpacecraftThrusterModel.hh"
 
-#include <mutex>
 #include <string>
 #include <optional>
 #include <chrono>
@@ -44,6 +43,7 @@
 
 #include <sdf/sdf.hh>
 
+#include "gz/sim/CommandMailbox.hh"
 #include "gz/sim/components/Actuators.hh"
 #include "gz/sim/components/ExternalWorldWrenchCmd.hh"
 #include "gz/sim/components/Pose.hh"
@@ -96,12 +96,13 @@ class gz::sim::systems::SpacecraftThrusterModelPrivate
   /// \brief Actuator maximum thrust
   public: double maxThrust = 0.0;
 
-  /// \brief Received Actuators message. This is nullopt if no message has been
-  /// received.
+  /// \brief Received Actuators message. This is nullopt if no message has
+  /// been received. Only touched on the simulation thread.
   public: std::optional<msgs::Actuators> recvdActuatorsMsg;
 
-  /// \brief Mutex to protect recvdActuatorsMsg.
-  public: std::mutex recvdActuatorsMsgMutex;
+  /// \brief Mailbox carrying actuator messages from the transport callback
+  /// to the simulation thread without locking.
+  public: CommandMailbox<msgs::Actuators> actuatorsMailbox;
 
   /// \brief Gazebo communication node.
   public: transport::Node node;
@@ -247,8 +248,7 @@ void SpacecraftThrusterModel::Configure(const Entity &_entity,
 void SpacecraftThrusterModelPrivate::OnActuatorMsg(
     const msgs::Actuators &_msg)
 {
-  std::lock_guard<std::mutex> lock(this->recvdActuatorsMsgMutex);
-  this->recvdActuatorsMsg = _msg;
+  this->actuatorsMailbox.Push(_msg);
   if (this->actuatorNumber == 0)
     gzdbg << "Received actuator message!" << std::endl;
 }
@@ -291,7 +291,11 @@ void SpacecraftThrusterModelPrivate::UpdateForcesAndMoments(
   }
   else
   {
-    std::lock_guard<std::mutex> lock(this->recvdActuatorsMsgMutex);
+    msgs::Actuators latest;
+    if (this->actuatorsMailbox.Pop(latest))
+    {
+      this->recvdActuatorsMsg = std::move(latest);
+    }
     if (this->recvdActuatorsMsg.has_value())
     {
       msg = *this->recvdActuatorsMsg;
@@ -14,12 +14,14 @@
  * limitations under the License.
  *
  */
+#include <cmath>
 #include <cstdlib>
 #include <gz/transport/TopicUtils.hh>
 #include <memory>
 #include <mutex>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <gz/msgs/double.pb.h>
 
@@ -143,6 +145,10 @@ class gz::sim::systems::ThrusterPrivateData
   /// \brief Diameter of propeller in m, default: 0.02
   public: double propellerDiameter = 0.02;
 
+  /// \brief Fourth power of the propeller diameter, precomputed since it
+  /// appears in every thrust conversion.
+  public: double propellerDiameterPow4 = std::pow(0.02, 4);
+
   /// \brief Linear velocity of the vehicle.
   public: double linearVelocity = 0.0;
 
@@ -170,6 +176,13 @@ class gz::sim::systems::ThrusterPrivateData
   /// \brief Has the battery consumption being initialized.
   public: bool batteryInitialized = false;
 
+  /// \brief Batteries of the parent model, resolved once so the per-step
+  /// charge check doesn't scan every battery in the world.
+  public: std::vector<Entity> modelBatteryEntities;
+
+  /// \brief True once the model's batteries have been looked up.
+  public: bool modelBatteriesResolved = false;
+
   /// \brief Callback for handling thrust update
   public: void OnCmdThrust(const msgs::Double &_msg);
 
@@ -197,7 +210,7 @@ class gz::sim::systems::ThrusterPrivateData
   /// \brief Returns a boolean if the battery has sufficient charge to continue
   /// \return True if battery is charged, false otherwise. If no battery found,
   /// returns true.
-  public: bool HasSufficientBattery(const EntityComponentManager &_ecm) const;
+  public: bool HasSufficientBattery(const EntityComponentManager &_ecm);
 
   /// \brief Applies the deadband to the thrust and angular velocity by setting
   /// those values to zero if the thrust absolute value is below the deadband
@@ -252,6 +265,8 @@ void Thruster::Configure(
   if (_sdf->HasElement("propeller_diameter"))
   {
     this->dataPtr->propellerDiameter = _sdf->Get<double>("propeller_diameter");
+    this->dataPtr->propellerDiameterPow4 =
+        std::pow(this->dataPtr->propellerDiameter, 4);
   }
 
   // Get fluid density, default to water otherwise
@@ -574,7 +589,7 @@ double ThrusterPrivateData::ThrustToAngularVec(double _thrust)
   auto propAngularVelocity = sqrt(abs(
     _thrust /
       (this->fluidDensity
-      * this->thrustCoefficient * pow(this->propellerDiameter, 4))));
+      * this->thrustCoefficient * this->propellerDiameterPow4)));
 
   propAngularVelocity *= (_thrust * this->thrustCoefficient > 0) ? 1: -1;
 
@@ -594,30 +609,53 @@ double ThrusterPrivateData::AngularVelToThrust(double _angVel)
 {
   // Thrust is proportional to the Rotation Rate squared
   // See Thor I Fossen's  "Guidance and Control of ocean vehicles" p. 246
-  return this->thrustCoefficient * pow(this->propellerDiameter, 4)
+  return this->thrustCoefficient * this->propellerDiameterPow4
     * abs(_angVel) * _angVel * this->fluidDensity;
 }
 
 /////////////////////////////////////////////////
 bool ThrusterPrivateData::HasSufficientBattery(
-  const EntityComponentManager &_ecm) const
+  const EntityComponentManager &_ecm)
 {
-  bool result = true;
-  _ecm.Each<components::BatterySoC>([&](
-    const Entity &_entity,
-    const components::BatterySoC *_data
-  ){
-    if(_ecm.ParentEntity(_entity) == this->modelEntity)
+  // If a cached battery was removed, resolve the model's batteries again.
+  if (this->modelBatteriesResolved)
+  {
+    for (const auto &battery : this->modelBatteryEntities)
     {
-      if(_data->Data() <= 0)
+      if (!_ecm.HasEntity(battery))
       {
-        result = false;
+        this->modelBatteriesResolved = false;
+        this->modelBatteryEntities.clear();
+        break;
       }
     }
+  }
 
-    return true;
-  });
-  return result;
+  if (!this->modelBatteriesResolved)
+  {
+    this->modelBatteriesResolved = true;
+    _ecm.Each<components::BatterySoC>([&](
+      const Entity &_entity,
+      const components::BatterySoC *
+    ){
+      if (_ecm.ParentEntity(_entity) == this->modelEntity)
+      {
+        this->modelBatteryEntities.push_back(_entity);
+      }
+
+      return true;
+    });
+  }
+
+  for (const auto &battery : this->modelBatteryEntities)
+  {
+    auto *soc = _ecm.Component<components::BatterySoC>(battery);
+    if (nullptr != soc && soc->Data() <= 0)
+    {
+      return false;
+    }
+  }
+  return true;
 }
 
 /////////////////////////////////////////////////
@@ -742,15 +780,19 @@ void Thruster::PreUpdate(
     angvel.set_data(desiredPropellerAngVel);
   }
 
-  if (this->dataPtr->opmode == ThrusterPrivateData::OperationMode::ForceCmd)
-  {
-    this->dataPtr->pub.Publish(angvel);
-  }
-  else
+  // Only serialize feedback when someone is listening.
+  if (this->dataPtr->pub.HasConnections())
   {
-    msgs::Double force;
-    force.set_data(desiredThrust);
-    this->dataPtr->pub.Publish(force);
+    if (this->dataPtr->opmode == ThrusterPrivateData::OperationMode::ForceCmd)
+    {
+      this->dataPtr->pub.Publish(angvel);
+    }
+    else
+    {
+      msgs::Double force;
+      force.set_data(desiredThrust);
+      this->dataPtr->pub.Publish(force);
+    }
   }
   // Force: thrust
   // Torque: propeller rotation, if using PID
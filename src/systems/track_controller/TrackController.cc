@@ -142,6 +142,11 @@ class gz::sim::systems::TrackControllerPrivate
   /// \brief World poses of all collision elements of the track's link.
   public: std::unordered_map<Entity, math::Pose3d> collisionsWorldPose;
 
+  /// \brief Y axis of the track frame in world coordinates. Cached once per
+  /// step together with the link pose; it is constant for all contact points
+  /// processed within a step.
+  public: math::Vector3d trackYAxisGlobal;
+
   /// \brief Track position
   public: double position {0};
   /// \brief The last commanded velocity.
@@ -159,6 +164,12 @@ class gz::sim::systems::TrackControllerPrivate
   /// \brief protects velocity and centerOfRotation
   public: std::mutex cmdMutex;
 
+  /// \brief Snapshot of centerOfRotation taken once per step under cmdMutex,
+  /// so that the contact surface callback does not need to lock the mutex for
+  /// every contact point.
+  public: math::Vector3d centerOfRotationCopy
+    {math::Vector3d::Zero * math::INF_D};
+
   /// \brief Maximum age of a command in seconds. If a command is older, the
   /// track automatically sets a zero velocity. Set this to max() to denote
   /// commands do not time out.
@@ -424,11 +435,22 @@ void TrackController::PreUpdate(
     return;
   }
 
-  // Cache poses
+  // Cache poses. Track collisions are direct children of the link, so their
+  // world poses derive from the link pose without walking the entity tree
+  // once more per collision.
   this->dataPtr->linkWorldPose = worldPose(this->dataPtr->linkEntity, _ecm);
   for (auto& collisionEntity : this->dataPtr->trackCollisions)
-    this->dataPtr->collisionsWorldPose[collisionEntity] =
+  {
+    auto poseComp = _ecm.Component<components::Pose>(collisionEntity);
+    this->dataPtr->collisionsWorldPose[collisionEntity] = poseComp ?
+      this->dataPtr->linkWorldPose * poseComp->Data() :
       worldPose(collisionEntity, _ecm);
+  }
+
+  const auto trackWorldRot =
+    this->dataPtr->linkWorldPose.Rot() * this->dataPtr->trackOrientation;
+  this->dataPtr->trackYAxisGlobal =
+    trackWorldRot.RotateVector(math::Vector3d::UnitY);
 
   std::chrono::steady_clock::duration lastCommandTimeCopy;
   {
@@ -442,6 +464,7 @@ void TrackController::PreUpdate(
 
     // Compute limited velocity command
     this->dataPtr->limitedVelocity = this->dataPtr->velocity;
+    this->dataPtr->centerOfRotationCopy = this->dataPtr->centerOfRotation;
   }
 
   if (this->dataPtr->maxCommandAge != std::chrono::steady_clock::duration::max()
@@ -523,8 +546,7 @@ void TrackController::PostUpdate(const UpdateInfo &_info,
   msgs::Odometry msg;
 
   // Set the time stamp in the header
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
   // Set position and velocity
   msg.mutable_pose()->mutable_position()->set_x(this->dataPtr->position);
@@ -569,34 +591,27 @@ void TrackControllerPrivate::ComputeSurfaceProperties(
   auto contactNormal = _normal.value();
 
   // In case we have not yet cached the collision pose, skip this iteration
-  if (this->collisionsWorldPose.find(trackCollision) ==
-      this->collisionsWorldPose.end())
+  const auto collisionPoseIt = this->collisionsWorldPose.find(trackCollision);
+  if (collisionPoseIt == this->collisionsWorldPose.end())
     return;
-  const auto& collisionPose = this->collisionsWorldPose[trackCollision];
+  const auto& collisionPose = collisionPoseIt->second;
 
   // Flip the contact normal if it points outside the track collision
   if (contactNormal.Dot(collisionPose.Pos() - _point) < 0)
     contactNormal = -contactNormal;
 
-  const auto trackWorldRot = this->linkWorldPose.Rot() * this->trackOrientation;
-  const auto trackYAxisGlobal =
-    trackWorldRot.RotateVector(math::Vector3d::UnitY);
-
   // Vector tangent to the belt pointing in the belt's movement direction
   // The belt's bottom moves backwards when the robot should move forward!
-  auto beltDirection = contactNormal.Cross(trackYAxisGlobal);
+  // trackYAxisGlobal and centerOfRotationCopy are cached once per step in
+  // PreUpdate, so this per-contact callback neither recomputes the track
+  // frame nor locks cmdMutex.
+  auto beltDirection = contactNormal.Cross(this->trackYAxisGlobal);
 
   if (this->limitedVelocity < 0)
     beltDirection = -beltDirection;
 
-  math::Vector3d cor;
-  {
-    std::lock_guard<std::mutex> lock(this->cmdMutex);
-    cor = this->centerOfRotation;
-  }
-
   const auto frictionDirection = this->ComputeFrictionDirection(
-    cor, _point, contactNormal, beltDirection);
+    this->centerOfRotationCopy, _point, contactNormal, beltDirection);
 
   _params.firstFrictionalDirection =
     convert(isCollision1Track ? frictionDirection : -frictionDirection);
@@ -619,8 +634,7 @@ void TrackControllerPrivate::ComputeSurfaceProperties(
     gzdbg << "- surface motion       " << surfaceMotion << std::endl;
     gzdbg << "- contact point        " << convert(_point) << std::endl;
     gzdbg << "- contact normal       " << contactNormal << std::endl;
-    gzdbg << "- track rot            " << trackWorldRot << std::endl;
-    gzdbg << "- track Y              " << trackYAxisGlobal << std::endl;
+    gzdbg << "- track Y              " << this->trackYAxisGlobal << std::endl;
     gzdbg << "- belt direction       " << beltDirection << std::endl;
 
     this->debugMarker.set_id(++this->markerId);
@@ -586,8 +586,7 @@ void TrackedVehiclePrivate::UpdateOdometry(
   msg.mutable_twist()->mutable_angular()->set_z(*this->odom.AngularVelocity());
 
   // Set the time stamp in the header
-  msg.mutable_header()->mutable_stamp()->CopyFrom(
-      convert<msgs::Time>(_info.simTime));
+  set(msg.mutable_header()->mutable_stamp(), _info.simTime);
 
   // Set the frame id.
   auto frame = msg.mutable_header()->add_data();
@@ -17,6 +17,7 @@
 
 #include <gz/msgs/boolean.pb.h>
 
+#include <cstddef>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -99,9 +100,14 @@ class gz::sim::systems::TrajectoryFollowerPrivate
   public: gz::math::Vector3d nextGoal;
 
   /// \brief Vector containing waypoints as 3D vectors of doubles representing
-  /// X Y, where X and Y are local (Gazebo) coordinates.
+  /// X Y, where X and Y are local (Gazebo) coordinates. The list is compiled
+  /// once at load time and never reshuffled; the current goal is tracked by
+  /// curWaypoint.
   public: std::vector<gz::math::Vector2d> localWaypoints;
 
+  /// \brief Index into localWaypoints of the current goal.
+  public: std::size_t curWaypoint{0};
+
   /// \brief Initialization flag.
   public: bool initialized{false};
 
@@ -329,8 +335,9 @@ void TrajectoryFollower::PreUpdate(
   if (this->dataPtr->localWaypoints.empty())
     return;
 
-  this->dataPtr->modelPose = gz::sim::worldPose(
-    this->dataPtr->link.Entity(), _ecm);
+  // The WorldPose component is enabled at initialization, so this reads the
+  // physics-maintained component instead of walking the pose chain.
+  this->dataPtr->modelPose = this->dataPtr->link.WorldPose(_ecm).value();
   this->dataPtr->modelPose.Pos().Z() = 0;
 
   // Direction vector to the goal from the model.
@@ -349,28 +356,19 @@ void TrajectoryFollower::PreUpdate(
   // Waypoint reached!
   if (range <= this->dataPtr->rangeTolerance)
   {
-    // We always keep the last waypoint in the vector to keep the model
+    // We always keep the last waypoint as the goal to keep the model
     // "alive" in case it moves away from its goal.
-    if (this->dataPtr->localWaypoints.size() == 1)
+    const std::size_t count = this->dataPtr->localWaypoints.size();
+    if (this->dataPtr->curWaypoint + 1 >= count &&
+        !this->dataPtr->loopForever)
       return;
 
-    if (this->dataPtr->loopForever)
-    {
-      // Rotate to the left.
-      std::rotate(this->dataPtr->localWaypoints.begin(),
-                  this->dataPtr->localWaypoints.begin() + 1,
-                  this->dataPtr->localWaypoints.end());
-    }
-    else
-    {
-      // Remove the first waypoint.
-      this->dataPtr->localWaypoints.erase(
-        this->dataPtr->localWaypoints.begin());
-    }
+    // Advance to the next waypoint, wrapping around when looping.
+    this->dataPtr->curWaypoint = (this->dataPtr->curWaypoint + 1) % count;
 
     this->dataPtr->nextGoal = {
-      this->dataPtr->localWaypoints.front().X(),
-      this->dataPtr->localWaypoints.front().Y(), 0};
+      this->dataPtr->localWaypoints[this->dataPtr->curWaypoint].X(),
+      this->dataPtr->localWaypoints[this->dataPtr->curWaypoint].Y(), 0};
 
     return;
   }
@@ -30,6 +30,7 @@
 #pragma warning(pop)
 #endif
 
+#include <cstdint>
 #include <limits>
 #include <utility>
 
@@ -190,6 +191,28 @@ class FieldMatcher : public InputMatcher
   /// \brief Field descriptor of the field compared by this matcher
   protected: std::vector<const google::protobuf::FieldDescriptor *>
                  fieldDescMatcher;
+
+  /// \brief True when the matched field is a non-repeated integer, bool,
+  /// enum or string, enabling a direct typed comparison that skips
+  /// MessageDifferencer. Floating point fields keep the differencer for
+  /// its approximate comparison semantics.
+  protected: bool scalarFastPath{false};
+
+  /// \brief Matcher value captured at construction for signed integer and
+  /// enum fields on the fast path.
+  protected: int64_t matchInt{0};
+
+  /// \brief Matcher value captured at construction for unsigned integer
+  /// fields on the fast path.
+  protected: uint64_t matchUint{0};
+
+  /// \brief Matcher value captured at construction for bool fields on the
+  /// fast path.
+  protected: bool matchBool{false};
+
+  /// \brief Matcher value captured at construction for string fields on
+  /// the fast path.
+  protected: std::string matchString;
 };
 
 //////////////////////////////////////////////////
@@ -306,6 +329,48 @@ FieldMatcher::FieldMatcher(const std::string &_msgType, bool _logicType,
     return;
   }
 
+  // Compile a direct typed comparison for the common case of a
+  // non-repeated integer, bool, enum or string field. The matcher value
+  // is captured once here so matching doesn't need the differencer.
+  const auto *lastDesc = this->fieldDescMatcher.back();
+  if (!lastDesc->is_repeated())
+  {
+    const auto *refl = matcherSubMsg->GetReflection();
+    switch (lastDesc->cpp_type())
+    {
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+        this->matchInt = refl->GetInt32(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+        this->matchInt = refl->GetInt64(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+        this->matchUint = refl->GetUInt32(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+        this->matchUint = refl->GetUInt64(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+        this->matchBool = refl->GetBool(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+        this->matchInt = refl->GetEnumValue(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+        this->matchString = refl->GetString(*matcherSubMsg, lastDesc);
+        this->scalarFastPath = true;
+        break;
+      default:
+        break;
+    }
+  }
+
   this->valid = true;
 }
 
@@ -389,8 +454,6 @@ bool FieldMatcher::FindFieldSubMessage(
 bool FieldMatcher::DoMatch(
     const transport::ProtoMsg &_input) const
 {
-  google::protobuf::util::DefaultFieldComparator comp;
-
   auto *matcherRefl = this->matchMsg->GetReflection();
   auto *inputRefl = _input.GetReflection();
   const transport::ProtoMsg *subMsgMatcher = this->matchMsg.get();
@@ -411,6 +474,45 @@ bool FieldMatcher::DoMatch(
     }
   }
 
+  // Direct typed comparison compiled at construction time.
+  if (this->scalarFastPath)
+  {
+    const auto *fieldDesc = this->fieldDescMatcher.back();
+    const auto *refl = subMsgInput->GetReflection();
+    bool equal{false};
+    switch (fieldDesc->cpp_type())
+    {
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+        equal = refl->GetInt32(*subMsgInput, fieldDesc) == this->matchInt;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+        equal = refl->GetInt64(*subMsgInput, fieldDesc) == this->matchInt;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+        equal = refl->GetUInt32(*subMsgInput, fieldDesc) == this->matchUint;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+        equal = refl->GetUInt64(*subMsgInput, fieldDesc) == this->matchUint;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+        equal = refl->GetBool(*subMsgInput, fieldDesc) == this->matchBool;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
+        equal = refl->GetEnumValue(*subMsgInput, fieldDesc) == this->matchInt;
+        break;
+      case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+      {
+        std::string scratch;
+        equal = refl->GetStringReference(*subMsgInput, fieldDesc, &scratch) ==
+            this->matchString;
+        break;
+      }
+      default:
+        break;
+    }
+    return this->logicType == equal;
+  }
+
   return this->logicType ==
          this->diff.CompareWithFields(*subMsgMatcher, *subMsgInput,
                                       {this->fieldDescMatcher.back()},
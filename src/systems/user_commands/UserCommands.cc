@@ -43,8 +43,14 @@
 #include <gz/msgs/visual.pb.h>
 #include <gz/msgs/wheel_slip_parameters_cmd.pb.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -93,6 +99,42 @@ using namespace gz;
 using namespace sim;
 using namespace systems;
 
+namespace
+{
+/// \brief Parse an SDF spawn string, memoizing successfully parsed roots so
+/// spawning many copies of the same snippet, like the shapes from
+/// getPrimitiveShape, only pays for one parse. The cache is capped so
+/// procedurally generated one-off strings can't grow it without bound.
+/// \param[in] _sdf SDF string to parse.
+/// \param[out] _root Parsed root, cloned from the cache on a hit.
+/// \return Errors from parsing, empty on a cache hit.
+sdf::Errors loadSpawnSdfString(const std::string &_sdf, sdf::Root &_root)
+{
+  static std::mutex cacheMutex;
+  static std::unordered_map<std::string, sdf::Root> cache;
+  constexpr std::size_t kMaxCachedRoots{128u};
+
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto it = cache.find(_sdf);
+    if (it != cache.end())
+    {
+      _root = it->second.Clone();
+      return sdf::Errors();
+    }
+  }
+
+  sdf::Errors errors = _root.LoadSdfString(_sdf);
+  if (errors.empty())
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    if (cache.size() < kMaxCachedRoots)
+      cache.emplace(_sdf, _root.Clone());
+  }
+  return errors;
+}
+}
+
 namespace gz
 {
 namespace sim
@@ -161,6 +203,24 @@ class CreateCommand : public UserCommandBase
 
   // Documentation inherited
   public: bool Execute() final;
+
+  /// \brief Parse and validate the spawn description ahead of Execute.
+  /// Called from the transport thread at enqueue time, so bursts of spawn
+  /// requests don't pay for SDF parsing inside the simulation step. Clone
+  /// requests need the ECM and are handled entirely by Execute.
+  public: void Prepare();
+
+  /// \brief Spawn SDF parsed by Prepare.
+  private: sdf::Root root;
+
+  /// \brief Light description converted by Prepare.
+  private: sdf::Light lightSdf;
+
+  /// \brief Errors from parsing, reported by Execute.
+  private: sdf::Errors errors;
+
+  /// \brief Whether Prepare already processed this command's message.
+  private: bool prepared{false};
 };
 
 /// \brief Command to remove an entity from simulation.
@@ -538,6 +598,21 @@ class gz::sim::systems::UserCommandsPrivate
   public: bool WheelSlipService(
     const msgs::WheelSlipParametersCmd &_req, msgs::Boolean &_res);
 
+  /// \brief Callback for streamed pose commands.
+  /// \param[in] _msg Pose message. The entity is identified by id or name.
+  public: void OnCmdPose(const msgs::Pose &_msg);
+
+  /// \brief Callback for the command barrier service. Blocks until every
+  /// command queued before the call has been executed, so a script can
+  /// fire any number of commands without waiting on each, then issue one
+  /// barrier to learn when, and whether, they all applied. All commands
+  /// pending at the start of a step execute within that single step.
+  /// \param[in] _req Unused.
+  /// \param[out] _res True if every command in the executed batch
+  /// succeeded.
+  /// \return True if successful, false on timeout.
+  public: bool BarrierService(const msgs::Boolean &_req, msgs::Boolean &_res);
+
   /// \brief Queue of commands pending execution.
   public: std::vector<std::unique_ptr<UserCommandBase>> pendingCmds;
 
@@ -549,6 +624,48 @@ class gz::sim::systems::UserCommandsPrivate
 
   /// \brief Mutex to protect pending queue.
   public: std::mutex pendingMutex;
+
+  /// \brief Streamed pose commands coalesced per entity: within a step
+  /// only the last received pose for each entity is kept, so high-rate
+  /// external pose driving costs one component write per entity per step
+  /// with no per-message command object. Protected by poseCmdsMutex.
+  public: std::unordered_map<std::string, msgs::Pose> pendingPoseCmds;
+
+  /// \brief Drained copy of pendingPoseCmds applied in PreUpdate. Kept as
+  /// a member so its buckets are reused across steps.
+  public: std::unordered_map<std::string, msgs::Pose> poseCmdsToApply;
+
+  /// \brief Mutex to protect pendingPoseCmds.
+  public: std::mutex poseCmdsMutex;
+
+  /// \brief Light commands received on the light_config topic, coalesced
+  /// per light: only the last message for each light survives a step, so
+  /// animating many lights at a high rate costs one command per light per
+  /// step instead of one heap-allocated command per message. Protected by
+  /// lightCmdsMutex.
+  public: std::unordered_map<std::string, msgs::Light> pendingLightCmds;
+
+  /// \brief Drained copy of pendingLightCmds applied in PreUpdate. Member
+  /// so its buckets are reused across steps.
+  public: std::unordered_map<std::string, msgs::Light> lightCmdsToApply;
+
+  /// \brief Mutex to protect pendingLightCmds.
+  public: std::mutex lightCmdsMutex;
+
+  /// \brief Number of command batches executed so far, bumped at the end
+  /// of every PreUpdate that drained the queue. Protected by
+  /// executedMutex.
+  public: uint64_t executedGeneration{0u};
+
+  /// \brief Whether every command in the last executed batch succeeded.
+  /// Protected by executedMutex.
+  public: bool lastBatchSuccess{true};
+
+  /// \brief Mutex protecting the execution bookkeeping.
+  public: std::mutex executedMutex;
+
+  /// \brief Signals barrier waiters after a batch executed.
+  public: std::condition_variable executedCv;
 };
 
 /// \brief Pose3d equality comparison function.
@@ -685,6 +802,13 @@ void UserCommands::Configure(const Entity &_entity,
 
   gzmsg << "Pose service on [" << poseVectorService << "]" << std::endl;
 
+  // Streamed pose commands on the same name as the pose service,
+  // following the light_config service/topic pairing. Messages are
+  // coalesced per entity each step instead of queued individually.
+  std::string poseTopic{"/world/" + validWorldName + "/set_pose"};
+  this->dataPtr->node.Subscribe(poseTopic, &UserCommandsPrivate::OnCmdPose,
+                                this->dataPtr.get());
+
   // Light service
   std::string lightService{"/world/" + validWorldName + "/light_config"};
   this->dataPtr->node.Advertise(lightService,
@@ -760,6 +884,15 @@ void UserCommands::Configure(const Entity &_entity,
       &UserCommandsPrivate::WheelSlipService, this->dataPtr.get());
 
   gzmsg << "Material service on [" << wheelSlipService << "]" << std::endl;
+
+  // Command barrier service
+  std::string barrierService
+      {"/world/" + validWorldName + "/command_barrier"};
+  this->dataPtr->node.Advertise(barrierService,
+      &UserCommandsPrivate::BarrierService, this->dataPtr.get());
+
+  gzmsg << "Command barrier service on [" << barrierService << "]"
+    << std::endl;
 }
 
 //////////////////////////////////////////////////
@@ -767,6 +900,36 @@ void UserCommands::PreUpdate(const UpdateInfo &/*_info*/,
     EntityComponentManager &)
 {
   GZ_PROFILE("UserCommands::PreUpdate");
+
+  // Apply the streamed pose commands received since the last step, one
+  // coalesced write per entity. The swap keeps the lock off the transport
+  // thread while the poses are applied.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->poseCmdsMutex);
+    std::swap(this->dataPtr->poseCmdsToApply, this->dataPtr->pendingPoseCmds);
+  }
+  for (const auto &[key, poseMsg] : this->dataPtr->poseCmdsToApply)
+    updatePose(poseMsg, this->dataPtr->iface);
+  this->dataPtr->poseCmdsToApply.clear();
+
+  // Same for streamed light commands: one coalesced LightCmd write per
+  // light per step. RenderUtil already batches LightCmd components into a
+  // single per-frame light map, so this keeps the whole path at one
+  // update per light per frame regardless of the incoming message rate.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->lightCmdsMutex);
+    std::swap(this->dataPtr->lightCmdsToApply,
+        this->dataPtr->pendingLightCmds);
+  }
+  for (const auto &[key, lightMsg] : this->dataPtr->lightCmdsToApply)
+  {
+    auto msg = lightMsg.New();
+    msg->CopyFrom(lightMsg);
+    LightCommand cmd(msg, this->dataPtr->iface);
+    cmd.Execute();
+  }
+  this->dataPtr->lightCmdsToApply.clear();
+
   // make a copy the cmds so execution does not block receiving other
   // incoming cmds
   std::vector<std::unique_ptr<UserCommandBase>> cmds;
@@ -781,11 +944,15 @@ void UserCommands::PreUpdate(const UpdateInfo &/*_info*/,
   // TODO(louise) Record current world state for undo
 
   // Execute pending commands
+  bool batchSuccess{true};
   for (auto &cmd : cmds)
   {
     // Execute
     if (!cmd->Execute())
+    {
+      batchSuccess = false;
       continue;
+    }
 
     // TODO(louise) Update command with current world state
 
@@ -793,13 +960,59 @@ void UserCommands::PreUpdate(const UpdateInfo &/*_info*/,
   }
 
   // TODO(louise) Clear redo list
+
+  // Wake up barrier waiters now that the batch has been applied.
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->executedMutex);
+    ++this->dataPtr->executedGeneration;
+    this->dataPtr->lastBatchSuccess = batchSuccess;
+  }
+  this->dataPtr->executedCv.notify_all();
+}
+
+//////////////////////////////////////////////////
+bool UserCommandsPrivate::BarrierService(const msgs::Boolean &/*_req*/,
+    msgs::Boolean &_res)
+{
+  uint64_t generation;
+  {
+    // Holding pendingMutex guarantees the pending commands haven't been
+    // drained yet, so the generation captured here predates their batch.
+    std::lock_guard<std::mutex> pendingLock(this->pendingMutex);
+    if (this->pendingCmds.empty())
+    {
+      std::lock_guard<std::mutex> lock(this->executedMutex);
+      _res.set_data(this->lastBatchSuccess);
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(this->executedMutex);
+    generation = this->executedGeneration;
+  }
+
+  std::unique_lock<std::mutex> lock(this->executedMutex);
+  if (!this->executedCv.wait_for(lock, std::chrono::seconds(10),
+      [this, generation]
+      {
+        return this->executedGeneration > generation;
+      }))
+  {
+    gzwarn << "Command barrier timed out waiting for pending commands; "
+           << "is the simulation paused?" << std::endl;
+    return false;
+  }
+
+  _res.set_data(this->lastBatchSuccess);
+  return true;
 }
 
 //////////////////////////////////////////////////
 bool UserCommandsPrivate::CreateServiceMultiple(
     const msgs::EntityFactory_V &_req, msgs::Boolean &_res)
 {
-  std::lock_guard<std::mutex> lock(this->pendingMutex);
+  // Build and prepare the commands outside the lock, so a large burst only
+  // holds pendingMutex for the final splice.
+  std::vector<std::unique_ptr<UserCommandBase>> cmds;
+  cmds.reserve(_req.data_size());
   for (int i = 0; i < _req.data_size(); ++i)
   {
     const msgs::EntityFactory &msg = _req.data(i);
@@ -807,7 +1020,15 @@ bool UserCommandsPrivate::CreateServiceMultiple(
     auto msgCopy = msg.New();
     msgCopy->CopyFrom(msg);
     auto cmd = std::make_unique<CreateCommand>(msgCopy, this->iface);
-    this->pendingCmds.push_back(std::move(cmd));
+    cmd->Prepare();
+    cmds.push_back(std::move(cmd));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(this->pendingMutex);
+    this->pendingCmds.insert(this->pendingCmds.end(),
+        std::make_move_iterator(cmds.begin()),
+        std::make_move_iterator(cmds.end()));
   }
 
   _res.set_data(true);
@@ -818,10 +1039,12 @@ bool UserCommandsPrivate::CreateServiceMultiple(
 bool UserCommandsPrivate::CreateService(const msgs::EntityFactory &_req,
     msgs::Boolean &_res)
 {
-  // Create command and push it to queue
+  // Create command and push it to queue. Parsing happens here on the
+  // transport thread, not inside the simulation step.
   auto msg = _req.New();
   msg->CopyFrom(_req);
   auto cmd = std::make_unique<CreateCommand>(msg, this->iface);
+  cmd->Prepare();
 
   // Push to pending
   {
@@ -874,15 +1097,23 @@ bool UserCommandsPrivate::LightService(const msgs::Light &_req,
 //////////////////////////////////////////////////
 void UserCommandsPrivate::OnCmdLight(const msgs::Light &_msg)
 {
-  auto msg = _msg.New();
-  msg->CopyFrom(_msg);
-  auto cmd = std::make_unique<LightCommand>(msg, this->iface);
+  // Key by id when set, otherwise by name, so repeated updates for the
+  // same light within a step overwrite each other.
+  std::string key = _msg.id() != 0u ?
+      "#" + std::to_string(_msg.id()) : _msg.name();
+  std::lock_guard<std::mutex> lock(this->lightCmdsMutex);
+  this->pendingLightCmds[key] = _msg;
+}
 
-  // Push to pending
-  {
-    std::lock_guard<std::mutex> lock(this->pendingMutex);
-    this->pendingCmds.push_back(std::move(cmd));
-  }
+//////////////////////////////////////////////////
+void UserCommandsPrivate::OnCmdPose(const msgs::Pose &_msg)
+{
+  // Key by id when set, otherwise by name. Overwriting keeps only the
+  // last pose received for an entity within a step.
+  std::string key = _msg.id() != 0u ?
+      "#" + std::to_string(_msg.id()) : _msg.name();
+  std::lock_guard<std::mutex> lock(this->poseCmdsMutex);
+  this->pendingPoseCmds[key] = _msg;
 }
 
 //////////////////////////////////////////////////
@@ -1071,6 +1302,41 @@ CreateCommand::CreateCommand(msgs::EntityFactory *_msg,
 {
 }
 
+//////////////////////////////////////////////////
+void CreateCommand::Prepare()
+{
+  auto createMsg = dynamic_cast<const msgs::EntityFactory *>(this->msg);
+  if (nullptr == createMsg)
+    return;
+
+  switch (createMsg->from_case())
+  {
+    case msgs::EntityFactory::kSdf:
+    {
+      this->errors = loadSpawnSdfString(createMsg->sdf(), this->root);
+      this->prepared = true;
+      break;
+    }
+    case msgs::EntityFactory::kSdfFilename:
+    {
+      this->errors = this->root.Load(createMsg->sdf_filename());
+      this->prepared = true;
+      break;
+    }
+    case msgs::EntityFactory::kLight:
+    {
+      this->lightSdf = convert<sdf::Light>(createMsg->light());
+      this->prepared = true;
+      break;
+    }
+    default:
+    {
+      // Clone and error cases need the ECM, so Execute handles them.
+      break;
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 bool CreateCommand::Execute()
 {
@@ -1081,20 +1347,20 @@ bool CreateCommand::Execute()
     return false;
   }
 
-  // Load SDF
-  sdf::Root root;
-  sdf::Light lightSdf;
-  sdf::Errors errors;
+  // Parse the description now if it wasn't prepared at enqueue time.
+  if (!this->prepared)
+    this->Prepare();
+
+  sdf::Root &root = this->root;
+  sdf::Light &lightSdf = this->lightSdf;
+  sdf::Errors &errors = this->errors;
   switch (createMsg->from_case())
   {
     case msgs::EntityFactory::kSdf:
-    {
-      errors = root.LoadSdfString(createMsg->sdf());
-      break;
-    }
     case msgs::EntityFactory::kSdfFilename:
+    case msgs::EntityFactory::kLight:
     {
-      errors = root.Load(createMsg->sdf_filename());
+      // Already handled by Prepare.
       break;
     }
     case msgs::EntityFactory::kModel:
@@ -1103,11 +1369,6 @@ bool CreateCommand::Execute()
       gzerr << "model field not yet supported." << std::endl;
       return false;
     }
-    case msgs::EntityFactory::kLight:
-    {
-      lightSdf = convert<sdf::Light>(createMsg->light());
-      break;
-    }
     case msgs::EntityFactory::kCloneName:
     {
       auto validClone = false;
@@ -206,8 +206,6 @@ void VelocityControl::PreUpdate(const UpdateInfo &_info,
 
   // If there are links, create link components
   // If the link hasn't been identified yet, look for it
-  auto modelName = this->dataPtr->model.Name(_ecm);
-
   if (this->dataPtr->linkNames.empty())
     return;
 
@@ -224,7 +222,8 @@ void VelocityControl::PreUpdate(const UpdateInfo &_info,
         else
         {
           gzwarn << "Failed to find link [" << linkName
-                << "] for model [" << modelName << "]" << std::endl;
+                << "] for model [" << this->dataPtr->model.Name(_ecm)
+                << "]" << std::endl;
         }
       }
     }
@@ -30,6 +30,9 @@
 
 #include <gz/msgs/wind.pb.h>
 
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -51,7 +54,9 @@
 
 #include "gz/sim/EntityComponentManager.hh"
 #include "gz/sim/SdfEntityCreator.hh"
+#include "gz/sim/Util.hh"
 
+#include "gz/sim/components/Environment.hh"
 #include "gz/sim/components/Inertial.hh"
 #include "gz/sim/components/Light.hh"
 #include "gz/sim/components/LinearVelocity.hh"
@@ -242,6 +247,25 @@ class gz::sim::systems::WindEffectsPrivate
   public: void ApplyWindForce(const UpdateInfo &_info,
                               EntityComponentManager &_ecm);
 
+  /// \brief Create lookup sessions into the environment wind field once
+  /// environmental data has been loaded.
+  /// \param[in] _ecm Immutable reference to the EntityComponentManager.
+  /// \param[in] _currTime The current time.
+  public: void SetWindFieldTable(
+      const EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_currTime);
+
+  /// \brief Sample the environment wind field.
+  /// \param[in] _ecm Immutable reference to the EntityComponentManager.
+  /// \param[in] _currTime The current time.
+  /// \param[in] _position Position in world coordinates.
+  /// \return The wind velocity at this position and time. Axes without a
+  /// configured field default to zero.
+  public: math::Vector3d WindVelocityFromEnvironment(
+      const EntityComponentManager &_ecm,
+      const std::chrono::steady_clock::duration &_currTime,
+      const math::Vector3d &_position);
+
   /// \brief Callback for topic for setting the wind seed velocity and enabling
   /// this system.
   /// \param[in] _msg msgs::Wind message.
@@ -299,6 +323,20 @@ class gz::sim::systems::WindEffectsPrivate
   /// \brief The scaling factor to approximate wind as force on a mass.
   public: PiecewiseScalingFactor forceApproximationScalingFactor;
 
+  /// \brief Sample the wind velocity from the environment wind field if true.
+  public: bool useWindField{false};
+
+  /// \brief Wind field data frame column names, per world axis.
+  public: std::string windFieldComponents[3];
+
+  /// \brief Grid field loaded from the environment.
+  public: std::shared_ptr<components::EnvironmentalData> gridField;
+
+  /// \brief Lookup sessions into the wind field, per world axis. Sessions
+  /// step through the time slices of the data frame on demand, so only the
+  /// slices around the current time are visited.
+  public: std::optional<math::InMemorySession<double, double>> session[3];
+
   /// \brief Noise added to magnitude.
   public: sensors::NoisePtr noiseMagnitude;
 
@@ -461,6 +499,24 @@ void WindEffectsPrivate::Load(EntityComponentManager &_ecm,
     return;
   }
 
+  if (_sdf->HasElement("lookup_wind_x"))
+  {
+    this->useWindField = true;
+    this->windFieldComponents[0] = _sdf->Get<std::string>("lookup_wind_x");
+  }
+
+  if (_sdf->HasElement("lookup_wind_y"))
+  {
+    this->useWindField = true;
+    this->windFieldComponents[1] = _sdf->Get<std::string>("lookup_wind_y");
+  }
+
+  if (_sdf->HasElement("lookup_wind_z"))
+  {
+    this->useWindField = true;
+    this->windFieldComponents[2] = _sdf->Get<std::string>("lookup_wind_z");
+  }
+
   this->validConfig = true;
 }
 
@@ -566,7 +622,110 @@ void WindEffectsPrivate::UpdateWindVelocity(const UpdateInfo &_info,
 }
 
 //////////////////////////////////////////////////
-void WindEffectsPrivate::ApplyWindForce(const UpdateInfo &,
+void WindEffectsPrivate::SetWindFieldTable(
+    const EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_currTime)
+{
+  _ecm.EachNew<components::Environment>([&](const Entity &/*_entity*/,
+    const components::Environment *_environment) -> bool
+  {
+    this->gridField = _environment->Data();
+
+    for (std::size_t i = 0; i < 3; i++)
+    {
+      if (!this->windFieldComponents[i].empty())
+      {
+        if (!this->gridField->frame.Has(this->windFieldComponents[i]))
+        {
+          gzwarn << "Wind effects could not find field "
+            << this->windFieldComponents[i] << "\n";
+          continue;
+        }
+
+        this->session[i] =
+          this->gridField->frame[this->windFieldComponents[i]].CreateSession();
+        if (!this->gridField->staticTime)
+        {
+          this->session[i] =
+            this->gridField->frame[this->windFieldComponents[i]].StepTo(
+              *this->session[i],
+              std::chrono::duration<double>(_currTime).count());
+        }
+
+        if (!this->session[i].has_value())
+        {
+          gzerr << "Exceeded time stamp." << std::endl;
+        }
+      }
+    }
+    return true;
+  });
+}
+
+//////////////////////////////////////////////////
+math::Vector3d WindEffectsPrivate::WindVelocityFromEnvironment(
+    const EntityComponentManager &_ecm,
+    const std::chrono::steady_clock::duration &_currTime,
+    const math::Vector3d &_position)
+{
+  math::Vector3d wind(0, 0, 0);
+
+  if (!this->gridField ||
+      !(this->session[0].has_value() ||
+        this->session[1].has_value() || this->session[2].has_value()))
+  {
+    return wind;
+  }
+
+  for (std::size_t i = 0; i < 3; i++)
+  {
+    if (!this->windFieldComponents[i].empty())
+    {
+      if (!this->gridField->staticTime)
+      {
+        this->session[i] =
+          this->gridField->frame[this->windFieldComponents[i]].StepTo(
+            *this->session[i],
+            std::chrono::duration<double>(_currTime).count());
+      }
+
+      if (!this->session[i].has_value())
+      {
+        gzerr << "Time exceeded" << std::endl;
+        continue;
+      }
+
+      auto position = getGridFieldCoordinates(
+        _ecm, _position, this->gridField);
+
+      if (!position.has_value())
+      {
+        gzerr << "Coordinate conversion failed" << std::endl;
+        continue;
+      }
+
+      auto data = this->gridField->frame[this->windFieldComponents[i]].LookUp(
+        this->session[i].value(), position.value());
+      if (!data.has_value())
+      {
+        auto bounds =
+          this->gridField->frame[this->windFieldComponents[i]].Bounds(
+            this->session[i].value());
+        gzwarn << "Failed to acquire value perhaps out of field?\n"
+          << "Bounds are " << bounds.first << ", "
+          << bounds.second << std::endl;
+        continue;
+      }
+
+      wind[i] = data.value();
+    }
+  }
+
+  return wind;
+}
+
+//////////////////////////////////////////////////
+void WindEffectsPrivate::ApplyWindForce(const UpdateInfo &_info,
                                         EntityComponentManager &_ecm)
 {
   GZ_PROFILE("WindEffectsPrivate::ApplyWindForce");
@@ -604,9 +763,16 @@ void WindEffectsPrivate::ApplyWindForce(const UpdateInfo &,
           forceScalingFactor = 0.;
         }
 
+        // Sample the wind field at the link position when one is configured,
+        // otherwise use the uniform worldwide wind velocity.
+        const math::Vector3d windVelAtLink = this->useWindField ?
+            this->WindVelocityFromEnvironment(
+                _ecm, _info.simTime, _linkPose->Data().Pos()) :
+            windVel->Data();
+
         const math::Vector3d windForce =
             _inertial->Data().MassMatrix().Mass() *
-            forceScalingFactor * (windVel->Data() - _linkVel->Data());
+            forceScalingFactor * (windVelAtLink - _linkVel->Data());
 
         // Apply force at center of mass
         link.AddWorldForce(_ecm, windForce);
@@ -738,6 +904,11 @@ void WindEffects::PreUpdate(const UpdateInfo &_info,
     return true;
   });
 
+  if (this->dataPtr->useWindField)
+  {
+    this->dataPtr->SetWindFieldTable(_ecm, _info.simTime);
+  }
+
   if (_info.paused)
     return;
 
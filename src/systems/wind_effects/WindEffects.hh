@@ -127,6 +127,19 @@ namespace systems
   /// ```
   /// Regions may not overlap.
   ///
+  /// ### Spatially varying wind
+  /// Instead of the uniform worldwide wind velocity, the wind may be sampled
+  /// per link from a gridded wind field preloaded with the EnvironmentPreload
+  /// system. Give the data frame column names with the tags below; if any of
+  /// them is present the seed velocity pipeline no longer determines the
+  /// applied wind, and missing axes default to zero.
+  ///
+  /// - `<lookup_wind_x>`: Column to use for the x wind component.
+  ///
+  /// - `<lookup_wind_y>`: Column to use for the y wind component.
+  ///
+  /// - `<lookup_wind_z>`: Column to use for the z wind component.
+  ///
   class WindEffects final:
     public System,
     public ISystemConfigure,
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <gz/msgs/axis_aligned_box.pb.h>
+#include <gz/msgs/stringmsg.pb.h>
+
+#include <gz/transport/Node.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "gz/sim/Server.hh"
+#include "gz/sim/ServerConfig.hh"
+#include "test_config.hh"
+
+#include "../helpers/EnvTestFixture.hh"
+
+using namespace gz;
+using namespace sim;
+
+class BoundingBoxesTest : public InternalFixture<::testing::Test>
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(BoundingBoxesTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(Service))
+{
+  const std::string sdf = R"(
+  <?xml version="1.0"?>
+  <sdf version="1.9">
+    <world name="bbox_world">
+      <physics name="1ms" type="ignored">
+        <max_step_size>0.001</max_step_size>
+        <real_time_factor>0</real_time_factor>
+      </physics>
+      <plugin filename="gz-sim-physics-system"
+              name="gz::sim::systems::Physics"/>
+      <plugin filename="gz-sim-bounding-boxes-system"
+              name="gz::sim::systems::BoundingBoxes"/>
+      <model name="box">
+        <static>true</static>
+        <pose>1 2 0.5 0 0 0</pose>
+        <link name="link">
+          <collision name="c">
+            <geometry><box><size>1 1 1</size></box></geometry>
+          </collision>
+        </link>
+      </model>
+    </world>
+  </sdf>)";
+
+  ServerConfig serverConfig;
+  ASSERT_TRUE(serverConfig.SetSdfString(sdf));
+
+  Server server(serverConfig);
+
+  // Run asynchronously so the blocking first request can be served while
+  // the simulation steps.
+  server.Run(false, 0, false);
+
+  transport::Node node;
+  msgs::StringMsg req;
+  req.set_data("box");
+
+  msgs::AxisAlignedBox rep;
+  bool result{false};
+  EXPECT_TRUE(node.Request("/world/bbox_world/entity/bounding_box", req,
+      10000, rep, result));
+  EXPECT_TRUE(result);
+
+  EXPECT_NEAR(0.5, rep.min_corner().x(), 1e-2);
+  EXPECT_NEAR(1.5, rep.min_corner().y(), 1e-2);
+  EXPECT_NEAR(0.0, rep.min_corner().z(), 1e-2);
+  EXPECT_NEAR(1.5, rep.max_corner().x(), 1e-2);
+  EXPECT_NEAR(2.5, rep.max_corner().y(), 1e-2);
+  EXPECT_NEAR(1.0, rep.max_corner().z(), 1e-2);
+
+  // Repeat queries are served from the cache.
+  result = false;
+  EXPECT_TRUE(node.Request("/world/bbox_world/entity/bounding_box", req,
+      10000, rep, result));
+  EXPECT_TRUE(result);
+
+  // Unknown models fail.
+  req.set_data("no_such_model");
+  EXPECT_TRUE(node.Request("/world/bbox_world/entity/bounding_box", req,
+      10000, rep, result));
+  EXPECT_FALSE(result);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <gz/common/Console.hh>
+#include <gz/common/Filesystem.hh>
+#include <gz/common/StringUtils.hh>
+#include <gz/common/Util.hh>
+#include <gz/utils/ExtraTestMacros.hh>
+
+#include "gz/sim/Server.hh"
+#include "test_config.hh"
+
+#include "../helpers/EnvTestFixture.hh"
+
+using namespace gz;
+using namespace sim;
+
+/// \brief Test DatasetExport system
+class DatasetExportTest : public InternalFixture<::testing::Test>
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(DatasetExportTest, GZ_UTILS_TEST_DISABLED_ON_MAC(ExportFrames))
+{
+  // This test requires rendering. Skip it on Github Actions, like the
+  // other camera tests.
+  std::string githubAction;
+  if (common::env("GITHUB_ACTIONS", githubAction))
+  {
+    GTEST_SKIP();
+  }
+
+  const std::string framesDir = "dataset_export_test_frames";
+  if (common::exists(framesDir))
+    common::removeAll(framesDir);
+
+  // Start server
+  ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/dataset_export.sdf");
+
+  Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  // Step until frames appear or we give up.
+  unsigned int frameCount = 0u;
+  int sleep = 0;
+  while (frameCount == 0u && sleep++ < 500)
+  {
+    server.Run(true, 10, false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    if (common::exists(framesDir))
+    {
+      for (common::DirIter file(framesDir);
+          file != common::DirIter(); ++file)
+      {
+        if (common::EndsWith(*file, ".png"))
+          ++frameCount;
+      }
+    }
+  }
+  EXPECT_LT(0u, frameCount);
+
+  common::removeAll(framesDir);
+}
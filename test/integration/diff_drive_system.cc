@@ -236,6 +236,78 @@ TEST_P(DiffDriveTest,
       "/model/foo/cmdvel", "/model/bar/odom");
 }
 
+/////////////////////////////////////////////////
+// Fleet mode: a single world-attached plugin drives every model that has
+// the configured wheel joints.
+TEST_P(DiffDriveTest, GZ_UTILS_TEST_ENABLED_ONLY_ON_LINUX(FleetMode))
+{
+  // Start server
+  ServerConfig serverConfig;
+  serverConfig.SetSdfFile(std::string(PROJECT_SOURCE_PATH) +
+      "/test/worlds/diff_drive_fleet.sdf");
+
+  Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  server.SetUpdatePeriod(0ns);
+
+  // Create a system that records both vehicle poses
+  test::Relay testSystem;
+
+  std::vector<math::Pose3d> poses1;
+  std::vector<math::Pose3d> poses2;
+  testSystem.OnPostUpdate([&](const UpdateInfo &,
+    const EntityComponentManager &_ecm)
+    {
+      auto id1 = _ecm.EntityByComponents(
+        components::Model(),
+        components::Name("vehicle1"));
+      ASSERT_NE(kNullEntity, id1);
+
+      auto id2 = _ecm.EntityByComponents(
+        components::Model(),
+        components::Name("vehicle2"));
+      ASSERT_NE(kNullEntity, id2);
+
+      poses1.push_back(_ecm.Component<components::Pose>(id1)->Data());
+      poses2.push_back(_ecm.Component<components::Pose>(id2)->Data());
+    });
+  server.AddSystem(testSystem.systemPtr);
+
+  // Run server and check that neither vehicle moved without a command
+  server.Run(true, 1000, false);
+
+  ASSERT_EQ(1000u, poses1.size());
+  EXPECT_EQ(poses1[0], poses1.back());
+  EXPECT_EQ(poses2[0], poses2.back());
+
+  // Command only the first vehicle forward on its default topic
+  transport::Node node;
+  auto pub = node.Advertise<msgs::Twist>("/model/vehicle1/cmd_vel");
+
+  msgs::Twist msg;
+  msgs::Set(msg.mutable_linear(), math::Vector3d(0.5, 0, 0));
+  msgs::Set(msg.mutable_angular(), math::Vector3d::Zero);
+
+  test::Relay cmdPublisher;
+  cmdPublisher.OnPreUpdate(
+      [&](const UpdateInfo &, const EntityComponentManager &)
+      {
+        pub.Publish(msg);
+      });
+  server.AddSystem(cmdPublisher.systemPtr);
+
+  server.Run(true, 3000, false);
+
+  ASSERT_EQ(4000u, poses1.size());
+
+  // Only the commanded vehicle moved
+  EXPECT_GT(poses1.back().Pos().X() - poses1[0].Pos().X(), 1.0);
+  EXPECT_NEAR(poses2.back().Pos().X(), poses2[0].Pos().X(), tol);
+  EXPECT_NEAR(poses2.back().Pos().Y(), poses2[0].Pos().Y(), tol);
+}
+
 /////////////////////////////////////////////////
 TEST_P(DiffDriveTest, GZ_UTILS_TEST_DISABLED_ON_WIN32(SkidPublishCmd))
 {
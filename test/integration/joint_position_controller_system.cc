@@ -21,6 +21,8 @@
 #include <gz/msgs/double.pb.h>
 #include <gz/msgs/actuators.pb.h>
 
+#include <map>
+
 #include <gz/common/Console.hh>
 #include <gz/common/Util.hh>
 #include <gz/transport/Node.hh>
@@ -579,3 +581,70 @@ TEST_F(JointPositionControllerTestFixture,
   server.Run(true, testIters , false);
   EXPECT_NEAR(currentPosition.at(0), targetPosition, TOL);
 }
+
+/////////////////////////////////////////////////
+// Tests that one controller instance in multi-joint mode drives each
+// joint to its own target from a single Actuators position array
+TEST_F(JointPositionControllerTestFixture,
+       GZ_UTILS_TEST_DISABLED_ON_WIN32(JointPositionMultiJointCommand))
+{
+  using namespace std::chrono_literals;
+
+  // Start server
+  ServerConfig serverConfig;
+  serverConfig.SetSdfFile(common::joinPaths(
+      PROJECT_SOURCE_PATH, "test", "worlds",
+      "joint_position_controller_multi_joint.sdf"));
+
+  Server server(serverConfig);
+  EXPECT_FALSE(server.Running());
+  EXPECT_FALSE(*server.Running(0));
+
+  server.SetUpdatePeriod(0ns);
+
+  test::Relay testSystem;
+  std::map<std::string, std::vector<double>> currentPosition;
+  testSystem.OnPostUpdate([&](const UpdateInfo &,
+                              const EntityComponentManager &_ecm)
+      {
+        _ecm.Each<components::Joint, components::Name,
+                  components::JointPosition>(
+            [&](const Entity &,
+                const components::Joint *,
+                const components::Name *_name,
+                const components::JointPosition *_position) -> bool
+            {
+              currentPosition[_name->Data()] = _position->Data();
+              return true;
+            });
+      });
+
+  server.AddSystem(testSystem.systemPtr);
+
+  const std::size_t initIters = 10;
+  server.Run(true, initIters, false);
+  ASSERT_EQ(2u, currentPosition.size());
+  EXPECT_NEAR(0, currentPosition["j1"].at(0), TOL);
+  EXPECT_NEAR(0, currentPosition["j2"].at(0), TOL);
+
+  // Publish per-joint targets and check that each joint tracks its own
+  transport::Node node;
+  auto pub = node.Advertise<msgs::Actuators>(
+      "/model/joint_position_controller_test/joint_positions");
+
+  const double targetPositionJ1{1.0};
+  const double targetPositionJ2{-0.5};
+  msgs::Actuators msg;
+  msg.add_position(targetPositionJ1);
+  msg.add_position(targetPositionJ2);
+
+  pub.Publish(msg);
+  // Wait for the message to be published
+  std::this_thread::sleep_for(100ms);
+
+  const std::size_t testIters = 3000;
+  server.Run(true, testIters , false);
+
+  EXPECT_NEAR(targetPositionJ1, currentPosition["j1"].at(0), TOL);
+  EXPECT_NEAR(targetPositionJ2, currentPosition["j2"].at(0), TOL);
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <gz/common/Console.hh>
+#include <gz/math/Stopwatch.hh>
+
+#include "gz/sim/Server.hh"
+#include "gz/sim/ServerConfig.hh"
+
+using namespace gz;
+using namespace sim;
+
+/// Physics micro-benchmarks. Each scenario builds a world programmatically,
+/// runs it unthrottled through the real Physics system and SimulationRunner,
+/// and reports steps per second, so regressions between releases show up as
+/// numbers instead of production RTF drops.
+///
+/// Usage: gz-sim-physics-benchmarks [iterations] [scale]
+///
+/// `scale` multiplies the entity counts of every scenario.
+
+namespace
+{
+
+//////////////////////////////////////////////////
+/// \brief Open a world SDF string with only the Physics system attached.
+std::string WorldHeader()
+{
+  return std::string(
+      "<?xml version=\"1.0\"?>"
+      "<sdf version=\"1.9\">"
+      "<world name=\"bench\">"
+      "<physics name=\"1ms\" type=\"ignored\">"
+      "  <max_step_size>0.001</max_step_size>"
+      "  <real_time_factor>0</real_time_factor>"
+      "</physics>"
+      "<plugin filename=\"gz-sim-physics-system\""
+      "        name=\"gz::sim::systems::Physics\"/>"
+      "<model name=\"ground\">"
+      "  <static>true</static>"
+      "  <link name=\"link\">"
+      "    <collision name=\"c\"><geometry><plane>"
+      "      <normal>0 0 1</normal><size>500 500</size>"
+      "    </plane></geometry></collision>"
+      "  </link>"
+      "</model>");
+}
+
+//////////////////////////////////////////////////
+/// \brief A unit box link with collision and inertia.
+std::string BoxLink(const std::string &_name)
+{
+  return
+      "<link name=\"" + _name + "\">"
+      "  <inertial><mass>1</mass><inertia>"
+      "    <ixx>0.167</ixx><iyy>0.167</iyy><izz>0.167</izz>"
+      "  </inertia></inertial>"
+      "  <collision name=\"c\"><geometry><box>"
+      "    <size>1 1 1</size>"
+      "  </box></geometry></collision>"
+      "</link>";
+}
+
+//////////////////////////////////////////////////
+/// \brief N boxes falling from varying heights, no initial contacts.
+std::string FallingBoxesWorld(unsigned int _count)
+{
+  std::ostringstream sdf;
+  sdf << WorldHeader();
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    sdf << "<model name=\"box_" << i << "\">"
+        << "<pose>" << 2.0 * (i % 32) << " " << 2.0 * (i / 32) << " "
+        << 2.0 + 0.1 * i << " 0 0 0</pose>"
+        << BoxLink("link")
+        << "</model>";
+  }
+  sdf << "</world></sdf>";
+  return sdf.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief A single hanging chain of M links connected by revolute joints.
+std::string JointChainWorld(unsigned int _joints)
+{
+  std::ostringstream sdf;
+  sdf << WorldHeader()
+      << "<model name=\"chain\"><pose>0 0 "
+      << 2.0 * (_joints + 2) << " 0 0 0</pose>"
+      << "<link name=\"base\"/><joint name=\"anchor\" type=\"fixed\">"
+      << "<parent>world</parent><child>base</child></joint>";
+  for (unsigned int i = 0; i < _joints; ++i)
+  {
+    sdf << "<model name=\"seg_" << i << "\">"
+        << "<pose>0 0 " << -1.5 * (i + 1) << " 0 0 0</pose>"
+        << BoxLink("link") << "</model>"
+        << "<joint name=\"j_" << i << "\" type=\"revolute\">"
+        << "<parent>" << (0 == i ? std::string("base")
+            : "seg_" + std::to_string(i - 1) + "::link") << "</parent>"
+        << "<child>seg_" << i << "::link</child>"
+        << "<axis><xyz>1 0 0</xyz></axis>"
+        << "</joint>";
+  }
+  sdf << "</model></world></sdf>";
+  return sdf.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief A dense pile: boxes stacked in a grid with persistent contacts.
+std::string ContactPileWorld(unsigned int _side, unsigned int _layers)
+{
+  std::ostringstream sdf;
+  sdf << WorldHeader();
+  for (unsigned int z = 0; z < _layers; ++z)
+  {
+    for (unsigned int y = 0; y < _side; ++y)
+    {
+      for (unsigned int x = 0; x < _side; ++x)
+      {
+        sdf << "<model name=\"pile_" << x << "_" << y << "_" << z << "\">"
+            << "<pose>" << 1.01 * x << " " << 1.01 * y << " "
+            << 0.5 + 1.0 * z << " 0 0 0</pose>"
+            << BoxLink("link")
+            << "</model>";
+      }
+    }
+  }
+  sdf << "</world></sdf>";
+  return sdf.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief Run a world for a number of iterations and report steps/sec.
+/// \return True if the scenario ran to completion.
+bool RunScenario(const std::string &_name, const std::string &_sdf,
+    const uint64_t _iterations)
+{
+  ServerConfig serverConfig;
+  if (!serverConfig.SetSdfString(_sdf))
+  {
+    gzerr << "Failed to load SDF for scenario [" << _name << "]" << std::endl;
+    return false;
+  }
+
+  Server server(serverConfig);
+
+  // Warm up: entity creation, view caching, engine setup.
+  server.Run(true, 10, false);
+
+  math::Stopwatch watch;
+  watch.Start(true);
+  server.Run(true, _iterations, false);
+  watch.Stop();
+
+  const double elapsed =
+      std::chrono::duration<double>(watch.ElapsedRunTime()).count();
+  const double stepsPerSec =
+      elapsed > 0 ? static_cast<double>(_iterations) / elapsed : 0.0;
+
+  std::cout << _name << ", " << _iterations << ", " << elapsed << ", "
+            << stepsPerSec << std::endl;
+  return true;
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////
+int main(int _argc, char **_argv)
+{
+  common::Console::SetVerbosity(1);
+
+  uint64_t iterations{1000};
+  if (_argc >= 2)
+  {
+    iterations = std::stoull(_argv[1]);
+  }
+
+  unsigned int scale{1};
+  if (_argc >= 3)
+  {
+    scale = static_cast<unsigned int>(std::stoul(_argv[2]));
+  }
+
+  std::cout << "# scenario, iterations, wall s, steps/s" << std::endl;
+
+  bool ok = true;
+  ok = RunScenario("falling_boxes_" + std::to_string(100 * scale),
+      FallingBoxesWorld(100 * scale), iterations) && ok;
+  ok = RunScenario("joint_chain_" + std::to_string(20 * scale),
+      JointChainWorld(20 * scale), iterations) && ok;
+  ok = RunScenario("contact_pile_" + std::to_string(25 * scale * scale) +
+      "x4", ContactPileWorld(5 * scale, 4), iterations) && ok;
+
+  return ok ? 0 : -1;
+}
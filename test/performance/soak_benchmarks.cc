@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include <gz/common/Console.hh>
+#include <gz/math/Stopwatch.hh>
+#include <gz/msgs/pose_v.pb.h>
+#include <gz/transport/Node.hh>
+
+#include "gz/sim/EntityComponentManager.hh"
+#include "gz/sim/Server.hh"
+#include "gz/sim/ServerConfig.hh"
+#include "gz/sim/TestFixture.hh"
+#include "gz/sim/components/Model.hh"
+#include "gz/sim/components/Name.hh"
+#include "gz/sim/components/Pose.hh"
+
+using namespace gz;
+using namespace sim;
+
+/// Server-scale soak benchmarks. Where physics_benchmarks.cc times the
+/// Physics system in isolation, these scenarios exercise the server-level
+/// machinery - entity creation and removal, scene broadcasting with a live
+/// subscriber, and level load/unload cycling - through `TestFixture`, so
+/// per-commit charts catch regressions in the runner itself.
+///
+/// Usage: gz-sim-soak-benchmarks [iterations] [scale]
+///
+/// `scale` multiplies the entity counts of every scenario.
+///
+/// Output is one CSV line per scenario:
+///   name, iterations, elapsed, stepsPerSec, peakRssKb
+/// Peak RSS is process-wide and monotonic, so only growth between
+/// consecutive lines is attributable to a scenario; keep the scenario
+/// order stable when charting.
+
+namespace
+{
+
+//////////////////////////////////////////////////
+/// \brief Peak resident set size of this process, in kilobytes.
+int64_t PeakRssKb()
+{
+#ifndef _WIN32
+  struct rusage usage;
+  if (0 == getrusage(RUSAGE_SELF, &usage))
+    return usage.ru_maxrss;
+#endif
+  return 0;
+}
+
+//////////////////////////////////////////////////
+/// \brief Drop incoming pose messages; only the subscription matters, it
+/// makes SceneBroadcaster's HasConnections checks return true.
+void PoseSink(const msgs::Pose_V &)
+{
+}
+
+//////////////////////////////////////////////////
+/// \brief An empty world with no systems; the runner alone does the work.
+std::string EmptyWorld()
+{
+  return std::string(
+      "<?xml version=\"1.0\"?>"
+      "<sdf version=\"1.9\">"
+      "<world name=\"bench\">"
+      "<physics name=\"1ms\" type=\"ignored\">"
+      "  <max_step_size>0.001</max_step_size>"
+      "  <real_time_factor>0</real_time_factor>"
+      "</physics>"
+      "</world></sdf>");
+}
+
+//////////////////////////////////////////////////
+/// \brief N static box models plus SceneBroadcaster, for pose sync load.
+std::string PoseSyncWorld(unsigned int _count)
+{
+  std::ostringstream sdf;
+  sdf << "<?xml version=\"1.0\"?>"
+      << "<sdf version=\"1.9\">"
+      << "<world name=\"bench\">"
+      << "<physics name=\"1ms\" type=\"ignored\">"
+      << "  <max_step_size>0.001</max_step_size>"
+      << "  <real_time_factor>0</real_time_factor>"
+      << "</physics>"
+      << "<plugin filename=\"gz-sim-scene-broadcaster-system\""
+      << "        name=\"gz::sim::systems::SceneBroadcaster\"/>";
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    sdf << "<model name=\"box_" << i << "\"><static>true</static>"
+        << "<pose>" << 2.0 * (i % 100) << " " << 2.0 * (i / 100)
+        << " 0.5 0 0 0</pose>"
+        << "<link name=\"link\"/></model>";
+  }
+  sdf << "</world></sdf>";
+  return sdf.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief A row of tiles, one level per tile, and a performer that the
+/// benchmark teleports from tile to tile to force load/unload cycles.
+std::string LevelCyclingWorld(unsigned int _tiles, unsigned int _modelsPerTile)
+{
+  std::ostringstream sdf;
+  sdf << "<?xml version=\"1.0\"?>"
+      << "<sdf version=\"1.9\">"
+      << "<world name=\"bench\">"
+      << "<physics name=\"1ms\" type=\"ignored\">"
+      << "  <max_step_size>0.001</max_step_size>"
+      << "  <real_time_factor>0</real_time_factor>"
+      << "</physics>"
+      << "<model name=\"walker\"><static>true</static>"
+      << "<pose>0 0 0.5 0 0 0</pose>"
+      << "<link name=\"link\"/></model>";
+  for (unsigned int t = 0; t < _tiles; ++t)
+  {
+    for (unsigned int m = 0; m < _modelsPerTile; ++m)
+    {
+      sdf << "<model name=\"tile_" << t << "_" << m << "\">"
+          << "<static>true</static>"
+          << "<pose>" << 200.0 * t + 2.0 * m << " 5 0.5 0 0 0</pose>"
+          << "<link name=\"link\"/></model>";
+    }
+  }
+  sdf << "<plugin name=\"gz::sim\" filename=\"dummy\">"
+      << "<performer name=\"perf_walker\">"
+      << "  <ref>walker</ref>"
+      << "  <geometry><box><size>1 1 1</size></box></geometry>"
+      << "</performer>";
+  for (unsigned int t = 0; t < _tiles; ++t)
+  {
+    sdf << "<level name=\"level_" << t << "\">"
+        << "<pose>" << 200.0 * t << " 0 0 0 0 0</pose>"
+        << "<geometry><box><size>100 100 100</size></box></geometry>"
+        << "<buffer>10</buffer>";
+    for (unsigned int m = 0; m < _modelsPerTile; ++m)
+      sdf << "<ref>tile_" << t << "_" << m << "</ref>";
+    sdf << "</level>";
+  }
+  sdf << "</plugin></world></sdf>";
+  return sdf.str();
+}
+
+//////////////////////////////////////////////////
+/// \brief Run a fixture for a number of iterations and report one CSV line.
+/// \return True if the scenario ran to completion.
+bool RunScenario(const std::string &_name, const ServerConfig &_config,
+    const uint64_t _iterations,
+    std::function<void(const UpdateInfo &, EntityComponentManager &)>
+        _preUpdate)
+{
+  TestFixture fixture(_config);
+  if (_preUpdate)
+    fixture.OnPreUpdate(_preUpdate);
+  fixture.Finalize();
+
+  auto server = fixture.Server();
+  if (nullptr == server)
+  {
+    gzerr << "Failed to start server for scenario [" << _name << "]"
+          << std::endl;
+    return false;
+  }
+
+  // Warm up: entity creation, view caching, topic advertisement.
+  server->Run(true, 10, false);
+
+  math::Stopwatch watch;
+  watch.Start(true);
+  server->Run(true, _iterations, false);
+  watch.Stop();
+
+  const double elapsed =
+      std::chrono::duration<double>(watch.ElapsedRunTime()).count();
+  const double stepsPerSec =
+      elapsed > 0 ? static_cast<double>(_iterations) / elapsed : 0.0;
+
+  std::cout << _name << ", " << _iterations << ", " << elapsed << ", "
+            << stepsPerSec << ", " << PeakRssKb() << std::endl;
+  return true;
+}
+
+//////////////////////////////////////////////////
+/// \brief Create a batch of entities every step and remove the previous
+/// batch, stressing entity bookkeeping and view invalidation.
+bool EntityChurn(const uint64_t _iterations, const unsigned int _scale)
+{
+  ServerConfig config;
+  config.SetSdfString(EmptyWorld());
+
+  const unsigned int batchSize = 20 * _scale;
+  auto previousBatch = std::make_shared<std::vector<Entity>>();
+  auto preUpdate =
+      [batchSize, previousBatch](const UpdateInfo &,
+          EntityComponentManager &_ecm)
+      {
+        for (const Entity entity : *previousBatch)
+          _ecm.RequestRemoveEntity(entity);
+        previousBatch->clear();
+        for (unsigned int i = 0; i < batchSize; ++i)
+        {
+          const Entity entity = _ecm.CreateEntity();
+          _ecm.CreateComponent(entity,
+              components::Name("churn_" + std::to_string(i)));
+          _ecm.CreateComponent(entity, components::Pose());
+          previousBatch->push_back(entity);
+        }
+      };
+
+  return RunScenario("entity_churn", config, _iterations, preUpdate);
+}
+
+//////////////////////////////////////////////////
+/// \brief Perturb every model pose each step with a pose subscriber
+/// attached, so SceneBroadcaster serializes and publishes the full set.
+bool PoseSync(const uint64_t _iterations, const unsigned int _scale)
+{
+  ServerConfig config;
+  config.SetSdfString(PoseSyncWorld(10000 * _scale));
+
+  transport::Node node;
+  node.Subscribe("/world/bench/pose/info", PoseSink);
+
+  auto preUpdate =
+      [](const UpdateInfo &_info, EntityComponentManager &_ecm)
+      {
+        const double shift =
+            0.001 * static_cast<double>(_info.iterations % 100);
+        _ecm.Each<components::Model, components::Pose>(
+            [&](const Entity &_entity, components::Model *,
+                components::Pose *_pose) -> bool
+            {
+              auto pose = _pose->Data();
+              pose.Pos().Z(0.5 + shift);
+              *_pose = components::Pose(pose);
+              _ecm.SetChanged(_entity, components::Pose::typeId,
+                  ComponentState::PeriodicChange);
+              return true;
+            });
+      };
+
+  return RunScenario("pose_sync", config, _iterations, preUpdate);
+}
+
+//////////////////////////////////////////////////
+/// \brief Teleport a performer across a row of levels, forcing the level
+/// manager to load and unload tiles continuously.
+bool LevelCycling(const uint64_t _iterations, const unsigned int _scale)
+{
+  const unsigned int tiles = 8;
+
+  ServerConfig config;
+  config.SetSdfString(LevelCyclingWorld(tiles, 50 * _scale));
+  config.SetUseLevels(true);
+
+  auto preUpdate =
+      [tiles](const UpdateInfo &_info, EntityComponentManager &_ecm)
+      {
+        // Hold the performer on each level long enough for the load to
+        // complete before jumping to the next one.
+        const uint64_t tile = (_info.iterations / 50) % tiles;
+        _ecm.Each<components::Model, components::Name, components::Pose>(
+            [&](const Entity &_entity, components::Model *,
+                components::Name *_name, components::Pose *_pose) -> bool
+            {
+              if ("walker" != _name->Data())
+                return true;
+              auto pose = _pose->Data();
+              pose.Pos().X(200.0 * static_cast<double>(tile));
+              *_pose = components::Pose(pose);
+              _ecm.SetChanged(_entity, components::Pose::typeId,
+                  ComponentState::OneTimeChange);
+              return false;
+            });
+      };
+
+  return RunScenario("level_cycling", config, _iterations, preUpdate);
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////
+int main(int _argc, char **_argv)
+{
+  common::Console::SetVerbosity(1);
+
+  uint64_t iterations{1000};
+  if (_argc >= 2)
+  {
+    iterations = std::stoull(_argv[1]);
+  }
+
+  unsigned int scale{1};
+  if (_argc >= 3)
+  {
+    scale = static_cast<unsigned int>(std::stoul(_argv[2]));
+  }
+
+  std::cout << "name, iterations, elapsed, stepsPerSec, peakRssKb"
+            << std::endl;
+
+  bool ok = true;
+  ok = EntityChurn(iterations, scale) && ok;
+  ok = PoseSync(iterations, scale) && ok;
+  ok = LevelCycling(iterations, scale) && ok;
+
+  return ok ? 0 : 1;
+}